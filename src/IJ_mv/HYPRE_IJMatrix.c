@@ -41,10 +41,15 @@ HYPRE_IJMatrixCreate( MPI_Comm        comm,
    hypre_IJMatrixObject(ijmatrix)         = NULL;
    hypre_IJMatrixTranslator(ijmatrix)     = NULL;
    hypre_IJMatrixAssumedPart(ijmatrix)    = NULL;
+   hypre_IJMatrixNeighborGraph(ijmatrix)  = NULL;
+   hypre_IJMatrixNumOwnerSearches(ijmatrix) = 0;
    hypre_IJMatrixObjectType(ijmatrix)     = HYPRE_UNITIALIZED;
    hypre_IJMatrixAssembleFlag(ijmatrix)   = 0;
    hypre_IJMatrixPrintLevel(ijmatrix)     = 0;
    hypre_IJMatrixOMPFlag(ijmatrix)        = 0;
+   hypre_IJMatrixStagingFlag(ijmatrix)    = 0;
+   hypre_IJMatrixLockPattern(ijmatrix)    = 0;
+   hypre_IJMatrixScatterMap(ijmatrix)     = NULL;
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &myid);
@@ -137,6 +142,8 @@ HYPRE_IJMatrixDestroy( HYPRE_IJMatrix matrix )
       {
          hypre_AssumedPartitionDestroy((hypre_IJAssumedPart*)hypre_IJMatrixAssumedPart(ijmatrix));
       }
+      hypre_IJNeighborGraphDestroy(hypre_IJMatrixNeighborGraph(ijmatrix));
+      hypre_IJScatterMapDestroy(hypre_IJMatrixScatterMap(ijmatrix));
       if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
       {
          hypre_IJMatrixDestroyParCSR( ijmatrix );
@@ -443,13 +450,32 @@ HYPRE_IJMatrixSetValues2( HYPRE_IJMatrix       matrix,
          hypre_PrefixSumInt(nrows, ncols_tmp, row_indexes_tmp);
       }
 
-      if (hypre_IJMatrixOMPFlag(ijmatrix))
+      if (hypre_IJMatrixPatternLocked(ijmatrix))
       {
-         hypre_IJMatrixSetValuesOMPParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         hypre_IJMatrixScatterValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols,
+                                           values, "set");
       }
       else
       {
-         hypre_IJMatrixSetValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         if (hypre_IJMatrixLockPattern(ijmatrix))
+         {
+            hypre_IJMatrixRecordValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols,
+                                             "set");
+         }
+
+         if (hypre_IJMatrixStaging(ijmatrix))
+         {
+            hypre_IJMatrixStageValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values,
+                                            "set");
+         }
+         else if (hypre_IJMatrixOMPFlag(ijmatrix))
+         {
+            hypre_IJMatrixSetValuesOMPParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         }
+         else
+         {
+            hypre_IJMatrixSetValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         }
       }
 
       if (!ncols)
@@ -651,13 +677,32 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
          hypre_PrefixSumInt(nrows, ncols_tmp, row_indexes_tmp);
       }
 
-      if (hypre_IJMatrixOMPFlag(ijmatrix))
+      if (hypre_IJMatrixPatternLocked(ijmatrix))
       {
-         hypre_IJMatrixAddToValuesOMPParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         hypre_IJMatrixScatterValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols,
+                                           values, "add");
       }
       else
       {
-         hypre_IJMatrixAddToValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         if (hypre_IJMatrixLockPattern(ijmatrix))
+         {
+            hypre_IJMatrixRecordValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols,
+                                             "add");
+         }
+
+         if (hypre_IJMatrixStaging(ijmatrix))
+         {
+            hypre_IJMatrixStageValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values,
+                                            "add");
+         }
+         else if (hypre_IJMatrixOMPFlag(ijmatrix))
+         {
+            hypre_IJMatrixAddToValuesOMPParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         }
+         else
+         {
+            hypre_IJMatrixAddToValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         }
       }
 
       if (!ncols)
@@ -699,9 +744,26 @@ HYPRE_IJMatrixAssemble( HYPRE_IJMatrix matrix )
       }
       else
 #endif
+      if (hypre_IJMatrixPatternLocked(ijmatrix))
+      {
+         return ( hypre_IJMatrixAssembleScatterParCSR( ijmatrix ) );
+      }
+
+      if (hypre_IJMatrixStaging(ijmatrix))
+      {
+         hypre_IJMatrixAssembleStagedParCSR( ijmatrix );
+      }
+      else
+      {
+         hypre_IJMatrixAssembleParCSR( ijmatrix );
+      }
+
+      if (hypre_IJMatrixLockPattern(ijmatrix))
       {
-         return ( hypre_IJMatrixAssembleParCSR( ijmatrix ) );
+         hypre_IJMatrixBuildScatterMapParCSR( ijmatrix );
       }
+
+      return hypre_error_flag;
    }
    else
    {
@@ -1115,6 +1177,247 @@ HYPRE_IJMatrixPrint( HYPRE_IJMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixReadBinary( const char     *filename,
+                          MPI_Comm        comm,
+                          HYPRE_Int       type,
+                          HYPRE_IJMatrix *matrix_ptr )
+{
+   HYPRE_IJMatrix     matrix;
+   hypre_longlongint  header[hypre_BINARY_IJ_HEADER_SIZE];
+   HYPRE_BigInt       ilower, iupper, jlower, jupper;
+   HYPRE_BigInt      *rows, *cols;
+   HYPRE_Int         *row_ptr, *ncols, *diag_sizes, *offd_sizes;
+   HYPRE_Complex     *values;
+   HYPRE_Int          num_rows, i, j;
+   HYPRE_Int          error_flag0 = hypre_error_flag;
+   HYPRE_Int          ierr, ierr_global;
+
+   *matrix_ptr = NULL;
+   row_ptr = NULL;
+   cols    = NULL;
+   values  = NULL;
+
+   /* check only for errors raised here, then agree on the outcome before
+      the collective calls below */
+   hypre_error_flag = 0;
+   hypre_BinaryIJReadHeader(filename, hypre_BINARY_IJ_MATRIX, header);
+   if (!hypre_error_flag)
+   {
+      hypre_BinaryIJGetLocalRange(comm, filename, header, hypre_BINARY_IJ_ROW_PARTITION,
+                                  &ilower, &iupper);
+   }
+   if (!hypre_error_flag)
+   {
+      hypre_BinaryIJGetLocalRange(comm, filename, header, hypre_BINARY_IJ_COL_PARTITION,
+                                  &jlower, &jupper);
+   }
+   if (!hypre_error_flag)
+   {
+      hypre_BinaryIJReadRows(filename, header, ilower, iupper, &row_ptr, &cols, &values);
+   }
+   ierr = (hypre_error_flag != 0);
+   hypre_error_flag |= error_flag0;
+
+   hypre_MPI_Allreduce(&ierr, &ierr_global, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (ierr_global)
+   {
+      if (!ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Error: binary IJ file could not be read by all processes\n");
+      }
+      hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(values, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   num_rows   = (HYPRE_Int) (iupper - ilower + 1);
+   rows       = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   ncols      = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   diag_sizes = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   offd_sizes = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      rows[i]  = ilower + (HYPRE_BigInt) i;
+      ncols[i] = row_ptr[i + 1] - row_ptr[i];
+      for (j = row_ptr[i]; j < row_ptr[i + 1]; j++)
+      {
+         if (cols[j] >= jlower && cols[j] <= jupper)
+         {
+            diag_sizes[i]++;
+         }
+         else
+         {
+            offd_sizes[i]++;
+         }
+      }
+   }
+
+   HYPRE_IJMatrixCreate(comm, ilower, iupper, jlower, jupper, &matrix);
+
+   HYPRE_IJMatrixSetObjectType(matrix, type);
+
+   HYPRE_IJMatrixSetDiagOffdSizes(matrix, diag_sizes, offd_sizes);
+
+   HYPRE_IJMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+
+   if (row_ptr[num_rows] > 0)
+   {
+      HYPRE_IJMatrixSetValues(matrix, num_rows, ncols, rows, cols, values);
+   }
+
+   HYPRE_IJMatrixAssemble(matrix);
+
+   hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   hypre_TFree(rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(ncols, HYPRE_MEMORY_HOST);
+   hypre_TFree(diag_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_sizes, HYPRE_MEMORY_HOST);
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixPrintBinary
+ *
+ * Rows and columns are written with the numbering of the IJ matrix.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixPrintBinary( HYPRE_IJMatrix  matrix,
+                           const char     *filename )
+{
+   HYPRE_ParCSRMatrix    par_csr, par_csr2;
+   HYPRE_MemoryLocation  memory_location;
+   HYPRE_Int             base_i, base_j;
+   void                 *object;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( (hypre_IJMatrixObjectType(matrix) != HYPRE_PARCSR) )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   HYPRE_IJMatrixGetObject(matrix, &object);
+   par_csr = (HYPRE_ParCSRMatrix) object;
+
+   base_i = (HYPRE_Int) (hypre_IJMatrixRowPartitioning(matrix)[0] -
+                         hypre_ParCSRMatrixFirstRowIndex(par_csr));
+   base_j = (HYPRE_Int) (hypre_IJMatrixColPartitioning(matrix)[0] -
+                         hypre_ParCSRMatrixFirstColDiag(par_csr));
+
+   memory_location = hypre_IJMatrixMemoryLocation(matrix);
+
+   if ( hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST )
+   {
+      hypre_ParCSRMatrixPrintBinaryIJ(par_csr, base_i, base_j, filename);
+   }
+   else
+   {
+      par_csr2 = hypre_ParCSRMatrixClone_v2(par_csr, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatrixPrintBinaryIJ(par_csr2, base_i, base_j, filename);
+      hypre_ParCSRMatrixDestroy(par_csr2);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixReadMM
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixReadMM( const char     *filename,
+                      MPI_Comm        comm,
+                      HYPRE_Int       type,
+                      HYPRE_IJMatrix *matrix_ptr )
+{
+   HYPRE_IJMatrix  matrix;
+   HYPRE_BigInt    num_rows, num_cols, ilower, iupper, jlower, jupper;
+   HYPRE_BigInt   *rows, *cols;
+   HYPRE_Complex  *values;
+   HYPRE_Int      *ncols;
+   HYPRE_Int       num_entries, myid, num_procs, i;
+   HYPRE_Int       error_flag0 = hypre_error_flag;
+   HYPRE_Int       ierr, ierr_global;
+
+   *matrix_ptr = NULL;
+
+   /* check only for errors raised while reading, as in ReadBinary */
+   hypre_error_flag = 0;
+   hypre_IJMatrixReadMMEntries(comm, filename, &num_rows, &num_cols, &num_entries,
+                               &rows, &cols, &values);
+   ierr = (hypre_error_flag != 0);
+   hypre_error_flag |= error_flag0;
+
+   hypre_MPI_Allreduce(&ierr, &ierr_global, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (ierr_global)
+   {
+      if (!ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Error: Matrix Market file could not be read by all processes\n");
+      }
+      hypre_TFree(rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(values, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   ilower = (HYPRE_BigInt) ((hypre_longlongint) num_rows * myid / num_procs);
+   iupper = (HYPRE_BigInt) ((hypre_longlongint) num_rows * (myid + 1) / num_procs) - 1;
+   jlower = (HYPRE_BigInt) ((hypre_longlongint) num_cols * myid / num_procs);
+   jupper = (HYPRE_BigInt) ((hypre_longlongint) num_cols * (myid + 1) / num_procs) - 1;
+
+   /* one entry per "row" of the call below */
+   ncols = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_entries; i++)
+   {
+      ncols[i] = 1;
+   }
+
+   HYPRE_IJMatrixCreate(comm, ilower, iupper, jlower, jupper, &matrix);
+
+   HYPRE_IJMatrixSetObjectType(matrix, type);
+
+   /* entries come in file order, for any rows */
+   HYPRE_IJMatrixSetStagingFlag(matrix, 1);
+
+   HYPRE_IJMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+
+   HYPRE_IJMatrixAddToValues(matrix, num_entries, ncols, rows, cols, values);
+
+   HYPRE_IJMatrixAssemble(matrix);
+
+   hypre_TFree(ncols, HYPRE_MEMORY_HOST);
+   hypre_TFree(rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixSetOMPFlag
  *--------------------------------------------------------------------------*/
@@ -1136,6 +1439,71 @@ HYPRE_IJMatrixSetOMPFlag( HYPRE_IJMatrix matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixSetStagingFlag
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetStagingFlag( HYPRE_IJMatrix matrix,
+                              HYPRE_Int      staging_flag )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* the scatter map of a locked pattern is shared by all threads */
+   if (staging_flag && hypre_IJMatrixLockPattern(ijmatrix) && hypre_NumThreads() > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Threaded staging can't be used with a locked pattern!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixStagingFlag(ijmatrix) = staging_flag;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixSetLockPattern
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetLockPattern( HYPRE_IJMatrix matrix,
+                              HYPRE_Int      lock_pattern )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* the scatter map of a locked pattern is shared by all threads */
+   if (lock_pattern && hypre_IJMatrixStagingFlag(ijmatrix) && hypre_NumThreads() > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Threaded staging can't be used with a locked pattern!\n");
+      return hypre_error_flag;
+   }
+
+   /* a new pattern is recorded by the next assembly cycle */
+   hypre_IJScatterMapDestroy(hypre_IJMatrixScatterMap(ijmatrix));
+   hypre_IJMatrixScatterMap(ijmatrix) = NULL;
+   if (lock_pattern)
+   {
+      hypre_IJScatterMapCreate(&hypre_IJMatrixScatterMap(ijmatrix));
+   }
+   hypre_IJMatrixLockPattern(ijmatrix) = lock_pattern;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixTranspose
  *--------------------------------------------------------------------------*/
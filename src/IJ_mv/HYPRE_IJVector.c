@@ -646,3 +646,117 @@ HYPRE_IJVectorPrint( HYPRE_IJVector  vector,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJVectorReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJVectorReadBinary( const char     *filename,
+                          MPI_Comm        comm,
+                          HYPRE_Int       type,
+                          HYPRE_IJVector *vector_ptr )
+{
+   HYPRE_IJVector     vector;
+   hypre_longlongint  header[hypre_BINARY_IJ_HEADER_SIZE];
+   HYPRE_BigInt       jlower, jupper;
+   HYPRE_Complex     *values = NULL;
+   HYPRE_Int          n_local = 0;
+   HYPRE_Int          error_flag0 = hypre_error_flag;
+   HYPRE_Int          ierr, ierr_global;
+
+   *vector_ptr = NULL;
+
+   /* check only for errors raised here, then agree on the outcome before
+      the collective calls below */
+   hypre_error_flag = 0;
+   hypre_BinaryIJReadHeader(filename, hypre_BINARY_IJ_VECTOR, header);
+   if (!hypre_error_flag)
+   {
+      hypre_BinaryIJGetLocalRange(comm, filename, header, hypre_BINARY_IJ_ROW_PARTITION,
+                                  &jlower, &jupper);
+   }
+   if (!hypre_error_flag)
+   {
+      n_local = (HYPRE_Int) (jupper - jlower + 1);
+      values  = hypre_TAlloc(HYPRE_Complex, n_local, HYPRE_MEMORY_HOST);
+      hypre_BinaryIJReadValues(filename, header, jlower, jupper, values);
+   }
+   ierr = (hypre_error_flag != 0);
+   hypre_error_flag |= error_flag0;
+
+   hypre_MPI_Allreduce(&ierr, &ierr_global, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (ierr_global)
+   {
+      if (!ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Error: binary IJ file could not be read by all processes\n");
+      }
+      hypre_TFree(values, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   HYPRE_IJVectorCreate(comm, jlower, jupper, &vector);
+
+   HYPRE_IJVectorSetObjectType(vector, type);
+
+   HYPRE_IJVectorInitialize_v2(vector, HYPRE_MEMORY_HOST);
+
+   HYPRE_IJVectorSetValues(vector, n_local, NULL, values);
+
+   HYPRE_IJVectorAssemble(vector);
+
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   *vector_ptr = vector;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJVectorPrintBinary
+ *
+ * Entries are written with the numbering of the IJ vector.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJVectorPrintBinary( HYPRE_IJVector  vector,
+                           const char     *filename )
+{
+   hypre_ParVector      *par_vector, *par_vector2;
+   HYPRE_MemoryLocation  memory_location;
+   HYPRE_Int             base_j;
+
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( (hypre_IJVectorObjectType(vector) != HYPRE_PARCSR) )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   par_vector = (hypre_ParVector *) hypre_IJVectorObject(vector);
+
+   base_j = (HYPRE_Int) (hypre_IJVectorPartitioning(vector)[0] -
+                         hypre_ParVectorFirstIndex(par_vector));
+
+   memory_location = hypre_IJVectorMemoryLocation(vector);
+
+   if ( hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST )
+   {
+      hypre_ParVectorPrintBinaryIJ(par_vector, base_j, filename);
+   }
+   else
+   {
+      par_vector2 = hypre_ParVectorCloneDeep_v2(par_vector, HYPRE_MEMORY_HOST);
+      hypre_ParVectorPrintBinaryIJ(par_vector2, base_j, filename);
+      hypre_ParVectorDestroy(par_vector2);
+   }
+
+   return hypre_error_flag;
+}
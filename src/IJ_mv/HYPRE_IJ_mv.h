@@ -323,6 +323,46 @@ HYPRE_Int HYPRE_IJMatrixSetPrintLevel(HYPRE_IJMatrix matrix,
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag(HYPRE_IJMatrix matrix,
                                    HYPRE_Int      omp_flag);
 
+/**
+ * (Optional) Stage coefficients in per-thread coordinate (COO) buffers
+ * instead of inserting them row by row, if \e staging_flag != 0.
+ * HYPRE_IJMatrixSetValues and HYPRE_IJMatrixAddToValues then only append
+ * (row, column, value) triples to a buffer owned by the calling thread,
+ * so they may be called concurrently from the threads of an OpenMP
+ * parallel region, with no restriction on repeated rows.
+ * HYPRE_IJMatrixAssemble sorts and combines all staged entries at once:
+ * for each coefficient, the last value set wins and values added later
+ * are summed onto it.  Values set for rows owned by other processes are
+ * not communicated (as with the device assembly), only added values are.
+ *
+ * Must be called before HYPRE_IJMatrixInitialize.  Host memory only.
+ *
+ * Not collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetStagingFlag(HYPRE_IJMatrix matrix,
+                                       HYPRE_Int      staging_flag);
+
+/**
+ * (Optional) Lock the sparsity pattern of the matrix, if \e lock_pattern != 0,
+ * for applications that re-assemble the same pattern with new values (e.g.,
+ * every time step).  The next assembly cycle (the calls to
+ * HYPRE_IJMatrixSetValues and HYPRE_IJMatrixAddToValues up to
+ * HYPRE_IJMatrixAssemble) runs as usual and records the row and column
+ * of every coefficient passed.  In later cycles, the same calls must be
+ * repeated with the same rows and columns in the same order; the values are
+ * then written directly into the matrix, and HYPRE_IJMatrixAssemble only
+ * exchanges the values added to rows owned by other processes.  Values set
+ * for rows owned by other processes are ignored, as in the regular assembly.
+ *
+ * Host memory only.  The calls of a locked cycle must not be made
+ * concurrently from several threads.  Calling this routine again discards
+ * the recorded pattern.
+ *
+ * Not collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetLockPattern(HYPRE_IJMatrix matrix,
+                                       HYPRE_Int      lock_pattern);
+
 /**
  * Read the matrix from file.  This is mainly for debugging purposes.
  **/
@@ -337,6 +377,52 @@ HYPRE_Int HYPRE_IJMatrixRead(const char     *filename,
 HYPRE_Int HYPRE_IJMatrixPrint(HYPRE_IJMatrix  matrix,
                               const char     *filename);
 
+/**
+ * Read the matrix from a binary file written by \ref HYPRE_IJMatrixPrintBinary.
+ * The file may be read on any number of processes.  With as many processes
+ * as the writer, the rows and columns are distributed as they were written;
+ * otherwise they are split into equal contiguous blocks.  The file is
+ * mapped into memory, and each process reads only its own rows.  If any
+ * process fails to read the file, all processes return an error and set
+ * \e matrix to NULL.
+ *
+ * Collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixReadBinary(const char     *filename,
+                                   MPI_Comm        comm,
+                                   HYPRE_Int       type,
+                                   HYPRE_IJMatrix *matrix);
+
+/**
+ * Print the matrix to a single binary file.  The file stores the global
+ * sizes, the partitioning, and the rows in global order with their column
+ * indices and values in the native integer and floating point formats.
+ * All processes write their part of the file at once (MPI-IO).
+ *
+ * Collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixPrintBinary(HYPRE_IJMatrix  matrix,
+                                    const char     *filename);
+
+/**
+ * Read the matrix from a Matrix Market file in coordinate format, with
+ * real, integer or pattern values and general, symmetric or skew-symmetric
+ * structure.  The 1-based indices of the file become 0-based rows and
+ * columns, split into equal contiguous blocks over the processes of comm.
+ * Every process parses an equal part of the file, and the entries are sent
+ * to the processes that own them during the assembly.  Pattern entries get
+ * the value 1, and duplicate entries are summed.  The matrix is assembled
+ * with the staging flag set (see \ref HYPRE_IJMatrixSetStagingFlag).  If
+ * the file cannot be read, all processes return an error and set \e matrix
+ * to NULL.
+ *
+ * Collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixReadMM(const char     *filename,
+                               MPI_Comm        comm,
+                               HYPRE_Int       type,
+                               HYPRE_IJMatrix *matrix);
+
 /**@}*/
 
 /*--------------------------------------------------------------------------
@@ -510,6 +596,26 @@ HYPRE_Int HYPRE_IJVectorRead(const char     *filename,
 HYPRE_Int HYPRE_IJVectorPrint(HYPRE_IJVector  vector,
                               const char     *filename);
 
+/**
+ * Read the vector from a binary file written by \ref HYPRE_IJVectorPrintBinary.
+ * The entries are distributed, and errors are reported, as in
+ * \ref HYPRE_IJMatrixReadBinary.
+ *
+ * Collective.
+ **/
+HYPRE_Int HYPRE_IJVectorReadBinary(const char     *filename,
+                                   MPI_Comm        comm,
+                                   HYPRE_Int       type,
+                                   HYPRE_IJVector *vector);
+
+/**
+ * Print the vector to a single binary file (see \ref HYPRE_IJMatrixPrintBinary).
+ *
+ * Collective.
+ **/
+HYPRE_Int HYPRE_IJVectorPrintBinary(HYPRE_IJVector  vector,
+                                    const char     *filename);
+
 /**@}*/
 /**@}*/
 
@@ -0,0 +1,374 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Parallel Matrix Market (coordinate format) reader
+ *
+ * Process 0 reads the banner and the size line.  The data lines are then
+ * split into equal byte ranges, one per process; a line belongs to the
+ * process whose range contains its first byte.  Each process maps its
+ * range of the file and parses it in place.
+ *
+ *****************************************************************************/
+
+#include <ctype.h>
+#include "_hypre_IJ_mv.h"
+
+/* entries of the header information broadcast by process 0 */
+#define hypre_MM_INFO_STATUS      0
+#define hypre_MM_INFO_NUM_ROWS    1
+#define hypre_MM_INFO_NUM_COLS    2
+#define hypre_MM_INFO_NUM_ENTRIES 3
+#define hypre_MM_INFO_DATA_START  4
+#define hypre_MM_INFO_FILE_SIZE   5
+#define hypre_MM_INFO_PATTERN     6
+#define hypre_MM_INFO_SYMMETRY    7  /* 0 general, 1 symmetric, -1 skew-symmetric */
+#define hypre_MM_INFO_SIZE        8
+
+/*--------------------------------------------------------------------------
+ * hypre_MMReadHeader
+ *
+ * Reads the banner and the size line of a Matrix Market file.  Sets
+ * info[hypre_MM_INFO_STATUS] to a nonzero value on failure.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_MMReadHeader( const char        *filename,
+                    hypre_longlongint *info )
+{
+   FILE              *fp;
+   char               line[1024];
+   char               object[64], format[64], field[64], symmetry[64];
+   hypre_longlongint  num_rows, num_cols, num_entries;
+   HYPRE_Int          k;
+
+   info[hypre_MM_INFO_STATUS] = 1;
+
+   if ((fp = fopen(filename, "r")) == NULL)
+   {
+      return;
+   }
+
+   if (fgets(line, sizeof(line), fp) == NULL ||
+       sscanf(line, "%%%%MatrixMarket %63s %63s %63s %63s",
+              object, format, field, symmetry) != 4)
+   {
+      fclose(fp);
+      return;
+   }
+   /* the banner is case-insensitive */
+   for (k = 0; k < 64 && object[k]; k++)
+   {
+      object[k] = (char) tolower((unsigned char) object[k]);
+   }
+   for (k = 0; k < 64 && format[k]; k++)
+   {
+      format[k] = (char) tolower((unsigned char) format[k]);
+   }
+   for (k = 0; k < 64 && field[k]; k++)
+   {
+      field[k] = (char) tolower((unsigned char) field[k]);
+   }
+   for (k = 0; k < 64 && symmetry[k]; k++)
+   {
+      symmetry[k] = (char) tolower((unsigned char) symmetry[k]);
+   }
+
+   /* real, integer and pattern coordinate matrices */
+   if (strcmp(object, "matrix") || strcmp(format, "coordinate") ||
+       (strcmp(field, "real") && strcmp(field, "double") &&
+        strcmp(field, "integer") && strcmp(field, "pattern")))
+   {
+      fclose(fp);
+      return;
+   }
+   info[hypre_MM_INFO_PATTERN] = !strcmp(field, "pattern");
+
+   if (!strcmp(symmetry, "general"))
+   {
+      info[hypre_MM_INFO_SYMMETRY] = 0;
+   }
+   else if (!strcmp(symmetry, "symmetric"))
+   {
+      info[hypre_MM_INFO_SYMMETRY] = 1;
+   }
+   else if (!strcmp(symmetry, "skew-symmetric"))
+   {
+      info[hypre_MM_INFO_SYMMETRY] = -1;
+   }
+   else
+   {
+      fclose(fp);
+      return;
+   }
+
+   /* skip comments, then read the size line */
+   do
+   {
+      if (fgets(line, sizeof(line), fp) == NULL)
+      {
+         fclose(fp);
+         return;
+      }
+   }
+   while (line[0] == '%' || sscanf(line, "%lld %lld %lld", &num_rows, &num_cols,
+                                   &num_entries) != 3);
+
+   info[hypre_MM_INFO_NUM_ROWS]    = num_rows;
+   info[hypre_MM_INFO_NUM_COLS]    = num_cols;
+   info[hypre_MM_INFO_NUM_ENTRIES] = num_entries;
+   info[hypre_MM_INFO_DATA_START]  = (hypre_longlongint) ftell(fp);
+   fseek(fp, 0, SEEK_END);
+   info[hypre_MM_INFO_FILE_SIZE]   = (hypre_longlongint) ftell(fp);
+   info[hypre_MM_INFO_STATUS]      = 0;
+
+   fclose(fp);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MMParseIndex, hypre_MMParseValue
+ *
+ * Parse the next whitespace-separated token of a line, advancing *pos.
+ * The buffer is not null-terminated.  Return 0 if there is no valid token
+ * before the end of the line.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_MMParseIndex( const char        **pos,
+                    const char         *end,
+                    hypre_longlongint  *index )
+{
+   const char        *p = *pos;
+   hypre_longlongint  val = 0;
+
+   while (p < end && (*p == ' ' || *p == '\t'))
+   {
+      p++;
+   }
+   if (p == end || *p < '0' || *p > '9')
+   {
+      return 0;
+   }
+   while (p < end && *p >= '0' && *p <= '9')
+   {
+      val = 10 * val + (*p - '0');
+      p++;
+   }
+
+   *index = val;
+   *pos = p;
+
+   return 1;
+}
+
+static HYPRE_Int
+hypre_MMParseValue( const char   **pos,
+                    const char    *end,
+                    HYPRE_Real    *value )
+{
+   const char *p = *pos;
+   char        token[64];
+   char       *token_end;
+   HYPRE_Int   n = 0;
+
+   while (p < end && (*p == ' ' || *p == '\t'))
+   {
+      p++;
+   }
+   while (p < end && n < 63 && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r')
+   {
+      token[n++] = *p++;
+   }
+   token[n] = '\0';
+
+   *value = (HYPRE_Real) strtod(token, &token_end);
+   if (n == 0 || token_end != token + n)
+   {
+      return 0;
+   }
+   *pos = p;
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixReadMMEntries
+ *
+ * Reads this process' share of the entries of a Matrix Market file.
+ * Returns the global sizes and the local entries with 0-based row and
+ * column indices (host memory).  Entries of symmetric and skew-symmetric
+ * matrices are expanded to both triangles, and pattern entries get the
+ * value 1.  On error, the entry arrays are set to NULL.  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixReadMMEntries( MPI_Comm         comm,
+                             const char      *filename,
+                             HYPRE_BigInt    *num_rows_ptr,
+                             HYPRE_BigInt    *num_cols_ptr,
+                             HYPRE_Int       *num_entries_ptr,
+                             HYPRE_BigInt   **rows_ptr,
+                             HYPRE_BigInt   **cols_ptr,
+                             HYPRE_Complex  **values_ptr )
+{
+   hypre_longlongint   info[hypre_MM_INFO_SIZE];
+   hypre_longlongint   data_start, data_size, lower, upper, map_start;
+   hypre_longlongint   num_rows, num_cols, row, col;
+   HYPRE_BigInt        num_read, num_read_global;
+   HYPRE_Int           pattern, symmetry, bad_line, any_bad_line;
+   HYPRE_Int           myid, num_procs;
+   HYPRE_Int           num_entries, max_entries;
+   HYPRE_BigInt       *rows, *cols;
+   HYPRE_Complex      *values;
+   HYPRE_Real          value;
+   void               *mapping = NULL, *data = NULL;
+   const char         *buf, *pos, *limit, *end;
+
+   *rows_ptr   = NULL;
+   *cols_ptr   = NULL;
+   *values_ptr = NULL;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (myid == 0)
+   {
+      hypre_MMReadHeader(filename, info);
+   }
+   hypre_MPI_Bcast(info, hypre_MM_INFO_SIZE * sizeof(hypre_longlongint), hypre_MPI_BYTE, 0, comm);
+   if (info[hypre_MM_INFO_STATUS])
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Error: can't read a real, integer or pattern coordinate Matrix Market header\n");
+      return hypre_error_flag;
+   }
+
+   num_rows   = info[hypre_MM_INFO_NUM_ROWS];
+   num_cols   = info[hypre_MM_INFO_NUM_COLS];
+   pattern    = (HYPRE_Int) info[hypre_MM_INFO_PATTERN];
+   symmetry   = (HYPRE_Int) info[hypre_MM_INFO_SYMMETRY];
+   data_start = info[hypre_MM_INFO_DATA_START];
+   data_size  = info[hypre_MM_INFO_FILE_SIZE] - data_start;
+
+   /* this process' byte range, plus the byte before it to find line starts */
+   lower     = data_start + data_size * myid / num_procs;
+   upper     = data_start + data_size * (myid + 1) / num_procs;
+   map_start = (myid > 0) ? lower - 1 : lower;
+
+   if (upper > lower)
+   {
+      /* lines may run past upper; only the pages touched are read */
+      hypre_BinaryFileMap(filename, (hypre_ulonglongint) map_start,
+                          (hypre_ulonglongint) (info[hypre_MM_INFO_FILE_SIZE] - map_start),
+                          &mapping, &data);
+   }
+
+   max_entries = (HYPRE_Int) ((upper - lower) / 16 + 16) * (symmetry ? 2 : 1);
+   rows   = hypre_TAlloc(HYPRE_BigInt, max_entries, HYPRE_MEMORY_HOST);
+   cols   = hypre_TAlloc(HYPRE_BigInt, max_entries, HYPRE_MEMORY_HOST);
+   values = hypre_TAlloc(HYPRE_Complex, max_entries, HYPRE_MEMORY_HOST);
+   num_entries = 0;
+   num_read = 0;
+   bad_line = 0;
+
+   if (data)
+   {
+      buf   = (const char *) data;
+      end   = buf + (info[hypre_MM_INFO_FILE_SIZE] - map_start);
+      limit = buf + (upper - map_start);
+      pos   = buf + (lower - map_start);
+
+      /* a line that starts before lower belongs to the previous process */
+      if (myid > 0 && buf[0] != '\n')
+      {
+         while (pos < end && *pos != '\n')
+         {
+            pos++;
+         }
+         pos++;
+      }
+
+      while (pos < limit)
+      {
+         while (pos < end && (*pos == ' ' || *pos == '\t'))
+         {
+            pos++;
+         }
+
+         if (pos < end && *pos != '%' && *pos != '\n' && *pos != '\r')
+         {
+            if (!hypre_MMParseIndex(&pos, end, &row) ||
+                !hypre_MMParseIndex(&pos, end, &col) ||
+                row < 1 || row > num_rows || col < 1 || col > num_cols)
+            {
+               bad_line = 1;
+               break;
+            }
+            value = 1.0;
+            if (!pattern && !hypre_MMParseValue(&pos, end, &value))
+            {
+               bad_line = 1;
+               break;
+            }
+
+            if (num_entries + 2 > max_entries)
+            {
+               rows   = hypre_TReAlloc_v2(rows, HYPRE_BigInt, max_entries,
+                                          HYPRE_BigInt, 2 * max_entries, HYPRE_MEMORY_HOST);
+               cols   = hypre_TReAlloc_v2(cols, HYPRE_BigInt, max_entries,
+                                          HYPRE_BigInt, 2 * max_entries, HYPRE_MEMORY_HOST);
+               values = hypre_TReAlloc_v2(values, HYPRE_Complex, max_entries,
+                                          HYPRE_Complex, 2 * max_entries, HYPRE_MEMORY_HOST);
+               max_entries *= 2;
+            }
+
+            rows[num_entries]   = (HYPRE_BigInt) (row - 1);
+            cols[num_entries]   = (HYPRE_BigInt) (col - 1);
+            values[num_entries] = value;
+            num_entries++;
+            if (symmetry && row != col)
+            {
+               rows[num_entries]   = (HYPRE_BigInt) (col - 1);
+               cols[num_entries]   = (HYPRE_BigInt) (row - 1);
+               values[num_entries] = (symmetry > 0) ? value : -value;
+               num_entries++;
+            }
+            num_read++;
+         }
+
+         /* next line */
+         while (pos < end && *pos != '\n')
+         {
+            pos++;
+         }
+         pos++;
+      }
+   }
+   hypre_BinaryFileUnmap(mapping);
+
+   /* every entry of the file must have been read exactly once */
+   hypre_MPI_Allreduce(&bad_line, &any_bad_line, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   hypre_MPI_Allreduce(&num_read, &num_read_global, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+   if (any_bad_line || (hypre_longlongint) num_read_global != info[hypre_MM_INFO_NUM_ENTRIES])
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error in Matrix Market input file\n");
+      hypre_TFree(rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(values, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   *num_rows_ptr    = (HYPRE_BigInt) num_rows;
+   *num_cols_ptr    = (HYPRE_BigInt) num_cols;
+   *num_entries_ptr = num_entries;
+   *rows_ptr        = rows;
+   *cols_ptr        = cols;
+   *values_ptr      = values;
+
+   return hypre_error_flag;
+}
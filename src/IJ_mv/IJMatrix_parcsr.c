@@ -279,6 +279,13 @@ hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation m
          hypre_IJMatrixTranslator(matrix) = aux_matrix;
       }
 
+      /* staged entries go to per-thread buffers, no row storage is needed */
+      if (hypre_IJMatrixStagingFlag(matrix) && memory_location_aux == HYPRE_MEMORY_HOST)
+      {
+         hypre_AuxParCSRMatrixNeedAux(aux_matrix) = 0;
+         hypre_AuxParCSRMatrixInitializeStages(aux_matrix, hypre_NumThreads());
+      }
+
       hypre_ParCSRMatrixInitialize_v2(par_matrix, memory_location);
       hypre_AuxParCSRMatrixInitialize_v2(aux_matrix, memory_location_aux);
 
@@ -332,6 +339,11 @@ hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation m
          hypre_AuxParCSRMatrixNeedAux(aux_matrix) = 0;
          hypre_IJMatrixTranslator(matrix) = aux_matrix;
       }
+
+      if (hypre_IJMatrixStagingFlag(matrix))
+      {
+         hypre_AuxParCSRMatrixInitializeStages(aux_matrix, hypre_NumThreads());
+      }
    }
 
    return hypre_error_flag;
@@ -652,6 +664,7 @@ hypre_IJMatrixSetValuesParCSR( hypre_IJMatrix       *matrix,
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
    par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject( matrix );
+   hypre_ParCSRMatrixSellInvalidate(par_matrix);
    row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
    col_partitioning = hypre_IJMatrixColPartitioning(matrix);
 
@@ -1053,6 +1066,7 @@ hypre_IJMatrixSetConstantValuesParCSR( hypre_IJMatrix *matrix,
 {
    if (hypre_IJMatrixAssembleFlag(matrix))  /* matrix already assembled*/
    {
+      hypre_ParCSRMatrixSellInvalidate((hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix));
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
       if (hypre_GetExecPolicy1(hypre_IJMatrixMemoryLocation(matrix)) == HYPRE_EXEC_DEVICE)
       {
@@ -1134,6 +1148,7 @@ hypre_IJMatrixAddToValuesParCSR( hypre_IJMatrix       *matrix,
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
    par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject( matrix );
+   hypre_ParCSRMatrixSellInvalidate(par_matrix);
    row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
    col_partitioning = hypre_IJMatrixColPartitioning(matrix);
    col_0 = col_partitioning[0];
@@ -1708,6 +1723,324 @@ hypre_IJMatrixAddParCSR( HYPRE_Complex    alpha,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_IJNeighborGraphDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJNeighborGraphDestroy( hypre_IJNeighborGraph *graph )
+{
+   if (graph)
+   {
+      hypre_MPI_Comm_free(&hypre_IJNeighborGraphComm(graph));
+      hypre_TFree(hypre_IJNeighborGraphNeighbors(graph),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJNeighborGraphRangeStarts(graph),   HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJNeighborGraphRangeEnds(graph),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJNeighborGraphRangeNeighbor(graph), HYPRE_MEMORY_HOST);
+      hypre_TFree(graph, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+#if defined(HYPRE_USING_MPI_NEIGHBOR_COLL)
+
+/*--------------------------------------------------------------------------
+ * hypre_IJNeighborGraphCreate
+ *
+ * Creates the graph of the processes this one sent off-processor values to
+ * (send_procs) or received them from (recv_procs).  Both lists are sorted.
+ * Collective.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJNeighborGraphCreate( hypre_IJMatrix         *matrix,
+                             HYPRE_Int               num_sends,
+                             HYPRE_Int              *send_procs,
+                             HYPRE_Int               num_recvs,
+                             HYPRE_Int              *recv_procs,
+                             hypre_IJNeighborGraph **graph_ptr )
+{
+   MPI_Comm               comm = hypre_IJMatrixComm(matrix);
+   hypre_IJNeighborGraph *graph;
+   HYPRE_Int              num_neighbors, i, j, k;
+   HYPRE_Int             *neighbors, *range_neighbor;
+   HYPRE_BigInt          *ranges, *range_starts, *range_ends;
+
+   /* the union of both lists, so that the graph is symmetric */
+   neighbors = hypre_TAlloc(HYPRE_Int, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+   num_neighbors = 0;
+   i = 0;
+   j = 0;
+   while (i < num_sends || j < num_recvs)
+   {
+      if (j == num_recvs || (i < num_sends && send_procs[i] < recv_procs[j]))
+      {
+         neighbors[num_neighbors++] = send_procs[i++];
+      }
+      else if (i == num_sends || recv_procs[j] < send_procs[i])
+      {
+         neighbors[num_neighbors++] = recv_procs[j++];
+      }
+      else
+      {
+         neighbors[num_neighbors++] = send_procs[i++];
+         j++;
+      }
+   }
+
+   graph = hypre_CTAlloc(hypre_IJNeighborGraph, 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Dist_graph_create_adjacent(comm, num_neighbors, neighbors, num_neighbors, neighbors,
+                                        &hypre_IJNeighborGraphComm(graph));
+
+   /* get the rows owned by the neighbors */
+   ranges = hypre_TAlloc(HYPRE_BigInt, 2 * num_neighbors, HYPRE_MEMORY_HOST);
+   hypre_MPI_Neighbor_allgather(hypre_IJMatrixRowPartitioning(matrix), 2, HYPRE_MPI_BIG_INT,
+                                ranges, 2, HYPRE_MPI_BIG_INT, hypre_IJNeighborGraphComm(graph));
+
+   range_starts   = hypre_TAlloc(HYPRE_BigInt, num_neighbors, HYPRE_MEMORY_HOST);
+   range_ends     = hypre_TAlloc(HYPRE_BigInt, num_neighbors, HYPRE_MEMORY_HOST);
+   range_neighbor = hypre_TAlloc(HYPRE_Int,    num_neighbors, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_neighbors; k++)
+   {
+      range_starts[k]   = ranges[2 * k];
+      range_neighbor[k] = k;
+   }
+   hypre_BigQsortbi(range_starts, range_neighbor, 0, num_neighbors - 1);
+   for (k = 0; k < num_neighbors; k++)
+   {
+      range_ends[k] = ranges[2 * range_neighbor[k] + 1];
+   }
+   hypre_TFree(ranges, HYPRE_MEMORY_HOST);
+
+   hypre_IJNeighborGraphNumNeighbors(graph)  = num_neighbors;
+   hypre_IJNeighborGraphNeighbors(graph)     = neighbors;
+   hypre_IJNeighborGraphRangeStarts(graph)   = range_starts;
+   hypre_IJNeighborGraphRangeEnds(graph)     = range_ends;
+   hypre_IJNeighborGraphRangeNeighbor(graph) = range_neighbor;
+
+   *graph_ptr = graph;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixExchangeOffProcValsNeighbor
+ *
+ * Sends the off-processor rows (in the off_proc_i format of
+ * hypre_IJMatrixAssembleOffProcValsParCSR) to their owners with
+ * neighborhood collectives on the cached graph, and adds the received rows
+ * in rank order.  If a row on any process is not owned by a neighbor,
+ * nothing is exchanged and *exchanged is set to 0.  Collective.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixExchangeOffProcValsNeighbor( hypre_IJMatrix       *matrix,
+                                           HYPRE_Int             num_rows,
+                                           HYPRE_BigInt         *off_proc_i,
+                                           HYPRE_BigInt         *off_proc_j,
+                                           HYPRE_Complex        *off_proc_data,
+                                           HYPRE_MemoryLocation  memory_location,
+                                           HYPRE_Int            *exchanged )
+{
+   MPI_Comm               comm           = hypre_IJMatrixComm(matrix);
+   hypre_IJNeighborGraph *graph          = hypre_IJMatrixNeighborGraph(matrix);
+   MPI_Comm               graph_comm     = hypre_IJNeighborGraphComm(graph);
+   HYPRE_Int              num_neighbors  = hypre_IJNeighborGraphNumNeighbors(graph);
+   HYPRE_BigInt          *range_starts   = hypre_IJNeighborGraphRangeStarts(graph);
+   HYPRE_BigInt          *range_ends     = hypre_IJNeighborGraphRangeEnds(graph);
+   HYPRE_Int             *range_neighbor = hypre_IJNeighborGraphRangeNeighbor(graph);
+
+   HYPRE_Int     *row_neighbor, *send_counts, *recv_counts;
+   HYPRE_Int     *int_send_counts, *int_send_starts, *int_recv_counts, *int_recv_starts;
+   HYPRE_Int     *data_send_counts, *data_send_starts, *data_recv_counts, *data_recv_starts;
+   HYPRE_BigInt  *int_send_buf, *int_recv_buf;
+   HYPRE_Complex *data_send_buf, *data_recv_buf;
+   HYPRE_Int      miss, global_miss, row_index = 0;
+   HYPRE_Int      i, j, k, nbr, num_elements, counter, ip, dp;
+   HYPRE_BigInt   row;
+
+   /* find the owners of the rows among the neighbors */
+   row_neighbor = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   send_counts  = hypre_CTAlloc(HYPRE_Int, 2 * num_neighbors, HYPRE_MEMORY_HOST);
+   miss = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      row = off_proc_i[2 * i];
+      k = (HYPRE_Int)(hypre_BigLowerBound(range_starts, range_starts + num_neighbors,
+                                          row + 1) - range_starts) - 1;
+      if (k < 0 || row >= range_ends[k])
+      {
+         miss = 1;
+         break;
+      }
+      nbr = range_neighbor[k];
+      num_elements = (HYPRE_Int) off_proc_i[2 * i + 1];
+      row_neighbor[i] = nbr;
+      send_counts[2 * nbr]     += 2 + num_elements;
+      send_counts[2 * nbr + 1] += num_elements;
+   }
+
+   /* all processes must take the same path */
+   hypre_MPI_Allreduce(&miss, &global_miss, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   *exchanged = !global_miss;
+   if (global_miss)
+   {
+      hypre_TFree(row_neighbor, HYPRE_MEMORY_HOST);
+      hypre_TFree(send_counts, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   recv_counts = hypre_TAlloc(HYPRE_Int, 2 * num_neighbors, HYPRE_MEMORY_HOST);
+   hypre_MPI_Neighbor_alltoall(send_counts, 2, HYPRE_MPI_INT, recv_counts, 2, HYPRE_MPI_INT,
+                               graph_comm);
+
+   int_send_counts  = hypre_TAlloc(HYPRE_Int, num_neighbors,     HYPRE_MEMORY_HOST);
+   int_send_starts  = hypre_TAlloc(HYPRE_Int, num_neighbors + 1, HYPRE_MEMORY_HOST);
+   int_recv_counts  = hypre_TAlloc(HYPRE_Int, num_neighbors,     HYPRE_MEMORY_HOST);
+   int_recv_starts  = hypre_TAlloc(HYPRE_Int, num_neighbors + 1, HYPRE_MEMORY_HOST);
+   data_send_counts = hypre_TAlloc(HYPRE_Int, num_neighbors,     HYPRE_MEMORY_HOST);
+   data_send_starts = hypre_TAlloc(HYPRE_Int, num_neighbors + 1, HYPRE_MEMORY_HOST);
+   data_recv_counts = hypre_TAlloc(HYPRE_Int, num_neighbors,     HYPRE_MEMORY_HOST);
+   data_recv_starts = hypre_TAlloc(HYPRE_Int, num_neighbors + 1, HYPRE_MEMORY_HOST);
+   int_send_starts[0] = int_recv_starts[0] = 0;
+   data_send_starts[0] = data_recv_starts[0] = 0;
+   for (k = 0; k < num_neighbors; k++)
+   {
+      int_send_counts[k]  = send_counts[2 * k];
+      data_send_counts[k] = send_counts[2 * k + 1];
+      int_recv_counts[k]  = recv_counts[2 * k];
+      data_recv_counts[k] = recv_counts[2 * k + 1];
+      int_send_starts[k + 1]  = int_send_starts[k]  + int_send_counts[k];
+      data_send_starts[k + 1] = data_send_starts[k] + data_send_counts[k];
+      int_recv_starts[k + 1]  = int_recv_starts[k]  + int_recv_counts[k];
+      data_recv_starts[k + 1] = data_recv_starts[k] + data_recv_counts[k];
+   }
+   hypre_TFree(send_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_counts, HYPRE_MEMORY_HOST);
+
+   /* for each row: row #, no. elements, col indices; the values separately */
+   int_send_buf  = hypre_TAlloc(HYPRE_BigInt,  int_send_starts[num_neighbors],  HYPRE_MEMORY_HOST);
+   data_send_buf = hypre_TAlloc(HYPRE_Complex, data_send_starts[num_neighbors], HYPRE_MEMORY_HOST);
+   int_recv_buf  = hypre_TAlloc(HYPRE_BigInt,  int_recv_starts[num_neighbors],  HYPRE_MEMORY_HOST);
+   data_recv_buf = hypre_TAlloc(HYPRE_Complex, data_recv_starts[num_neighbors], HYPRE_MEMORY_HOST);
+
+   /* use the counts as positions while packing */
+   for (k = 0; k < num_neighbors; k++)
+   {
+      int_send_counts[k]  = int_send_starts[k];
+      data_send_counts[k] = data_send_starts[k];
+   }
+   counter = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      nbr = row_neighbor[i];
+      num_elements = (HYPRE_Int) off_proc_i[2 * i + 1];
+      ip = int_send_counts[nbr];
+      dp = data_send_counts[nbr];
+      int_send_buf[ip++] = off_proc_i[2 * i];
+      int_send_buf[ip++] = off_proc_i[2 * i + 1];
+      for (j = 0; j < num_elements; j++)
+      {
+         int_send_buf[ip++]  = off_proc_j[counter];
+         data_send_buf[dp++] = off_proc_data[counter++];
+      }
+      int_send_counts[nbr]  = ip;
+      data_send_counts[nbr] = dp;
+   }
+   for (k = 0; k < num_neighbors; k++)
+   {
+      int_send_counts[k]  -= int_send_starts[k];
+      data_send_counts[k] -= data_send_starts[k];
+   }
+   hypre_TFree(row_neighbor, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Neighbor_alltoallv(int_send_buf, int_send_counts, int_send_starts, HYPRE_MPI_BIG_INT,
+                                int_recv_buf, int_recv_counts, int_recv_starts, HYPRE_MPI_BIG_INT,
+                                graph_comm);
+   hypre_MPI_Neighbor_alltoallv(data_send_buf, data_send_counts, data_send_starts,
+                                HYPRE_MPI_COMPLEX, data_recv_buf, data_recv_counts,
+                                data_recv_starts, HYPRE_MPI_COMPLEX, graph_comm);
+
+   /* the neighbors are in rank order, as in the data exchange path */
+   ip = 0;
+   dp = 0;
+   if (memory_location == HYPRE_MEMORY_HOST)
+   {
+      while (ip < int_recv_starts[num_neighbors])
+      {
+         row = int_recv_buf[ip++];
+         num_elements = (HYPRE_Int) int_recv_buf[ip++];
+         if (hypre_IJMatrixStaging(matrix))
+         {
+            hypre_IJMatrixStageValuesParCSR(matrix, 1, &num_elements, &row, &row_index,
+                                            &int_recv_buf[ip], &data_recv_buf[dp], "add");
+         }
+         else
+         {
+            hypre_IJMatrixAddToValuesParCSR(matrix, 1, &num_elements, &row, &row_index,
+                                            &int_recv_buf[ip], &data_recv_buf[dp]);
+         }
+         ip += num_elements;
+         dp += num_elements;
+      }
+   }
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+   else
+   {
+      HYPRE_Int      nelm = data_recv_starts[num_neighbors];
+      HYPRE_BigInt  *recv_i    = hypre_TAlloc(HYPRE_BigInt,  nelm, HYPRE_MEMORY_HOST);
+      HYPRE_BigInt  *recv_j    = hypre_TAlloc(HYPRE_BigInt,  nelm, HYPRE_MEMORY_HOST);
+      HYPRE_BigInt  *recv_i_d  = hypre_TAlloc(HYPRE_BigInt,  nelm, HYPRE_MEMORY_DEVICE);
+      HYPRE_BigInt  *recv_j_d  = hypre_TAlloc(HYPRE_BigInt,  nelm, HYPRE_MEMORY_DEVICE);
+      HYPRE_Complex *recv_data_d = hypre_TAlloc(HYPRE_Complex, nelm, HYPRE_MEMORY_DEVICE);
+
+      while (ip < int_recv_starts[num_neighbors])
+      {
+         row = int_recv_buf[ip++];
+         num_elements = (HYPRE_Int) int_recv_buf[ip++];
+         for (j = 0; j < num_elements; j++)
+         {
+            recv_i[dp] = row;
+            recv_j[dp++] = int_recv_buf[ip++];
+         }
+      }
+
+      hypre_TMemcpy(recv_i_d,    recv_i,        HYPRE_BigInt,  nelm, HYPRE_MEMORY_DEVICE,
+                    HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(recv_j_d,    recv_j,        HYPRE_BigInt,  nelm, HYPRE_MEMORY_DEVICE,
+                    HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(recv_data_d, data_recv_buf, HYPRE_Complex, nelm, HYPRE_MEMORY_DEVICE,
+                    HYPRE_MEMORY_HOST);
+      hypre_IJMatrixSetAddValuesParCSRDevice(matrix, nelm, NULL, recv_i_d, NULL, recv_j_d,
+                                             recv_data_d, "add");
+
+      hypre_TFree(recv_i,      HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_j,      HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_i_d,    HYPRE_MEMORY_DEVICE);
+      hypre_TFree(recv_j_d,    HYPRE_MEMORY_DEVICE);
+      hypre_TFree(recv_data_d, HYPRE_MEMORY_DEVICE);
+   }
+#endif
+
+   hypre_TFree(int_send_counts,  HYPRE_MEMORY_HOST);
+   hypre_TFree(int_send_starts,  HYPRE_MEMORY_HOST);
+   hypre_TFree(int_recv_counts,  HYPRE_MEMORY_HOST);
+   hypre_TFree(int_recv_starts,  HYPRE_MEMORY_HOST);
+   hypre_TFree(data_send_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(data_send_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(data_recv_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(data_recv_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(int_send_buf,     HYPRE_MEMORY_HOST);
+   hypre_TFree(data_send_buf,    HYPRE_MEMORY_HOST);
+   hypre_TFree(int_recv_buf,     HYPRE_MEMORY_HOST);
+   hypre_TFree(data_recv_buf,    HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+#endif
+
 /******************************************************************************
  *
  * hypre_IJMatrixAssembleOffProcValsParCSR
@@ -1843,6 +2176,32 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 
    num_rows = off_proc_i_indx / 2;
 
+#if defined(HYPRE_USING_MPI_NEIGHBOR_COLL)
+   /* skip the discovery of the row owners if the neighbors of an earlier
+      assembly own all the rows */
+   if (hypre_IJMatrixNeighborGraph(matrix))
+   {
+      HYPRE_Int exchanged;
+
+      hypre_IJMatrixExchangeOffProcValsNeighbor(matrix, num_rows, off_proc_i, off_proc_j,
+                                                off_proc_data, memory_location, &exchanged);
+      if (exchanged)
+      {
+         if (memory_location == HYPRE_MEMORY_DEVICE)
+         {
+            hypre_TFree(off_proc_i,    HYPRE_MEMORY_HOST);
+            hypre_TFree(off_proc_j,    HYPRE_MEMORY_HOST);
+            hypre_TFree(off_proc_data, HYPRE_MEMORY_HOST);
+         }
+         return hypre_error_flag;
+      }
+
+      /* some rows have new owners */
+      hypre_IJNeighborGraphDestroy(hypre_IJMatrixNeighborGraph(matrix));
+      hypre_IJMatrixNeighborGraph(matrix) = NULL;
+   }
+#endif
+
    /* verify that we have created the assumed partition */
    if  (hypre_IJMatrixAssumedPart(matrix) == NULL)
    {
@@ -2195,7 +2554,6 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
    hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
 
-   hypre_TFree(ex_contact_procs, HYPRE_MEMORY_HOST);
    hypre_TFree(void_contact_buf, HYPRE_MEMORY_HOST);
    hypre_TFree(ex_contact_vec_starts, HYPRE_MEMORY_HOST);
 
@@ -2213,6 +2571,20 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
     * argsort_contact_procs */
    hypre_qsort2i( send_proc_obj.id, argsort_contact_procs, 0, num_recvs - 1 );
 
+#if defined(HYPRE_USING_MPI_NEIGHBOR_COLL)
+   /* once the owners had to be looked up in an earlier assembly too, keep
+      the processes exchanging values with this one for the next assemblies
+      (a matrix assembled only once does not pay for the graph) */
+   hypre_IJMatrixNumOwnerSearches(matrix)++;
+   if (hypre_IJMatrixNumOwnerSearches(matrix) > 1)
+   {
+      hypre_IJNeighborGraphCreate(matrix, num_real_procs, ex_contact_procs,
+                                  num_recvs, send_proc_obj.id,
+                                  &hypre_IJMatrixNeighborGraph(matrix));
+   }
+#endif
+   hypre_TFree(ex_contact_procs, HYPRE_MEMORY_HOST);
+
    /* alias */
    recv_data_ptr = send_proc_obj.v_elements;
    recv_starts = send_proc_obj.vec_starts;
@@ -2288,7 +2660,12 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 
          }
 
-         if (memory_location == HYPRE_MEMORY_HOST)
+         if (memory_location == HYPRE_MEMORY_HOST && hypre_IJMatrixStaging(matrix))
+         {
+            hypre_IJMatrixStageValuesParCSR(matrix, 1, &num_elements, &row, &row_index, col_ptr,
+                                            col_data_ptr, "add");
+         }
+         else if (memory_location == HYPRE_MEMORY_HOST)
          {
             hypre_IJMatrixAddToValuesParCSR(matrix, 1, &num_elements, &row, &row_index, col_ptr, col_data_ptr);
          }
@@ -2547,6 +2924,9 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
 
    max_num_threads = hypre_NumThreads();
 
+   /* off-processor values may be added to an assembled matrix */
+   hypre_ParCSRMatrixSellInvalidate(par_matrix);
+
    /* first find out if anyone has an aux_matrix, and create one if you don't
     * have one, but other procs do */
    aux_flag = 0;
@@ -2984,6 +3364,7 @@ hypre_IJMatrixSetValuesOMPParCSR( hypre_IJMatrix       *matrix,
    hypre_MPI_Comm_rank(comm, &my_id);
    //max_num_threads = hypre_NumThreads();
    par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject( matrix );
+   hypre_ParCSRMatrixSellInvalidate(par_matrix);
    row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
    col_partitioning = hypre_IJMatrixColPartitioning(matrix);
 
@@ -3618,6 +3999,7 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
    hypre_MPI_Comm_rank(comm, &my_id);
    max_num_threads = hypre_NumThreads();
    par_matrix = (hypre_ParCSRMatrix*) hypre_IJMatrixObject( matrix );
+   hypre_ParCSRMatrixSellInvalidate(par_matrix);
    row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
    col_partitioning = hypre_IJMatrixColPartitioning(matrix);
 
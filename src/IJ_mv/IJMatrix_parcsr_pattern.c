@@ -0,0 +1,630 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * IJMatrix_ParCSR value-only re-assembly (see HYPRE_IJMatrixSetLockPattern)
+ *
+ * During the first assembly cycle after the pattern is locked, the (row, col)
+ * of every Set/AddToValues entry is recorded.  When that cycle is assembled,
+ * each entry is mapped to its slot in the diag/offd data or in a buffer of
+ * off-processor values, and a communication package for these values is
+ * built.  Later cycles write the values directly into their slots, and
+ * Assemble only exchanges the off-processor values.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+#include "_hypre_parcsr_mv.h"
+
+/* order-dependent hash of the (row, col) sequence of a cycle (64-bit FNV-1a
+   over the indices) */
+#define hypre_IJ_PATTERN_HASH_INIT 14695981039346656037ULL
+
+static inline hypre_ulonglongint
+hypre_IJPatternHash( hypre_ulonglongint hash,
+                     HYPRE_BigInt       row,
+                     HYPRE_BigInt       col )
+{
+   hash = (hash ^ (hypre_ulonglongint) row) * 1099511628211ULL;
+   hash = (hash ^ (hypre_ulonglongint) col) * 1099511628211ULL;
+
+   return hash;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJScatterMapCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJScatterMapCreate( hypre_IJScatterMap **map_ptr )
+{
+   hypre_IJScatterMap *map = hypre_CTAlloc(hypre_IJScatterMap, 1, HYPRE_MEMORY_HOST);
+
+   hypre_IJScatterMapNumEntries(map) = 0;
+   hypre_IJScatterMapMaxEntries(map) = 0;
+   hypre_IJScatterMapEntryI(map)     = NULL;
+   hypre_IJScatterMapEntryJ(map)     = NULL;
+   hypre_IJScatterMapEntrySkip(map)  = NULL;
+   hypre_IJScatterMapPatternHash(map) = hypre_IJ_PATTERN_HASH_INIT;
+   hypre_IJScatterMapBuilt(map)      = 0;
+   hypre_IJScatterMapSlot(map)       = NULL;
+   hypre_IJScatterMapCursor(map)     = 0;
+   hypre_IJScatterMapCycleHash(map)  = hypre_IJ_PATTERN_HASH_INIT;
+   hypre_IJScatterMapNumDiag(map)    = 0;
+   hypre_IJScatterMapNumOffd(map)    = 0;
+   hypre_IJScatterMapSendData(map)   = NULL;
+   hypre_IJScatterMapRecvData(map)   = NULL;
+   hypre_IJScatterMapCommPkg(map)    = NULL;
+
+   *map_ptr = map;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJScatterMapDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJScatterMapDestroy( hypre_IJScatterMap *map )
+{
+   if (map)
+   {
+      hypre_TFree(hypre_IJScatterMapEntryI(map),    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJScatterMapEntryJ(map),    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJScatterMapEntrySkip(map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJScatterMapSlot(map),      HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJScatterMapSendData(map),  HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJScatterMapRecvData(map),  HYPRE_MEMORY_HOST);
+      if (hypre_IJScatterMapCommPkg(map))
+      {
+         hypre_MatvecCommPkgDestroy(hypre_IJScatterMapCommPkg(map));
+      }
+      hypre_TFree(map, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixFindSlotParCSR
+ *
+ * Returns the slot of (local row, global col) in the diag/offd data of an
+ * assembled matrix, or -1 if the entry is not stored.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixFindSlotParCSR( hypre_IJMatrix *matrix,
+                              HYPRE_Int       row,
+                              HYPRE_BigInt    col )
+{
+   hypre_ParCSRMatrix *par_matrix    = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix    *diag          = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix    *offd          = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int          *diag_i        = hypre_CSRMatrixI(diag);
+   HYPRE_Int          *diag_j        = hypre_CSRMatrixJ(diag);
+   HYPRE_Int          *offd_i        = hypre_CSRMatrixI(offd);
+   HYPRE_Int          *offd_j        = hypre_CSRMatrixJ(offd);
+   HYPRE_Int           num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_BigInt       *col_map_offd  = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_BigInt       *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt        col_0 = col_partitioning[0];
+   HYPRE_BigInt        col_n = col_partitioning[1] - 1;
+   HYPRE_Int           jj, k;
+
+   if (col >= col_0 && col <= col_n)
+   {
+      jj = (HYPRE_Int)(col - col_0);
+      for (k = diag_i[row]; k < diag_i[row + 1]; k++)
+      {
+         if (diag_j[k] == jj)
+         {
+            return k;
+         }
+      }
+   }
+   else if (num_cols_offd)
+   {
+      jj = hypre_BigBinarySearch(col_map_offd, col - hypre_IJMatrixGlobalFirstCol(matrix),
+                                 num_cols_offd);
+      if (jj > -1)
+      {
+         for (k = offd_i[row]; k < offd_i[row + 1]; k++)
+         {
+            if (offd_j[k] == jj)
+            {
+               return diag_i[hypre_CSRMatrixNumRows(diag)] + k;
+            }
+         }
+      }
+   }
+
+   return -1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixRecordValuesParCSR
+ *
+ * Records the (row, col) of the entries of a Set/AddToValues call made while
+ * the scatter map is not built yet.  Values set in rows owned by other
+ * processes are recorded as skipped, since they are not communicated.
+ * The map is shared by all threads, so the calls must not be concurrent.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixRecordValuesParCSR( hypre_IJMatrix       *matrix,
+                                  HYPRE_Int             nrows,
+                                  HYPRE_Int            *ncols,
+                                  const HYPRE_BigInt   *rows,
+                                  const HYPRE_Int      *row_indexes,
+                                  const HYPRE_BigInt   *cols,
+                                  const char           *action )
+{
+   hypre_IJScatterMap *map = hypre_IJMatrixScatterMap(matrix);
+   HYPRE_BigInt       *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_Int           num_entries, max_entries, nelms, i, k;
+   hypre_ulonglongint  hash;
+   char                skip;
+
+   if (hypre_NumActiveThreads() > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Pattern-locked matrices must be set from a single thread!\n");
+      return hypre_error_flag;
+   }
+
+   if (!map)
+   {
+      hypre_IJScatterMapCreate(&map);
+      hypre_IJMatrixScatterMap(matrix) = map;
+   }
+
+   nelms = 0;
+   for (i = 0; i < nrows; i++)
+   {
+      nelms += hypre_max(ncols[i], 0);
+   }
+
+   num_entries = hypre_IJScatterMapNumEntries(map);
+   max_entries = hypre_IJScatterMapMaxEntries(map);
+   if (num_entries + nelms > max_entries)
+   {
+      max_entries = hypre_max(2 * max_entries, num_entries + nelms);
+      hypre_IJScatterMapEntryI(map) = hypre_TReAlloc(hypre_IJScatterMapEntryI(map),
+                                                     HYPRE_BigInt, max_entries, HYPRE_MEMORY_HOST);
+      hypre_IJScatterMapEntryJ(map) = hypre_TReAlloc(hypre_IJScatterMapEntryJ(map),
+                                                     HYPRE_BigInt, max_entries, HYPRE_MEMORY_HOST);
+      hypre_IJScatterMapEntrySkip(map) = hypre_TReAlloc(hypre_IJScatterMapEntrySkip(map),
+                                                        char, max_entries, HYPRE_MEMORY_HOST);
+      hypre_IJScatterMapMaxEntries(map) = max_entries;
+   }
+
+   hash = hypre_IJScatterMapPatternHash(map);
+   for (i = 0; i < nrows; i++)
+   {
+      skip = (action[0] == 's') &&
+             (rows[i] < row_partitioning[0] || rows[i] >= row_partitioning[1]);
+      for (k = 0; k < ncols[i]; k++)
+      {
+         hypre_IJScatterMapEntryI(map)[num_entries]    = rows[i];
+         hypre_IJScatterMapEntryJ(map)[num_entries]    = cols[row_indexes[i] + k];
+         hypre_IJScatterMapEntrySkip(map)[num_entries] = skip;
+         hash = hypre_IJPatternHash(hash, rows[i], cols[row_indexes[i] + k]);
+         num_entries++;
+      }
+   }
+   hypre_IJScatterMapNumEntries(map)  = num_entries;
+   hypre_IJScatterMapPatternHash(map) = hash;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixBuildScatterMapParCSR
+ *
+ * Maps the recorded entries to their slots and sets up the exchange of the
+ * off-processor values.  Called by the first Assemble after the pattern is
+ * locked, once the matrix is assembled.  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixBuildScatterMapParCSR( hypre_IJMatrix *matrix )
+{
+   MPI_Comm             comm       = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRMatrix  *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix     *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix     *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_BigInt        *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt         first_row  = hypre_IJMatrixGlobalFirstRow(matrix);
+   HYPRE_BigInt         global_num_rows = hypre_IJMatrixGlobalNumRows(matrix);
+   hypre_IJScatterMap  *map;
+
+   HYPRE_Int            num_entries, num_local, num_keys, num_uniq, num_uniq_rows;
+   HYPRE_BigInt        *entry_i, *entry_j;
+   char                *entry_skip;
+   HYPRE_Int           *slot;
+   HYPRE_BigInt        *key_i, *key_j, *uniq_j, *uniq_rows;
+   HYPRE_Int           *key_k, *perm, *work, *uniq_row_cnt;
+   HYPRE_Int            num_not_found;
+
+   hypre_IJAssumedPart *apart;
+   hypre_ParCSRCommPkg *row_pkg, *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int            num_sends, num_recvs, num_recv_rows, num_recv_elmts;
+   HYPRE_Int           *send_map_starts, *send_map_elmts, *recv_vec_starts;
+   HYPRE_Int           *recv_row_cnt, *elmt_send_map_starts, *elmt_recv_vec_starts;
+   HYPRE_Int           *elmt_send_map_elmts;
+   HYPRE_BigInt        *recv_cols;
+   HYPRE_Int            i, k, r, c, p;
+
+   if (!hypre_IJMatrixScatterMap(matrix))
+   {
+      hypre_IJScatterMapCreate(&map);
+      hypre_IJMatrixScatterMap(matrix) = map;
+   }
+   map         = hypre_IJMatrixScatterMap(matrix);
+   num_entries = hypre_IJScatterMapNumEntries(map);
+   entry_i     = hypre_IJScatterMapEntryI(map);
+   entry_j     = hypre_IJScatterMapEntryJ(map);
+   entry_skip  = hypre_IJScatterMapEntrySkip(map);
+   num_local   = hypre_CSRMatrixNumNonzeros(diag) + hypre_CSRMatrixNumNonzeros(offd);
+
+   /* slots of the local entries; collect the off-processor ones */
+   slot  = hypre_TAlloc(HYPRE_Int,    num_entries, HYPRE_MEMORY_HOST);
+   key_i = hypre_TAlloc(HYPRE_BigInt, num_entries, HYPRE_MEMORY_HOST);
+   key_j = hypre_TAlloc(HYPRE_BigInt, num_entries, HYPRE_MEMORY_HOST);
+   key_k = hypre_TAlloc(HYPRE_Int,    num_entries, HYPRE_MEMORY_HOST);
+   num_keys = 0;
+   num_not_found = 0;
+   for (k = 0; k < num_entries; k++)
+   {
+      if (entry_skip[k])
+      {
+         slot[k] = -1;
+      }
+      else if (entry_i[k] >= row_partitioning[0] && entry_i[k] < row_partitioning[1])
+      {
+         slot[k] = hypre_IJMatrixFindSlotParCSR(matrix, (HYPRE_Int)(entry_i[k] - row_partitioning[0]),
+                                                entry_j[k]);
+         if (slot[k] < 0)
+         {
+            num_not_found++;
+         }
+      }
+      else
+      {
+         key_i[num_keys] = entry_i[k];
+         key_j[num_keys] = entry_j[k];
+         key_k[num_keys] = k;
+         num_keys++;
+      }
+   }
+
+   /* off-processor entries with the same (row, col) share a send slot;
+      the send slots are ordered by row, hence by owner */
+   perm = hypre_TAlloc(HYPRE_Int, num_keys, HYPRE_MEMORY_HOST);
+   work = hypre_TAlloc(HYPRE_Int, num_keys, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_keys; k++)
+   {
+      perm[k] = k;
+   }
+   hypre_IJSortEntries(num_keys, key_i, key_j, perm, work);
+
+   uniq_j       = hypre_TAlloc(HYPRE_BigInt, num_keys, HYPRE_MEMORY_HOST);
+   uniq_rows    = hypre_TAlloc(HYPRE_BigInt, num_keys, HYPRE_MEMORY_HOST);
+   uniq_row_cnt = hypre_TAlloc(HYPRE_Int,    num_keys, HYPRE_MEMORY_HOST);
+   num_uniq = 0;
+   num_uniq_rows = 0;
+   for (k = 0; k < num_keys; k++)
+   {
+      p = perm[k];
+      if (!k || key_i[p] != key_i[perm[k - 1]] || key_j[p] != key_j[perm[k - 1]])
+      {
+         if (!k || key_i[p] != key_i[perm[k - 1]])
+         {
+            uniq_rows[num_uniq_rows]    = key_i[p] - first_row;
+            uniq_row_cnt[num_uniq_rows] = 0;
+            num_uniq_rows++;
+         }
+         uniq_row_cnt[num_uniq_rows - 1]++;
+         uniq_j[num_uniq++] = key_j[p];
+      }
+      slot[key_k[p]] = num_local + num_uniq - 1;
+   }
+
+   hypre_TFree(key_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(key_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(key_k, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm,  HYPRE_MEMORY_HOST);
+   hypre_TFree(work,  HYPRE_MEMORY_HOST);
+
+   /* find the owners of the off-processor rows; the rows are numbered from
+      zero here, as in a ParCSR matrix */
+   apart = hypre_AssumedPartitionCreate(comm, global_num_rows,
+                                        row_partitioning[0] - first_row,
+                                        row_partitioning[1] - 1 - first_row);
+   row_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgCreateApart(comm, uniq_rows, row_partitioning[0] - first_row,
+                                  num_uniq_rows, global_num_rows, apart, row_pkg);
+   hypre_AssumedPartitionDestroy(apart);
+
+   num_sends       = hypre_ParCSRCommPkgNumSends(row_pkg);
+   num_recvs       = hypre_ParCSRCommPkgNumRecvs(row_pkg);
+   send_map_starts = hypre_ParCSRCommPkgSendMapStarts(row_pkg);
+   send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(row_pkg);
+   recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(row_pkg);
+
+   /* tell the owners how many entries to expect in each row */
+   num_recv_rows = send_map_starts[num_sends];
+   recv_row_cnt  = hypre_CTAlloc(HYPRE_Int, num_recv_rows, HYPRE_MEMORY_HOST);
+   comm_handle = hypre_ParCSRCommHandleCreate(12, row_pkg, uniq_row_cnt, recv_row_cnt);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /* the values are exchanged per entry, with the same neighbors */
+   elmt_send_map_starts = hypre_CTAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+   elmt_recv_vec_starts = hypre_CTAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      elmt_send_map_starts[i + 1] = elmt_send_map_starts[i];
+      for (r = send_map_starts[i]; r < send_map_starts[i + 1]; r++)
+      {
+         elmt_send_map_starts[i + 1] += recv_row_cnt[r];
+      }
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      elmt_recv_vec_starts[i + 1] = elmt_recv_vec_starts[i];
+      for (r = recv_vec_starts[i]; r < recv_vec_starts[i + 1]; r++)
+      {
+         elmt_recv_vec_starts[i + 1] += uniq_row_cnt[r];
+      }
+   }
+   num_recv_elmts = elmt_send_map_starts[num_sends];
+
+   comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgComm(comm_pkg)           = comm;
+   hypre_ParCSRCommPkgNumSends(comm_pkg)       = num_sends;
+   hypre_ParCSRCommPkgSendProcs(comm_pkg)      = hypre_ParCSRCommPkgSendProcs(row_pkg);
+   hypre_ParCSRCommPkgSendMapStarts(comm_pkg)  = elmt_send_map_starts;
+   hypre_ParCSRCommPkgNumRecvs(comm_pkg)       = num_recvs;
+   hypre_ParCSRCommPkgRecvProcs(comm_pkg)      = hypre_ParCSRCommPkgRecvProcs(row_pkg);
+   hypre_ParCSRCommPkgRecvVecStarts(comm_pkg)  = elmt_recv_vec_starts;
+   hypre_ParCSRCommPkgSendProcs(row_pkg) = NULL;
+   hypre_ParCSRCommPkgRecvProcs(row_pkg) = NULL;
+
+   /* send the columns, and find the slots of the received entries */
+   recv_cols = hypre_TAlloc(HYPRE_BigInt, num_recv_elmts, HYPRE_MEMORY_HOST);
+   comm_handle = hypre_ParCSRCommHandleCreate(22, comm_pkg, uniq_j, recv_cols);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   elmt_send_map_elmts = hypre_TAlloc(HYPRE_Int, num_recv_elmts, HYPRE_MEMORY_HOST);
+   k = 0;
+   for (r = 0; r < num_recv_rows; r++)
+   {
+      for (c = 0; c < recv_row_cnt[r]; c++)
+      {
+         elmt_send_map_elmts[k] = hypre_IJMatrixFindSlotParCSR(matrix, send_map_elmts[r],
+                                                               recv_cols[k]);
+         if (elmt_send_map_elmts[k] < 0)
+         {
+            num_not_found++;
+         }
+         k++;
+      }
+   }
+   hypre_ParCSRCommPkgSendMapElmts(comm_pkg) = elmt_send_map_elmts;
+
+   if (num_not_found)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Locked pattern entries not stored in the assembled matrix are ignored!\n");
+   }
+
+   hypre_MatvecCommPkgDestroy(row_pkg);
+   hypre_TFree(uniq_j,       HYPRE_MEMORY_HOST);
+   hypre_TFree(uniq_rows,    HYPRE_MEMORY_HOST);
+   hypre_TFree(uniq_row_cnt, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_row_cnt, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_cols,    HYPRE_MEMORY_HOST);
+
+   /* the recorded entries are no longer needed */
+   hypre_TFree(hypre_IJScatterMapEntryI(map),    HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_IJScatterMapEntryJ(map),    HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_IJScatterMapEntrySkip(map), HYPRE_MEMORY_HOST);
+   hypre_IJScatterMapMaxEntries(map) = 0;
+
+   hypre_IJScatterMapSlot(map)     = slot;
+   hypre_IJScatterMapCursor(map)   = 0;
+   hypre_IJScatterMapCycleHash(map) = hypre_IJ_PATTERN_HASH_INIT;
+   hypre_IJScatterMapNumDiag(map)  = hypre_CSRMatrixNumNonzeros(diag);
+   hypre_IJScatterMapNumOffd(map)  = hypre_CSRMatrixNumNonzeros(offd);
+   hypre_IJScatterMapSendData(map) = hypre_CTAlloc(HYPRE_Complex, num_uniq, HYPRE_MEMORY_HOST);
+   hypre_IJScatterMapRecvData(map) = hypre_TAlloc(HYPRE_Complex, num_recv_elmts, HYPRE_MEMORY_HOST);
+   hypre_IJScatterMapCommPkg(map)  = comm_pkg;
+   hypre_IJScatterMapBuilt(map)    = 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixScatterValuesParCSR
+ *
+ * Writes the values of a Set/AddToValues call directly into the slots of the
+ * next entries of the locked pattern.  The (row, col) of the entries are only
+ * hashed, and checked against the recorded pattern by the next Assemble.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixScatterValuesParCSR( hypre_IJMatrix       *matrix,
+                                   HYPRE_Int             nrows,
+                                   HYPRE_Int            *ncols,
+                                   const HYPRE_BigInt   *rows,
+                                   const HYPRE_Int      *row_indexes,
+                                   const HYPRE_BigInt   *cols,
+                                   const HYPRE_Complex  *values,
+                                   const char           *action )
+{
+   hypre_ParCSRMatrix *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_IJScatterMap *map        = hypre_IJMatrixScatterMap(matrix);
+   HYPRE_Complex      *diag_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(par_matrix));
+   HYPRE_Complex      *offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Complex      *send_data  = hypre_IJScatterMapSendData(map);
+   HYPRE_Int          *slot       = hypre_IJScatterMapSlot(map);
+   HYPRE_Int           num_diag   = hypre_IJScatterMapNumDiag(map);
+   HYPRE_Int           num_local  = num_diag + hypre_IJScatterMapNumOffd(map);
+   HYPRE_Int           cursor     = hypre_IJScatterMapCursor(map);
+   hypre_ulonglongint  hash       = hypre_IJScatterMapCycleHash(map);
+   HYPRE_Int           set        = (action[0] == 's');
+   HYPRE_Int           i, k, s;
+   HYPRE_Complex       value;
+
+   if (hypre_NumActiveThreads() > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Pattern-locked matrices must be set from a single thread!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixSellInvalidate(par_matrix);
+
+   for (i = 0; i < nrows; i++)
+   {
+      if (cursor + hypre_max(ncols[i], 0) > hypre_IJScatterMapNumEntries(map))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "More entries than in the locked pattern!\n");
+         break;
+      }
+
+      for (k = 0; k < ncols[i]; k++)
+      {
+         s = slot[cursor++];
+         value = values[row_indexes[i] + k];
+         hash = hypre_IJPatternHash(hash, rows[i], cols[row_indexes[i] + k]);
+         if (s < 0)
+         {
+            continue;
+         }
+         else if (s < num_diag)
+         {
+            diag_data[s] = set ? value : diag_data[s] + value;
+         }
+         else if (s < num_local)
+         {
+            offd_data[s - num_diag] = set ? value : offd_data[s - num_diag] + value;
+         }
+         else
+         {
+            /* only added values are sent (see hypre_IJMatrixRecordValuesParCSR) */
+            send_data[s - num_local] += value;
+         }
+      }
+   }
+   hypre_IJScatterMapCursor(map)    = cursor;
+   hypre_IJScatterMapCycleHash(map) = hash;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleScatterParCSR
+ *
+ * Assembles a pattern-locked matrix: adds the exchanged off-processor values
+ * into their slots and starts a new cycle.  A cycle that did not repeat the
+ * recorded entries in order is reported as an error; the exchange is still
+ * done, so that all processes stay in step.  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleScatterParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_ParCSRMatrix    *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix       *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix       *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Complex         *diag_data  = hypre_CSRMatrixData(diag);
+   HYPRE_Complex         *offd_data  = hypre_CSRMatrixData(offd);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   hypre_IJScatterMap    *map        = hypre_IJMatrixScatterMap(matrix);
+   hypre_ParCSRCommPkg   *comm_pkg   = hypre_IJScatterMapCommPkg(map);
+   HYPRE_Complex         *send_data  = hypre_IJScatterMapSendData(map);
+   HYPRE_Complex         *recv_data  = hypre_IJScatterMapRecvData(map);
+   HYPRE_Int              num_diag   = hypre_IJScatterMapNumDiag(map);
+   HYPRE_Int              num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int              num_recvs  = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int             *send_map_elmts = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+   HYPRE_Int              num_recv_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   HYPRE_Int              num_send_elmts = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+   HYPRE_Int              i, s;
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
+#else
+   hypre_ParCSRCommHandle           *comm_handle;
+#endif
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (hypre_CSRMatrixNumNonzeros(diag) != num_diag ||
+       hypre_CSRMatrixNumNonzeros(offd) != hypre_IJScatterMapNumOffd(map))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix pattern changed since it was locked!\n");
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_error_flag;
+   }
+
+   if (hypre_IJScatterMapCursor(map) != hypre_IJScatterMapNumEntries(map) ||
+       hypre_IJScatterMapCycleHash(map) != hypre_IJScatterMapPatternHash(map))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Entries set since the last Assemble differ from the locked pattern!\n");
+   }
+
+   hypre_ParCSRMatrixSellInvalidate(par_matrix);
+
+   /* the off-processor values go to the owners of their rows, which is the
+      reverse direction of comm_pkg */
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg);
+   hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, send_data);
+   hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, recv_data);
+#else
+   comm_handle = hypre_ParCSRCommHandleCreate(2, comm_pkg, send_data, recv_data);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
+
+   for (i = 0; i < num_recv_elmts; i++)
+   {
+      s = send_map_elmts[i];
+      if (s < 0)
+      {
+         continue;
+      }
+      else if (s < num_diag)
+      {
+         diag_data[s] += recv_data[i];
+      }
+      else
+      {
+         offd_data[s - num_diag] += recv_data[i];
+      }
+   }
+
+   /* start the next cycle */
+   for (i = 0; i < num_send_elmts; i++)
+   {
+      send_data[i] = 0.0;
+   }
+   hypre_IJScatterMapCursor(map)    = 0;
+   hypre_IJScatterMapCycleHash(map) = hypre_IJ_PATTERN_HASH_INIT;
+
+   hypre_AuxParCSRMatrixDestroy(aux_matrix);
+   hypre_IJMatrixTranslator(matrix) = NULL;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
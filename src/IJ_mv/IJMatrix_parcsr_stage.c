@@ -0,0 +1,806 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * IJMatrix_ParCSR staged (COO) assembly on the host
+ *
+ * With HYPRE_IJMatrixSetStagingFlag, SetValues and AddToValues only append
+ * (row, col, value) triples to a buffer owned by the calling thread.
+ * Assemble then sorts all triples by (row, col) and reduces duplicates in one
+ * pass, following the semantics of hypre_IJMatrixAssembleParCSRDevice:
+ * on-processor, the last "set" wins and later "add"s are summed onto it;
+ * off-processor, only values added after the last "set" are communicated.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+#include "_hypre_parcsr_mv.h"
+
+/* key comparison for hypre_IJSortEntries, I may be NULL */
+#define hypre_IJEntryLess(I, J, a, b) \
+   ( (I) ? ( (I)[a] < (I)[b] || ((I)[a] == (I)[b] && (J)[a] < (J)[b]) ) : ((J)[a] < (J)[b]) )
+
+/*--------------------------------------------------------------------------
+ * hypre_IJSortEntries
+ *
+ * Stable sort of perm[0:n-1] by the keys (I[perm[k]], J[perm[k]]), or by
+ * J[perm[k]] alone if I is NULL.  Bottom-up merge sort on top of insertion
+ * sorted runs.  work has length n.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_IJSortEntries( HYPRE_Int            n,
+                     const HYPRE_BigInt  *I,
+                     const HYPRE_BigInt  *J,
+                     HYPRE_Int           *perm,
+                     HYPRE_Int           *work )
+{
+   const HYPRE_Int  run = 16;
+   HYPRE_Int       *src = perm, *dst = work, *tmp;
+   HYPRE_Int        lo, mid, hi, width, i, j, k, p;
+
+   /* insertion sort runs */
+   for (lo = 0; lo < n; lo += run)
+   {
+      hi = hypre_min(lo + run, n);
+      for (i = lo + 1; i < hi; i++)
+      {
+         p = src[i];
+         for (j = i; j > lo && hypre_IJEntryLess(I, J, p, src[j - 1]); j--)
+         {
+            src[j] = src[j - 1];
+         }
+         src[j] = p;
+      }
+   }
+
+   /* merge runs */
+   for (width = run; width < n; width *= 2)
+   {
+      for (lo = 0; lo < n; lo += 2 * width)
+      {
+         mid = hypre_min(lo + width, n);
+         hi  = hypre_min(lo + 2 * width, n);
+         i = lo; j = mid; k = lo;
+         while (i < mid && j < hi)
+         {
+            /* take from the left run on ties to keep the sort stable */
+            if (hypre_IJEntryLess(I, J, src[j], src[i]))
+            {
+               dst[k++] = src[j++];
+            }
+            else
+            {
+               dst[k++] = src[i++];
+            }
+         }
+         while (i < mid)
+         {
+            dst[k++] = src[i++];
+         }
+         while (j < hi)
+         {
+            dst[k++] = src[j++];
+         }
+      }
+      tmp = src; src = dst; dst = tmp;
+   }
+
+   if (src != perm)
+   {
+      hypre_TMemcpy(perm, src, HYPRE_Int, n, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixStageValuesParCSR
+ *
+ * Appends the entries to the staging buffer of the calling thread.  action
+ * is "set" or "add".  Each thread only touches its own buffer, so this may
+ * be called concurrently from an OpenMP parallel region.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixStageValuesParCSR( hypre_IJMatrix       *matrix,
+                                 HYPRE_Int             nrows,
+                                 HYPRE_Int            *ncols,
+                                 const HYPRE_BigInt   *rows,
+                                 const HYPRE_Int      *row_indexes,
+                                 const HYPRE_BigInt   *cols,
+                                 const HYPRE_Complex  *values,
+                                 const char           *action )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_Int              my_thread_num = hypre_GetThreadNum();
+   char                   sora = (action[0] == 's');
+
+   HYPRE_Int              num_elmts, max_elmts, nelms, i, k, indx;
+   HYPRE_BigInt          *stage_i;
+   HYPRE_BigInt          *stage_j;
+   HYPRE_Complex         *stage_data;
+   char                  *stage_sora;
+
+   if (my_thread_num >= hypre_AuxParCSRMatrixNumStages(aux_matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Number of threads changed since HYPRE_IJMatrixInitialize!\n");
+      return hypre_error_flag;
+   }
+
+   nelms = 0;
+   for (i = 0; i < nrows; i++)
+   {
+      nelms += hypre_max(ncols[i], 0);
+   }
+
+   num_elmts = hypre_AuxParCSRMatrixStageElmts(aux_matrix)[my_thread_num];
+   max_elmts = hypre_AuxParCSRMatrixMaxStageElmts(aux_matrix)[my_thread_num];
+
+   if (num_elmts + nelms > max_elmts)
+   {
+      max_elmts = hypre_max(2 * max_elmts, num_elmts + nelms);
+      hypre_AuxParCSRMatrixStageI(aux_matrix)[my_thread_num] =
+         hypre_TReAlloc(hypre_AuxParCSRMatrixStageI(aux_matrix)[my_thread_num],
+                        HYPRE_BigInt, max_elmts, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixStageJ(aux_matrix)[my_thread_num] =
+         hypre_TReAlloc(hypre_AuxParCSRMatrixStageJ(aux_matrix)[my_thread_num],
+                        HYPRE_BigInt, max_elmts, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixStageData(aux_matrix)[my_thread_num] =
+         hypre_TReAlloc(hypre_AuxParCSRMatrixStageData(aux_matrix)[my_thread_num],
+                        HYPRE_Complex, max_elmts, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixStageSorA(aux_matrix)[my_thread_num] =
+         hypre_TReAlloc(hypre_AuxParCSRMatrixStageSorA(aux_matrix)[my_thread_num],
+                        char, max_elmts, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixMaxStageElmts(aux_matrix)[my_thread_num] = max_elmts;
+   }
+
+   stage_i    = hypre_AuxParCSRMatrixStageI(aux_matrix)[my_thread_num];
+   stage_j    = hypre_AuxParCSRMatrixStageJ(aux_matrix)[my_thread_num];
+   stage_data = hypre_AuxParCSRMatrixStageData(aux_matrix)[my_thread_num];
+   stage_sora = hypre_AuxParCSRMatrixStageSorA(aux_matrix)[my_thread_num];
+
+   for (i = 0; i < nrows; i++)
+   {
+      indx = row_indexes[i];
+      for (k = 0; k < ncols[i]; k++)
+      {
+         stage_i[num_elmts]    = rows[i];
+         stage_j[num_elmts]    = cols[indx + k];
+         stage_data[num_elmts] = values[indx + k];
+         stage_sora[num_elmts] = sora;
+         num_elmts++;
+      }
+   }
+
+   hypre_AuxParCSRMatrixStageElmts(aux_matrix)[my_thread_num] = num_elmts;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleStagedOffProc
+ *
+ * Moves the staged entries of rows owned by other processes out of the
+ * staging buffers, reduces them and sends them to their owners, which stage
+ * them again as "add" (see hypre_IJMatrixAssembleOffProcValsParCSR).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixAssembleStagedOffProc( hypre_IJMatrix *matrix )
+{
+   MPI_Comm               comm       = hypre_IJMatrixComm(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt           row_start  = row_partitioning[0];
+   HYPRE_BigInt           row_end    = row_partitioning[1];
+   HYPRE_Int              num_stages = hypre_AuxParCSRMatrixNumStages(aux_matrix);
+
+   HYPRE_Int             *off_start;
+   HYPRE_Int              num_off, num_off_global, num_red, num_pairs, num_add;
+   HYPRE_BigInt          *off_i, *off_j, *pairs, *red_j;
+   HYPRE_Complex         *off_data, *red_data, value;
+   char                  *off_sora;
+   HYPRE_Int             *perm, *work;
+   HYPRE_Int              s, k, kk, p;
+
+   /* count off-processor entries of each stage */
+   off_start = hypre_CTAlloc(HYPRE_Int, num_stages + 1, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(s, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (s = 0; s < num_stages; s++)
+   {
+      HYPRE_BigInt *stage_i = hypre_AuxParCSRMatrixStageI(aux_matrix)[s];
+      HYPRE_Int     cnt = 0;
+
+      for (k = 0; k < hypre_AuxParCSRMatrixStageElmts(aux_matrix)[s]; k++)
+      {
+         if (stage_i[k] < row_start || stage_i[k] >= row_end)
+         {
+            cnt++;
+         }
+      }
+      off_start[s + 1] = cnt;
+   }
+   for (s = 0; s < num_stages; s++)
+   {
+      off_start[s + 1] += off_start[s];
+   }
+   num_off = off_start[num_stages];
+
+   hypre_MPI_Allreduce(&num_off, &num_off_global, 1, HYPRE_MPI_INT, hypre_MPI_SUM, comm);
+   if (!num_off_global)
+   {
+      hypre_TFree(off_start, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   /* move them out, compacting the on-processor entries in place */
+   off_i    = hypre_TAlloc(HYPRE_BigInt,  num_off, HYPRE_MEMORY_HOST);
+   off_j    = hypre_TAlloc(HYPRE_BigInt,  num_off, HYPRE_MEMORY_HOST);
+   off_data = hypre_TAlloc(HYPRE_Complex, num_off, HYPRE_MEMORY_HOST);
+   off_sora = hypre_TAlloc(char,          num_off, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(s, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (s = 0; s < num_stages; s++)
+   {
+      HYPRE_BigInt  *stage_i    = hypre_AuxParCSRMatrixStageI(aux_matrix)[s];
+      HYPRE_BigInt  *stage_j    = hypre_AuxParCSRMatrixStageJ(aux_matrix)[s];
+      HYPRE_Complex *stage_data = hypre_AuxParCSRMatrixStageData(aux_matrix)[s];
+      char          *stage_sora = hypre_AuxParCSRMatrixStageSorA(aux_matrix)[s];
+      HYPRE_Int      pos = off_start[s], cnt = 0;
+
+      for (k = 0; k < hypre_AuxParCSRMatrixStageElmts(aux_matrix)[s]; k++)
+      {
+         if (stage_i[k] < row_start || stage_i[k] >= row_end)
+         {
+            off_i[pos]    = stage_i[k];
+            off_j[pos]    = stage_j[k];
+            off_data[pos] = stage_data[k];
+            off_sora[pos] = stage_sora[k];
+            pos++;
+         }
+         else
+         {
+            stage_i[cnt]    = stage_i[k];
+            stage_j[cnt]    = stage_j[k];
+            stage_data[cnt] = stage_data[k];
+            stage_sora[cnt] = stage_sora[k];
+            cnt++;
+         }
+      }
+      hypre_AuxParCSRMatrixStageElmts(aux_matrix)[s] = cnt;
+   }
+
+   /* sort by (row, col), stable to preserve the order of the set/add calls */
+   perm = hypre_TAlloc(HYPRE_Int, num_off, HYPRE_MEMORY_HOST);
+   work = hypre_TAlloc(HYPRE_Int, num_off, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_off; k++)
+   {
+      perm[k] = k;
+   }
+   hypre_IJSortEntries(num_off, off_i, off_j, perm, work);
+
+   /* reduce: values up to and including the last set are dropped, entries
+      with no add after that are skipped (explicit zeros are kept); build the
+      (row, count) pairs expected by the exchange */
+   pairs    = hypre_TAlloc(HYPRE_BigInt,  2 * num_off, HYPRE_MEMORY_HOST);
+   red_j    = hypre_TAlloc(HYPRE_BigInt,  num_off, HYPRE_MEMORY_HOST);
+   red_data = hypre_TAlloc(HYPRE_Complex, num_off, HYPRE_MEMORY_HOST);
+   num_red = 0;
+   num_pairs = 0;
+   for (k = 0; k < num_off; k = kk)
+   {
+      p = perm[k];
+      value = 0.0;
+      num_add = 0;
+      for (kk = k; kk < num_off && off_i[perm[kk]] == off_i[p] && off_j[perm[kk]] == off_j[p]; kk++)
+      {
+         if (off_sora[perm[kk]])
+         {
+            value = 0.0;
+            num_add = 0;
+         }
+         else
+         {
+            value += off_data[perm[kk]];
+            num_add++;
+         }
+      }
+
+      if (num_add)
+      {
+         if (!num_pairs || pairs[2 * num_pairs - 2] != off_i[p])
+         {
+            pairs[2 * num_pairs]     = off_i[p];
+            pairs[2 * num_pairs + 1] = 0;
+            num_pairs++;
+         }
+         pairs[2 * num_pairs - 1]++;
+         red_j[num_red]    = off_j[p];
+         red_data[num_red] = value;
+         num_red++;
+      }
+   }
+
+   hypre_IJMatrixAssembleOffProcValsParCSR(matrix, 2 * num_pairs, num_red, num_red,
+                                           HYPRE_MEMORY_HOST, pairs, red_j, red_data);
+
+   hypre_TFree(off_start, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_i,     HYPRE_MEMORY_HOST);
+   hypre_TFree(off_j,     HYPRE_MEMORY_HOST);
+   hypre_TFree(off_data,  HYPRE_MEMORY_HOST);
+   hypre_TFree(off_sora,  HYPRE_MEMORY_HOST);
+   hypre_TFree(perm,      HYPRE_MEMORY_HOST);
+   hypre_TFree(work,      HYPRE_MEMORY_HOST);
+   hypre_TFree(pairs,     HYPRE_MEMORY_HOST);
+   hypre_TFree(red_j,     HYPRE_MEMORY_HOST);
+   hypre_TFree(red_data,  HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleStagedParCSR
+ *
+ * Builds diag and offd from the staged entries (plus the current entries,
+ * if the matrix was assembled before).  The local rows are split into one
+ * contiguous block per thread; the entries are first scattered by block,
+ * then each thread sorts its block by row (counting sort) and each row by
+ * column (stable merge sort), reduces duplicates and writes its rows.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleStagedParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_ParCSRMatrix    *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix;
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt          *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt           row_start = row_partitioning[0];
+   HYPRE_BigInt           col_0     = col_partitioning[0];
+   HYPRE_BigInt           col_n     = col_partitioning[1] - 1;
+   HYPRE_BigInt           base      = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_Int              num_rows  = (HYPRE_Int)(row_partitioning[1] - row_partitioning[0]);
+
+   hypre_CSRMatrix       *diag = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix       *offd = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_MemoryLocation   memory_location = hypre_CSRMatrixMemoryLocation(diag);
+   HYPRE_Int             *diag_i = hypre_CSRMatrixI(diag);
+   HYPRE_Int             *offd_i = hypre_CSRMatrixI(offd);
+   HYPRE_Int             *diag_j, *offd_j = NULL;
+   HYPRE_Complex         *diag_data, *offd_data;
+   HYPRE_BigInt          *big_offd_j, *col_map_offd = NULL, *tmp_j;
+
+   /* sources of entries: the current matrix (if any) and the stages */
+   HYPRE_Int              num_sources, num_stages, num_old;
+   HYPRE_Int             *src_elmts;
+   HYPRE_BigInt         **src_i, **src_j;
+   HYPRE_Complex        **src_data;
+   char                 **src_sora;
+   HYPRE_BigInt          *old_i = NULL, *old_j = NULL;
+   HYPRE_Complex         *old_data = NULL;
+   char                  *old_sora = NULL;
+
+   /* entries grouped by row block, and sorted by row */
+   HYPRE_Int              num_blocks, nnz, nnz_diag, nnz_offd, num_cols_offd;
+   HYPRE_Int             *blk_start, *blk_pos, *blk_diag, *blk_offd;
+   HYPRE_Int             *row_start_pos, *row_fill;
+   HYPRE_Int             *ent_i;
+   HYPRE_BigInt          *ent_j, *sort_j;
+   HYPRE_Complex         *ent_data, *sort_data;
+   char                  *ent_sora, *sort_sora;
+
+   HYPRE_Int              b, s, i, k;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   /* send off-processor entries to their owners */
+   hypre_IJMatrixAssembleStagedOffProc(matrix);
+
+   /* the local blocks are rebuilt below */
+   hypre_ParCSRMatrixSellInvalidate(par_matrix);
+
+   aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   num_stages = hypre_AuxParCSRMatrixNumStages(aux_matrix);
+
+   /* current entries are prepended as "add", with global column indices */
+   num_old = 0;
+   if (hypre_IJMatrixAssembleFlag(matrix))
+   {
+      HYPRE_Int     *old_diag_j    = hypre_CSRMatrixJ(diag);
+      HYPRE_Complex *old_diag_data = hypre_CSRMatrixData(diag);
+      HYPRE_Int     *old_offd_j    = hypre_CSRMatrixJ(offd);
+      HYPRE_Complex *old_offd_data = hypre_CSRMatrixData(offd);
+      HYPRE_BigInt  *old_col_map   = hypre_ParCSRMatrixColMapOffd(par_matrix);
+
+      num_old  = diag_i[num_rows] + offd_i[num_rows];
+      old_i    = hypre_TAlloc(HYPRE_BigInt,  num_old, HYPRE_MEMORY_HOST);
+      old_j    = hypre_TAlloc(HYPRE_BigInt,  num_old, HYPRE_MEMORY_HOST);
+      old_data = hypre_TAlloc(HYPRE_Complex, num_old, HYPRE_MEMORY_HOST);
+      old_sora = hypre_CTAlloc(char,         num_old, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Int pos = diag_i[i] + offd_i[i];
+
+         for (k = diag_i[i]; k < diag_i[i + 1]; k++)
+         {
+            old_i[pos]    = row_start + i;
+            old_j[pos]    = col_0 + old_diag_j[k];
+            old_data[pos] = old_diag_data[k];
+            pos++;
+         }
+         for (k = offd_i[i]; k < offd_i[i + 1]; k++)
+         {
+            old_i[pos]    = row_start + i;
+            old_j[pos]    = old_col_map[old_offd_j[k]] + base;
+            old_data[pos] = old_offd_data[k];
+            pos++;
+         }
+      }
+   }
+
+   num_sources = num_stages + 1;
+   src_elmts = hypre_TAlloc(HYPRE_Int,       num_sources, HYPRE_MEMORY_HOST);
+   src_i     = hypre_TAlloc(HYPRE_BigInt *,  num_sources, HYPRE_MEMORY_HOST);
+   src_j     = hypre_TAlloc(HYPRE_BigInt *,  num_sources, HYPRE_MEMORY_HOST);
+   src_data  = hypre_TAlloc(HYPRE_Complex *, num_sources, HYPRE_MEMORY_HOST);
+   src_sora  = hypre_TAlloc(char *,          num_sources, HYPRE_MEMORY_HOST);
+   src_elmts[0] = num_old;
+   src_i[0]     = old_i;
+   src_j[0]     = old_j;
+   src_data[0]  = old_data;
+   src_sora[0]  = old_sora;
+   for (s = 0; s < num_stages; s++)
+   {
+      src_elmts[s + 1] = hypre_AuxParCSRMatrixStageElmts(aux_matrix)[s];
+      src_i[s + 1]     = hypre_AuxParCSRMatrixStageI(aux_matrix)[s];
+      src_j[s + 1]     = hypre_AuxParCSRMatrixStageJ(aux_matrix)[s];
+      src_data[s + 1]  = hypre_AuxParCSRMatrixStageData(aux_matrix)[s];
+      src_sora[s + 1]  = hypre_AuxParCSRMatrixStageSorA(aux_matrix)[s];
+   }
+
+   /* local row i belongs to block i * num_blocks / num_rows; count the
+      entries of each (block, source) pair, ordered block-major so that each
+      block gets its sources in order (this keeps the set/add order) */
+   num_blocks = hypre_max(hypre_min(hypre_NumThreads(), num_rows), 1);
+   blk_start = hypre_CTAlloc(HYPRE_Int, num_blocks * num_sources + 1, HYPRE_MEMORY_HOST);
+   blk_pos   = hypre_TAlloc(HYPRE_Int,  num_blocks * num_sources,     HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(s, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (s = 0; s < num_sources; s++)
+   {
+      for (k = 0; k < src_elmts[s]; k++)
+      {
+         HYPRE_Int ii = (HYPRE_Int)(src_i[s][k] - row_start);
+
+         blk_start[((HYPRE_BigInt) ii * num_blocks / num_rows) * num_sources + s + 1]++;
+      }
+   }
+   for (k = 0; k < num_blocks * num_sources; k++)
+   {
+      blk_start[k + 1] += blk_start[k];
+      blk_pos[k] = blk_start[k];
+   }
+   nnz = blk_start[num_blocks * num_sources];
+
+   /* scatter into blocks */
+   ent_i     = hypre_TAlloc(HYPRE_Int,     nnz, HYPRE_MEMORY_HOST);
+   ent_j     = hypre_TAlloc(HYPRE_BigInt,  nnz, HYPRE_MEMORY_HOST);
+   ent_data  = hypre_TAlloc(HYPRE_Complex, nnz, HYPRE_MEMORY_HOST);
+   ent_sora  = hypre_TAlloc(char,          nnz, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(s, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (s = 0; s < num_sources; s++)
+   {
+      for (k = 0; k < src_elmts[s]; k++)
+      {
+         HYPRE_Int ii  = (HYPRE_Int)(src_i[s][k] - row_start);
+         HYPRE_Int pos = blk_pos[((HYPRE_BigInt) ii * num_blocks / num_rows) * num_sources + s]++;
+
+         ent_i[pos]    = ii;
+         ent_j[pos]    = src_j[s][k];
+         ent_data[pos] = src_data[s][k];
+         ent_sora[pos] = src_sora[s][k];
+      }
+   }
+
+   hypre_TFree(old_i,     HYPRE_MEMORY_HOST);
+   hypre_TFree(old_j,     HYPRE_MEMORY_HOST);
+   hypre_TFree(old_data,  HYPRE_MEMORY_HOST);
+   hypre_TFree(old_sora,  HYPRE_MEMORY_HOST);
+   hypre_TFree(src_elmts, HYPRE_MEMORY_HOST);
+   hypre_TFree(src_i,     HYPRE_MEMORY_HOST);
+   hypre_TFree(src_j,     HYPRE_MEMORY_HOST);
+   hypre_TFree(src_data,  HYPRE_MEMORY_HOST);
+   hypre_TFree(src_sora,  HYPRE_MEMORY_HOST);
+
+   /* sort and reduce each block; the reduced row i is stored at
+      row_start_pos[i], diagonal block entries first (with the diagonal
+      leading), and its diag/offd lengths are stored in diag_i/offd_i[i+1] */
+   sort_j        = hypre_TAlloc(HYPRE_BigInt,  nnz, HYPRE_MEMORY_HOST);
+   sort_data     = hypre_TAlloc(HYPRE_Complex, nnz, HYPRE_MEMORY_HOST);
+   sort_sora     = hypre_TAlloc(char,          nnz, HYPRE_MEMORY_HOST);
+   row_start_pos = hypre_TAlloc(HYPRE_Int,     num_rows, HYPRE_MEMORY_HOST);
+   row_fill      = hypre_TAlloc(HYPRE_Int,     num_rows, HYPRE_MEMORY_HOST);
+   blk_diag      = hypre_CTAlloc(HYPRE_Int,    num_blocks + 1, HYPRE_MEMORY_HOST);
+   blk_offd      = hypre_CTAlloc(HYPRE_Int,    num_blocks + 1, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(b, i, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (b = 0; b < num_blocks; b++)
+   {
+      HYPRE_Int      ilo = (HYPRE_Int)(((HYPRE_BigInt) b * num_rows + num_blocks - 1) / num_blocks);
+      HYPRE_Int      ihi = (HYPRE_Int)(((HYPRE_BigInt) (b + 1) * num_rows + num_blocks - 1) / num_blocks);
+      HYPRE_Int      klo = blk_start[b * num_sources];
+      HYPRE_Int      khi = blk_start[(b + 1) * num_sources];
+      HYPRE_Int      pos, cnt, len, max_len, nd, no, kk, p;
+      HYPRE_Int     *perm, *work;
+      HYPRE_BigInt   col;
+      HYPRE_Complex  value;
+
+      /* counting sort by row */
+      for (i = ilo; i < ihi; i++)
+      {
+         row_start_pos[i] = 0;
+      }
+      for (k = klo; k < khi; k++)
+      {
+         row_start_pos[ent_i[k]]++;
+      }
+      pos = klo;
+      max_len = 0;
+      for (i = ilo; i < ihi; i++)
+      {
+         cnt = row_start_pos[i];
+         max_len = hypre_max(max_len, cnt);
+         row_start_pos[i] = pos;
+         row_fill[i] = pos;
+         pos += cnt;
+      }
+      for (k = klo; k < khi; k++)
+      {
+         pos = row_fill[ent_i[k]]++;
+         sort_j[pos]    = ent_j[k];
+         sort_data[pos] = ent_data[k];
+         sort_sora[pos] = ent_sora[k];
+      }
+
+      /* sort each row by column and reduce into ent_j/ent_data */
+      perm = hypre_TAlloc(HYPRE_Int, max_len, HYPRE_MEMORY_HOST);
+      work = hypre_TAlloc(HYPRE_Int, max_len, HYPRE_MEMORY_HOST);
+      for (i = ilo; i < ihi; i++)
+      {
+         HYPRE_BigInt  *row_j    = sort_j    + row_start_pos[i];
+         HYPRE_Complex *row_data = sort_data + row_start_pos[i];
+         char          *row_sora = sort_sora + row_start_pos[i];
+         HYPRE_Int      diag_pos = -1;
+
+         len = row_fill[i] - row_start_pos[i];
+         for (k = 0; k < len; k++)
+         {
+            perm[k] = k;
+         }
+         hypre_IJSortEntries(len, NULL, row_j, perm, work);
+
+         /* diag entries go to the front, offd entries to the back of ent_j,
+            the offd ones are reversed again below */
+         nd = 0;
+         no = 0;
+         for (k = 0; k < len; k = kk)
+         {
+            p = perm[k];
+            col = row_j[p];
+            value = 0.0;
+            for (kk = k; kk < len && row_j[perm[kk]] == col; kk++)
+            {
+               if (row_sora[perm[kk]])
+               {
+                  value = row_data[perm[kk]];
+               }
+               else
+               {
+                  value += row_data[perm[kk]];
+               }
+            }
+
+            if (col < col_0 || col > col_n)
+            {
+               pos = row_start_pos[i] + len - 1 - no;
+               no++;
+            }
+            else
+            {
+               pos = row_start_pos[i] + nd;
+               if (col - col_0 == (HYPRE_BigInt) i)
+               {
+                  diag_pos = nd;
+               }
+               nd++;
+            }
+            ent_j[pos]    = col;
+            ent_data[pos] = value;
+         }
+
+         /* move the diagonal to the front */
+         pos = row_start_pos[i];
+         if (diag_pos > 0)
+         {
+            col   = ent_j[pos + diag_pos];
+            value = ent_data[pos + diag_pos];
+            for (k = diag_pos; k > 0; k--)
+            {
+               ent_j[pos + k]    = ent_j[pos + k - 1];
+               ent_data[pos + k] = ent_data[pos + k - 1];
+            }
+            ent_j[pos]    = col;
+            ent_data[pos] = value;
+         }
+
+         /* restore the order of the offd entries and move them right
+            after the diag ones */
+         for (k = 0; k < no / 2; k++)
+         {
+            kk = pos + len - no + k;
+            p  = pos + len - 1 - k;
+            col = ent_j[kk];    ent_j[kk]    = ent_j[p];    ent_j[p]    = col;
+            value = ent_data[kk]; ent_data[kk] = ent_data[p]; ent_data[p] = value;
+         }
+         for (k = 0; k < no; k++)
+         {
+            ent_j[pos + nd + k]    = ent_j[pos + len - no + k];
+            ent_data[pos + nd + k] = ent_data[pos + len - no + k];
+         }
+
+         diag_i[i + 1] = nd;
+         offd_i[i + 1] = no;
+         blk_diag[b + 1] += nd;
+         blk_offd[b + 1] += no;
+      }
+      hypre_TFree(perm, HYPRE_MEMORY_HOST);
+      hypre_TFree(work, HYPRE_MEMORY_HOST);
+   }
+
+   for (b = 0; b < num_blocks; b++)
+   {
+      blk_diag[b + 1] += blk_diag[b];
+      blk_offd[b + 1] += blk_offd[b];
+   }
+   nnz_diag = blk_diag[num_blocks];
+   nnz_offd = blk_offd[num_blocks];
+
+   /* fill diag and offd */
+   diag_j     = hypre_TAlloc(HYPRE_Int,     nnz_diag, memory_location);
+   diag_data  = hypre_TAlloc(HYPRE_Complex, nnz_diag, memory_location);
+   big_offd_j = hypre_TAlloc(HYPRE_BigInt,  nnz_offd, memory_location);
+   offd_data  = hypre_TAlloc(HYPRE_Complex, nnz_offd, memory_location);
+   diag_i[0] = 0;
+   offd_i[0] = 0;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(b, i, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (b = 0; b < num_blocks; b++)
+   {
+      HYPRE_Int ilo = (HYPRE_Int)(((HYPRE_BigInt) b * num_rows + num_blocks - 1) / num_blocks);
+      HYPRE_Int ihi = (HYPRE_Int)(((HYPRE_BigInt) (b + 1) * num_rows + num_blocks - 1) / num_blocks);
+      HYPRE_Int id  = blk_diag[b];
+      HYPRE_Int io  = blk_offd[b];
+      HYPRE_Int nd, no, pos;
+
+      for (i = ilo; i < ihi; i++)
+      {
+         nd  = diag_i[i + 1];
+         no  = offd_i[i + 1];
+         pos = row_start_pos[i];
+         for (k = 0; k < nd; k++)
+         {
+            diag_j[id]    = (HYPRE_Int)(ent_j[pos + k] - col_0);
+            diag_data[id] = ent_data[pos + k];
+            id++;
+         }
+         for (k = nd; k < nd + no; k++)
+         {
+            big_offd_j[io] = ent_j[pos + k];
+            offd_data[io]  = ent_data[pos + k];
+            io++;
+         }
+         diag_i[i + 1] = id;
+         offd_i[i + 1] = io;
+      }
+   }
+
+   hypre_TFree(blk_start,     HYPRE_MEMORY_HOST);
+   hypre_TFree(blk_pos,       HYPRE_MEMORY_HOST);
+   hypre_TFree(blk_diag,      HYPRE_MEMORY_HOST);
+   hypre_TFree(blk_offd,      HYPRE_MEMORY_HOST);
+   hypre_TFree(row_start_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_fill,      HYPRE_MEMORY_HOST);
+   hypre_TFree(ent_i,         HYPRE_MEMORY_HOST);
+   hypre_TFree(ent_j,         HYPRE_MEMORY_HOST);
+   hypre_TFree(ent_data,      HYPRE_MEMORY_HOST);
+   hypre_TFree(ent_sora,      HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_j,        HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_data,     HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_sora,     HYPRE_MEMORY_HOST);
+
+   /* generate col_map_offd */
+   num_cols_offd = 0;
+   if (nnz_offd)
+   {
+      offd_j = hypre_TAlloc(HYPRE_Int,    nnz_offd, memory_location);
+      tmp_j  = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(tmp_j, big_offd_j, HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST, memory_location);
+      hypre_BigQsort0(tmp_j, 0, nnz_offd - 1);
+      num_cols_offd = 1;
+      for (k = 0; k < nnz_offd - 1; k++)
+      {
+         if (tmp_j[k + 1] > tmp_j[k])
+         {
+            tmp_j[num_cols_offd++] = tmp_j[k + 1];
+         }
+      }
+      col_map_offd = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(col_map_offd, tmp_j, HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST,
+                    HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < nnz_offd; k++)
+      {
+         offd_j[k] = hypre_BigBinarySearch(col_map_offd, big_offd_j[k], num_cols_offd);
+      }
+      for (k = 0; k < num_cols_offd; k++)
+      {
+         col_map_offd[k] -= base;
+      }
+      hypre_TFree(tmp_j, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(big_offd_j, memory_location);
+
+   /* replace the local matrices */
+   hypre_TFree(hypre_CSRMatrixJ(diag),    memory_location);
+   hypre_TFree(hypre_CSRMatrixData(diag), memory_location);
+   hypre_TFree(hypre_CSRMatrixJ(offd),    memory_location);
+   hypre_TFree(hypre_CSRMatrixBigJ(offd), memory_location);
+   hypre_TFree(hypre_CSRMatrixData(offd), memory_location);
+   hypre_TFree(hypre_ParCSRMatrixColMapOffd(par_matrix), HYPRE_MEMORY_HOST);
+
+   hypre_CSRMatrixJ(diag)           = diag_j;
+   hypre_CSRMatrixData(diag)        = diag_data;
+   hypre_CSRMatrixNumNonzeros(diag) = nnz_diag;
+   hypre_CSRMatrixJ(offd)           = offd_j;
+   hypre_CSRMatrixData(offd)        = offd_data;
+   hypre_CSRMatrixNumNonzeros(offd) = nnz_offd;
+   hypre_CSRMatrixNumCols(offd)     = num_cols_offd;
+   hypre_ParCSRMatrixColMapOffd(par_matrix) = col_map_offd;
+
+   /* the communication pattern depends on col_map_offd */
+   if (hypre_ParCSRMatrixCommPkg(par_matrix))
+   {
+      hypre_MatvecCommPkgDestroy(hypre_ParCSRMatrixCommPkg(par_matrix));
+      hypre_ParCSRMatrixCommPkg(par_matrix) = NULL;
+   }
+
+   hypre_CSRMatrixSetRownnz(diag);
+   hypre_CSRMatrixSetRownnz(offd);
+
+   hypre_IJMatrixAssembleFlag(matrix) = 1;
+
+   hypre_AuxParCSRMatrixDestroy(aux_matrix);
+   hypre_IJMatrixTranslator(matrix) = NULL;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
@@ -14,6 +14,95 @@
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJScatterMap:
+ *
+ * Destinations of the Set/AddToValues entries of a pattern-locked IJMatrix
+ * (see HYPRE_IJMatrixSetLockPattern).  slot[k] for the k-th entry is
+ *    0 <= slot < num_diag                      : index into diag data
+ *    num_diag <= slot < num_diag + num_offd    : index into offd data
+ *    num_diag + num_offd <= slot               : index into send_data
+ *    -1                                        : entry is ignored
+ * The off-processor values are exchanged with comm_pkg used in reverse
+ * (as in a transpose matvec), its send_map_elmts hold the slots of the
+ * received values.  pattern_hash is an order-dependent hash of the recorded
+ * (row, col) sequence, which each later cycle must reproduce.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* entries recorded until the map is built */
+   HYPRE_Int             num_entries;
+   HYPRE_Int             max_entries;
+   HYPRE_BigInt         *entry_i;
+   HYPRE_BigInt         *entry_j;
+   char                 *entry_skip;     /* not stored in the matrix */
+   hypre_ulonglongint    pattern_hash;
+
+   HYPRE_Int             built;
+   HYPRE_Int            *slot;
+   HYPRE_Int             cursor;         /* next entry of the current cycle */
+   hypre_ulonglongint    cycle_hash;     /* hash of the current cycle so far */
+   HYPRE_Int             num_diag;
+   HYPRE_Int             num_offd;
+   HYPRE_Complex        *send_data;
+   HYPRE_Complex        *recv_data;
+   hypre_ParCSRCommPkg  *comm_pkg;
+
+} hypre_IJScatterMap;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_IJScatterMap
+ *--------------------------------------------------------------------------*/
+
+#define hypre_IJScatterMapNumEntries(map)      ((map) -> num_entries)
+#define hypre_IJScatterMapMaxEntries(map)      ((map) -> max_entries)
+#define hypre_IJScatterMapEntryI(map)          ((map) -> entry_i)
+#define hypre_IJScatterMapEntryJ(map)          ((map) -> entry_j)
+#define hypre_IJScatterMapEntrySkip(map)       ((map) -> entry_skip)
+#define hypre_IJScatterMapPatternHash(map)     ((map) -> pattern_hash)
+#define hypre_IJScatterMapBuilt(map)           ((map) -> built)
+#define hypre_IJScatterMapSlot(map)            ((map) -> slot)
+#define hypre_IJScatterMapCursor(map)          ((map) -> cursor)
+#define hypre_IJScatterMapCycleHash(map)       ((map) -> cycle_hash)
+#define hypre_IJScatterMapNumDiag(map)         ((map) -> num_diag)
+#define hypre_IJScatterMapNumOffd(map)         ((map) -> num_offd)
+#define hypre_IJScatterMapSendData(map)        ((map) -> send_data)
+#define hypre_IJScatterMapRecvData(map)        ((map) -> recv_data)
+#define hypre_IJScatterMapCommPkg(map)         ((map) -> comm_pkg)
+
+/*--------------------------------------------------------------------------
+ * hypre_IJNeighborGraph:
+ *
+ * Processes exchanging off-processor values with this one in an earlier
+ * assembly, as a distributed graph communicator.  The graph is symmetric,
+ * so neighbors are both sources and destinations.  The row ranges owned by
+ * the neighbors are sorted by their first row; range_neighbor gives the
+ * index of the owner in neighbors.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm       comm;
+   HYPRE_Int      num_neighbors;
+   HYPRE_Int     *neighbors;          /* ranks in the matrix communicator */
+   HYPRE_BigInt  *range_starts;
+   HYPRE_BigInt  *range_ends;         /* one past the last row */
+   HYPRE_Int     *range_neighbor;
+
+} hypre_IJNeighborGraph;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_IJNeighborGraph
+ *--------------------------------------------------------------------------*/
+
+#define hypre_IJNeighborGraphComm(graph)           ((graph) -> comm)
+#define hypre_IJNeighborGraphNumNeighbors(graph)   ((graph) -> num_neighbors)
+#define hypre_IJNeighborGraphNeighbors(graph)      ((graph) -> neighbors)
+#define hypre_IJNeighborGraphRangeStarts(graph)    ((graph) -> range_starts)
+#define hypre_IJNeighborGraphRangeEnds(graph)      ((graph) -> range_ends)
+#define hypre_IJNeighborGraphRangeNeighbor(graph)  ((graph) -> range_neighbor)
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -30,6 +119,9 @@ typedef struct hypre_IJMatrix_struct
    void         *translator;          /* optional storage_type specific structure
                                          for holding additional local info */
    void         *assumed_part;        /* IJMatrix assumed partition */
+   hypre_IJNeighborGraph *neighbor_graph; /* off-processor value exchange */
+   HYPRE_Int     num_owner_searches;  /* assemblies that looked up the owners
+                                         of off-processor rows */
    HYPRE_Int     assemble_flag;       /* indicates whether matrix has been
                                          assembled */
 
@@ -38,6 +130,9 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_rows;     /* global partition */
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
+   HYPRE_Int     staging_flag;        /* stage entries in per-thread buffers */
+   HYPRE_Int     lock_pattern;        /* reuse the pattern of the first assembly */
+   hypre_IJScatterMap *scatter_map;
    HYPRE_Int     print_level;
 
 } hypre_IJMatrix;
@@ -54,6 +149,8 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixObject(matrix)           ((matrix) -> object)
 #define hypre_IJMatrixTranslator(matrix)       ((matrix) -> translator)
 #define hypre_IJMatrixAssumedPart(matrix)      ((matrix) -> assumed_part)
+#define hypre_IJMatrixNeighborGraph(matrix)    ((matrix) -> neighbor_graph)
+#define hypre_IJMatrixNumOwnerSearches(matrix) ((matrix) -> num_owner_searches)
 
 #define hypre_IJMatrixAssembleFlag(matrix)     ((matrix) -> assemble_flag)
 
@@ -62,6 +159,9 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumRows(matrix)    ((matrix) -> global_num_rows)
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
+#define hypre_IJMatrixStagingFlag(matrix)      ((matrix) -> staging_flag)
+#define hypre_IJMatrixLockPattern(matrix)      ((matrix) -> lock_pattern)
+#define hypre_IJMatrixScatterMap(matrix)       ((matrix) -> scatter_map)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
 
 static inline HYPRE_MemoryLocation
@@ -75,6 +175,31 @@ hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+/* nonzero if Set/AddToValues go to the per-thread staging buffers */
+static inline HYPRE_Int
+hypre_IJMatrixStaging(hypre_IJMatrix *matrix)
+{
+   hypre_AuxParCSRMatrix *aux_matrix;
+
+   if ( !hypre_IJMatrixStagingFlag(matrix) || hypre_IJMatrixObjectType(matrix) != HYPRE_PARCSR )
+   {
+      return 0;
+   }
+
+   aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+
+   return ( aux_matrix && hypre_AuxParCSRMatrixNumStages(aux_matrix) > 0 );
+}
+
+/* nonzero if Set/AddToValues write through the scatter map */
+static inline HYPRE_Int
+hypre_IJMatrixPatternLocked(hypre_IJMatrix *matrix)
+{
+   hypre_IJScatterMap *map = hypre_IJMatrixScatterMap(matrix);
+
+   return ( hypre_IJMatrixLockPattern(matrix) && map && hypre_IJScatterMapBuilt(map) );
+}
+
 /*--------------------------------------------------------------------------
  * prototypes for operations on local objects
  *--------------------------------------------------------------------------*/
@@ -80,6 +80,16 @@ typedef struct
 
    HYPRE_MemoryLocation memory_location;
 
+   /* per-thread staging buffers for host COO assembly
+      (see HYPRE_IJMatrixSetStagingFlag) */
+   HYPRE_Int            num_stages;              /* number of staging buffers */
+   HYPRE_Int           *stage_elmts;             /* current no. of elements in each buffer */
+   HYPRE_Int           *max_stage_elmts;         /* allocated length of each buffer */
+   HYPRE_BigInt       **stage_i;                 /* global row indices */
+   HYPRE_BigInt       **stage_j;                 /* global column indices */
+   HYPRE_Complex      **stage_data;
+   char               **stage_sora;              /* Set (1) or Add (0) */
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_Int            max_stack_elmts;
    HYPRE_Int            current_stack_elmts;
@@ -124,6 +134,14 @@ typedef struct
 
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
+#define hypre_AuxParCSRMatrixNumStages(matrix)            ((matrix) -> num_stages)
+#define hypre_AuxParCSRMatrixStageElmts(matrix)           ((matrix) -> stage_elmts)
+#define hypre_AuxParCSRMatrixMaxStageElmts(matrix)        ((matrix) -> max_stage_elmts)
+#define hypre_AuxParCSRMatrixStageI(matrix)               ((matrix) -> stage_i)
+#define hypre_AuxParCSRMatrixStageJ(matrix)               ((matrix) -> stage_j)
+#define hypre_AuxParCSRMatrixStageData(matrix)            ((matrix) -> stage_data)
+#define hypre_AuxParCSRMatrixStageSorA(matrix)            ((matrix) -> stage_sora)
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
 #define hypre_AuxParCSRMatrixMaxStackElmts(matrix)        ((matrix) -> max_stack_elmts)
 #define hypre_AuxParCSRMatrixCurrentStackElmts(matrix)    ((matrix) -> current_stack_elmts)
@@ -221,6 +239,95 @@ typedef struct
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJScatterMap:
+ *
+ * Destinations of the Set/AddToValues entries of a pattern-locked IJMatrix
+ * (see HYPRE_IJMatrixSetLockPattern).  slot[k] for the k-th entry is
+ *    0 <= slot < num_diag                      : index into diag data
+ *    num_diag <= slot < num_diag + num_offd    : index into offd data
+ *    num_diag + num_offd <= slot               : index into send_data
+ *    -1                                        : entry is ignored
+ * The off-processor values are exchanged with comm_pkg used in reverse
+ * (as in a transpose matvec), its send_map_elmts hold the slots of the
+ * received values.  pattern_hash is an order-dependent hash of the recorded
+ * (row, col) sequence, which each later cycle must reproduce.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* entries recorded until the map is built */
+   HYPRE_Int             num_entries;
+   HYPRE_Int             max_entries;
+   HYPRE_BigInt         *entry_i;
+   HYPRE_BigInt         *entry_j;
+   char                 *entry_skip;     /* not stored in the matrix */
+   hypre_ulonglongint    pattern_hash;
+
+   HYPRE_Int             built;
+   HYPRE_Int            *slot;
+   HYPRE_Int             cursor;         /* next entry of the current cycle */
+   hypre_ulonglongint    cycle_hash;     /* hash of the current cycle so far */
+   HYPRE_Int             num_diag;
+   HYPRE_Int             num_offd;
+   HYPRE_Complex        *send_data;
+   HYPRE_Complex        *recv_data;
+   hypre_ParCSRCommPkg  *comm_pkg;
+
+} hypre_IJScatterMap;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_IJScatterMap
+ *--------------------------------------------------------------------------*/
+
+#define hypre_IJScatterMapNumEntries(map)      ((map) -> num_entries)
+#define hypre_IJScatterMapMaxEntries(map)      ((map) -> max_entries)
+#define hypre_IJScatterMapEntryI(map)          ((map) -> entry_i)
+#define hypre_IJScatterMapEntryJ(map)          ((map) -> entry_j)
+#define hypre_IJScatterMapEntrySkip(map)       ((map) -> entry_skip)
+#define hypre_IJScatterMapPatternHash(map)     ((map) -> pattern_hash)
+#define hypre_IJScatterMapBuilt(map)           ((map) -> built)
+#define hypre_IJScatterMapSlot(map)            ((map) -> slot)
+#define hypre_IJScatterMapCursor(map)          ((map) -> cursor)
+#define hypre_IJScatterMapCycleHash(map)       ((map) -> cycle_hash)
+#define hypre_IJScatterMapNumDiag(map)         ((map) -> num_diag)
+#define hypre_IJScatterMapNumOffd(map)         ((map) -> num_offd)
+#define hypre_IJScatterMapSendData(map)        ((map) -> send_data)
+#define hypre_IJScatterMapRecvData(map)        ((map) -> recv_data)
+#define hypre_IJScatterMapCommPkg(map)         ((map) -> comm_pkg)
+
+/*--------------------------------------------------------------------------
+ * hypre_IJNeighborGraph:
+ *
+ * Processes exchanging off-processor values with this one in an earlier
+ * assembly, as a distributed graph communicator.  The graph is symmetric,
+ * so neighbors are both sources and destinations.  The row ranges owned by
+ * the neighbors are sorted by their first row; range_neighbor gives the
+ * index of the owner in neighbors.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm       comm;
+   HYPRE_Int      num_neighbors;
+   HYPRE_Int     *neighbors;          /* ranks in the matrix communicator */
+   HYPRE_BigInt  *range_starts;
+   HYPRE_BigInt  *range_ends;         /* one past the last row */
+   HYPRE_Int     *range_neighbor;
+
+} hypre_IJNeighborGraph;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_IJNeighborGraph
+ *--------------------------------------------------------------------------*/
+
+#define hypre_IJNeighborGraphComm(graph)           ((graph) -> comm)
+#define hypre_IJNeighborGraphNumNeighbors(graph)   ((graph) -> num_neighbors)
+#define hypre_IJNeighborGraphNeighbors(graph)      ((graph) -> neighbors)
+#define hypre_IJNeighborGraphRangeStarts(graph)    ((graph) -> range_starts)
+#define hypre_IJNeighborGraphRangeEnds(graph)      ((graph) -> range_ends)
+#define hypre_IJNeighborGraphRangeNeighbor(graph)  ((graph) -> range_neighbor)
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -237,6 +344,9 @@ typedef struct hypre_IJMatrix_struct
    void         *translator;          /* optional storage_type specific structure
                                          for holding additional local info */
    void         *assumed_part;        /* IJMatrix assumed partition */
+   hypre_IJNeighborGraph *neighbor_graph; /* off-processor value exchange */
+   HYPRE_Int     num_owner_searches;  /* assemblies that looked up the owners
+                                         of off-processor rows */
    HYPRE_Int     assemble_flag;       /* indicates whether matrix has been
                                          assembled */
 
@@ -245,6 +355,9 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_rows;     /* global partition */
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
+   HYPRE_Int     staging_flag;        /* stage entries in per-thread buffers */
+   HYPRE_Int     lock_pattern;        /* reuse the pattern of the first assembly */
+   hypre_IJScatterMap *scatter_map;
    HYPRE_Int     print_level;
 
 } hypre_IJMatrix;
@@ -261,6 +374,8 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixObject(matrix)           ((matrix) -> object)
 #define hypre_IJMatrixTranslator(matrix)       ((matrix) -> translator)
 #define hypre_IJMatrixAssumedPart(matrix)      ((matrix) -> assumed_part)
+#define hypre_IJMatrixNeighborGraph(matrix)    ((matrix) -> neighbor_graph)
+#define hypre_IJMatrixNumOwnerSearches(matrix) ((matrix) -> num_owner_searches)
 
 #define hypre_IJMatrixAssembleFlag(matrix)     ((matrix) -> assemble_flag)
 
@@ -269,6 +384,9 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumRows(matrix)    ((matrix) -> global_num_rows)
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
+#define hypre_IJMatrixStagingFlag(matrix)      ((matrix) -> staging_flag)
+#define hypre_IJMatrixLockPattern(matrix)      ((matrix) -> lock_pattern)
+#define hypre_IJMatrixScatterMap(matrix)       ((matrix) -> scatter_map)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
 
 static inline HYPRE_MemoryLocation
@@ -282,6 +400,31 @@ hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+/* nonzero if Set/AddToValues go to the per-thread staging buffers */
+static inline HYPRE_Int
+hypre_IJMatrixStaging(hypre_IJMatrix *matrix)
+{
+   hypre_AuxParCSRMatrix *aux_matrix;
+
+   if ( !hypre_IJMatrixStagingFlag(matrix) || hypre_IJMatrixObjectType(matrix) != HYPRE_PARCSR )
+   {
+      return 0;
+   }
+
+   aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+
+   return ( aux_matrix && hypre_AuxParCSRMatrixNumStages(aux_matrix) > 0 );
+}
+
+/* nonzero if Set/AddToValues write through the scatter map */
+static inline HYPRE_Int
+hypre_IJMatrixPatternLocked(hypre_IJMatrix *matrix)
+{
+   hypre_IJScatterMap *map = hypre_IJMatrixScatterMap(matrix);
+
+   return ( hypre_IJMatrixLockPattern(matrix) && map && hypre_IJScatterMapBuilt(map) );
+}
+
 /*--------------------------------------------------------------------------
  * prototypes for operations on local objects
  *--------------------------------------------------------------------------*/
@@ -387,6 +530,8 @@ HYPRE_Int hypre_AuxParCSRMatrixSetRownnz ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix,
                                               HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_AuxParCSRMatrixInitializeStages ( hypre_AuxParCSRMatrix *matrix,
+                                                  HYPRE_Int num_stages );
 
 /* aux_par_vector.c */
 HYPRE_Int hypre_AuxParVectorCreate ( hypre_AuxParVector **aux_vector );
@@ -457,6 +602,7 @@ HYPRE_Int hypre_IJMatrixTransposeParCSR ( hypre_IJMatrix  *matrix_A, hypre_IJMat
 HYPRE_Int hypre_IJMatrixNormParCSR ( hypre_IJMatrix *matrix, HYPRE_Real *norm );
 HYPRE_Int hypre_IJMatrixAddParCSR ( HYPRE_Complex alpha, hypre_IJMatrix *matrix_A,
                                     HYPRE_Complex beta, hypre_IJMatrix *matrix_B, hypre_IJMatrix *matrix_C );
+HYPRE_Int hypre_IJNeighborGraphDestroy ( hypre_IJNeighborGraph *graph );
 HYPRE_Int hypre_IJMatrixAssembleOffProcValsParCSR ( hypre_IJMatrix *matrix,
                                                     HYPRE_Int off_proc_i_indx, HYPRE_Int max_off_proc_elmts, HYPRE_Int current_num_elmts,
                                                     HYPRE_MemoryLocation memory_location, HYPRE_BigInt *off_proc_i, HYPRE_BigInt *off_proc_j,
@@ -478,6 +624,32 @@ HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix,
 HYPRE_Int hypre_IJMatrixSetConstantValuesParCSRDevice( hypre_IJMatrix *matrix,
                                                        HYPRE_Complex value );
 
+/* IJMatrix_mm.c */
+HYPRE_Int hypre_IJMatrixReadMMEntries ( MPI_Comm comm, const char *filename,
+                                        HYPRE_BigInt *num_rows_ptr, HYPRE_BigInt *num_cols_ptr,
+                                        HYPRE_Int *num_entries_ptr, HYPRE_BigInt **rows_ptr,
+                                        HYPRE_BigInt **cols_ptr, HYPRE_Complex **values_ptr );
+
+/* IJMatrix_parcsr_stage.c */
+void hypre_IJSortEntries ( HYPRE_Int n, const HYPRE_BigInt *I, const HYPRE_BigInt *J,
+                           HYPRE_Int *perm, HYPRE_Int *work );
+HYPRE_Int hypre_IJMatrixStageValuesParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                            HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
+                                            const HYPRE_Complex *values, const char *action );
+HYPRE_Int hypre_IJMatrixAssembleStagedParCSR ( hypre_IJMatrix *matrix );
+
+/* IJMatrix_parcsr_pattern.c */
+HYPRE_Int hypre_IJScatterMapCreate ( hypre_IJScatterMap **map_ptr );
+HYPRE_Int hypre_IJScatterMapDestroy ( hypre_IJScatterMap *map );
+HYPRE_Int hypre_IJMatrixRecordValuesParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                             HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
+                                             const char *action );
+HYPRE_Int hypre_IJMatrixBuildScatterMapParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixScatterValuesParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                              HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
+                                              const HYPRE_Complex *values, const char *action );
+HYPRE_Int hypre_IJMatrixAssembleScatterParCSR ( hypre_IJMatrix *matrix );
+
 /* IJMatrix_petsc.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizePETSc ( hypre_IJMatrix *matrix, HYPRE_Int local_m,
                                             HYPRE_Int local_n );
@@ -558,7 +730,14 @@ HYPRE_Int HYPRE_IJMatrixSetMaxOffProcElmts ( HYPRE_IJMatrix matrix, HYPRE_Int ma
 HYPRE_Int HYPRE_IJMatrixRead ( const char *filename, MPI_Comm comm, HYPRE_Int type,
                                HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix, const char *filename );
+HYPRE_Int HYPRE_IJMatrixReadBinary ( const char *filename, MPI_Comm comm, HYPRE_Int type,
+                                     HYPRE_IJMatrix *matrix_ptr );
+HYPRE_Int HYPRE_IJMatrixPrintBinary ( HYPRE_IJMatrix matrix, const char *filename );
+HYPRE_Int HYPRE_IJMatrixReadMM ( const char *filename, MPI_Comm comm, HYPRE_Int type,
+                                 HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix, HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetStagingFlag ( HYPRE_IJMatrix matrix, HYPRE_Int staging_flag );
+HYPRE_Int HYPRE_IJMatrixSetLockPattern ( HYPRE_IJMatrix matrix, HYPRE_Int lock_pattern );
 HYPRE_Int HYPRE_IJMatrixTranspose ( HYPRE_IJMatrix  matrix_A, HYPRE_IJMatrix *matrix_AT );
 HYPRE_Int HYPRE_IJMatrixNorm ( HYPRE_IJMatrix matrix, HYPRE_Real *norm );
 HYPRE_Int HYPRE_IJMatrixAdd ( HYPRE_Complex alpha, HYPRE_IJMatrix matrix_A, HYPRE_Complex beta,
@@ -586,6 +765,9 @@ HYPRE_Int HYPRE_IJVectorGetObject ( HYPRE_IJVector vector, void **object );
 HYPRE_Int HYPRE_IJVectorRead ( const char *filename, MPI_Comm comm, HYPRE_Int type,
                                HYPRE_IJVector *vector_ptr );
 HYPRE_Int HYPRE_IJVectorPrint ( HYPRE_IJVector vector, const char *filename );
+HYPRE_Int HYPRE_IJVectorReadBinary ( const char *filename, MPI_Comm comm, HYPRE_Int type,
+                                     HYPRE_IJVector *vector_ptr );
+HYPRE_Int HYPRE_IJVectorPrintBinary ( HYPRE_IJVector vector, const char *filename );
 
 #ifdef __cplusplus
 }
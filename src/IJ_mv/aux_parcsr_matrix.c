@@ -52,6 +52,14 @@ hypre_AuxParCSRMatrixCreate( hypre_AuxParCSRMatrix **aux_matrix,
    hypre_AuxParCSRMatrixOffProcJ(matrix) = NULL;
    hypre_AuxParCSRMatrixOffProcData(matrix) = NULL;
    hypre_AuxParCSRMatrixMemoryLocation(matrix) = HYPRE_MEMORY_HOST;
+   /* per-thread staging buffers */
+   hypre_AuxParCSRMatrixNumStages(matrix) = 0;
+   hypre_AuxParCSRMatrixStageElmts(matrix) = NULL;
+   hypre_AuxParCSRMatrixMaxStageElmts(matrix) = NULL;
+   hypre_AuxParCSRMatrixStageI(matrix) = NULL;
+   hypre_AuxParCSRMatrixStageJ(matrix) = NULL;
+   hypre_AuxParCSRMatrixStageData(matrix) = NULL;
+   hypre_AuxParCSRMatrixStageSorA(matrix) = NULL;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    hypre_AuxParCSRMatrixMaxStackElmts(matrix) = 0;
    hypre_AuxParCSRMatrixCurrentStackElmts(matrix) = 0;
@@ -142,6 +150,20 @@ hypre_AuxParCSRMatrixDestroy( hypre_AuxParCSRMatrix *matrix )
       hypre_TFree(hypre_AuxParCSRMatrixOffProcJ(matrix),    HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_AuxParCSRMatrixOffProcData(matrix), HYPRE_MEMORY_HOST);
 
+      for (i = 0; i < hypre_AuxParCSRMatrixNumStages(matrix); i++)
+      {
+         hypre_TFree(hypre_AuxParCSRMatrixStageI(matrix)[i],    HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AuxParCSRMatrixStageJ(matrix)[i],    HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AuxParCSRMatrixStageData(matrix)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AuxParCSRMatrixStageSorA(matrix)[i], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_AuxParCSRMatrixStageElmts(matrix),    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixMaxStageElmts(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixStageI(matrix),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixStageJ(matrix),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixStageData(matrix),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixStageSorA(matrix),     HYPRE_MEMORY_HOST);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
       hypre_TFree(hypre_AuxParCSRMatrixStackI(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
       hypre_TFree(hypre_AuxParCSRMatrixStackJ(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
@@ -384,3 +406,55 @@ hypre_AuxParCSRMatrixInitialize(hypre_AuxParCSRMatrix *matrix)
 
    return -2;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_AuxParCSRMatrixInitializeStages
+ *
+ * Allocates num_stages empty staging buffers, one per thread.  Buffers that
+ * already exist are kept.  Must not be called from a parallel region.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AuxParCSRMatrixInitializeStages( hypre_AuxParCSRMatrix *matrix,
+                                       HYPRE_Int              num_stages )
+{
+   HYPRE_Int  old_num_stages = hypre_AuxParCSRMatrixNumStages(matrix);
+   HYPRE_Int  i;
+
+   if (num_stages <= old_num_stages)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_AuxParCSRMatrixStageElmts(matrix) =
+      hypre_TReAlloc(hypre_AuxParCSRMatrixStageElmts(matrix), HYPRE_Int, num_stages,
+                     HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixMaxStageElmts(matrix) =
+      hypre_TReAlloc(hypre_AuxParCSRMatrixMaxStageElmts(matrix), HYPRE_Int, num_stages,
+                     HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixStageI(matrix) =
+      hypre_TReAlloc(hypre_AuxParCSRMatrixStageI(matrix), HYPRE_BigInt *, num_stages,
+                     HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixStageJ(matrix) =
+      hypre_TReAlloc(hypre_AuxParCSRMatrixStageJ(matrix), HYPRE_BigInt *, num_stages,
+                     HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixStageData(matrix) =
+      hypre_TReAlloc(hypre_AuxParCSRMatrixStageData(matrix), HYPRE_Complex *, num_stages,
+                     HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixStageSorA(matrix) =
+      hypre_TReAlloc(hypre_AuxParCSRMatrixStageSorA(matrix), char *, num_stages,
+                     HYPRE_MEMORY_HOST);
+
+   for (i = old_num_stages; i < num_stages; i++)
+   {
+      hypre_AuxParCSRMatrixStageElmts(matrix)[i]    = 0;
+      hypre_AuxParCSRMatrixMaxStageElmts(matrix)[i] = 0;
+      hypre_AuxParCSRMatrixStageI(matrix)[i]        = NULL;
+      hypre_AuxParCSRMatrixStageJ(matrix)[i]        = NULL;
+      hypre_AuxParCSRMatrixStageData(matrix)[i]     = NULL;
+      hypre_AuxParCSRMatrixStageSorA(matrix)[i]     = NULL;
+   }
+   hypre_AuxParCSRMatrixNumStages(matrix) = num_stages;
+
+   return hypre_error_flag;
+}
@@ -65,6 +65,16 @@ typedef struct
 
    HYPRE_MemoryLocation memory_location;
 
+   /* per-thread staging buffers for host COO assembly
+      (see HYPRE_IJMatrixSetStagingFlag) */
+   HYPRE_Int            num_stages;              /* number of staging buffers */
+   HYPRE_Int           *stage_elmts;             /* current no. of elements in each buffer */
+   HYPRE_Int           *max_stage_elmts;         /* allocated length of each buffer */
+   HYPRE_BigInt       **stage_i;                 /* global row indices */
+   HYPRE_BigInt       **stage_j;                 /* global column indices */
+   HYPRE_Complex      **stage_data;
+   char               **stage_sora;              /* Set (1) or Add (0) */
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_Int            max_stack_elmts;
    HYPRE_Int            current_stack_elmts;
@@ -109,6 +119,14 @@ typedef struct
 
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
+#define hypre_AuxParCSRMatrixNumStages(matrix)            ((matrix) -> num_stages)
+#define hypre_AuxParCSRMatrixStageElmts(matrix)           ((matrix) -> stage_elmts)
+#define hypre_AuxParCSRMatrixMaxStageElmts(matrix)        ((matrix) -> max_stage_elmts)
+#define hypre_AuxParCSRMatrixStageI(matrix)               ((matrix) -> stage_i)
+#define hypre_AuxParCSRMatrixStageJ(matrix)               ((matrix) -> stage_j)
+#define hypre_AuxParCSRMatrixStageData(matrix)            ((matrix) -> stage_data)
+#define hypre_AuxParCSRMatrixStageSorA(matrix)            ((matrix) -> stage_sora)
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
 #define hypre_AuxParCSRMatrixMaxStackElmts(matrix)        ((matrix) -> max_stack_elmts)
 #define hypre_AuxParCSRMatrixCurrentStackElmts(matrix)    ((matrix) -> current_stack_elmts)
@@ -13,6 +13,8 @@ HYPRE_Int hypre_AuxParCSRMatrixSetRownnz ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix,
                                               HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_AuxParCSRMatrixInitializeStages ( hypre_AuxParCSRMatrix *matrix,
+                                                  HYPRE_Int num_stages );
 
 /* aux_par_vector.c */
 HYPRE_Int hypre_AuxParVectorCreate ( hypre_AuxParVector **aux_vector );
@@ -83,6 +85,7 @@ HYPRE_Int hypre_IJMatrixTransposeParCSR ( hypre_IJMatrix  *matrix_A, hypre_IJMat
 HYPRE_Int hypre_IJMatrixNormParCSR ( hypre_IJMatrix *matrix, HYPRE_Real *norm );
 HYPRE_Int hypre_IJMatrixAddParCSR ( HYPRE_Complex alpha, hypre_IJMatrix *matrix_A,
                                     HYPRE_Complex beta, hypre_IJMatrix *matrix_B, hypre_IJMatrix *matrix_C );
+HYPRE_Int hypre_IJNeighborGraphDestroy ( hypre_IJNeighborGraph *graph );
 HYPRE_Int hypre_IJMatrixAssembleOffProcValsParCSR ( hypre_IJMatrix *matrix,
                                                     HYPRE_Int off_proc_i_indx, HYPRE_Int max_off_proc_elmts, HYPRE_Int current_num_elmts,
                                                     HYPRE_MemoryLocation memory_location, HYPRE_BigInt *off_proc_i, HYPRE_BigInt *off_proc_j,
@@ -104,6 +107,32 @@ HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix,
 HYPRE_Int hypre_IJMatrixSetConstantValuesParCSRDevice( hypre_IJMatrix *matrix,
                                                        HYPRE_Complex value );
 
+/* IJMatrix_mm.c */
+HYPRE_Int hypre_IJMatrixReadMMEntries ( MPI_Comm comm, const char *filename,
+                                        HYPRE_BigInt *num_rows_ptr, HYPRE_BigInt *num_cols_ptr,
+                                        HYPRE_Int *num_entries_ptr, HYPRE_BigInt **rows_ptr,
+                                        HYPRE_BigInt **cols_ptr, HYPRE_Complex **values_ptr );
+
+/* IJMatrix_parcsr_stage.c */
+void hypre_IJSortEntries ( HYPRE_Int n, const HYPRE_BigInt *I, const HYPRE_BigInt *J,
+                           HYPRE_Int *perm, HYPRE_Int *work );
+HYPRE_Int hypre_IJMatrixStageValuesParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                            HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
+                                            const HYPRE_Complex *values, const char *action );
+HYPRE_Int hypre_IJMatrixAssembleStagedParCSR ( hypre_IJMatrix *matrix );
+
+/* IJMatrix_parcsr_pattern.c */
+HYPRE_Int hypre_IJScatterMapCreate ( hypre_IJScatterMap **map_ptr );
+HYPRE_Int hypre_IJScatterMapDestroy ( hypre_IJScatterMap *map );
+HYPRE_Int hypre_IJMatrixRecordValuesParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                             HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
+                                             const char *action );
+HYPRE_Int hypre_IJMatrixBuildScatterMapParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixScatterValuesParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                              HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
+                                              const HYPRE_Complex *values, const char *action );
+HYPRE_Int hypre_IJMatrixAssembleScatterParCSR ( hypre_IJMatrix *matrix );
+
 /* IJMatrix_petsc.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizePETSc ( hypre_IJMatrix *matrix, HYPRE_Int local_m,
                                             HYPRE_Int local_n );
@@ -184,7 +213,14 @@ HYPRE_Int HYPRE_IJMatrixSetMaxOffProcElmts ( HYPRE_IJMatrix matrix, HYPRE_Int ma
 HYPRE_Int HYPRE_IJMatrixRead ( const char *filename, MPI_Comm comm, HYPRE_Int type,
                                HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix, const char *filename );
+HYPRE_Int HYPRE_IJMatrixReadBinary ( const char *filename, MPI_Comm comm, HYPRE_Int type,
+                                     HYPRE_IJMatrix *matrix_ptr );
+HYPRE_Int HYPRE_IJMatrixPrintBinary ( HYPRE_IJMatrix matrix, const char *filename );
+HYPRE_Int HYPRE_IJMatrixReadMM ( const char *filename, MPI_Comm comm, HYPRE_Int type,
+                                 HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix, HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetStagingFlag ( HYPRE_IJMatrix matrix, HYPRE_Int staging_flag );
+HYPRE_Int HYPRE_IJMatrixSetLockPattern ( HYPRE_IJMatrix matrix, HYPRE_Int lock_pattern );
 HYPRE_Int HYPRE_IJMatrixTranspose ( HYPRE_IJMatrix  matrix_A, HYPRE_IJMatrix *matrix_AT );
 HYPRE_Int HYPRE_IJMatrixNorm ( HYPRE_IJMatrix matrix, HYPRE_Real *norm );
 HYPRE_Int HYPRE_IJMatrixAdd ( HYPRE_Complex alpha, HYPRE_IJMatrix matrix_A, HYPRE_Complex beta,
@@ -212,3 +248,6 @@ HYPRE_Int HYPRE_IJVectorGetObject ( HYPRE_IJVector vector, void **object );
 HYPRE_Int HYPRE_IJVectorRead ( const char *filename, MPI_Comm comm, HYPRE_Int type,
                                HYPRE_IJVector *vector_ptr );
 HYPRE_Int HYPRE_IJVectorPrint ( HYPRE_IJVector vector, const char *filename );
+HYPRE_Int HYPRE_IJVectorReadBinary ( const char *filename, MPI_Comm comm, HYPRE_Int type,
+                                     HYPRE_IJVector *vector_ptr );
+HYPRE_Int HYPRE_IJVectorPrintBinary ( HYPRE_IJVector vector, const char *filename );
@@ -286,6 +286,158 @@ HYPRE_Int HYPRE_PCGGetConverged(HYPRE_Solver  solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Pipelined PCG Solver
+ *
+ * Pipelined preconditioned conjugate gradient (Ghysels and Vanroose).  It
+ * needs one global reduction per iteration, overlapped with a preconditioner
+ * apply and a matvec, at the cost of extra vector updates and some loss of
+ * stability compared to PCG.
+ *
+ * @{
+ **/
+
+/**
+ * Prepare to solve the system.  The coefficient data in \e b and \e x is
+ * ignored here, but information about the layout of the data may be used.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetup(HYPRE_Solver solver,
+                                  HYPRE_Matrix A,
+                                  HYPRE_Vector b,
+                                  HYPRE_Vector x);
+
+/**
+ * Solve the system.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSolve(HYPRE_Solver solver,
+                                  HYPRE_Matrix A,
+                                  HYPRE_Vector b,
+                                  HYPRE_Vector x);
+
+/**
+ * (Optional) Set the relative convergence tolerance.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetTol(HYPRE_Solver solver,
+                                   HYPRE_Real   tol);
+
+/**
+ * (Optional) Set the absolute convergence tolerance (default is 0).  The
+ * convergence test is the same as for PCG.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetAbsoluteTol(HYPRE_Solver solver,
+                                           HYPRE_Real   a_tol);
+
+/**
+ * (Optional) Set maximum number of iterations.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetMaxIter(HYPRE_Solver solver,
+                                       HYPRE_Int    max_iter);
+
+/**
+ * (Optional) Use the two-norm in stopping criteria.  This adds a third
+ * inner product to the fused reduction.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetTwoNorm(HYPRE_Solver solver,
+                                       HYPRE_Int    two_norm);
+
+/**
+ * (Optional) Residual replacement: every \e recompute_residual_p
+ * iterations, recompute the residual and the auxiliary recurrence vectors
+ * from their definitions.  This limits the loss of accuracy of the
+ * pipelined recurrences at the cost of three matvecs and two preconditioner
+ * applies.  The default is 0 (never).
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetRecomputeResidualP(HYPRE_Solver solver,
+                                                  HYPRE_Int    recompute_residual_p);
+
+/**
+ * (Optional) Set the preconditioner to use.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetPrecond(HYPRE_Solver         solver,
+                                       HYPRE_PtrToSolverFcn precond,
+                                       HYPRE_PtrToSolverFcn precond_setup,
+                                       HYPRE_Solver         precond_solver);
+
+/**
+ * (Optional) Set the amount of logging to do.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetLogging(HYPRE_Solver solver,
+                                       HYPRE_Int    logging);
+
+/**
+ * (Optional) Set the amount of printing to do to the screen.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetPrintLevel(HYPRE_Solver solver,
+                                          HYPRE_Int    level);
+
+/**
+ * Return the number of iterations taken.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetNumIterations(HYPRE_Solver  solver,
+                                             HYPRE_Int    *num_iterations);
+
+/**
+ * Return the norm of the final relative residual.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                         HYPRE_Real   *norm);
+
+/**
+ * Return the residual.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetResidual(HYPRE_Solver  solver,
+                                        void         *residual);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetTol(HYPRE_Solver  solver,
+                                   HYPRE_Real   *tol);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetAbsoluteTol(HYPRE_Solver  solver,
+                                           HYPRE_Real   *a_tol);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetMaxIter(HYPRE_Solver  solver,
+                                       HYPRE_Int    *max_iter);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetTwoNorm(HYPRE_Solver  solver,
+                                       HYPRE_Int    *two_norm);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetRecomputeResidualP(HYPRE_Solver  solver,
+                                                  HYPRE_Int    *recompute_residual_p);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetPrecond(HYPRE_Solver  solver,
+                                       HYPRE_Solver *precond_data_ptr);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetLogging(HYPRE_Solver  solver,
+                                       HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetPrintLevel(HYPRE_Solver  solver,
+                                          HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetConverged(HYPRE_Solver  solver,
+                                         HYPRE_Int    *converged);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -896,6 +1048,18 @@ HYPRE_Int HYPRE_COGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_COGMRESSetCGS(HYPRE_Solver solver,
                               HYPRE_Int    cgs);
 
+/**
+ * (Optional) Set the block size of the s-step (communication-avoiding)
+ * variant.  For s\_step > 1, each block of s\_step Krylov vectors is built
+ * with a Newton basis, using Leja-ordered Ritz values from the first
+ * s\_step Arnoldi steps as shifts, and orthogonalized at once with block
+ * CGS2 and a Cholesky QR of the block Gram matrix.  This reduces the number
+ * of global reductions per iteration by about a factor of s\_step.
+ * Values around 4-8 are typical.  Default is 1 (standard COGMRES).
+ **/
+HYPRE_Int HYPRE_COGMRESSetSStep(HYPRE_Solver solver,
+                                HYPRE_Int    s_step);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -977,6 +1141,11 @@ HYPRE_Int HYPRE_COGMRESGetUnroll(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_COGMRESGetCGS(HYPRE_Solver  solver,
                               HYPRE_Int    *cgs);
 
+/**
+ **/
+HYPRE_Int HYPRE_COGMRESGetSStep(HYPRE_Solver  solver,
+                                HYPRE_Int    *s_step);
+
 /**
  **/
 HYPRE_Int HYPRE_COGMRESGetPrecond(HYPRE_Solver  solver,
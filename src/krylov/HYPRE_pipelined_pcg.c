@@ -0,0 +1,248 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * HYPRE_PipelinedPCG interface
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGCreate: Call class-specific function,
+ * e.g. HYPRE_ParCSRPipelinedPCGCreate
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGDestroy: Call class-specific function
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGSetup( HYPRE_Solver solver,
+                         HYPRE_Matrix A,
+                         HYPRE_Vector b,
+                         HYPRE_Vector x )
+{
+   return ( hypre_PipelinedPCGSetup( solver, A, b, x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGSolve( HYPRE_Solver solver,
+                         HYPRE_Matrix A,
+                         HYPRE_Vector b,
+                         HYPRE_Vector x )
+{
+   return ( hypre_PipelinedPCGSolve( solver, A, b, x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGSetTol, HYPRE_PipelinedPCGGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGSetTol( HYPRE_Solver solver,
+                          HYPRE_Real   tol )
+{
+   return ( hypre_PipelinedPCGSetTol( (void *) solver, tol ) );
+}
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetTol( HYPRE_Solver  solver,
+                          HYPRE_Real   *tol )
+{
+   return ( hypre_PipelinedPCGGetTol( (void *) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGSetAbsoluteTol, HYPRE_PipelinedPCGGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGSetAbsoluteTol( HYPRE_Solver solver,
+                                  HYPRE_Real   a_tol )
+{
+   return ( hypre_PipelinedPCGSetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetAbsoluteTol( HYPRE_Solver  solver,
+                                  HYPRE_Real   *a_tol )
+{
+   return ( hypre_PipelinedPCGGetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGSetMaxIter, HYPRE_PipelinedPCGGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGSetMaxIter( HYPRE_Solver solver,
+                              HYPRE_Int    max_iter )
+{
+   return ( hypre_PipelinedPCGSetMaxIter( (void *) solver, max_iter ) );
+}
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetMaxIter( HYPRE_Solver  solver,
+                              HYPRE_Int    *max_iter )
+{
+   return ( hypre_PipelinedPCGGetMaxIter( (void *) solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGSetTwoNorm, HYPRE_PipelinedPCGGetTwoNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGSetTwoNorm( HYPRE_Solver solver,
+                              HYPRE_Int    two_norm )
+{
+   return ( hypre_PipelinedPCGSetTwoNorm( (void *) solver, two_norm ) );
+}
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetTwoNorm( HYPRE_Solver  solver,
+                              HYPRE_Int    *two_norm )
+{
+   return ( hypre_PipelinedPCGGetTwoNorm( (void *) solver, two_norm ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGSetRecomputeResidualP, HYPRE_PipelinedPCGGetRecomputeResidualP
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGSetRecomputeResidualP( HYPRE_Solver solver,
+                                         HYPRE_Int    recompute_residual_p )
+{
+   return ( hypre_PipelinedPCGSetRecomputeResidualP( (void *) solver, recompute_residual_p ) );
+}
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetRecomputeResidualP( HYPRE_Solver  solver,
+                                         HYPRE_Int    *recompute_residual_p )
+{
+   return ( hypre_PipelinedPCGGetRecomputeResidualP( (void *) solver, recompute_residual_p ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGSetPrecond( HYPRE_Solver         solver,
+                              HYPRE_PtrToSolverFcn precond,
+                              HYPRE_PtrToSolverFcn precond_setup,
+                              HYPRE_Solver         precond_solver )
+{
+   return ( hypre_PipelinedPCGSetPrecond( (void *) solver,
+                                          (HYPRE_Int (*)(void*, void*, void*, void*))precond,
+                                          (HYPRE_Int (*)(void*, void*, void*, void*))precond_setup,
+                                          (void *) precond_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetPrecond( HYPRE_Solver  solver,
+                              HYPRE_Solver *precond_data_ptr )
+{
+   return ( hypre_PipelinedPCGGetPrecond( (void *)         solver,
+                                          (HYPRE_Solver *) precond_data_ptr ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGSetLogging, HYPRE_PipelinedPCGGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGSetLogging( HYPRE_Solver solver,
+                              HYPRE_Int    level )
+{
+   return ( hypre_PipelinedPCGSetLogging( (void *) solver, level ) );
+}
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetLogging( HYPRE_Solver  solver,
+                              HYPRE_Int    *level )
+{
+   return ( hypre_PipelinedPCGGetLogging( (void *) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGSetPrintLevel, HYPRE_PipelinedPCGGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGSetPrintLevel( HYPRE_Solver solver,
+                                 HYPRE_Int    level )
+{
+   return ( hypre_PipelinedPCGSetPrintLevel( (void *) solver, level ) );
+}
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetPrintLevel( HYPRE_Solver  solver,
+                                 HYPRE_Int    *level )
+{
+   return ( hypre_PipelinedPCGGetPrintLevel( (void *) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetNumIterations( HYPRE_Solver  solver,
+                                    HYPRE_Int    *num_iterations )
+{
+   return ( hypre_PipelinedPCGGetNumIterations( (void *) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetConverged( HYPRE_Solver  solver,
+                                HYPRE_Int    *converged )
+{
+   return ( hypre_PipelinedPCGGetConverged( (void *) solver, converged ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                                HYPRE_Real   *norm )
+{
+   return ( hypre_PipelinedPCGGetFinalRelativeResidualNorm( (void *) solver, norm ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PipelinedPCGGetResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PipelinedPCGGetResidual( HYPRE_Solver  solver,
+                               void         *residual )
+{
+   /* returns a pointer to the residual vector */
+   return ( hypre_PipelinedPCGGetResidual( (void *) solver, (void **) residual ) );
+}
@@ -73,6 +73,25 @@ hypre_COGMRESFunctionsCreate(
    return cogmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESFunctionsSetMassInnerProdBlock
+ *
+ * Registers the optional block inner product used by the s-step variant.
+ * MassInnerProdBlock computes result[j*k + i] = (x[j], p[i]), j < nx, i < k,
+ * with a single global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESFunctionsSetMassInnerProdBlock(
+   hypre_COGMRESFunctions *cogmres_functions,
+   HYPRE_Int    (*MassInnerProdBlock)( void **x, HYPRE_Int nx, void **p, HYPRE_Int k,
+                                       HYPRE_Int unroll, void *result ) )
+{
+   cogmres_functions->MassInnerProdBlock = MassInnerProdBlock;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESCreate
  *--------------------------------------------------------------------------*/
@@ -90,6 +109,7 @@ hypre_COGMRESCreate( hypre_COGMRESFunctions *cogmres_functions )
    /* set defaults */
    (cogmres_data -> k_dim)          = 5;
    (cogmres_data -> cgs)            = 1; /* if 2 performs reorthogonalization */
+   (cogmres_data -> s_step)         = 1; /* if > 1 uses the s-step variant */
    (cogmres_data -> tol)            = 1.0e-06; /* relative residual tol */
    (cogmres_data -> cf_tol)         = 0.0;
    (cogmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -270,6 +290,616 @@ hypre_COGMRESSetup( void *cogmres_vdata,
 
    return hypre_error_flag;
 }
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESHessenbergEigenvalues
+ *
+ * Eigenvalues (wr + i wi) of the n x n upper Hessenberg matrix a (row-major,
+ * overwritten).  Implicit double-shift QR iteration (Golub and Van Loan,
+ * Matrix Computations, Alg. 7.5.1) applied to the trailing unreduced block,
+ * deflating 1 x 1 and 2 x 2 blocks as their subdiagonal entries become
+ * negligible.  Only the eigenvalues are needed, so each QR step is applied to
+ * the active block alone.  Returns 1 if the iteration does not converge.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESHessenbergEigenvalues( HYPRE_Int   n,
+                                    HYPRE_Real *a,
+                                    HYPRE_Real *wr,
+                                    HYPRE_Real *wi )
+{
+   HYPRE_Int   lo, hi, i, j, k, r, len;
+   HYPRE_Int   sweeps, stalled, max_sweeps;
+   HYPRE_Real  h_norm, diag_sum, trace, det, shift;
+   HYPRE_Real  mid, half, disc, root;
+   HYPRE_Real  v[3], v_norm, beta, proj;
+
+#define HA(i_, j_) a[(i_) * n + (j_)]
+
+   h_norm = 0.0;
+   for (i = 0; i < n; i++)
+   {
+      for (j = hypre_max(i - 1, 0); j < n; j++)
+      {
+         h_norm = hypre_max(h_norm, fabs(HA(i, j)));
+      }
+   }
+
+   max_sweeps = 30 * hypre_max(10, n);
+   sweeps  = 0;
+   stalled = 0;
+   hi = n - 1;
+   while (hi >= 0)
+   {
+      /* lo..hi is the largest unreduced block ending in row hi */
+      for (lo = hi; lo > 0; lo--)
+      {
+         diag_sum = fabs(HA(lo - 1, lo - 1)) + fabs(HA(lo, lo));
+         if (diag_sum == 0.0)
+         {
+            diag_sum = h_norm;
+         }
+         if (fabs(HA(lo, lo - 1)) <= HYPRE_REAL_EPSILON * diag_sum)
+         {
+            HA(lo, lo - 1) = 0.0;
+            break;
+         }
+      }
+
+      if (lo == hi)
+      {
+         wr[hi] = HA(hi, hi);
+         wi[hi] = 0.0;
+         hi--;
+         stalled = 0;
+         continue;
+      }
+
+      if (lo == hi - 1)
+      {
+         /* eigenvalues of the trailing 2 x 2 block */
+         mid  = 0.5 * (HA(lo, lo) + HA(hi, hi));
+         half = 0.5 * (HA(lo, lo) - HA(hi, hi));
+         disc = half * half + HA(lo, hi) * HA(hi, lo);
+         if (disc >= 0.0)
+         {
+            root = sqrt(disc);
+            wr[lo] = (mid >= 0.0) ? mid + root : mid - root;
+            det = HA(lo, lo) * HA(hi, hi) - HA(lo, hi) * HA(hi, lo);
+            wr[hi] = (wr[lo] != 0.0) ? det / wr[lo] : 0.0;
+            wi[lo] = 0.0;
+            wi[hi] = 0.0;
+         }
+         else
+         {
+            root = sqrt(-disc);
+            wr[lo] = mid;
+            wr[hi] = mid;
+            wi[lo] = root;
+            wi[hi] = -root;
+         }
+         hi -= 2;
+         stalled = 0;
+         continue;
+      }
+
+      if (++sweeps > max_sweeps)
+      {
+         return 1;
+      }
+      stalled++;
+
+      /* shifts: the eigenvalues of the trailing 2 x 2 block, given by their
+         sum and product; after every 10 steps without deflation, perturb
+         them to break a possible cycle */
+      if (stalled % 10 == 0)
+      {
+         shift = fabs(HA(hi, hi)) + fabs(HA(hi, hi - 1)) + fabs(HA(hi - 1, hi - 2));
+         trace = 2.0 * shift;
+         det   = shift * shift;
+      }
+      else
+      {
+         trace = HA(hi - 1, hi - 1) + HA(hi, hi);
+         det   = HA(hi - 1, hi - 1) * HA(hi, hi) - HA(hi - 1, hi) * HA(hi, hi - 1);
+      }
+
+      /* first column of (H - s1 I)(H - s2 I) */
+      v[0] = HA(lo, lo) * (HA(lo, lo) - trace) + HA(lo, lo + 1) * HA(lo + 1, lo) + det;
+      v[1] = HA(lo + 1, lo) * (HA(lo, lo) + HA(lo + 1, lo + 1) - trace);
+      v[2] = HA(lo + 1, lo) * HA(lo + 2, lo + 1);
+
+      /* chase the bulge down the block with Householder reflectors
+         I - beta v v^T acting on rows/columns k..k+len-1 */
+      for (k = lo; k < hi; k++)
+      {
+         len = (k < hi - 1) ? 3 : 2;
+         if (len == 2)
+         {
+            v[2] = 0.0;
+         }
+
+         v_norm = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+         if (v_norm > 0.0)
+         {
+            v[0] += (v[0] >= 0.0) ? v_norm : -v_norm;
+            beta  = 2.0 / (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+
+            for (j = hypre_max(lo, k - 1); j <= hi; j++)
+            {
+               proj = 0.0;
+               for (r = 0; r < len; r++)
+               {
+                  proj += v[r] * HA(k + r, j);
+               }
+               proj *= beta;
+               for (r = 0; r < len; r++)
+               {
+                  HA(k + r, j) -= proj * v[r];
+               }
+            }
+
+            for (i = lo; i <= hypre_min(k + 3, hi); i++)
+            {
+               proj = 0.0;
+               for (r = 0; r < len; r++)
+               {
+                  proj += HA(i, k + r) * v[r];
+               }
+               proj *= beta;
+               for (r = 0; r < len; r++)
+               {
+                  HA(i, k + r) -= proj * v[r];
+               }
+            }
+
+            /* the reflector annihilated the bulge in column k-1 */
+            if (k > lo)
+            {
+               for (r = 1; r < len; r++)
+               {
+                  HA(k + r, k - 1) = 0.0;
+               }
+            }
+         }
+
+         if (k < hi - 1)
+         {
+            v[0] = HA(k + 1, k);
+            v[1] = HA(k + 2, k);
+            v[2] = (k < hi - 2) ? HA(k + 3, k) : 0.0;
+         }
+      }
+   }
+
+#undef HA
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESNewtonShifts
+ *
+ * Computes the Newton basis parameters of the s-step variant from the
+ * leading s x s block of the (unrotated) Hessenberg matrix hs of the first
+ * s Arnoldi steps.  The Ritz values are Leja ordered, keeping complex
+ * conjugate pairs together so that the basis stays real:
+ *
+ *    v_{j+1} = ((AM - shift_re[j]) v_j + shift_c[j] v_{j-1}) / sigma[j]
+ *
+ * where shift_c is nonzero only for the second step of a complex pair, and
+ * sigma scales the basis vectors to about unit length.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESNewtonShifts( hypre_COGMRESFunctions *cogmres_functions,
+                           HYPRE_Int               s,
+                           HYPRE_Int               k_dim,
+                           HYPRE_Real             *hs,
+                           HYPRE_Real             *shifts )
+{
+   HYPRE_Real *shift_re = shifts;
+   HYPRE_Real *shift_c  = shifts + s;
+   HYPRE_Real *sigma    = shifts + 2 * s;
+   HYPRE_Real *a, *wr, *wi, *shift_im;
+   HYPRE_Int  *used;
+   HYPRE_Int   i, j, k, n_shifts, best;
+   HYPRE_Real  dr, di, d, prod, best_prod;
+
+   a        = hypre_CTAllocF(HYPRE_Real, s * s, cogmres_functions, HYPRE_MEMORY_HOST);
+   wr       = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+   wi       = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+   shift_im = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+   used     = hypre_CTAllocF(HYPRE_Int, s, cogmres_functions, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < s; i++)
+   {
+      for (j = 0; j < s; j++)
+      {
+         a[i * s + j] = hs[j * (k_dim + 1) + i];
+      }
+   }
+
+   for (j = 0; j < s; j++)
+   {
+      shift_re[j] = 0.0;
+      shift_c[j]  = 0.0;
+      sigma[j]    = 1.0;
+   }
+
+   if (hypre_COGMRESHessenbergEigenvalues(s, a, wr, wi))
+   {
+      /* no Ritz values, fall back to the monomial basis */
+      hypre_TFreeF(a, cogmres_functions);
+      hypre_TFreeF(wr, cogmres_functions);
+      hypre_TFreeF(wi, cogmres_functions);
+      hypre_TFreeF(shift_im, cogmres_functions);
+      hypre_TFreeF(used, cogmres_functions);
+
+      return hypre_error_flag;
+   }
+
+   /* modified Leja ordering; a conjugate pair is represented by the member
+      with positive imaginary part */
+   for (k = 0; k < s; k++)
+   {
+      if (wi[k] < 0.0) { used[k] = 1; }
+   }
+   n_shifts = 0;
+   while (n_shifts < s)
+   {
+      best = -1;
+      best_prod = 0.0;
+      for (k = 0; k < s; k++)
+      {
+         if (used[k]) { continue; }
+         if (n_shifts == 0)
+         {
+            prod = sqrt(wr[k] * wr[k] + wi[k] * wi[k]);
+         }
+         else
+         {
+            prod = 0.0;
+            for (j = 0; j < n_shifts; j++)
+            {
+               dr = wr[k] - shift_re[j];
+               di = wi[k] - shift_im[j];
+               d  = sqrt(dr * dr + di * di);
+               prod += (d > 0.0) ? log(d) : -1.0e+300;
+            }
+         }
+         if (best < 0 || prod > best_prod)
+         {
+            best = k;
+            best_prod = prod;
+         }
+      }
+      if (best < 0) { break; }
+      used[best] = 1;
+
+      shift_re[n_shifts] = wr[best];
+      shift_im[n_shifts] = wi[best];
+      n_shifts++;
+      if (wi[best] > 0.0 && n_shifts < s)
+      {
+         /* second step of the pair: (AM - re)^2 + im^2 */
+         shift_re[n_shifts] = wr[best];
+         shift_im[n_shifts] = -wi[best];
+         shift_c[n_shifts]  = wi[best] * wi[best];
+         n_shifts++;
+      }
+   }
+
+   /* scale each step by the largest distance from its shift to the Ritz values */
+   for (j = 0; j < n_shifts; j++)
+   {
+      d = 0.0;
+      for (k = 0; k < s; k++)
+      {
+         dr = wr[k] - shift_re[j];
+         di = wi[k] - shift_im[j];
+         d  = hypre_max(d, sqrt(dr * dr + di * di));
+      }
+      sigma[j] = (d > 0.0) ? d : 1.0;
+   }
+   for (j = n_shifts - 1; j > 0; j--)
+   {
+      shift_c[j] /= sigma[j - 1];
+   }
+
+   hypre_TFreeF(a, cogmres_functions);
+   hypre_TFreeF(wr, cogmres_functions);
+   hypre_TFreeF(wi, cogmres_functions);
+   hypre_TFreeF(shift_im, cogmres_functions);
+   hypre_TFreeF(used, cogmres_functions);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESMassInnerProdBlock
+ *
+ * result[j*k + i] = (x[j], p[i]).  Uses the fused MassInnerProdBlock when
+ * available, otherwise one MassInnerProd per vector.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESMassInnerProdBlock( hypre_COGMRESFunctions *cogmres_functions,
+                                 void                  **x,
+                                 HYPRE_Int               nx,
+                                 void                  **p,
+                                 HYPRE_Int               k,
+                                 HYPRE_Int               unroll,
+                                 HYPRE_Real             *result )
+{
+   HYPRE_Int j;
+
+   if (cogmres_functions->MassInnerProdBlock)
+   {
+      (*(cogmres_functions->MassInnerProdBlock))(x, nx, p, k, unroll, result);
+   }
+   else
+   {
+      for (j = 0; j < nx; j++)
+      {
+         (*(cogmres_functions->MassInnerProd))(x[j], p, k, unroll, &result[j * k]);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSStepOrthogonalize
+ *
+ * One pass of block classical Gram-Schmidt with a Pythagorean Cholesky QR
+ * of the block: with Q = p[0..m-1] orthonormal and V = p[m..m+s-1],
+ *
+ *    [C; G] = [Q V]^T V               (one global reduction)
+ *    R^T R  = G - C^T C
+ *    V     <- (V - Q C) R^{-1}
+ *
+ * On return, c holds C (stride m + s) and r the upper triangular R (stride
+ * s_max).  If the Cholesky factorization breaks down at column j > 0, the
+ * block is truncated to its first j vectors and *s_ptr is set to j.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESSStepOrthogonalize( hypre_COGMRESFunctions *cogmres_functions,
+                                 void                  **p,
+                                 HYPRE_Int               m,
+                                 HYPRE_Int              *s_ptr,
+                                 HYPRE_Int               s_max,
+                                 HYPRE_Int               unroll,
+                                 HYPRE_Real             *c,
+                                 HYPRE_Real             *r,
+                                 HYPRE_Real             *alpha )
+{
+   HYPRE_Int   s  = *s_ptr;
+   HYPRE_Int   ld = m + s;
+   HYPRE_Int   i, j, l;
+   HYPRE_Real  t;
+
+   hypre_COGMRESMassInnerProdBlock(cogmres_functions, &p[m], s, p, ld, unroll, c);
+
+   /* Cholesky factorization of the projected Gram matrix */
+   for (j = 0; j < s; j++)
+   {
+      for (l = 0; l <= j; l++)
+      {
+         t = c[j * ld + m + l];
+         for (i = 0; i < m; i++)
+         {
+            t -= c[j * ld + i] * c[l * ld + i];
+         }
+         for (i = 0; i < l; i++)
+         {
+            t -= r[i * s_max + l] * r[i * s_max + j];
+         }
+         if (l < j)
+         {
+            r[l * s_max + j] = t / r[l * s_max + l];
+         }
+         else if (t > 1.0e-12 * c[j * ld + m + j])
+         {
+            r[j * s_max + j] = sqrt(t);
+         }
+         else if (j > 0)
+         {
+            /* numerically dependent, stop the block here */
+            s = j;
+         }
+         else
+         {
+            /* (near) breakdown on the first vector, as in the one-step code */
+            r[0] = (t > 0.0) ? sqrt(t) : 0.0;
+         }
+      }
+   }
+
+   /* V <- (V - Q C) R^{-1}, one column at a time */
+   for (j = 0; j < s; j++)
+   {
+      for (i = 0; i < m; i++)
+      {
+         alpha[i] = -c[j * ld + i];
+      }
+      for (l = 0; l < j; l++)
+      {
+         alpha[m + l] = -r[l * s_max + j];
+      }
+      (*(cogmres_functions->MassAxpy))(alpha, p, p[m + j], m + j, unroll);
+      if (r[j * s_max + j] != 0.0)
+      {
+         (*(cogmres_functions->ScaleVector))(1.0 / r[j * s_max + j], p[m + j]);
+      }
+   }
+
+   *s_ptr = s;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSStepBlock
+ *
+ * Builds s new Krylov vectors p[i0+1..i0+s] from p[i0] with the Newton basis,
+ * orthonormalizes them against p[0..i0] and among themselves with two passes
+ * of hypre_COGMRESSStepOrthogonalize (two global reductions for the block),
+ * and recovers the unrotated Hessenberg columns i0..i0+s-1 in hs from the
+ * change of basis.  *s_ptr may be reduced if the basis is numerically rank
+ * deficient.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESSStepBlock( hypre_COGMRESData *cogmres_data,
+                         void              *A,
+                         HYPRE_Int          i0,
+                         HYPRE_Int         *s_ptr,
+                         HYPRE_Real        *shifts,
+                         HYPRE_Real        *hs,
+                         HYPRE_Real        *work )
+{
+   hypre_COGMRESFunctions *cogmres_functions = cogmres_data->functions;
+   HYPRE_Int     k_dim       = (cogmres_data -> k_dim);
+   HYPRE_Int     s_max       = hypre_min((cogmres_data -> s_step), k_dim);
+   HYPRE_Int     unroll      = (cogmres_data -> unroll);
+   void         *matvec_data = (cogmres_data -> matvec_data);
+   void         *r           = (cogmres_data -> r);
+   void        **p           = (cogmres_data -> p);
+
+   HYPRE_Int (*precond)(void*, void*, void*, void*) = (cogmres_functions -> precond);
+   void         *precond_data = (cogmres_data -> precond_data);
+
+   HYPRE_Real   *shift_re = shifts;
+   HYPRE_Real   *shift_c  = shifts + s_max;
+   HYPRE_Real   *sigma    = shifts + 2 * s_max;
+
+   HYPRE_Int     ld = k_dim + 1;
+   HYPRE_Int     m  = i0 + 1;
+   HYPRE_Int     s  = *s_ptr;
+   HYPRE_Int     s1, ld1, ld2;
+   HYPRE_Int     i, j, l, q;
+   HYPRE_Real   *c1, *c2, *r1, *r2, *tt, *mm, *alpha;
+   HYPRE_Real    t;
+
+   c1    = work;
+   c2    = c1 + s_max * ld;
+   r1    = c2 + s_max * ld;
+   r2    = r1 + s_max * s_max;
+   tt    = r2 + s_max * s_max;
+   mm    = tt + ld * (s_max + 1);
+   alpha = mm + ld * s_max;
+
+   /* build the Newton basis v_j = p[i0+j], j = 0..s */
+   for (j = 0; j < s; j++)
+   {
+      (*(cogmres_functions->ClearVector))(r);
+      precond(precond_data, A, p[i0 + j], r);
+      (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i0 + j + 1]);
+      if (shift_re[j] != 0.0)
+      {
+         (*(cogmres_functions->Axpy))(-shift_re[j], p[i0 + j], p[i0 + j + 1]);
+      }
+      if (shift_c[j] != 0.0)
+      {
+         (*(cogmres_functions->Axpy))(shift_c[j], p[i0 + j - 1], p[i0 + j + 1]);
+      }
+      if (sigma[j] != 1.0)
+      {
+         (*(cogmres_functions->ScaleVector))(1.0 / sigma[j], p[i0 + j + 1]);
+      }
+   }
+
+   /* block CGS2: V = Q C1 + V1 R1, V1 = Q C2 + V2 R2 */
+   hypre_COGMRESSStepOrthogonalize(cogmres_functions, p, m, &s, s_max, unroll, c1, r1, alpha);
+   ld1 = m + *s_ptr;
+   s1 = s;
+   hypre_COGMRESSStepOrthogonalize(cogmres_functions, p, m, &s, s_max, unroll, c2, r2, alpha);
+   ld2 = m + s1;
+
+   /* T: V_{0..s} = p[0..i0+s] T, with v_0 = p[i0] */
+   for (j = 0; j <= s; j++)
+   {
+      for (i = 0; i <= i0 + s; i++)
+      {
+         tt[j * ld + i] = 0.0;
+      }
+   }
+   tt[i0] = 1.0;
+   for (j = 0; j < s; j++)
+   {
+      /* rows 0..i0: C1 + C2 R1 */
+      for (i = 0; i < m; i++)
+      {
+         t = c1[j * ld1 + i];
+         for (l = 0; l <= j; l++)
+         {
+            t += c2[l * ld2 + i] * r1[l * s_max + j];
+         }
+         tt[(j + 1) * ld + i] = t;
+      }
+      /* rows i0+1..i0+s: R2 R1 */
+      for (i = 0; i <= j; i++)
+      {
+         t = 0.0;
+         for (l = i; l <= j; l++)
+         {
+            t += r2[i * s_max + l] * r1[l * s_max + j];
+         }
+         tt[(j + 1) * ld + m + i] = t;
+      }
+   }
+
+   /* AM V_{0..s-1} = V_{0..s} B, B tridiagonal with
+      B(j,j) = shift_re[j], B(j+1,j) = sigma[j], B(j-1,j) = -shift_c[j] */
+   for (j = 0; j < s; j++)
+   {
+      for (i = 0; i <= i0 + s; i++)
+      {
+         t = shift_re[j] * tt[j * ld + i] + sigma[j] * tt[(j + 1) * ld + i];
+         if (j > 0)
+         {
+            t -= shift_c[j] * tt[(j - 1) * ld + i];
+         }
+         mm[j * ld + i] = t;
+      }
+      /* subtract the part of AM V_j from previous Arnoldi columns */
+      for (q = 0; q < i0; q++)
+      {
+         t = tt[j * ld + q];
+         if (t != 0.0)
+         {
+            for (i = 0; i <= q + 1; i++)
+            {
+               mm[j * ld + i] -= hs[q * ld + i] * t;
+            }
+         }
+      }
+   }
+
+   /* H(:, i0..i0+s-1) = M T(i0..i0+s-1, 0..s-1)^{-1} */
+   for (j = 0; j < s; j++)
+   {
+      for (i = 0; i <= i0 + j + 1; i++)
+      {
+         t = mm[j * ld + i];
+         for (q = 0; q < j; q++)
+         {
+            t -= hs[(i0 + q) * ld + i] * tt[j * ld + i0 + q];
+         }
+         hs[(i0 + j) * ld + i] = t / tt[j * ld + i0 + j];
+      }
+      for (i = i0 + j + 2; i < ld; i++)
+      {
+         hs[(i0 + j) * ld + i] = 0.0;
+      }
+   }
+
+   *s_ptr = s;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSolve
  *-------------------------------------------------------------------------*/
@@ -286,6 +916,7 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
    HYPRE_Int     k_dim             = (cogmres_data -> k_dim);
    HYPRE_Int     unroll            = (cogmres_data -> unroll);
    HYPRE_Int     cgs               = (cogmres_data -> cgs);
+   HYPRE_Int     s_step            = hypre_min((cogmres_data -> s_step), k_dim);
    HYPRE_Int     min_iter          = (cogmres_data -> min_iter);
    HYPRE_Int     max_iter          = (cogmres_data -> max_iter);
    HYPRE_Int     rel_change        = (cogmres_data -> rel_change);
@@ -337,6 +968,10 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
 
    HYPRE_Real real_r_norm_old, real_r_norm_new;
 
+   /* s-step variant: unrotated Hessenberg, Newton shifts and work space */
+   HYPRE_Real *hs = NULL, *shifts = NULL, *s_work = NULL;
+   HYPRE_Int   have_shifts = 0, blk_end = 0, s_blk;
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (cogmres_data -> converged) = 0;
@@ -365,6 +1000,14 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
    hh = hypre_CTAllocF(HYPRE_Real, (k_dim + 1) * k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
    uu = hypre_CTAllocF(HYPRE_Real, (k_dim + 1) * k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
 
+   if (s_step > 1)
+   {
+      hs     = hypre_CTAllocF(HYPRE_Real, (k_dim + 1) * k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+      shifts = hypre_CTAllocF(HYPRE_Real, 3 * s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+      s_work = hypre_CTAllocF(HYPRE_Real, 2 * s_step * (k_dim + 1) + 2 * s_step * s_step +
+                              (2 * s_step + 2) * (k_dim + 1), cogmres_functions, HYPRE_MEMORY_HOST);
+   }
+
    (*(cogmres_functions->CopyVector))(b, p[0]);
 
    /* compute initial residual */
@@ -494,6 +1137,9 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
          if (rel_change) { hypre_TFreeF(rs_2, cogmres_functions); }
          hypre_TFreeF(hh, cogmres_functions);
          hypre_TFreeF(uu, cogmres_functions);
+         hypre_TFreeF(hs, cogmres_functions);
+         hypre_TFreeF(shifts, cogmres_functions);
+         hypre_TFreeF(s_work, cogmres_functions);
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -531,6 +1177,7 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
       t = 1.0 / r_norm;
       (*(cogmres_functions->ScaleVector))(t, p[0]);
       i = 0;
+      blk_end = 0;
       /***RESTART CYCLE (right-preconditioning) ***/
       while (i < k_dim && iter < max_iter)
       {
@@ -538,53 +1185,87 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
          iter++;
          itmp = (i - 1) * (k_dim + 1);
 
-         (*(cogmres_functions->ClearVector))(r);
-
-         precond(precond_data, A, p[i - 1], r);
-         (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
-         for (j = 0; j < i; j++)
+         if (have_shifts)
          {
-            rv[j]  = 0;
+            /* s-step: generate and orthogonalize a new block when needed,
+               then take the next Hessenberg column from it */
+            if (i > blk_end)
+            {
+               s_blk = hypre_min(s_step, hypre_min(k_dim - i + 1, max_iter - iter + 1));
+               hypre_COGMRESSStepBlock(cogmres_data, A, i - 1, &s_blk, shifts, hs, s_work);
+               blk_end = i - 1 + s_blk;
+            }
+            for (j = 0; j <= i; j++)
+            {
+               hh[itmp + j] = hs[itmp + j];
+            }
          }
-
-         if (cgs > 1)
+         else
          {
-            (*(cogmres_functions->MassDotpTwo))((void *) p[i], p[i - 1], p, i, unroll, &hh[itmp], &uu[itmp]);
-            for (j = 0; j < i - 1; j++) { uu[j * (k_dim + 1) + i - 1] = uu[itmp + j]; }
-            for (j = 0; j < i; j++) { rv[j] = hh[itmp + j]; }
-            for (k = 0; k < i; k++)
+            (*(cogmres_functions->ClearVector))(r);
+
+            precond(precond_data, A, p[i - 1], r);
+            (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
+            for (j = 0; j < i; j++)
             {
+               rv[j]  = 0;
+            }
+
+            if (cgs > 1)
+            {
+               (*(cogmres_functions->MassDotpTwo))((void *) p[i], p[i - 1], p, i, unroll, &hh[itmp], &uu[itmp]);
+               for (j = 0; j < i - 1; j++) { uu[j * (k_dim + 1) + i - 1] = uu[itmp + j]; }
+               for (j = 0; j < i; j++) { rv[j] = hh[itmp + j]; }
+               for (k = 0; k < i; k++)
+               {
+                  for (j = 0; j < i; j++)
+                  {
+                     hh[itmp + j] -= (uu[k * (k_dim + 1) + j] * rv[j]);
+                  }
+               }
                for (j = 0; j < i; j++)
                {
-                  hh[itmp + j] -= (uu[k * (k_dim + 1) + j] * rv[j]);
+                  hh[itmp + j]  = -rv[j] - hh[itmp + j];
                }
             }
-            for (j = 0; j < i; j++)
+            else
             {
-               hh[itmp + j]  = -rv[j] - hh[itmp + j];
+               (*(cogmres_functions->MassInnerProd))((void *) p[i], p, i, unroll, &hh[itmp]);
+               for (j = 0; j < i; j++)
+               {
+                  hh[itmp + j]  = -hh[itmp + j];
+               }
             }
-         }
-         else
-         {
-            (*(cogmres_functions->MassInnerProd))((void *) p[i], p, i, unroll, &hh[itmp]);
+
+            (*(cogmres_functions->MassAxpy))(&hh[itmp], p, p[i], i, unroll);
             for (j = 0; j < i; j++)
             {
                hh[itmp + j]  = -hh[itmp + j];
             }
-         }
+            t = sqrt( (*(cogmres_functions->InnerProd))(p[i], p[i]) );
+            hh[itmp + i] = t;
 
-         (*(cogmres_functions->MassAxpy))(&hh[itmp], p, p[i], i, unroll);
-         for (j = 0; j < i; j++)
-         {
-            hh[itmp + j]  = -hh[itmp + j];
-         }
-         t = sqrt( (*(cogmres_functions->InnerProd))(p[i], p[i]) );
-         hh[itmp + i] = t;
+            if (hh[itmp + i] != 0.0)
+            {
+               t = 1.0 / t;
+               (*(cogmres_functions->ScaleVector))(t, p[i]);
+            }
 
-         if (hh[itmp + i] != 0.0)
-         {
-            t = 1.0 / t;
-            (*(cogmres_functions->ScaleVector))(t, p[i]);
+            if (s_step > 1)
+            {
+               /* keep the unrotated column; the first s_step Arnoldi steps
+                  give the Ritz values used as Newton shifts */
+               for (j = 0; j <= i; j++)
+               {
+                  hs[itmp + j] = hh[itmp + j];
+               }
+               if (i == s_step)
+               {
+                  hypre_COGMRESNewtonShifts(cogmres_functions, s_step, k_dim, hs, shifts);
+                  have_shifts = 1;
+                  blk_end = i;
+               }
+            }
          }
          for (j = 1; j < i; j++)
          {
@@ -908,6 +1589,9 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
    }*/
    hypre_TFreeF(hh, cogmres_functions);
    hypre_TFreeF(uu, cogmres_functions);
+   hypre_TFreeF(hs, cogmres_functions);
+   hypre_TFreeF(shifts, cogmres_functions);
+   hypre_TFreeF(s_work, cogmres_functions);
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -980,6 +1664,28 @@ hypre_COGMRESGetCGS( void   *cogmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetSStep, hypre_COGMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetSStep( void   *cogmres_vdata,
+                       HYPRE_Int   s_step )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *) cogmres_vdata;
+   (cogmres_data -> s_step) = s_step;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetSStep( void   *cogmres_vdata,
+                       HYPRE_Int * s_step )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *s_step = (cogmres_data -> s_step);
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSetTol, hypre_COGMRESGetTol
  *--------------------------------------------------------------------------*/
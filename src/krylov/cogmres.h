@@ -67,6 +67,9 @@ typedef struct
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
+   /* optional, used by the s-step variant */
+   HYPRE_Int    (*MassInnerProdBlock) ( void **x, HYPRE_Int nx, void **p, HYPRE_Int k,
+                                        HYPRE_Int unroll, void *result);
    HYPRE_Int    (*precond)       ();
    HYPRE_Int    (*precond_setup) ();
 
@@ -83,6 +86,7 @@ typedef struct
    HYPRE_Int      k_dim;
    HYPRE_Int      unroll;
    HYPRE_Int      cgs;
+   HYPRE_Int      s_step;
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
@@ -577,6 +577,9 @@ typedef struct
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex * alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
+   /* optional, used by the s-step variant */
+   HYPRE_Int    (*MassInnerProdBlock) ( void **x, HYPRE_Int nx, void **p, HYPRE_Int k,
+                                        HYPRE_Int unroll, void *result);
    HYPRE_Int    (*precond)       (void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup) (void *vdata, void *A, void *b, void *x);
 
@@ -594,6 +597,7 @@ typedef struct
    HYPRE_Int      k_dim;
    HYPRE_Int      unroll;
    HYPRE_Int      cgs;
+   HYPRE_Int      s_step;
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
@@ -1067,6 +1071,13 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional fused non-blocking inner products, used by pipelined PCG;
+      NULL means fall back to InnerProd */
+   HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y,
+                                   HYPRE_Real *local_result, HYPRE_Real *result,
+                                   hypre_MPI_Request *request );
+   HYPRE_Int    (*InnerProdWait) ( hypre_MPI_Request *request );
+
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x);
 
@@ -1202,6 +1213,69 @@ extern "C" {
 
 #endif
 
+/******************************************************************************
+ *
+ * Pipelined PCG
+ *
+ *****************************************************************************/
+
+#ifndef hypre_KRYLOV_PIPELINED_PCG_HEADER
+#define hypre_KRYLOV_PIPELINED_PCG_HEADER
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGData
+ *
+ * Pipelined preconditioned conjugate gradient (Ghysels and Vanroose).  It
+ * uses the same hypre_PCGFunctions object as PCG.  Per iteration, the inner
+ * products (r,u), (w,u) and optionally (r,r) are combined into a single
+ * reduction, which is started with InnerProdStart and overlapped with one
+ * preconditioner apply and one matvec.
+ *
+ * The recurrences are less stable than those of standard PCG.
+ * - recompute_residual_p means: every "recompute_residual_p" iterations,
+ * replace the recursively updated vectors r, u, w, s, q, z by their true
+ * values (r = b - Ax, u = Cr, w = Au, s = Ap, q = Cs, z = Aq).  This costs
+ * three matvecs and two preconditioner applies.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Real   tol;
+   HYPRE_Real   a_tol;
+   HYPRE_Int    max_iter;
+   HYPRE_Int    two_norm;
+   HYPRE_Int    recompute_residual_p;
+   HYPRE_Int    converged;
+
+   void        *A;
+   void        *r;   /* residual */
+   void        *u;   /* C r */
+   void        *w;   /* A u */
+   void        *m;   /* C w */
+   void        *n;   /* A m */
+   void        *p;   /* search direction */
+   void        *s;   /* A p */
+   void        *q;   /* C s */
+   void        *z;   /* A q */
+
+   void        *matvec_data;
+   void        *precond_data;
+
+   hypre_PCGFunctions * functions;
+
+   /* log info (always logged) */
+   HYPRE_Int    num_iterations;
+   HYPRE_Real   rel_residual_norm;
+
+   HYPRE_Int    print_level; /* printing when print_level>0 */
+   HYPRE_Int    logging;  /* extra computations for logging when logging>0 */
+   HYPRE_Real  *norms;
+   HYPRE_Real  *rel_norms;
+
+} hypre_PipelinedPCGData;
+
+#endif
+
 /* bicgstab.c */
 void *hypre_BiCGSTABCreate ( hypre_BiCGSTABFunctions *bicgstab_functions );
 HYPRE_Int hypre_BiCGSTABDestroy ( void *bicgstab_vdata );
@@ -1284,6 +1358,8 @@ HYPRE_Int hypre_GMRESGetFinalRelativeResidualNorm ( void *gmres_vdata,
                                                     HYPRE_Real *relative_residual_norm );
 
 /* cogmres.c */
+HYPRE_Int hypre_COGMRESFunctionsSetMassInnerProdBlock ( hypre_COGMRESFunctions *cogmres_functions,
+                                                        HYPRE_Int (*MassInnerProdBlock)( void **x, HYPRE_Int nx, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result ) );
 void *hypre_COGMRESCreate ( hypre_COGMRESFunctions *gmres_functions );
 HYPRE_Int hypre_COGMRESDestroy ( void *gmres_vdata );
 HYPRE_Int hypre_COGMRESGetResidual ( void *gmres_vdata, void **residual );
@@ -1295,6 +1371,8 @@ HYPRE_Int hypre_COGMRESSetUnroll ( void *gmres_vdata, HYPRE_Int unroll );
 HYPRE_Int hypre_COGMRESGetUnroll ( void *gmres_vdata, HYPRE_Int *unroll );
 HYPRE_Int hypre_COGMRESSetCGS ( void *gmres_vdata, HYPRE_Int cgs );
 HYPRE_Int hypre_COGMRESGetCGS ( void *gmres_vdata, HYPRE_Int *cgs );
+HYPRE_Int hypre_COGMRESSetSStep ( void *gmres_vdata, HYPRE_Int s_step );
+HYPRE_Int hypre_COGMRESGetSStep ( void *gmres_vdata, HYPRE_Int *s_step );
 HYPRE_Int hypre_COGMRESSetTol ( void *gmres_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_COGMRESGetTol ( void *gmres_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_COGMRESSetAbsoluteTol ( void *gmres_vdata, HYPRE_Real a_tol );
@@ -1475,6 +1553,8 @@ HYPRE_Int HYPRE_COGMRESSetUnroll ( HYPRE_Solver solver, HYPRE_Int unroll );
 HYPRE_Int HYPRE_COGMRESGetUnroll ( HYPRE_Solver solver, HYPRE_Int *unroll );
 HYPRE_Int HYPRE_COGMRESSetCGS ( HYPRE_Solver solver, HYPRE_Int cgs );
 HYPRE_Int HYPRE_COGMRESGetCGS ( HYPRE_Solver solver, HYPRE_Int *cgs );
+HYPRE_Int HYPRE_COGMRESSetSStep ( HYPRE_Solver solver, HYPRE_Int s_step );
+HYPRE_Int HYPRE_COGMRESGetSStep ( HYPRE_Solver solver, HYPRE_Int *s_step );
 HYPRE_Int HYPRE_COGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_COGMRESGetTol ( HYPRE_Solver solver, HYPRE_Real *tol );
 HYPRE_Int HYPRE_COGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
@@ -1600,7 +1680,41 @@ HYPRE_Int HYPRE_PCGGetConverged ( HYPRE_Solver solver, HYPRE_Int *converged );
 HYPRE_Int HYPRE_PCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver, HYPRE_Real *norm );
 HYPRE_Int HYPRE_PCGGetResidual ( HYPRE_Solver solver, void *residual );
 
+/* HYPRE_pipelined_pcg.c */
+HYPRE_Int HYPRE_PipelinedPCGSetup ( HYPRE_Solver solver, HYPRE_Matrix A, HYPRE_Vector b,
+                                    HYPRE_Vector x );
+HYPRE_Int HYPRE_PipelinedPCGSolve ( HYPRE_Solver solver, HYPRE_Matrix A, HYPRE_Vector b,
+                                    HYPRE_Vector x );
+HYPRE_Int HYPRE_PipelinedPCGSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
+HYPRE_Int HYPRE_PipelinedPCGGetTol ( HYPRE_Solver solver, HYPRE_Real *tol );
+HYPRE_Int HYPRE_PipelinedPCGSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
+HYPRE_Int HYPRE_PipelinedPCGGetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real *a_tol );
+HYPRE_Int HYPRE_PipelinedPCGSetMaxIter ( HYPRE_Solver solver, HYPRE_Int max_iter );
+HYPRE_Int HYPRE_PipelinedPCGGetMaxIter ( HYPRE_Solver solver, HYPRE_Int *max_iter );
+HYPRE_Int HYPRE_PipelinedPCGSetTwoNorm ( HYPRE_Solver solver, HYPRE_Int two_norm );
+HYPRE_Int HYPRE_PipelinedPCGGetTwoNorm ( HYPRE_Solver solver, HYPRE_Int *two_norm );
+HYPRE_Int HYPRE_PipelinedPCGSetRecomputeResidualP ( HYPRE_Solver solver,
+                                                    HYPRE_Int recompute_residual_p );
+HYPRE_Int HYPRE_PipelinedPCGGetRecomputeResidualP ( HYPRE_Solver solver,
+                                                    HYPRE_Int *recompute_residual_p );
+HYPRE_Int HYPRE_PipelinedPCGSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToSolverFcn precond,
+                                         HYPRE_PtrToSolverFcn precond_setup,
+                                         HYPRE_Solver precond_solver );
+HYPRE_Int HYPRE_PipelinedPCGGetPrecond ( HYPRE_Solver solver, HYPRE_Solver *precond_data_ptr );
+HYPRE_Int HYPRE_PipelinedPCGSetLogging ( HYPRE_Solver solver, HYPRE_Int level );
+HYPRE_Int HYPRE_PipelinedPCGGetLogging ( HYPRE_Solver solver, HYPRE_Int *level );
+HYPRE_Int HYPRE_PipelinedPCGSetPrintLevel ( HYPRE_Solver solver, HYPRE_Int level );
+HYPRE_Int HYPRE_PipelinedPCGGetPrintLevel ( HYPRE_Solver solver, HYPRE_Int *level );
+HYPRE_Int HYPRE_PipelinedPCGGetNumIterations ( HYPRE_Solver solver, HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_PipelinedPCGGetConverged ( HYPRE_Solver solver, HYPRE_Int *converged );
+HYPRE_Int HYPRE_PipelinedPCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver,
+                                                           HYPRE_Real *norm );
+HYPRE_Int HYPRE_PipelinedPCGGetResidual ( HYPRE_Solver solver, void *residual );
+
 /* pcg.c */
+HYPRE_Int hypre_PCGFunctionsSetNonBlockingInnerProd ( hypre_PCGFunctions *pcg_functions,
+                                                      HYPRE_Int (*InnerProdStart)( HYPRE_Int n, void **x, void **y, HYPRE_Real *local_result, HYPRE_Real *result, hypre_MPI_Request *request ),
+                                                      HYPRE_Int (*InnerProdWait)( hypre_MPI_Request *request ) );
 void *hypre_PCGCreate ( hypre_PCGFunctions *pcg_functions );
 HYPRE_Int hypre_PCGDestroy ( void *pcg_vdata );
 HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata, void **residual );
@@ -1642,6 +1756,38 @@ HYPRE_Int hypre_PCGPrintLogging ( void *pcg_vdata, HYPRE_Int myid );
 HYPRE_Int hypre_PCGGetFinalRelativeResidualNorm ( void *pcg_vdata,
                                                   HYPRE_Real *relative_residual_norm );
 
+/* pipelined_pcg.c */
+void *hypre_PipelinedPCGCreate ( hypre_PCGFunctions *pcg_functions );
+HYPRE_Int hypre_PipelinedPCGDestroy ( void *ppcg_vdata );
+HYPRE_Int hypre_PipelinedPCGSetup ( void *ppcg_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_PipelinedPCGSolve ( void *ppcg_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_PipelinedPCGSetTol ( void *ppcg_vdata, HYPRE_Real tol );
+HYPRE_Int hypre_PipelinedPCGGetTol ( void *ppcg_vdata, HYPRE_Real *tol );
+HYPRE_Int hypre_PipelinedPCGSetAbsoluteTol ( void *ppcg_vdata, HYPRE_Real a_tol );
+HYPRE_Int hypre_PipelinedPCGGetAbsoluteTol ( void *ppcg_vdata, HYPRE_Real *a_tol );
+HYPRE_Int hypre_PipelinedPCGSetMaxIter ( void *ppcg_vdata, HYPRE_Int max_iter );
+HYPRE_Int hypre_PipelinedPCGGetMaxIter ( void *ppcg_vdata, HYPRE_Int *max_iter );
+HYPRE_Int hypre_PipelinedPCGSetTwoNorm ( void *ppcg_vdata, HYPRE_Int two_norm );
+HYPRE_Int hypre_PipelinedPCGGetTwoNorm ( void *ppcg_vdata, HYPRE_Int *two_norm );
+HYPRE_Int hypre_PipelinedPCGSetRecomputeResidualP ( void *ppcg_vdata,
+                                                    HYPRE_Int recompute_residual_p );
+HYPRE_Int hypre_PipelinedPCGGetRecomputeResidualP ( void *ppcg_vdata,
+                                                    HYPRE_Int *recompute_residual_p );
+HYPRE_Int hypre_PipelinedPCGGetPrecond ( void *ppcg_vdata, HYPRE_Solver *precond_data_ptr );
+HYPRE_Int hypre_PipelinedPCGSetPrecond ( void *ppcg_vdata,
+                                         HYPRE_Int (*precond )(void*, void*, void*, void*),
+                                         HYPRE_Int (*precond_setup )(void*, void*, void*, void*),
+                                         void *precond_data );
+HYPRE_Int hypre_PipelinedPCGSetPrintLevel ( void *ppcg_vdata, HYPRE_Int level );
+HYPRE_Int hypre_PipelinedPCGGetPrintLevel ( void *ppcg_vdata, HYPRE_Int *level );
+HYPRE_Int hypre_PipelinedPCGSetLogging ( void *ppcg_vdata, HYPRE_Int level );
+HYPRE_Int hypre_PipelinedPCGGetLogging ( void *ppcg_vdata, HYPRE_Int *level );
+HYPRE_Int hypre_PipelinedPCGGetNumIterations ( void *ppcg_vdata, HYPRE_Int *num_iterations );
+HYPRE_Int hypre_PipelinedPCGGetConverged ( void *ppcg_vdata, HYPRE_Int *converged );
+HYPRE_Int hypre_PipelinedPCGGetFinalRelativeResidualNorm ( void *ppcg_vdata,
+                                                          HYPRE_Real *relative_residual_norm );
+HYPRE_Int hypre_PipelinedPCGGetResidual ( void *ppcg_vdata, void **residual );
+
 #ifdef __cplusplus
 }
 #endif
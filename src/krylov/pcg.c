@@ -72,6 +72,28 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetNonBlockingInnerProd
+ *
+ * Registers the optional fused, non-blocking inner products.  InnerProdStart
+ * computes the local parts of (x[i],y[i]), i < n, and starts their global
+ * reduction into result; InnerProdWait completes it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetNonBlockingInnerProd(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y,
+                                   HYPRE_Real *local_result, HYPRE_Real *result,
+                                   hypre_MPI_Request *request ),
+   HYPRE_Int    (*InnerProdWait) ( hypre_MPI_Request *request ) )
+{
+   pcg_functions->InnerProdStart = InnerProdStart;
+   pcg_functions->InnerProdWait  = InnerProdWait;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
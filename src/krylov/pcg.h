@@ -64,6 +64,13 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional fused non-blocking inner products, used by pipelined PCG;
+      NULL means fall back to InnerProd */
+   HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y,
+                                   HYPRE_Real *local_result, HYPRE_Real *result,
+                                   hypre_MPI_Request *request );
+   HYPRE_Int    (*InnerProdWait) ( hypre_MPI_Request *request );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -0,0 +1,818 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Pipelined preconditioned conjugate gradient functions
+ *
+ * P. Ghysels and W. Vanroose, "Hiding global synchronization latency in the
+ * preconditioned Conjugate Gradient algorithm", Parallel Computing 40 (2014).
+ *
+ * Each iteration performs a single (fused) global reduction that is
+ * overlapped with one preconditioner apply and one matvec.  The
+ * hypre_PCGFunctions object is shared with PCG; when its InnerProdStart and
+ * InnerProdWait entries are NULL, the blocking InnerProd is used instead and
+ * the algorithm is still correct, just without overlap.
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_PipelinedPCGCreate( hypre_PCGFunctions *pcg_functions )
+{
+   hypre_PipelinedPCGData *ppcg_data;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   ppcg_data = hypre_CTAllocF(hypre_PipelinedPCGData, 1, pcg_functions, HYPRE_MEMORY_HOST);
+
+   ppcg_data -> functions = pcg_functions;
+
+   /* set defaults */
+   (ppcg_data -> tol)          = 1.0e-06;
+   (ppcg_data -> a_tol)        = 0.0;
+   (ppcg_data -> max_iter)     = 1000;
+   (ppcg_data -> two_norm)     = 0;
+   (ppcg_data -> recompute_residual_p) = 0;
+   (ppcg_data -> converged)    = 0;
+   (ppcg_data -> matvec_data)  = NULL;
+   (ppcg_data -> precond_data) = NULL;
+   (ppcg_data -> print_level)  = 0;
+   (ppcg_data -> logging)      = 0;
+   (ppcg_data -> norms)        = NULL;
+   (ppcg_data -> rel_norms)    = NULL;
+   (ppcg_data -> r)            = NULL;
+   (ppcg_data -> u)            = NULL;
+   (ppcg_data -> w)            = NULL;
+   (ppcg_data -> m)            = NULL;
+   (ppcg_data -> n)            = NULL;
+   (ppcg_data -> p)            = NULL;
+   (ppcg_data -> s)            = NULL;
+   (ppcg_data -> q)            = NULL;
+   (ppcg_data -> z)            = NULL;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return (void *) ppcg_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGDestroyVectors
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PipelinedPCGDestroyVectors( hypre_PipelinedPCGData *ppcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = ppcg_data->functions;
+   void              **vecs[9];
+   HYPRE_Int           k;
+
+   vecs[0] = &(ppcg_data -> r);
+   vecs[1] = &(ppcg_data -> u);
+   vecs[2] = &(ppcg_data -> w);
+   vecs[3] = &(ppcg_data -> m);
+   vecs[4] = &(ppcg_data -> n);
+   vecs[5] = &(ppcg_data -> p);
+   vecs[6] = &(ppcg_data -> s);
+   vecs[7] = &(ppcg_data -> q);
+   vecs[8] = &(ppcg_data -> z);
+
+   for (k = 0; k < 9; k++)
+   {
+      if (*vecs[k] != NULL)
+      {
+         (*(pcg_functions->DestroyVector))(*vecs[k]);
+         *vecs[k] = NULL;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGDestroy( void *ppcg_vdata )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (ppcg_data)
+   {
+      hypre_PCGFunctions *pcg_functions = ppcg_data->functions;
+      if ( (ppcg_data -> norms) != NULL )
+      {
+         hypre_TFreeF( ppcg_data -> norms, pcg_functions );
+      }
+      if ( (ppcg_data -> rel_norms) != NULL )
+      {
+         hypre_TFreeF( ppcg_data -> rel_norms, pcg_functions );
+      }
+      if ( ppcg_data -> matvec_data != NULL )
+      {
+         (*(pcg_functions->MatvecDestroy))(ppcg_data -> matvec_data);
+         ppcg_data -> matvec_data = NULL;
+      }
+      hypre_PipelinedPCGDestroyVectors(ppcg_data);
+      hypre_TFreeF( ppcg_data, pcg_functions );
+      hypre_TFreeF( pcg_functions, pcg_functions );
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return (hypre_error_flag);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetup( void *ppcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+   hypre_PCGFunctions     *pcg_functions = ppcg_data->functions;
+   HYPRE_Int               max_iter      = (ppcg_data -> max_iter);
+   HYPRE_Int             (*precond_setup)(void*, void*, void*, void*) =
+      (pcg_functions -> precond_setup);
+   void                   *precond_data  = (ppcg_data -> precond_data);
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (ppcg_data -> A) = A;
+
+   /*--------------------------------------------------
+    * Vectors in the range of A are created from b,
+    * vectors in the range of C from x.
+    *--------------------------------------------------*/
+
+   hypre_PipelinedPCGDestroyVectors(ppcg_data);
+   (ppcg_data -> r) = (*(pcg_functions->CreateVector))(b);
+   (ppcg_data -> w) = (*(pcg_functions->CreateVector))(b);
+   (ppcg_data -> n) = (*(pcg_functions->CreateVector))(b);
+   (ppcg_data -> s) = (*(pcg_functions->CreateVector))(b);
+   (ppcg_data -> z) = (*(pcg_functions->CreateVector))(b);
+   (ppcg_data -> u) = (*(pcg_functions->CreateVector))(x);
+   (ppcg_data -> m) = (*(pcg_functions->CreateVector))(x);
+   (ppcg_data -> p) = (*(pcg_functions->CreateVector))(x);
+   (ppcg_data -> q) = (*(pcg_functions->CreateVector))(x);
+
+   if ( ppcg_data -> matvec_data != NULL )
+   {
+      (*(pcg_functions->MatvecDestroy))(ppcg_data -> matvec_data);
+   }
+   (ppcg_data -> matvec_data) = (*(pcg_functions->MatvecCreate))(A, x);
+
+   precond_setup(precond_data, A, b, x);
+
+   /*-----------------------------------------------------
+    * Allocate space for log info
+    *-----------------------------------------------------*/
+
+   if ( (ppcg_data->logging) > 0  || (ppcg_data->print_level) > 0 )
+   {
+      if ( (ppcg_data -> norms) != NULL )
+      {
+         hypre_TFreeF( ppcg_data -> norms, pcg_functions );
+      }
+      (ppcg_data -> norms)     = hypre_CTAllocF( HYPRE_Real, max_iter + 1,
+                                                 pcg_functions, HYPRE_MEMORY_HOST);
+
+      if ( (ppcg_data -> rel_norms) != NULL )
+      {
+         hypre_TFreeF( ppcg_data -> rel_norms, pcg_functions );
+      }
+      (ppcg_data -> rel_norms) = hypre_CTAllocF( HYPRE_Real, max_iter + 1,
+                                                 pcg_functions, HYPRE_MEMORY_HOST );
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSolve
+ *
+ * Stopping test as in PCG: <C*r,r> <= max(tol^2 <C*b,b>, a_tol^2), or the
+ * same with the L2 inner product when two_norm is set.  The norm of the
+ * current residual is a by-product of the fused reduction, so the test costs
+ * no extra synchronization.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSolve( void *ppcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x )
+{
+   hypre_PipelinedPCGData *ppcg_data     = (hypre_PipelinedPCGData *)ppcg_vdata;
+   hypre_PCGFunctions     *pcg_functions = ppcg_data->functions;
+
+   HYPRE_Real      r_tol        = (ppcg_data -> tol);
+   HYPRE_Real      a_tol        = (ppcg_data -> a_tol);
+   HYPRE_Int       max_iter     = (ppcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (ppcg_data -> two_norm);
+   HYPRE_Int       recompute_residual_p = (ppcg_data -> recompute_residual_p);
+   void           *r            = (ppcg_data -> r);
+   void           *u            = (ppcg_data -> u);
+   void           *w            = (ppcg_data -> w);
+   void           *m            = (ppcg_data -> m);
+   void           *n            = (ppcg_data -> n);
+   void           *p            = (ppcg_data -> p);
+   void           *s            = (ppcg_data -> s);
+   void           *q            = (ppcg_data -> q);
+   void           *z            = (ppcg_data -> z);
+   void           *matvec_data  = (ppcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*, void*, void*, void*)   = (pcg_functions -> precond);
+   void           *precond_data = (ppcg_data -> precond_data);
+   HYPRE_Int       print_level  = (ppcg_data -> print_level);
+   HYPRE_Int       logging      = (ppcg_data -> logging);
+   HYPRE_Real     *norms        = (ppcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (ppcg_data -> rel_norms);
+
+   HYPRE_Real      alpha = 0.0, beta;
+   HYPRE_Real      gamma, gamma_old = 0.0, delta, denom;
+   HYPRE_Real      bi_prod, eps;
+   HYPRE_Real      i_prod = 0.0;
+   HYPRE_Real      ieee_check = 0.;
+
+   void           *x_vecs[3];
+   void           *y_vecs[3];
+   HYPRE_Real      local_prods[3];
+   HYPRE_Real      prods[3];
+   HYPRE_Int       num_prods;
+   hypre_MPI_Request request;
+
+   HYPRE_Int       i = 0, k;
+   HYPRE_Int       my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (ppcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A, &my_id, &num_procs);
+
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+      if (print_level > 1 && my_id == 0)
+      {
+         hypre_printf("<b,b>: %e\n", bi_prod);
+      }
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      bi_prod = (*(pcg_functions->InnerProd))(p, b);
+      if (print_level > 1 && my_id == 0)
+      {
+         hypre_printf("<C*b,b>: %e\n", bi_prod);
+      }
+   }
+
+   if (bi_prod != 0.) { ieee_check = bi_prod / bi_prod; } /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+         hypre_printf("ERROR -- hypre_PipelinedPCGSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied b.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   if (bi_prod > 0.0)
+   {
+      eps = hypre_max(r_tol * r_tol, a_tol * a_tol / bi_prod);
+   }
+   else    /* bi_prod==0.0: the rhs vector b is zero */
+   {
+      /* Set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging > 0 || print_level > 0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[0] = 0.0;
+      }
+      (ppcg_data -> num_iterations)    = 0;
+      (ppcg_data -> rel_residual_norm) = 0.0;
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /* r = b - Ax, u = C*r, w = A*u */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   (*(pcg_functions->ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+   /* the fused reduction: gamma = <r,u>, delta = <w,u> and, if needed, <r,r> */
+   x_vecs[0] = r;  y_vecs[0] = u;
+   x_vecs[1] = w;  y_vecs[1] = u;
+   x_vecs[2] = r;  y_vecs[2] = r;
+   num_prods = two_norm ? 3 : 2;
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+         hypre_printf("-----    ------------   ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
+
+   while (1)
+   {
+      /*--------------------------------------------------------------------
+       * Start the reduction, then compute m = C*w and n = A*m while it is
+       * in flight.
+       *--------------------------------------------------------------------*/
+
+      if (pcg_functions->InnerProdStart)
+      {
+         (*(pcg_functions->InnerProdStart))(num_prods, x_vecs, y_vecs,
+                                            local_prods, prods, &request);
+      }
+      else
+      {
+         for (k = 0; k < num_prods; k++)
+         {
+            prods[k] = (*(pcg_functions->InnerProd))(x_vecs[k], y_vecs[k]);
+         }
+      }
+
+      (*(pcg_functions->ClearVector))(m);
+      precond(precond_data, A, w, m);
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+
+      if (pcg_functions->InnerProdStart)
+      {
+         (*(pcg_functions->InnerProdWait))(&request);
+      }
+
+      gamma  = prods[0];
+      delta  = prods[1];
+      i_prod = two_norm ? prods[2] : gamma;
+
+      if (i == 0)
+      {
+         if (gamma != 0.) { ieee_check = gamma / gamma; } /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            if (print_level > 0 || logging > 0)
+            {
+               hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+               hypre_printf("ERROR -- hypre_PipelinedPCGSolve: INFs and/or NaNs detected in input.\n");
+               hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+               hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+               hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            HYPRE_ANNOTATE_FUNC_END;
+
+            return hypre_error_flag;
+         }
+      }
+
+      /* print norm info */
+      if ( logging > 0 || print_level > 0 )
+      {
+         norms[i]     = sqrt(i_prod);
+         rel_norms[i] = sqrt(i_prod / bi_prod);
+      }
+      if ( print_level > 1 && my_id == 0 && i > 0 )
+      {
+         hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                      norms[i] / norms[i - 1], rel_norms[i] );
+      }
+
+      /*--------------------------------------------------------------------
+       * check for convergence
+       *--------------------------------------------------------------------*/
+
+      if (i_prod / bi_prod < eps)
+      {
+         (ppcg_data -> converged) = 1;
+         break;
+      }
+      if (i >= max_iter)
+      {
+         break;
+      }
+      if (! (gamma > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in pipelined PCG");
+         break;
+      }
+
+      /*--------------------------------------------------------------------
+       * the core pipelined CG calculations...
+       *--------------------------------------------------------------------*/
+
+      if (i == 0)
+      {
+         beta  = 0.0;
+         denom = delta;
+      }
+      else
+      {
+         beta  = gamma / gamma_old;
+         denom = delta - beta * gamma / alpha;
+      }
+      if (denom == 0.0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero denominator in pipelined PCG");
+         break;
+      }
+      alpha = gamma / denom;
+      if (! (alpha > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal alpha value in pipelined PCG");
+         break;
+      }
+      gamma_old = gamma;
+
+      /* z = n + beta z, q = m + beta q, s = w + beta s, p = u + beta p */
+      if (i == 0)
+      {
+         (*(pcg_functions->CopyVector))(n, z);
+         (*(pcg_functions->CopyVector))(m, q);
+         (*(pcg_functions->CopyVector))(w, s);
+         (*(pcg_functions->CopyVector))(u, p);
+      }
+      else
+      {
+         (*(pcg_functions->ScaleVector))(beta, z);
+         (*(pcg_functions->Axpy))(1.0, n, z);
+         (*(pcg_functions->ScaleVector))(beta, q);
+         (*(pcg_functions->Axpy))(1.0, m, q);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+      }
+
+      /* x = x + alpha*p */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+
+      i++;
+
+      if (recompute_residual_p && !(i % recompute_residual_p))
+      {
+         /* residual replacement: recompute r, u, w and the auxiliary
+            recurrences s, q, z from their definitions */
+         if (print_level > 1 && my_id == 0)
+         {
+            hypre_printf("Recomputing the residual...\n");
+         }
+         (*(pcg_functions->CopyVector))(b, r);
+         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         (*(pcg_functions->ClearVector))(u);
+         precond(precond_data, A, r, u);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, p, 0.0, s);
+         (*(pcg_functions->ClearVector))(q);
+         precond(precond_data, A, s, q);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, q, 0.0, z);
+      }
+      else
+      {
+         /* r = r - alpha*s, u = u - alpha*q, w = w - alpha*z */
+         (*(pcg_functions->Axpy))(-alpha, s, r);
+         (*(pcg_functions->Axpy))(-alpha, q, u);
+         (*(pcg_functions->Axpy))(-alpha, z, w);
+      }
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (i >= max_iter && !(ppcg_data -> converged))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV,
+                        "Reached max iterations in pipelined PCG before convergence");
+   }
+
+   (ppcg_data -> num_iterations)    = i;
+   (ppcg_data -> rel_residual_norm) = sqrt(i_prod / bi_prod);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetTol, hypre_PipelinedPCGGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetTol( void       *ppcg_vdata,
+                          HYPRE_Real  tol )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   (ppcg_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetTol( void       *ppcg_vdata,
+                          HYPRE_Real *tol )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *tol = (ppcg_data -> tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetAbsoluteTol, hypre_PipelinedPCGGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetAbsoluteTol( void       *ppcg_vdata,
+                                  HYPRE_Real  a_tol )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   (ppcg_data -> a_tol) = a_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetAbsoluteTol( void       *ppcg_vdata,
+                                  HYPRE_Real *a_tol )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *a_tol = (ppcg_data -> a_tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetMaxIter, hypre_PipelinedPCGGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetMaxIter( void      *ppcg_vdata,
+                              HYPRE_Int  max_iter )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   (ppcg_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetMaxIter( void      *ppcg_vdata,
+                              HYPRE_Int *max_iter )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *max_iter = (ppcg_data -> max_iter);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetTwoNorm, hypre_PipelinedPCGGetTwoNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetTwoNorm( void      *ppcg_vdata,
+                              HYPRE_Int  two_norm )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   (ppcg_data -> two_norm) = two_norm;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetTwoNorm( void      *ppcg_vdata,
+                              HYPRE_Int *two_norm )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *two_norm = (ppcg_data -> two_norm);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetRecomputeResidualP, hypre_PipelinedPCGGetRecomputeResidualP
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetRecomputeResidualP( void      *ppcg_vdata,
+                                         HYPRE_Int  recompute_residual_p )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   (ppcg_data -> recompute_residual_p) = recompute_residual_p;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetRecomputeResidualP( void      *ppcg_vdata,
+                                         HYPRE_Int *recompute_residual_p )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *recompute_residual_p = (ppcg_data -> recompute_residual_p);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGGetPrecond( void         *ppcg_vdata,
+                              HYPRE_Solver *precond_data_ptr )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *precond_data_ptr = (HYPRE_Solver)(ppcg_data -> precond_data);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetPrecond( void  *ppcg_vdata,
+                              HYPRE_Int  (*precond)(void*, void*, void*, void*),
+                              HYPRE_Int  (*precond_setup)(void*, void*, void*, void*),
+                              void  *precond_data )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+   hypre_PCGFunctions     *pcg_functions = ppcg_data->functions;
+
+   (pcg_functions -> precond)       = precond;
+   (pcg_functions -> precond_setup) = precond_setup;
+   (ppcg_data -> precond_data)      = precond_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetPrintLevel, hypre_PipelinedPCGGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetPrintLevel( void      *ppcg_vdata,
+                                 HYPRE_Int  level )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   (ppcg_data -> print_level) = level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetPrintLevel( void      *ppcg_vdata,
+                                 HYPRE_Int *level )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *level = (ppcg_data -> print_level);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetLogging, hypre_PipelinedPCGGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetLogging( void      *ppcg_vdata,
+                              HYPRE_Int  level )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   (ppcg_data -> logging) = level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetLogging( void      *ppcg_vdata,
+                              HYPRE_Int *level )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *level = (ppcg_data -> logging);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGGetNumIterations( void      *ppcg_vdata,
+                                    HYPRE_Int *num_iterations )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *num_iterations = (ppcg_data -> num_iterations);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGGetConverged( void      *ppcg_vdata,
+                                HYPRE_Int *converged )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *converged = (ppcg_data -> converged);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGGetFinalRelativeResidualNorm( void       *ppcg_vdata,
+                                                HYPRE_Real *relative_residual_norm )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *relative_residual_norm = (ppcg_data -> rel_residual_norm);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGGetResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGGetResidual( void  *ppcg_vdata,
+                               void **residual )
+{
+   hypre_PipelinedPCGData *ppcg_data = (hypre_PipelinedPCGData *)ppcg_vdata;
+
+   *residual = (ppcg_data -> r);
+
+   return hypre_error_flag;
+}
@@ -1291,6 +1291,39 @@ HYPRE_BoomerAMGSetILULocalReordering( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGSetILULocalReordering( (void *) solver, ilu_reordering_type ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetILUTriSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetILUTriSolve( HYPRE_Solver  solver,
+                               HYPRE_Int         ilu_tri_solve)
+{
+   return ( hypre_BoomerAMGSetILUTriSolve( (void *) solver, ilu_tri_solve ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetILULowerJacobiIters
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetILULowerJacobiIters( HYPRE_Solver  solver,
+                                       HYPRE_Int         ilu_lower_jacobi_iters)
+{
+   return ( hypre_BoomerAMGSetILULowerJacobiIters( (void *) solver, ilu_lower_jacobi_iters ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetILUUpperJacobiIters
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetILUUpperJacobiIters( HYPRE_Solver  solver,
+                                       HYPRE_Int         ilu_upper_jacobi_iters)
+{
+   return ( hypre_BoomerAMGSetILUUpperJacobiIters( (void *) solver, ilu_upper_jacobi_iters ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetNumFunctions, HYPRE_BoomerAMGGetNumFunctions
  *--------------------------------------------------------------------------*/
@@ -1930,6 +1963,50 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSellNumLevels
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSellNumLevels (HYPRE_Solver solver,
+                                 HYPRE_Int    sell_num_levels)
+{
+   return (hypre_BoomerAMGSetSellNumLevels ( (void *) solver, sell_num_levels ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetSellNumLevels
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetSellNumLevels (HYPRE_Solver  solver,
+                                 HYPRE_Int    *sell_num_levels)
+{
+   return (hypre_BoomerAMGGetSellNumLevels ( (void *) solver, sell_num_levels ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFrozenPattern
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFrozenPattern (HYPRE_Solver solver,
+                                 HYPRE_Int    frozen_pattern)
+{
+   return (hypre_BoomerAMGSetFrozenPattern ( (void *) solver, frozen_pattern ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetFrozenPattern
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetFrozenPattern (HYPRE_Solver  solver,
+                                 HYPRE_Int    *frozen_pattern)
+{
+   return (hypre_BoomerAMGGetFrozenPattern ( (void *) solver, frozen_pattern ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
@@ -107,6 +107,12 @@ HYPRE_Int HYPRE_BoomerAMGSetup(HYPRE_Solver       solver,
  * If used as a preconditioner, this function should be passed
  * to the iterative solver \e SetPrecond function.
  *
+ * If \e b and \e x are multivectors (see \e HYPRE_ParMultiVectorCreate),
+ * all right-hand sides are solved simultaneously: the V-cycle relaxes and
+ * transfers all columns at once, and the iteration stops when every column
+ * has converged. Configurations without a fused multivector path (e.g.
+ * complex smoothers or the additive cycles) solve the columns one at a time.
+ *
  * @param solver [IN] solver or preconditioner object to be applied.
  * @param A [IN] ParCSR matrix, matrix of the linear system to be solved
  * @param b [IN] right hand side of the linear system to be solved
@@ -1086,6 +1092,30 @@ HYPRE_Int HYPRE_BoomerAMGSetILUMaxIter( HYPRE_Solver  solver,
 HYPRE_Int HYPRE_BoomerAMGSetILUDroptol( HYPRE_Solver  solver,
                                         HYPRE_Real        ilu_droptol);
 
+/**
+ * Defines the triangular solve type of the ILU smoother (0 iterative,
+ * 1 direct, default).
+ * For further explanation see description of ILU.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetILUTriSolve( HYPRE_Solver  solver,
+                                         HYPRE_Int         ilu_tri_solve);
+
+/**
+ * Defines number of Jacobi sweeps for the L solve of the ILU smoother
+ * when the iterative triangular solve is used.
+ * For further explanation see description of ILU.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetILULowerJacobiIters( HYPRE_Solver  solver,
+                                                 HYPRE_Int         ilu_lower_jacobi_iters);
+
+/**
+ * Defines number of Jacobi sweeps for the U solve of the ILU smoother
+ * when the iterative triangular solve is used.
+ * For further explanation see description of ILU.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetILUUpperJacobiIters( HYPRE_Solver  solver,
+                                                 HYPRE_Int         ilu_upper_jacobi_iters);
+
 /**
  * (Optional) Defines which parallel restriction operator is used.
  * There are the following options for restr_type:
@@ -1204,6 +1234,54 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                           HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) Number of levels, starting from the finest, on which the host
+ * matvecs with A and P use a SELL-C-sigma (sliced ELLPACK) copy of the
+ * local matrices. The copy is built during the setup and roughly doubles
+ * the memory used by the matrices of these levels.  The SELL matvecs
+ * themselves are faster than the CSR ones, but the smoothers still read
+ * the CSR matrices, so the extra copy competes with them for cache and a
+ * full solve is not necessarily faster; for a 7-point Laplacian on a
+ * single process the solve time was unchanged or a few percent slower.
+ * The user's matrix A gets its previous setting back in
+ * HYPRE_BoomerAMGDestroy, so it must still exist at that point.
+ * The default is 0, i.e. plain CSR matvecs on all levels.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSellNumLevels(HYPRE_Solver solver,
+                                          HYPRE_Int    sell_num_levels);
+
+/**
+ * Returns the number of levels that use SELL-C-sigma matvecs.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetSellNumLevels(HYPRE_Solver  solver,
+                                          HYPRE_Int    *sell_num_levels);
+
+/**
+ * (Optional) If set to 1, repeated calls to HYPRE_BoomerAMGSetup with a
+ * matrix whose sparsity pattern has not changed reuse the coarse grids
+ * (CF splittings) and the sparsity patterns of the interpolation operators
+ * of the previous setup. The coarsening is skipped; the interpolation set
+ * by HYPRE_BoomerAMGSetInterpType (with its truncation and post-smoothing)
+ * is built from the new matrix and restricted to the old pattern, and each
+ * row is rescaled to keep its row sum, as in the truncation. The coarse
+ * operators are recomputed by the Galerkin product, whose symbolic phase
+ * and communication setup are also kept from the previous setup (unless a
+ * drop tolerance is set for the coarse matrices). The pattern is taken as
+ * unchanged if a hash of the local rows and column indices of the matrix
+ * matches the previous setup on all processes; set the option to 0 to force
+ * a full setup. Only the host scalar setup is supported (one function, no
+ * nodal or aggressive coarsening, no additive cycles, no AIR). The default
+ * is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFrozenPattern(HYPRE_Solver solver,
+                                          HYPRE_Int    frozen_pattern);
+
+/**
+ * Returns whether pattern-frozen re-setups are enabled.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetFrozenPattern(HYPRE_Solver  solver,
+                                          HYPRE_Int    *frozen_pattern);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2499,6 +2577,82 @@ HYPRE_Int HYPRE_ParCSROnProcTriSolve(HYPRE_Solver       solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name ParCSR Pipelined PCG Solver
+ *
+ * Pipelined PCG with one fused, non-blocking global reduction per
+ * iteration.  See the generic pipelined PCG interface in \ref KrylovSolvers.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRPipelinedPCGCreate(MPI_Comm     comm,
+                                         HYPRE_Solver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRPipelinedPCGDestroy(HYPRE_Solver solver);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetup(HYPRE_Solver       solver,
+                                        HYPRE_ParCSRMatrix A,
+                                        HYPRE_ParVector    b,
+                                        HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSolve(HYPRE_Solver       solver,
+                                        HYPRE_ParCSRMatrix A,
+                                        HYPRE_ParVector    b,
+                                        HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetTol(HYPRE_Solver solver,
+                                         HYPRE_Real   tol);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetAbsoluteTol(HYPRE_Solver solver,
+                                                 HYPRE_Real   a_tol);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetMaxIter(HYPRE_Solver solver,
+                                             HYPRE_Int    max_iter);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetTwoNorm(HYPRE_Solver solver,
+                                             HYPRE_Int    two_norm);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetRecomputeResidualP(HYPRE_Solver solver,
+                                                        HYPRE_Int    recompute_residual_p);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetPrecond(HYPRE_Solver            solver,
+                                             HYPRE_PtrToParSolverFcn precond,
+                                             HYPRE_PtrToParSolverFcn precond_setup,
+                                             HYPRE_Solver            precond_solver);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetPrecond(HYPRE_Solver solver,
+                                             HYPRE_Solver *precond_data);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetLogging(HYPRE_Solver solver,
+                                             HYPRE_Int    logging);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetPrintLevel(HYPRE_Solver solver,
+                                                HYPRE_Int    print_level);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetNumIterations(HYPRE_Solver solver,
+                                                   HYPRE_Int    *num_iterations);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetFinalRelativeResidualNorm(HYPRE_Solver solver,
+                                                               HYPRE_Real   *norm);
+
+/**
+ * Returns the residual.
+ **/
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetResidual(HYPRE_Solver    solver,
+                                              HYPRE_ParVector *residual);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -2614,6 +2768,9 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS(HYPRE_Solver solver,
                                     HYPRE_Int    cgs);
 
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStep(HYPRE_Solver solver,
+                                      HYPRE_Int    s_step);
+
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol(HYPRE_Solver solver,
                                     HYPRE_Real   tol);
 
@@ -4157,6 +4314,54 @@ HYPRE_ILUSetType( HYPRE_Solver solver, HYPRE_Int ilu_type );
 HYPRE_Int
 HYPRE_ILUSetLocalReordering( HYPRE_Solver solver, HYPRE_Int reordering_type );
 
+/**
+ * (Optional) Set the type of triangular solve used by the block Jacobi
+ * variants (\e ilu_type 0 and 1) on the host.
+ *
+ * Options for \e tri_solve are:
+ *    - 0 : iterative, a fixed number of Jacobi sweeps on L and U
+ *    - 1 : direct (default); with more than one OpenMP thread the rows of
+ *          L and U are grouped into independent levels during setup and
+ *          each level is solved in parallel
+ **/
+HYPRE_Int
+HYPRE_ILUSetTriSolve( HYPRE_Solver solver, HYPRE_Int tri_solve );
+
+/**
+ * (Optional) Set the number of Jacobi sweeps for the L solve when
+ * \e tri_solve is 0. The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetLowerJacobiIters( HYPRE_Solver solver, HYPRE_Int lower_jacobi_iters );
+
+/**
+ * (Optional) Set the number of Jacobi sweeps for the U solve when
+ * \e tri_solve is 0. The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetUpperJacobiIters( HYPRE_Solver solver, HYPRE_Int upper_jacobi_iters );
+
+/**
+ * (Optional) Set the type of factorization used by the block Jacobi ILU(k)
+ * variants (\e ilu_type 0 and the default) on the host. With more than one
+ * OpenMP thread both the symbolic and the numeric factorization are threaded.
+ *
+ * Options for \e iter_setup_type are:
+ *    - 0 : exact (default); the rows of each level of L are factored in
+ *          parallel, giving the same factors as the sequential setup
+ *    - 1 : iterative, a fixed number of fixed-point sweeps on the ILU(k)
+ *          pattern (Chow and Patel); cheaper, the factors are approximate
+ **/
+HYPRE_Int
+HYPRE_ILUSetIterativeSetupType( HYPRE_Solver solver, HYPRE_Int iter_setup_type );
+
+/**
+ * (Optional) Set the number of fixed-point sweeps of the factorization when
+ * \e iter_setup_type is 1. The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetIterativeSetupMaxIter( HYPRE_Solver solver, HYPRE_Int iter_setup_max_iter );
+
 /**
  * (Optional) Set the print level to print setup and solve information.
  *
@@ -105,6 +105,9 @@ hypre_BoomerAMGCreate()
    HYPRE_Int    ilu_max_iter;
    HYPRE_Real   ilu_droptol;
    HYPRE_Int    ilu_reordering_type;
+   HYPRE_Int    ilu_tri_solve;
+   HYPRE_Int    ilu_lower_jacobi_iters;
+   HYPRE_Int    ilu_upper_jacobi_iters;
 
    HYPRE_Int cheby_order;
    HYPRE_Int cheby_eig_est;
@@ -207,6 +210,9 @@ hypre_BoomerAMGCreate()
    ilu_max_iter = 1;
    ilu_droptol = 0.01;
    ilu_reordering_type = 1;
+   ilu_tri_solve = 1;
+   ilu_lower_jacobi_iters = 5;
+   ilu_upper_jacobi_iters = 5;
 
    /* solve params */
    min_iter  = 0;
@@ -343,6 +349,9 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetILUDroptol(amg_data, ilu_droptol);
    hypre_BoomerAMGSetILUMaxIter(amg_data, ilu_max_iter);
    hypre_BoomerAMGSetILULocalReordering(amg_data, ilu_reordering_type);
+   hypre_BoomerAMGSetILUTriSolve(amg_data, ilu_tri_solve);
+   hypre_BoomerAMGSetILULowerJacobiIters(amg_data, ilu_lower_jacobi_iters);
+   hypre_BoomerAMGSetILUUpperJacobiIters(amg_data, ilu_upper_jacobi_iters);
 
    hypre_BoomerAMGSetMinIter(amg_data, min_iter);
    hypre_BoomerAMGSetMaxIter(amg_data, max_iter);
@@ -470,6 +479,17 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataRAP2(amg_data)              = rap2;
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
    hypre_ParAMGDataModularizedMatMat(amg_data) = modu_rap;
+   hypre_ParAMGDataSellNumLevels(amg_data)     = 0;
+   hypre_ParAMGDataSellA(amg_data)             = NULL;
+   hypre_ParAMGDataSellASigma(amg_data)        = 0;
+
+   hypre_ParAMGDataFrozenPattern(amg_data)        = 0;
+   hypre_ParAMGDataFrozenNumLevels(amg_data)      = 0;
+   hypre_ParAMGDataFrozenPatternHash(amg_data)    = 0;
+   hypre_ParAMGDataFrozenCFMarkerArray(amg_data)  = NULL;
+   hypre_ParAMGDataFrozenPArray(amg_data)         = NULL;
+   hypre_ParAMGDataFrozenAPPlanArray(amg_data)    = NULL;
+   hypre_ParAMGDataFrozenRAPPlanArray(amg_data)   = NULL;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -518,6 +538,14 @@ hypre_BoomerAMGDestroy( void *data )
    }
 #endif
 
+   /* leave the user's matrix as it was before the setup */
+   if (hypre_ParAMGDataSellA(amg_data))
+   {
+      hypre_ParCSRMatrixSetSellSigma(hypre_ParAMGDataSellA(amg_data),
+                                     hypre_ParAMGDataSellASigma(amg_data));
+      hypre_ParAMGDataSellA(amg_data) = NULL;
+   }
+
    if (hypre_ParAMGDataMaxEigEst(amg_data))
    {
       hypre_TFree(hypre_ParAMGDataMaxEigEst(amg_data), HYPRE_MEMORY_HOST);
@@ -705,6 +733,7 @@ hypre_BoomerAMGDestroy( void *data )
    hypre_TFree(hypre_ParAMGDataPBlockArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataPArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataCFMarkerArray(amg_data), HYPRE_MEMORY_HOST);
+   hypre_BoomerAMGDestroyFrozenPattern(amg_data);
 
    if (hypre_ParAMGDataRtemp(amg_data))
    {
@@ -4218,6 +4247,51 @@ hypre_BoomerAMGSetILULocalReordering( void     *data,
    return hypre_error_flag;
 }
 HYPRE_Int
+hypre_BoomerAMGSetILUTriSolve( void     *data,
+                               HYPRE_Int       ilu_tri_solve)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataILUTriSolve(amg_data) = ilu_tri_solve;
+
+   return hypre_error_flag;
+}
+HYPRE_Int
+hypre_BoomerAMGSetILULowerJacobiIters( void     *data,
+                                       HYPRE_Int       ilu_lower_jacobi_iters)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataILULowerJacobiIters(amg_data) = ilu_lower_jacobi_iters;
+
+   return hypre_error_flag;
+}
+HYPRE_Int
+hypre_BoomerAMGSetILUUpperJacobiIters( void     *data,
+                                       HYPRE_Int       ilu_upper_jacobi_iters)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataILUUpperJacobiIters(amg_data) = ilu_upper_jacobi_iters;
+
+   return hypre_error_flag;
+}
+HYPRE_Int
 hypre_BoomerAMGSetChebyOrder( void     *data,
                               HYPRE_Int       order)
 {
@@ -4702,6 +4776,125 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetSellNumLevels( void       *data,
+                                 HYPRE_Int   sell_num_levels)
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (sell_num_levels < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataSellNumLevels(amg_data) = sell_num_levels;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetSellNumLevels( void       *data,
+                                 HYPRE_Int  *sell_num_levels)
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *sell_num_levels = hypre_ParAMGDataSellNumLevels(amg_data);
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetFrozenPattern( void       *data,
+                                 HYPRE_Int   frozen_pattern)
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataFrozenPattern(amg_data) = frozen_pattern;
+   if (!frozen_pattern)
+   {
+      hypre_BoomerAMGDestroyFrozenPattern(data);
+   }
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetFrozenPattern( void       *data,
+                                 HYPRE_Int  *frozen_pattern)
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *frozen_pattern = hypre_ParAMGDataFrozenPattern(amg_data);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGDestroyFrozenPattern
+ *
+ * Frees the CF splittings, interpolation patterns and product plans saved
+ * for a pattern-frozen re-setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGDestroyFrozenPattern( void *data )
+{
+   hypre_ParAMGData     *amg_data = (hypre_ParAMGData*) data;
+   hypre_IntArray      **frozen_CF_marker_array = hypre_ParAMGDataFrozenCFMarkerArray(amg_data);
+   hypre_ParCSRMatrix  **frozen_P_array = hypre_ParAMGDataFrozenPArray(amg_data);
+   hypre_ParMatmulPlan **AP_plans  = hypre_ParAMGDataFrozenAPPlanArray(amg_data);
+   hypre_ParMatmulPlan **RAP_plans = hypre_ParAMGDataFrozenRAPPlanArray(amg_data);
+   HYPRE_Int             num_levels = hypre_ParAMGDataFrozenNumLevels(amg_data);
+   HYPRE_Int             i;
+
+   if (frozen_CF_marker_array)
+   {
+      for (i = 0; i < num_levels; i++)
+      {
+         hypre_IntArrayDestroy(frozen_CF_marker_array[i]);
+         if (frozen_P_array[i])
+         {
+            hypre_ParCSRMatrixDestroy(frozen_P_array[i]);
+         }
+         hypre_ParMatmulPlanDestroy(AP_plans[i]);
+         hypre_ParMatmulPlanDestroy(RAP_plans[i]);
+      }
+      hypre_TFree(frozen_CF_marker_array, HYPRE_MEMORY_HOST);
+      hypre_TFree(frozen_P_array, HYPRE_MEMORY_HOST);
+      hypre_TFree(AP_plans, HYPRE_MEMORY_HOST);
+      hypre_TFree(RAP_plans, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParAMGDataFrozenCFMarkerArray(amg_data) = NULL;
+   hypre_ParAMGDataFrozenPArray(amg_data) = NULL;
+   hypre_ParAMGDataFrozenAPPlanArray(amg_data) = NULL;
+   hypre_ParAMGDataFrozenRAPPlanArray(amg_data) = NULL;
+   hypre_ParAMGDataFrozenNumLevels(amg_data) = 0;
+   hypre_ParAMGDataFrozenPatternHash(amg_data) = 0;
+
+   return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
@@ -143,6 +143,9 @@ typedef struct
    HYPRE_Int            ilu_max_iter;
    HYPRE_Real           ilu_droptol;
    HYPRE_Int            ilu_reordering_type;
+   HYPRE_Int            ilu_tri_solve;
+   HYPRE_Int            ilu_lower_jacobi_iters;
+   HYPRE_Int            ilu_upper_jacobi_iters;
 
    HYPRE_Real          *max_eig_est;
    HYPRE_Real          *min_eig_est;
@@ -241,6 +244,23 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* number of levels whose matvecs use the SELL-C-sigma storage */
+   HYPRE_Int sell_num_levels;
+   /* user matrix A whose SELL setting the setup changed, and the setting
+      given back to it on destroy */
+   hypre_ParCSRMatrix *sell_A;
+   HYPRE_Int           sell_A_sigma;
+
+   /* pattern-frozen re-setup: CF splittings and interpolation patterns kept
+      from the previous setup, reused while the pattern of A is unchanged */
+   HYPRE_Int             frozen_pattern;
+   HYPRE_Int             frozen_num_levels;
+   hypre_ulonglongint    frozen_pattern_hash;   /* of the local pattern of A */
+   hypre_IntArray      **frozen_CF_marker_array;
+   hypre_ParCSRMatrix  **frozen_P_array;
+   hypre_ParMatmulPlan **frozen_AP_plan_array;  /* symbolic plans of A*P */
+   hypre_ParMatmulPlan **frozen_RAP_plan_array; /* and of P^T*(AP) */
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -385,6 +405,9 @@ typedef struct
 #define hypre_ParAMGDataILUDroptol(amg_data) ((amg_data)->ilu_droptol)
 #define hypre_ParAMGDataILUMaxIter(amg_data) ((amg_data)->ilu_max_iter)
 #define hypre_ParAMGDataILULocalReordering(amg_data) ((amg_data)->ilu_reordering_type)
+#define hypre_ParAMGDataILUTriSolve(amg_data) ((amg_data)->ilu_tri_solve)
+#define hypre_ParAMGDataILULowerJacobiIters(amg_data) ((amg_data)->ilu_lower_jacobi_iters)
+#define hypre_ParAMGDataILUUpperJacobiIters(amg_data) ((amg_data)->ilu_upper_jacobi_iters)
 
 #define hypre_ParAMGDataMaxEigEst(amg_data) ((amg_data)->max_eig_est)
 #define hypre_ParAMGDataMinEigEst(amg_data) ((amg_data)->min_eig_est)
@@ -490,6 +513,16 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataSellNumLevels(amg_data) ((amg_data)->sell_num_levels)
+#define hypre_ParAMGDataSellA(amg_data) ((amg_data)->sell_A)
+#define hypre_ParAMGDataSellASigma(amg_data) ((amg_data)->sell_A_sigma)
+#define hypre_ParAMGDataFrozenPattern(amg_data) ((amg_data)->frozen_pattern)
+#define hypre_ParAMGDataFrozenNumLevels(amg_data) ((amg_data)->frozen_num_levels)
+#define hypre_ParAMGDataFrozenPatternHash(amg_data) ((amg_data)->frozen_pattern_hash)
+#define hypre_ParAMGDataFrozenCFMarkerArray(amg_data) ((amg_data)->frozen_CF_marker_array)
+#define hypre_ParAMGDataFrozenPArray(amg_data) ((amg_data)->frozen_P_array)
+#define hypre_ParAMGDataFrozenAPPlanArray(amg_data) ((amg_data)->frozen_AP_plan_array)
+#define hypre_ParAMGDataFrozenRAPPlanArray(amg_data) ((amg_data)->frozen_RAP_plan_array)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
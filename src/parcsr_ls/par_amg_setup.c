@@ -128,6 +128,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 #if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_HIP)
    HYPRE_Int       num_threads = hypre_NumThreads();
 #endif
+   HYPRE_Int       frozen_pattern, use_frozen = 0, frozen_level = 0, frozen_interp = 0;
    HYPRE_Int      *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
    HYPRE_Int       num_functions = hypre_ParAMGDataNumFunctions(amg_data);
    HYPRE_Int       nodal = hypre_ParAMGDataNodal(amg_data);
@@ -164,6 +165,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int     ilu_max_iter;
    HYPRE_Real    ilu_droptol;
    HYPRE_Int     ilu_reordering_type;
+   HYPRE_Int     ilu_tri_solve;
+   HYPRE_Int     ilu_lower_jacobi_iters;
+   HYPRE_Int     ilu_upper_jacobi_iters;
    HYPRE_Int     needZ = 0;
 
    HYPRE_Int interp_type, restri_type;
@@ -197,6 +201,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       addlvl = hypre_max(mult_addlvl, additive);
    HYPRE_Int       rap2 = hypre_ParAMGDataRAP2(amg_data);
    HYPRE_Int       keepTranspose = hypre_ParAMGDataKeepTranspose(amg_data);
+   HYPRE_Int       sell_num_levels = hypre_ParAMGDataSellNumLevels(amg_data);
 
    HYPRE_Int       local_coarse_size;
    HYPRE_Int       num_C_points_coarse      = hypre_ParAMGDataNumCPoints(amg_data);
@@ -249,6 +254,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    ilu_droptol = hypre_ParAMGDataILUDroptol(amg_data);
    ilu_max_iter = hypre_ParAMGDataILUMaxIter(amg_data);
    ilu_reordering_type = hypre_ParAMGDataILULocalReordering(amg_data);
+   ilu_tri_solve = hypre_ParAMGDataILUTriSolve(amg_data);
+   ilu_lower_jacobi_iters = hypre_ParAMGDataILULowerJacobiIters(amg_data);
+   ilu_upper_jacobi_iters = hypre_ParAMGDataILUUpperJacobiIters(amg_data);
    interp_type = hypre_ParAMGDataInterpType(amg_data);
    restri_type = hypre_ParAMGDataRestriction(amg_data); /* RL */
    post_interp_type = hypre_ParAMGDataPostInterpType(amg_data);
@@ -371,6 +379,33 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    hypre_ParAMGDataBlockMode(amg_data) = block_mode;
 
+   /* pattern-frozen re-setup, only for the scalar host setup */
+   frozen_pattern = hypre_ParAMGDataFrozenPattern(amg_data);
+   if (block_mode || nodal || num_functions > 1 || agg_num_levels > 0 || mult_addlvl > -1 ||
+       interp_vec_variant || interp_refine || restri_type || interp_type == 1 ||
+       hypre_ParAMGDataGSMG(amg_data) || hypre_ParAMGDataNumCPoints(amg_data) > 0 ||
+       coarsen_type == 98 || coarsen_type == 99 || max_levels == 1 ||
+       hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) != HYPRE_EXEC_HOST)
+   {
+      frozen_pattern = 0;
+   }
+   if (frozen_pattern && hypre_ParAMGDataFrozenCFMarkerArray(amg_data))
+   {
+      /* the pattern of A is unchanged if the hash of its local pattern
+         matches the one of the previous setup on all processes */
+      hypre_IntArray *frozen_CF_marker = hypre_ParAMGDataFrozenCFMarkerArray(amg_data)[0];
+      HYPRE_Int       local_same;
+
+      local_same = (frozen_CF_marker && hypre_IntArraySize(frozen_CF_marker) == local_size &&
+                    hypre_ParAMGDataFrozenNumLevels(amg_data) <= max_levels &&
+                    hypre_ParAMGDataFrozenPatternHash(amg_data) == hypre_ParCSRMatrixPatternHash(A));
+      hypre_MPI_Allreduce(&local_same, &use_frozen, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   }
+   if (!use_frozen)
+   {
+      hypre_BoomerAMGDestroyFrozenPattern(amg_data);
+   }
+
 
    /* end of systems checks */
 
@@ -399,7 +434,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       for (j = 0; j < old_num_levels - 1; j++)
       {
-         if (P_array[j])
+         if (P_array[j] && use_frozen && !hypre_ParAMGDataFrozenPArray(amg_data)[j])
+         {
+            /* keep the interpolation pattern for the re-setup */
+            hypre_ParAMGDataFrozenPArray(amg_data)[j] = P_array[j];
+            P_array[j] = NULL;
+         }
+         else if (P_array[j])
          {
             hypre_ParCSRMatrixDestroy(P_array[j]);
             P_array[j] = NULL;
@@ -645,6 +686,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    A_array[0] = A;
 
+   /* give the previous fine grid matrix its own SELL setting back; the
+      values of A may also have changed since the last setup */
+   if (hypre_ParAMGDataSellA(amg_data))
+   {
+      hypre_ParCSRMatrixSetSellSigma(hypre_ParAMGDataSellA(amg_data),
+                                     hypre_ParAMGDataSellASigma(amg_data));
+      hypre_ParAMGDataSellA(amg_data) = NULL;
+   }
+   hypre_ParCSRMatrixSellInvalidate(A);
+
    /* interp vectors setup */
    if (interp_vec_variant == 1)
    {
@@ -945,6 +996,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                             level, &SmoothVecs);
          }
 
+         /* a pattern-frozen level keeps the splitting and the interpolation
+            pattern of the previous setup; the interpolation is built as
+            usual and then restricted to the old pattern */
+         frozen_level = use_frozen && level < hypre_ParAMGDataFrozenNumLevels(amg_data) - 1 &&
+                        hypre_ParAMGDataFrozenCFMarkerArray(amg_data)[level] &&
+                        hypre_ParAMGDataFrozenPArray(amg_data)[level];
+         frozen_interp = 0;
+
          /**** Get the Strength Matrix ****/
          if (hypre_ParAMGDataGSMG(amg_data) == 0)
          {
@@ -1067,7 +1126,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          if (nodal == 0) /* no nodal coarsening */
          {
-            if (coarsen_type == 6)
+            if (frozen_level)
+            {
+               /* reuse the splitting of the previous setup */
+               hypre_IntArrayCopy(hypre_ParAMGDataFrozenCFMarkerArray(amg_data)[level],
+                                  CF_marker_array[level]);
+            }
+            else if (coarsen_type == 6)
                hypre_BoomerAMGCoarsenFalgout(S, A_array[level], measure_type,
                                              coarsen_cut_factor, debug_flag, &(CF_marker_array[level]));
             else if (coarsen_type == 7)
@@ -1391,6 +1456,26 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
          }
 
+         /* save the splitting for a pattern-frozen re-setup */
+         if (frozen_pattern && !frozen_level)
+         {
+            if (!hypre_ParAMGDataFrozenCFMarkerArray(amg_data))
+            {
+               hypre_ParAMGDataFrozenCFMarkerArray(amg_data) =
+                  hypre_CTAlloc(hypre_IntArray *, max_levels, HYPRE_MEMORY_HOST);
+               hypre_ParAMGDataFrozenPArray(amg_data) =
+                  hypre_CTAlloc(hypre_ParCSRMatrix *, max_levels, HYPRE_MEMORY_HOST);
+               hypre_ParAMGDataFrozenAPPlanArray(amg_data) =
+                  hypre_CTAlloc(hypre_ParMatmulPlan *, max_levels, HYPRE_MEMORY_HOST);
+               hypre_ParAMGDataFrozenRAPPlanArray(amg_data) =
+                  hypre_CTAlloc(hypre_ParMatmulPlan *, max_levels, HYPRE_MEMORY_HOST);
+               hypre_ParAMGDataFrozenNumLevels(amg_data) = max_levels;
+            }
+            hypre_IntArrayDestroy(hypre_ParAMGDataFrozenCFMarkerArray(amg_data)[level]);
+            hypre_ParAMGDataFrozenCFMarkerArray(amg_data)[level] =
+               hypre_IntArrayCloneDeep(CF_marker_array[level]);
+         }
+
          /**************************************************/
          /*********Set the fixed index to CF_marker*********/
          /* copy CF_marker to the host if needed */
@@ -2529,6 +2614,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                       level, jacobi_trunc_threshold, 0.5 * jacobi_trunc_threshold );
       }
 
+      /* the new weights on the interpolation pattern of the previous setup */
+      if (frozen_level)
+      {
+         hypre_BoomerAMGBuildInterpOnPattern(P, hypre_ParAMGDataFrozenPArray(amg_data)[level]);
+         hypre_ParCSRMatrixDestroy(P);
+         P = hypre_ParAMGDataFrozenPArray(amg_data)[level];
+         hypre_ParAMGDataFrozenPArray(amg_data)[level] = NULL;
+         frozen_interp = 1;
+      }
+
       dof_func_data = NULL;
       if (dof_func_array[level + 1])
       {
@@ -2878,6 +2973,23 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             /* Delete AP */
             hypre_ParCSRMatrixDestroy(Q);
          }
+         else if (frozen_pattern && hypre_ParAMGDataADropTol(amg_data) <= 0.0)
+         {
+            /* Galerkin product with symbolic plans, kept while the
+               interpolation pattern is frozen */
+            hypre_ParMatmulPlan **AP_plans  = hypre_ParAMGDataFrozenAPPlanArray(amg_data);
+            hypre_ParMatmulPlan **RAP_plans = hypre_ParAMGDataFrozenRAPPlanArray(amg_data);
+
+            if (!frozen_interp)
+            {
+               hypre_ParMatmulPlanDestroy(AP_plans[level]);
+               hypre_ParMatmulPlanDestroy(RAP_plans[level]);
+               AP_plans[level]  = NULL;
+               RAP_plans[level] = NULL;
+            }
+            hypre_BoomerAMGBuildCoarseOperatorPlan(P_array[level], A_array[level], P_array[level],
+                                                   &AP_plans[level], &RAP_plans[level], &A_H);
+         }
          else
          {
             /* Compute standard Galerkin coarse-grid product */
@@ -3034,12 +3146,60 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    num_levels = level + 1;
    hypre_ParAMGDataNumLevels(amg_data) = num_levels;
+
+   if (hypre_ParAMGDataFrozenCFMarkerArray(amg_data))
+   {
+      /* only the splittings of the levels with an interpolation are kept */
+      for (j = num_levels - 1; j < hypre_ParAMGDataFrozenNumLevels(amg_data); j++)
+      {
+         hypre_IntArrayDestroy(hypre_ParAMGDataFrozenCFMarkerArray(amg_data)[j]);
+         hypre_ParAMGDataFrozenCFMarkerArray(amg_data)[j] = NULL;
+         if (hypre_ParAMGDataFrozenPArray(amg_data)[j])
+         {
+            hypre_ParCSRMatrixDestroy(hypre_ParAMGDataFrozenPArray(amg_data)[j]);
+            hypre_ParAMGDataFrozenPArray(amg_data)[j] = NULL;
+         }
+         hypre_ParMatmulPlanDestroy(hypre_ParAMGDataFrozenAPPlanArray(amg_data)[j]);
+         hypre_ParMatmulPlanDestroy(hypre_ParAMGDataFrozenRAPPlanArray(amg_data)[j]);
+         hypre_ParAMGDataFrozenAPPlanArray(amg_data)[j]  = NULL;
+         hypre_ParAMGDataFrozenRAPPlanArray(amg_data)[j] = NULL;
+      }
+      hypre_ParAMGDataFrozenNumLevels(amg_data) = num_levels;
+      hypre_ParAMGDataFrozenPatternHash(amg_data) = hypre_ParCSRMatrixPatternHash(A);
+   }
    if (hypre_ParAMGDataSmoothNumLevels(amg_data) > num_levels - 1)
    {
       hypre_ParAMGDataSmoothNumLevels(amg_data) = num_levels;
    }
    smooth_num_levels = hypre_ParAMGDataSmoothNumLevels(amg_data);
 
+   /*-----------------------------------------------------------------------
+    * Switch the matvecs of the finest levels to SELL-C-sigma storage
+    *-----------------------------------------------------------------------*/
+
+   if (sell_num_levels > 0 && num_levels > 0)
+   {
+      /* A_array[0] is the user's matrix, restored in hypre_BoomerAMGDestroy */
+      hypre_ParAMGDataSellA(amg_data)      = A_array[0];
+      hypre_ParAMGDataSellASigma(amg_data) =
+         hypre_CSRMatrixSellSigma(hypre_ParCSRMatrixDiag(A_array[0]));
+   }
+   for (level = 0; level < hypre_min(sell_num_levels, num_levels); level++)
+   {
+      hypre_ParCSRMatrixSetSellSigma(A_array[level], hypre_CSR_SELL_SIGMA);
+      if (level < num_levels - 1)
+      {
+         if (P_array[level])
+         {
+            hypre_ParCSRMatrixSetSellSigma(P_array[level], hypre_CSR_SELL_SIGMA);
+         }
+         if (R_array && R_array[level])
+         {
+            hypre_ParCSRMatrixSetSellSigma(R_array[level], hypre_CSR_SELL_SIGMA);
+         }
+      }
+   }
+
    /*-----------------------------------------------------------------------
     * Setup of special smoothers when needed
     *-----------------------------------------------------------------------*/
@@ -3362,6 +3522,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          HYPRE_ILUCreate( &smoother[j]);
          HYPRE_ILUSetType( smoother[j], ilu_type);
          HYPRE_ILUSetLocalReordering( smoother[j], ilu_reordering_type);
+         HYPRE_ILUSetTriSolve( smoother[j], ilu_tri_solve);
+         HYPRE_ILUSetLowerJacobiIters( smoother[j], ilu_lower_jacobi_iters);
+         HYPRE_ILUSetUpperJacobiIters( smoother[j], ilu_upper_jacobi_iters);
          HYPRE_ILUSetMaxIter(smoother[j], ilu_max_iter);
          HYPRE_ILUSetTol(smoother[j], 0.);
          HYPRE_ILUSetDropThreshold(smoother[j], ilu_droptol);
@@ -80,6 +80,14 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    hypre_ParVector  *Vtemp;
    hypre_ParVector  *Residual;
 
+#if !defined(HYPRE_USING_GPU)
+   /* block right-hand sides: cycle all columns at once */
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      return hypre_BoomerAMGSolveMultiVec(amg_vdata, A, f, u);
+   }
+#endif
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
@@ -406,3 +414,337 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVecCopy
+ *
+ * y = x for multivectors that may use different storage methods
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiVecCopy( hypre_ParVector *x,
+                             hypre_ParVector *y )
+{
+   hypre_Vector  *x_local     = hypre_ParVectorLocalVector(x);
+   hypre_Vector  *y_local     = hypre_ParVectorLocalVector(y);
+   HYPRE_Complex *x_data      = hypre_VectorData(x_local);
+   HYPRE_Complex *y_data      = hypre_VectorData(y_local);
+   HYPRE_Int      size        = hypre_VectorSize(x_local);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x_local);
+   HYPRE_Int      x_vs        = hypre_VectorVectorStride(x_local);
+   HYPRE_Int      x_is        = hypre_VectorIndexStride(x_local);
+   HYPRE_Int      y_vs        = hypre_VectorVectorStride(y_local);
+   HYPRE_Int      y_is        = hypre_VectorIndexStride(y_local);
+   HYPRE_Int      i, jv;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         y_data[i * y_is + jv * y_vs] = x_data[i * x_is + jv * x_vs];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveMultiVec
+ *
+ * Solves A u = f for all columns of the multivectors f and u (host
+ * memory). For plain cycles (no block mode, additive cycles, complex
+ * smoothers, explicit relaxation points or partial cycles), all columns
+ * are cycled together by hypre_BoomerAMGCycleMultiVec, so that the
+ * operators of each level are streamed once per cycle for all right-hand
+ * sides. Otherwise, the columns are solved one after the other.
+ *
+ * Convergence is tested column by column; iteration stops once every
+ * column satisfies the stopping criterion, and the relative residual norm
+ * reported is the largest one over the columns.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSolveMultiVec( void               *amg_vdata,
+                              hypre_ParCSRMatrix *A,
+                              hypre_ParVector    *f,
+                              hypre_ParVector    *u )
+{
+   MPI_Comm            comm        = hypre_ParCSRMatrixComm(A);
+   hypre_ParAMGData   *amg_data    = (hypre_ParAMGData*) amg_vdata;
+
+   HYPRE_Int           num_vectors = hypre_ParVectorNumVectors(f);
+   HYPRE_Int           num_levels  = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int           print_level = hypre_ParAMGDataPrintLevel(amg_data);
+   HYPRE_Int           converge_type = hypre_ParAMGDataConvergeType(amg_data);
+   HYPRE_Real          tol         = hypre_ParAMGDataTol(amg_data);
+   HYPRE_Int           min_iter    = hypre_ParAMGDataMinIter(amg_data);
+   HYPRE_Int           max_iter    = hypre_ParAMGDataMaxIter(amg_data);
+   HYPRE_Int           additive    = hypre_ParAMGDataAdditive(amg_data);
+   HYPRE_Int           mult_additive = hypre_ParAMGDataMultAdditive(amg_data);
+   HYPRE_Int           simple      = hypre_ParAMGDataSimple(amg_data);
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+
+   hypre_ParVector   **F_array;
+   hypre_ParVector   **U_array;
+   hypre_ParVector   **Vtemp_array;
+   hypre_ParVector    *f_col, *u_col;
+
+   HYPRE_Real         *resid_nrm, *resid_nrm_init, *rhs_norm;
+   HYPRE_Real          relative_resid, max_resid_nrm, rel;
+   HYPRE_Int           fused, cycle_count, level, jv, my_id;
+   HYPRE_Int           input_error = 0;
+   HYPRE_Int           copy_fine;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   hypre_assert(hypre_ParVectorNumVectors(u) == num_vectors);
+
+   fused = num_levels > 1 &&
+           !hypre_ParAMGDataBlockMode(amg_data) &&
+           (additive      < 0 || additive      >= num_levels) &&
+           (mult_additive < 0 || mult_additive >= num_levels) &&
+           (simple        < 0 || simple        >= num_levels) &&
+           hypre_ParAMGDataSmoothNumLevels(amg_data) <= 0 &&
+           hypre_ParAMGDataGridRelaxPoints(amg_data) == NULL &&
+           hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) < 0;
+
+   f_col = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                 hypre_ParCSRMatrixRowStarts(A));
+   u_col = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                 hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize_v2(f_col, HYPRE_MEMORY_HOST);
+   hypre_ParVectorInitialize_v2(u_col, HYPRE_MEMORY_HOST);
+
+   if (!fused)
+   {
+      HYPRE_Int  max_num_iterations = 0;
+      HYPRE_Real max_rel_resid      = 0.0;
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         hypre_ParMultiVectorGetColumn(f, jv, f_col);
+         hypre_ParMultiVectorGetColumn(u, jv, u_col);
+         hypre_BoomerAMGSolve(amg_vdata, A, f_col, u_col);
+         hypre_ParMultiVectorSetColumn(u, jv, u_col);
+
+         max_num_iterations = hypre_max(max_num_iterations,
+                                        hypre_ParAMGDataNumIterations(amg_data));
+         max_rel_resid      = hypre_max(max_rel_resid,
+                                        hypre_ParAMGDataRelativeResidualNorm(amg_data));
+      }
+
+      hypre_ParAMGDataNumIterations(amg_data)        = max_num_iterations;
+      hypre_ParAMGDataRelativeResidualNorm(amg_data) = max_rel_resid;
+      hypre_ParAMGDataFArray(amg_data)[0] = f;
+      hypre_ParAMGDataUArray(amg_data)[0] = u;
+
+      hypre_ParVectorDestroy(f_col);
+      hypre_ParVectorDestroy(u_col);
+
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   /*-----------------------------------------------------------------------
+    * Multivector level data, stored rowwise so that all right-hand sides of
+    * a row are contiguous. If u is stored by columns, the finest level works
+    * on rowwise copies of f and u.
+    *-----------------------------------------------------------------------*/
+
+   F_array     = hypre_CTAlloc(hypre_ParVector *, num_levels, HYPRE_MEMORY_HOST);
+   U_array     = hypre_CTAlloc(hypre_ParVector *, num_levels, HYPRE_MEMORY_HOST);
+   Vtemp_array = hypre_CTAlloc(hypre_ParVector *, num_levels, HYPRE_MEMORY_HOST);
+
+   copy_fine = hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(u)) != 1;
+
+   A_array[0] = A;
+   hypre_ParAMGDataFArray(amg_data)[0] = f;
+   hypre_ParAMGDataUArray(amg_data)[0] = u;
+   for (level = 0; level < num_levels; level++)
+   {
+      HYPRE_BigInt  global_size = hypre_ParCSRMatrixGlobalNumRows(A_array[level]);
+      HYPRE_BigInt *row_starts  = hypre_ParCSRMatrixRowStarts(A_array[level]);
+
+      if (level > 0 || copy_fine)
+      {
+         F_array[level] = hypre_ParMultiVectorCreate(comm, global_size, row_starts, num_vectors);
+         U_array[level] = hypre_ParMultiVectorCreate(comm, global_size, row_starts, num_vectors);
+         hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(F_array[level])) = 1;
+         hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(U_array[level])) = 1;
+         hypre_ParVectorInitialize_v2(F_array[level], HYPRE_MEMORY_HOST);
+         hypre_ParVectorInitialize_v2(U_array[level], HYPRE_MEMORY_HOST);
+      }
+      Vtemp_array[level] = hypre_ParMultiVectorCreate(comm, global_size, row_starts, num_vectors);
+      hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(Vtemp_array[level])) = 1;
+      hypre_ParVectorInitialize_v2(Vtemp_array[level], HYPRE_MEMORY_HOST);
+   }
+
+   if (copy_fine)
+   {
+      hypre_BoomerAMGMultiVecCopy(f, F_array[0]);
+      hypre_BoomerAMGMultiVecCopy(u, U_array[0]);
+   }
+   else
+   {
+      F_array[0] = f;
+      U_array[0] = u;
+   }
+
+   resid_nrm      = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   resid_nrm_init = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   rhs_norm       = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+   if (my_id == 0 && print_level > 1)
+   {
+      hypre_BoomerAMGWriteSolverParams(amg_data);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Initial residual norms, one per column
+    *-----------------------------------------------------------------------*/
+
+   relative_resid = 1.0;
+   max_resid_nrm  = 0.0;
+   if (print_level > 1 || tol > 0.)
+   {
+      hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, U_array[0], 1.0, F_array[0], Vtemp_array[0]);
+      hypre_ParMultiVectorColumnInnerProds(Vtemp_array[0], Vtemp_array[0], resid_nrm_init);
+      if (converge_type == 0)
+      {
+         hypre_ParMultiVectorColumnInnerProds(F_array[0], F_array[0], rhs_norm);
+      }
+
+      relative_resid = 0.0;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         resid_nrm_init[jv] = sqrt(resid_nrm_init[jv]);
+         rhs_norm[jv]       = sqrt(rhs_norm[jv]);
+
+         /* INF -> NaN conversion, see hypre_BoomerAMGSolve */
+         if (resid_nrm_init[jv] != 0. &&
+             (resid_nrm_init[jv] / resid_nrm_init[jv]) != (resid_nrm_init[jv] / resid_nrm_init[jv]))
+         {
+            if (print_level > 0)
+            {
+               hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+               hypre_printf("ERROR -- hypre_BoomerAMGSolve: INFs and/or NaNs detected in input.\n");
+               hypre_printf("User probably placed non-numerics in supplied A, x_0, or b.\n");
+               hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            input_error = 1;
+            break;
+         }
+
+         rel = (converge_type == 0 && rhs_norm[jv]) ? resid_nrm_init[jv] / rhs_norm[jv] :
+               (converge_type == 0 ? resid_nrm_init[jv] : 1.0);
+         relative_resid = hypre_max(relative_resid, rel);
+         max_resid_nrm  = hypre_max(max_resid_nrm, resid_nrm_init[jv]);
+      }
+   }
+
+   if (my_id == 0 && print_level > 1)
+   {
+      hypre_printf("\n\nAMG SOLUTION INFO (%d right-hand sides):\n", num_vectors);
+      hypre_printf("                                 max relative\n");
+      hypre_printf("               max residual      residual\n");
+      hypre_printf("               ------------      --------\n");
+      hypre_printf("    Initial    %e      %e\n", max_resid_nrm, relative_resid);
+   }
+
+   /*-----------------------------------------------------------------------
+    *    Main cycle loop
+    *-----------------------------------------------------------------------*/
+
+   cycle_count = 0;
+   while ( !input_error &&
+           (relative_resid >= tol || cycle_count < min_iter) && cycle_count < max_iter )
+   {
+      hypre_ParAMGDataCycleOpCount(amg_data) = 0;
+
+      if (hypre_BoomerAMGCycleMultiVec(amg_data, F_array, U_array, Vtemp_array, f_col, u_col))
+      {
+         break;
+      }
+
+      if (print_level > 1 || tol > 0.)
+      {
+         hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, U_array[0], 1.0, F_array[0], Vtemp_array[0]);
+         hypre_ParMultiVectorColumnInnerProds(Vtemp_array[0], Vtemp_array[0], resid_nrm);
+
+         relative_resid = 0.0;
+         max_resid_nrm  = 0.0;
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            resid_nrm[jv] = sqrt(resid_nrm[jv]);
+            if (converge_type == 0)
+            {
+               rel = rhs_norm[jv] ? resid_nrm[jv] / rhs_norm[jv] : resid_nrm[jv];
+            }
+            else
+            {
+               rel = resid_nrm_init[jv] ? resid_nrm[jv] / resid_nrm_init[jv] : 0.0;
+            }
+            relative_resid = hypre_max(relative_resid, rel);
+            max_resid_nrm  = hypre_max(max_resid_nrm, resid_nrm[jv]);
+         }
+
+         hypre_ParAMGDataRelativeResidualNorm(amg_data) = relative_resid;
+      }
+
+      ++cycle_count;
+
+      hypre_ParAMGDataNumIterations(amg_data) = cycle_count;
+#ifdef CUMNUMIT
+      ++hypre_ParAMGDataCumNumIterations(amg_data);
+#endif
+
+      if (my_id == 0 && print_level > 1)
+      {
+         hypre_printf("    Cycle %2d   %e      %e \n", cycle_count, max_resid_nrm, relative_resid);
+      }
+   }
+
+   if (!input_error && cycle_count == max_iter && tol > 0.)
+   {
+      if (my_id == 0 && print_level > 1)
+      {
+         hypre_printf("\n\n==============================================");
+         hypre_printf("\n NOTE: Convergence tolerance was not achieved\n");
+         hypre_printf("      within the allowed %d V-cycles\n", max_iter);
+         hypre_printf("==============================================\n");
+      }
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   if (copy_fine)
+   {
+      hypre_BoomerAMGMultiVecCopy(U_array[0], u);
+   }
+
+   for (level = 0; level < num_levels; level++)
+   {
+      if (level > 0 || copy_fine)
+      {
+         hypre_ParVectorDestroy(F_array[level]);
+         hypre_ParVectorDestroy(U_array[level]);
+      }
+      hypre_ParVectorDestroy(Vtemp_array[level]);
+   }
+   hypre_TFree(F_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(U_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(Vtemp_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(resid_nrm, HYPRE_MEMORY_HOST);
+   hypre_TFree(resid_nrm_init, HYPRE_MEMORY_HOST);
+   hypre_TFree(rhs_norm, HYPRE_MEMORY_HOST);
+   hypre_ParVectorDestroy(f_col);
+   hypre_ParVectorDestroy(u_col);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
@@ -753,3 +753,346 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    return (Solve_err_flag);
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCycleRelaxColumns
+ *
+ * Applies one relaxation sweep of type relax_type to each column of the
+ * multivectors F and U separately, using the single-vector level data of
+ * amg_data (f_col and u_col on the finest level). Used by
+ * hypre_BoomerAMGCycleMultiVec for relaxation types that have no fused
+ * multivector kernel.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGCycleRelaxColumns( hypre_ParAMGData *amg_data,
+                                  HYPRE_Int         level,
+                                  HYPRE_Int         relax_type,
+                                  HYPRE_Int         cycle_param,
+                                  HYPRE_Int         num_sweep,
+                                  HYPRE_Int         sweep,
+                                  hypre_ParVector  *F,
+                                  hypre_ParVector  *U,
+                                  hypre_ParVector  *f_col,
+                                  hypre_ParVector  *u_col )
+{
+   hypre_ParCSRMatrix *A            = hypre_ParAMGDataAArray(amg_data)[level];
+   hypre_IntArray     *CF_marker_ia = hypre_ParAMGDataCFMarkerArray(amg_data)[level];
+   HYPRE_Int          *CF_marker    = CF_marker_ia ? hypre_IntArrayData(CF_marker_ia) : NULL;
+   hypre_Vector      **l1_norms     = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Real         *l1_norms_lev = NULL;
+   HYPRE_Real          relax_weight = hypre_ParAMGDataRelaxWeight(amg_data)[level];
+   HYPRE_Real          omega        = hypre_ParAMGDataOmega(amg_data)[level];
+   HYPRE_Int           relax_order  = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Int           num_levels   = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParVector    *Vtemp        = hypre_ParAMGDataVtemp(amg_data);
+   hypre_ParVector    *Ztemp        = hypre_ParAMGDataZtemp(amg_data);
+   hypre_ParVector    *Ptemp        = hypre_ParAMGDataPtemp(amg_data);
+   hypre_ParVector    *Rtemp        = hypre_ParAMGDataRtemp(amg_data);
+   HYPRE_Solver       *smoother     = hypre_ParAMGDataSmoother(amg_data);
+   HYPRE_Int           num_vectors  = hypre_ParVectorNumVectors(F);
+   hypre_ParVector    *fc, *uc;
+   HYPRE_Int           jv, Solve_err_flag = 0;
+
+   if (l1_norms && l1_norms[level])
+   {
+      l1_norms_lev = hypre_VectorData(l1_norms[level]);
+   }
+
+   /* GaussElimSolve works on the level vectors stored in amg_data */
+   fc = level ? hypre_ParAMGDataFArray(amg_data)[level] : f_col;
+   uc = level ? hypre_ParAMGDataUArray(amg_data)[level] : u_col;
+
+   hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) =
+      hypre_VectorSize(hypre_ParVectorLocalVector(fc));
+
+   for (jv = 0; jv < num_vectors && !Solve_err_flag; jv++)
+   {
+      hypre_ParMultiVectorGetColumn(F, jv, fc);
+      hypre_ParMultiVectorGetColumn(U, jv, uc);
+
+      if (relax_type == 9 || relax_type == 99 || relax_type == 199)
+      {
+         Solve_err_flag = hypre_GaussElimSolve(amg_data, level, relax_type);
+      }
+      else if (relax_type == 15)
+      {
+         /* num_sweep iterations of CG, done on the first sweep */
+         if (sweep == 0)
+         {
+            hypre_ParCSRRelax_CG(smoother[level], A, fc, uc, num_sweep);
+         }
+      }
+      else if (relax_type == 16)
+      {
+         hypre_ParCSRRelax_Cheby_Solve(A, fc,
+                                       hypre_VectorData(hypre_ParAMGDataChebyDS(amg_data)[level]),
+                                       hypre_ParAMGDataChebyCoefs(amg_data)[level],
+                                       hypre_ParAMGDataChebyOrder(amg_data),
+                                       hypre_ParAMGDataChebyScale(amg_data),
+                                       hypre_ParAMGDataChebyVariant(amg_data),
+                                       uc, Vtemp, Ztemp, Ptemp, Rtemp);
+      }
+      else if (relax_type == 17)
+      {
+         if (level == num_levels - 1)
+         {
+            hypre_BoomerAMGRelax(A, fc, CF_marker, 0, 0, relax_weight, 0.0, NULL, uc, Vtemp, NULL);
+         }
+         else
+         {
+            hypre_BoomerAMGRelax_FCFJacobi(A, fc, CF_marker, relax_weight, uc, Vtemp);
+         }
+      }
+      else
+      {
+         Solve_err_flag = hypre_BoomerAMGRelaxIF(A, fc, CF_marker, relax_type, relax_order,
+                                                 cycle_param, relax_weight, omega,
+                                                 l1_norms_lev, uc, Vtemp, Ztemp);
+      }
+
+      hypre_ParMultiVectorSetColumn(U, jv, uc);
+   }
+
+   return Solve_err_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCycleMultiVec
+ *
+ * One multigrid cycle for all columns of the multivectors F_array[0] and
+ * U_array[0] at once. F_array, U_array and Vtemp_array hold multivectors on
+ * every level, with Vtemp_array[level] using the same layout as
+ * U_array[level]. Residuals, restriction and interpolation are fused
+ * multivector matvecs, so that A, R and P are streamed once per cycle
+ * rather than once per right-hand side. Relaxation types without a fused
+ * kernel (see hypre_BoomerAMGRelaxMultiVecSupported) are applied column by
+ * column through f_col and u_col, which are single vectors of the finest
+ * level size.
+ *
+ * The caller (hypre_BoomerAMGSolveMultiVec) only uses this cycle for plain
+ * (non-block, non-additive, no complex smoother) configurations.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCycleMultiVec( void              *amg_vdata,
+                              hypre_ParVector  **F_array,
+                              hypre_ParVector  **U_array,
+                              hypre_ParVector  **Vtemp_array,
+                              hypre_ParVector   *f_col,
+                              hypre_ParVector   *u_col )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array         = hypre_ParAMGDataRArray(amg_data);
+   hypre_IntArray     **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   hypre_Vector       **l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            cycle_type      = hypre_ParAMGDataCycleType(amg_data);
+   HYPRE_Int            fcycle          = hypre_ParAMGDataFCycle(amg_data);
+   HYPRE_Int           *num_grid_sweeps = hypre_ParAMGDataNumGridSweeps(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int            relax_order     = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Real          *relax_weight    = hypre_ParAMGDataRelaxWeight(amg_data);
+   HYPRE_Real          *omega           = hypre_ParAMGDataOmega(amg_data);
+   HYPRE_Int            restri_type     = hypre_ParAMGDataRestriction(amg_data);
+   HYPRE_Real           cycle_op_count  = hypre_ParAMGDataCycleOpCount(amg_data);
+   hypre_ParVector     *Vtemp           = hypre_ParAMGDataVtemp(amg_data);
+   HYPRE_Int            vtemp_size      = hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp));
+
+   HYPRE_Int           *lev_counter;
+   HYPRE_Real          *num_coeffs;
+   HYPRE_Int           *CF_marker;
+   HYPRE_Real          *l1_norms_level;
+   HYPRE_Int            relax_points[2];
+   HYPRE_Int            num_relax_points;
+   HYPRE_Int            Solve_err_flag = 0;
+   HYPRE_Int            k, j, ip;
+   HYPRE_Int            level, fine_grid, coarse_grid;
+   HYPRE_Int            cycle_param, fcycle_lev;
+   HYPRE_Int            num_sweep, relax_type;
+   HYPRE_Int            Not_Finished;
+   HYPRE_Int            seq_cg          = hypre_ParAMGDataParticipate(amg_data) ? 1 : 0;
+   void                *dslu_solver     = NULL;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+#ifdef HYPRE_USING_DSUPERLU
+   dslu_solver = hypre_ParAMGDataDSLUSolver(amg_data);
+#endif
+
+   lev_counter = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+   num_coeffs  = hypre_CTAlloc(HYPRE_Real, num_levels, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_levels; j++)
+   {
+      num_coeffs[j] = hypre_ParCSRMatrixDNumNonzeros(A_array[j]);
+   }
+
+   /* Same cycling control as hypre_BoomerAMGCycle */
+   lev_counter[0] = 1;
+   for (k = 1; k < num_levels; ++k)
+   {
+      lev_counter[k] = fcycle ? 1 : cycle_type;
+   }
+   fcycle_lev = num_levels - 2;
+
+   level = 0;
+   cycle_param = 1;
+   Not_Finished = 1;
+
+   HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
+   while (Not_Finished)
+   {
+      num_sweep  = num_grid_sweeps[cycle_param];
+      relax_type = grid_relax_type[cycle_param];
+      CF_marker  = CF_marker_array[level] ? hypre_IntArrayData(CF_marker_array[level]) : NULL;
+      l1_norms_level = (l1_norms && l1_norms[level]) ? hypre_VectorData(l1_norms[level]) : NULL;
+
+      /* C/F ordering as in hypre_BoomerAMGRelaxIF */
+      if (relax_order == 1 && cycle_param < 3)
+      {
+         num_relax_points = 2;
+         relax_points[0]  = cycle_param < 2 ?  1 : -1;
+         relax_points[1]  = cycle_param < 2 ? -1 :  1;
+      }
+      else
+      {
+         num_relax_points = 1;
+         relax_points[0]  = 0;
+      }
+
+      if (cycle_param == 3 && (seq_cg || dslu_solver))
+      {
+         /* Coarse solves on a sub-communicator work on single vectors */
+         hypre_ParVector *fc = hypre_ParAMGDataFArray(amg_data)[level];
+         hypre_ParVector *uc = hypre_ParAMGDataUArray(amg_data)[level];
+
+         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
+         for (k = 0; k < hypre_ParVectorNumVectors(F_array[level]); k++)
+         {
+            hypre_ParMultiVectorGetColumn(F_array[level], k, fc);
+            hypre_ParMultiVectorGetColumn(U_array[level], k, uc);
+            if (seq_cg)
+            {
+               hypre_seqAMGCycle(amg_data, level, hypre_ParAMGDataFArray(amg_data),
+                                 hypre_ParAMGDataUArray(amg_data));
+            }
+#ifdef HYPRE_USING_DSUPERLU
+            else
+            {
+               hypre_SLUDistSolve(dslu_solver, fc, uc);
+            }
+#endif
+            hypre_ParMultiVectorSetColumn(U_array[level], k, uc);
+         }
+         HYPRE_ANNOTATE_REGION_END("%s", "Coarse solve");
+         num_sweep = 0;
+      }
+
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "Relaxation");
+      for (j = 0; j < num_sweep && !Solve_err_flag; j++)
+      {
+         cycle_op_count += num_coeffs[level];
+
+         if (hypre_BoomerAMGRelaxMultiVecSupported(relax_type))
+         {
+            for (ip = 0; ip < num_relax_points; ip++)
+            {
+               hypre_BoomerAMGRelaxMultiVec(A_array[level], F_array[level], CF_marker,
+                                            relax_type, relax_points[ip],
+                                            relax_weight[level], omega[level], l1_norms_level,
+                                            U_array[level], Vtemp_array[level]);
+            }
+         }
+         else
+         {
+            Solve_err_flag = hypre_BoomerAMGCycleRelaxColumns(amg_data, level, relax_type,
+                                                              cycle_param, num_sweep, j,
+                                                              F_array[level], U_array[level],
+                                                              f_col, u_col);
+         }
+      }
+      HYPRE_ANNOTATE_REGION_END("%s", "Relaxation");
+
+      if (Solve_err_flag)
+      {
+         break;
+      }
+
+      --lev_counter[level];
+
+      if (lev_counter[level] >= 0 && level != num_levels - 1)
+      {
+         /* Visit coarser level next: fused residual and restriction */
+         fine_grid   = level;
+         coarse_grid = level + 1;
+
+         hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
+
+         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
+         hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A_array[fine_grid], U_array[fine_grid],
+                                            1.0, F_array[fine_grid], Vtemp_array[fine_grid]);
+         HYPRE_ANNOTATE_REGION_END("%s", "Residual");
+
+         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
+         if (restri_type)
+         {
+            /* RL: no transpose for R */
+            hypre_ParCSRMatrixMatvec(1.0, R_array[fine_grid], Vtemp_array[fine_grid],
+                                     0.0, F_array[coarse_grid]);
+         }
+         else
+         {
+            hypre_ParCSRMatrixMatvecT(1.0, R_array[fine_grid], Vtemp_array[fine_grid],
+                                      0.0, F_array[coarse_grid]);
+         }
+         HYPRE_ANNOTATE_REGION_END("%s", "Restriction");
+         HYPRE_ANNOTATE_MGLEVEL_END(level);
+
+         ++level;
+         lev_counter[level] = hypre_max(lev_counter[level], cycle_type);
+         cycle_param = (level == num_levels - 1) ? 3 : 1;
+
+         HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
+      }
+      else if (level != 0)
+      {
+         /* Visit finer level next: fused interpolation and correction */
+         fine_grid   = level - 1;
+         coarse_grid = level;
+
+         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Interpolation");
+         hypre_ParCSRMatrixMatvec(1.0, P_array[fine_grid], U_array[coarse_grid],
+                                  1.0, U_array[fine_grid]);
+         HYPRE_ANNOTATE_REGION_END("%s", "Interpolation");
+         HYPRE_ANNOTATE_MGLEVEL_END(level);
+
+         --level;
+         cycle_param = 2;
+         if (fcycle && fcycle_lev == level)
+         {
+            lev_counter[level] = hypre_max(lev_counter[level], 1);
+            fcycle_lev--;
+         }
+
+         HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
+      }
+      else
+      {
+         Not_Finished = 0;
+      }
+   }
+   HYPRE_ANNOTATE_MGLEVEL_END(level);
+
+   hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) = vtemp_size;
+   hypre_ParAMGDataCycleOpCount(amg_data) = cycle_op_count;
+
+   hypre_TFree(lev_counter, HYPRE_MEMORY_HOST);
+   hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return Solve_err_flag;
+}
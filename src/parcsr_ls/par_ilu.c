@@ -98,6 +98,22 @@ hypre_ILUCreate()
    /* reordering_type default to use local RCM */
    hypre_ParILUDataReorderingType(ilu_data) = 1;
 
+   /* direct triangular solves, level scheduled when threaded */
+   hypre_ParILUDataTriSolve(ilu_data) = 1;
+   hypre_ParILUDataLowerJacobiIters(ilu_data) = 5;
+   hypre_ParILUDataUpperJacobiIters(ilu_data) = 5;
+
+   /* exact factorization, threaded for BJ ILU(k) */
+   hypre_ParILUDataIterSetupType(ilu_data) = 0;
+   hypre_ParILUDataIterSetupMaxIter(ilu_data) = 5;
+   hypre_ParILUDataTriWork(ilu_data) = NULL;
+   hypre_ParILUDataNumLevelsL(ilu_data) = 0;
+   hypre_ParILUDataLevelPtrL(ilu_data) = NULL;
+   hypre_ParILUDataLevelRowsL(ilu_data) = NULL;
+   hypre_ParILUDataNumLevelsU(ilu_data) = 0;
+   hypre_ParILUDataLevelPtrU(ilu_data) = NULL;
+   hypre_ParILUDataLevelRowsU(ilu_data) = NULL;
+
    /* see hypre_ILUSetType for more default values */
    hypre_ParILUDataTestOption(ilu_data) = 0;
 
@@ -317,6 +333,9 @@ hypre_ILUDestroy( void *data )
       hypre_ParILUDataUEnd(ilu_data) = NULL;
    }
 
+   /* triangular solve data */
+   hypre_ILUDestroyTriSolveData(ilu_data);
+
    /* Factors */
    if (hypre_ParILUDataMatL(ilu_data))
    {
@@ -590,6 +609,47 @@ hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type )
    return hypre_error_flag;
 }
 
+/* Set type of triangular solve (host BJ only) */
+HYPRE_Int
+hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParILUDataTriSolve(ilu_data) = tri_solve;
+   return hypre_error_flag;
+}
+/* Set number of Jacobi sweeps for the iterative L solve */
+HYPRE_Int
+hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParILUDataLowerJacobiIters(ilu_data) = lower_jacobi_iters;
+   return hypre_error_flag;
+}
+/* Set number of Jacobi sweeps for the iterative U solve */
+HYPRE_Int
+hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParILUDataUpperJacobiIters(ilu_data) = upper_jacobi_iters;
+   return hypre_error_flag;
+}
+/* Set type of factorization (host BJ ILU(k) only) */
+HYPRE_Int
+hypre_ILUSetIterativeSetupType( void *ilu_vdata, HYPRE_Int iter_setup_type )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParILUDataIterSetupType(ilu_data) = iter_setup_type;
+   return hypre_error_flag;
+}
+/* Set number of fixed-point sweeps for the iterative factorization */
+HYPRE_Int
+hypre_ILUSetIterativeSetupMaxIter( void *ilu_vdata, HYPRE_Int iter_setup_max_iter )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParILUDataIterSetupMaxIter(ilu_data) = iter_setup_max_iter;
+   return hypre_error_flag;
+}
+
 /* Set KDim (for GMRES) for Solver of Schur System */
 HYPRE_Int
 hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim )
@@ -936,9 +996,120 @@ hypre_ILUWriteSolverParams(void *ilu_vdata)
          break;
    }
 
+   if (hypre_ParILUDataIterSetupType(ilu_data))
+   {
+      hypre_printf("Factorization: %d fixed-point sweeps\n",
+                   hypre_ParILUDataIterSetupMaxIter(ilu_data));
+   }
+
    hypre_printf("\n ILU Solver Parameters: \n");
    hypre_printf("Max number of iterations: %d\n", hypre_ParILUDataMaxIter(ilu_data));
    hypre_printf("Stopping tolerance: %e\n", hypre_ParILUDataTol(ilu_data));
+   if (hypre_ParILUDataTriSolve(ilu_data) && hypre_ParILUDataNumLevelsL(ilu_data))
+   {
+      hypre_printf("Triangular solves: direct, %d (L) and %d (U) levels\n",
+                   hypre_ParILUDataNumLevelsL(ilu_data), hypre_ParILUDataNumLevelsU(ilu_data));
+   }
+   else if (hypre_ParILUDataTriSolve(ilu_data))
+   {
+      hypre_printf("Triangular solves: direct\n");
+   }
+   else
+   {
+      hypre_printf("Triangular solves: %d (L) and %d (U) Jacobi sweeps\n",
+                   hypre_ParILUDataLowerJacobiIters(ilu_data),
+                   hypre_ParILUDataUpperJacobiIters(ilu_data));
+   }
+
+   return hypre_error_flag;
+}
+
+/* Free the data of the host triangular solves */
+HYPRE_Int
+hypre_ILUDestroyTriSolveData( void *ilu_vdata )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+
+   hypre_TFree(hypre_ParILUDataTriWork(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLevelPtrL(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLevelRowsL(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLevelPtrU(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLevelRowsU(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_ParILUDataTriWork(ilu_data) = NULL;
+   hypre_ParILUDataLevelPtrL(ilu_data) = NULL;
+   hypre_ParILUDataLevelRowsL(ilu_data) = NULL;
+   hypre_ParILUDataLevelPtrU(ilu_data) = NULL;
+   hypre_ParILUDataLevelRowsU(ilu_data) = NULL;
+   hypre_ParILUDataNumLevelsL(ilu_data) = 0;
+   hypre_ParILUDataNumLevelsU(ilu_data) = 0;
+
+   return hypre_error_flag;
+}
+
+/*
+ * Build the level schedule of a triangular factor for the threaded solves.
+ * Rows in the same level only depend on rows of earlier levels, so each level
+ * can be processed in parallel.
+ * M: the diag part of L or U, strictly lower/upper triangular, first n rows used
+ * lower: 1 if M is lower triangular, 0 if upper triangular
+ * num_levelsp, level_ptrp, level_rowsp: output, see hypre_ParILUData
+ */
+HYPRE_Int
+hypre_ILUSetupLevelSchedule( hypre_CSRMatrix *M, HYPRE_Int n, HYPRE_Int lower,
+                             HYPRE_Int *num_levelsp, HYPRE_Int **level_ptrp,
+                             HYPRE_Int **level_rowsp )
+{
+   HYPRE_Int   *M_i = hypre_CSRMatrixI(M);
+   HYPRE_Int   *M_j = hypre_CSRMatrixJ(M);
+   HYPRE_Int   *level, *level_ptr, *level_rows;
+   HYPRE_Int   num_levels = 0;
+   HYPRE_Int   i, ii, j, col, lev;
+
+   level = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+   /* level of a row is one more than the highest level it depends on */
+   for (ii = 0; ii < n; ii++)
+   {
+      i = lower ? ii : n - 1 - ii;
+      lev = 0;
+      for (j = M_i[i]; j < M_i[i + 1]; j++)
+      {
+         col = M_j[j];
+         if (col < n)
+         {
+            lev = hypre_max(lev, level[col] + 1);
+         }
+      }
+      level[i] = lev;
+      num_levels = hypre_max(num_levels, lev + 1);
+   }
+
+   /* bucket the rows by level, keeping the natural order within a level */
+   level_ptr  = hypre_CTAlloc(HYPRE_Int, num_levels + 1, HYPRE_MEMORY_HOST);
+   level_rows = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      level_ptr[level[i] + 1]++;
+   }
+   for (lev = 0; lev < num_levels; lev++)
+   {
+      level_ptr[lev + 1] += level_ptr[lev];
+   }
+   for (i = 0; i < n; i++)
+   {
+      level_rows[level_ptr[level[i]]++] = i;
+   }
+   for (lev = num_levels; lev > 0; lev--)
+   {
+      level_ptr[lev] = level_ptr[lev - 1];
+   }
+   level_ptr[0] = 0;
+
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+
+   *num_levelsp = num_levels;
+   *level_ptrp  = level_ptr;
+   *level_rowsp = level_rows;
 
    return hypre_error_flag;
 }
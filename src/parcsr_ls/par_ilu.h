@@ -136,6 +136,28 @@ typedef struct hypre_ParILUData_struct
    /* local reordering */
    HYPRE_Int            reordering_type;
 
+   /* triangular solves on the host (BJ only)
+    * tri_solve: 0 = iterative (Jacobi sweeps), 1 = direct (default)
+    */
+   HYPRE_Int            tri_solve;
+   HYPRE_Int            lower_jacobi_iters;
+   HYPRE_Int            upper_jacobi_iters;
+   /* factorization on the host (BJ ILU(k) only)
+    * iter_setup_type: 0 = exact (default), 1 = fixed-point sweeps
+    */
+   HYPRE_Int            iter_setup_type;
+   HYPRE_Int            iter_setup_max_iter;
+   HYPRE_Real           *tri_work;/* work array for Jacobi sweeps */
+   /* level schedules of L and U for the threaded direct solve,
+    * rows of level k are level_rows[level_ptr[k]:level_ptr[k+1]-1]
+    */
+   HYPRE_Int            num_levels_L;
+   HYPRE_Int            *level_ptr_L;
+   HYPRE_Int            *level_rows_L;
+   HYPRE_Int            num_levels_U;
+   HYPRE_Int            *level_ptr_U;
+   HYPRE_Int            *level_rows_U;
+
 } hypre_ParILUData;
 
 #define hypre_ParILUDataTestOption(ilu_data)                   ((ilu_data) -> test_opt)
@@ -208,6 +230,18 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataRhs(ilu_data)                          ((ilu_data) -> rhs)
 #define hypre_ParILUDataX(ilu_data)                            ((ilu_data) -> x)
 #define hypre_ParILUDataReorderingType(ilu_data)               ((ilu_data) -> reordering_type)
+#define hypre_ParILUDataTriSolve(ilu_data)                     ((ilu_data) -> tri_solve)
+#define hypre_ParILUDataLowerJacobiIters(ilu_data)             ((ilu_data) -> lower_jacobi_iters)
+#define hypre_ParILUDataUpperJacobiIters(ilu_data)             ((ilu_data) -> upper_jacobi_iters)
+#define hypre_ParILUDataIterSetupType(ilu_data)                ((ilu_data) -> iter_setup_type)
+#define hypre_ParILUDataIterSetupMaxIter(ilu_data)             ((ilu_data) -> iter_setup_max_iter)
+#define hypre_ParILUDataTriWork(ilu_data)                      ((ilu_data) -> tri_work)
+#define hypre_ParILUDataNumLevelsL(ilu_data)                   ((ilu_data) -> num_levels_L)
+#define hypre_ParILUDataLevelPtrL(ilu_data)                    ((ilu_data) -> level_ptr_L)
+#define hypre_ParILUDataLevelRowsL(ilu_data)                   ((ilu_data) -> level_rows_L)
+#define hypre_ParILUDataNumLevelsU(ilu_data)                   ((ilu_data) -> num_levels_U)
+#define hypre_ParILUDataLevelPtrU(ilu_data)                    ((ilu_data) -> level_ptr_U)
+#define hypre_ParILUDataLevelRowsU(ilu_data)                   ((ilu_data) -> level_rows_U)
 /* Schur System */
 #define hypre_ParILUDataSchurGMRESKDim(ilu_data)               ((ilu_data) -> ss_kDim)
 #define hypre_ParILUDataSchurGMRESMaxIter(ilu_data)            ((ilu_data) -> ss_max_iter)
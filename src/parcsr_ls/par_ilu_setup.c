@@ -435,8 +435,17 @@ hypre_ILUSetup( void               *ilu_vdata,
                                      &matE_d, &matF_d, &A_diag_fake);//BJ + hypre_iluk(), setup the device solve
          }
 #else
-         hypre_ILUSetupILUK(matA, fill_level, perm, perm, n, n, &matL, &matD, &matU, &matS,
-                            &u_end); //BJ + hypre_iluk()
+         if (hypre_NumThreads() > 1 || hypre_ParILUDataIterSetupType(ilu_data))
+         {
+            hypre_ILUSetupILUKThreaded(matA, fill_level, perm, hypre_ParILUDataIterSetupType(ilu_data),
+                                       hypre_ParILUDataIterSetupMaxIter(ilu_data), &matL, &matD, &matU,
+                                       &u_end); //BJ + threaded hypre_iluk()
+         }
+         else
+         {
+            hypre_ILUSetupILUK(matA, fill_level, perm, perm, n, n, &matL, &matD, &matU, &matS,
+                               &u_end); //BJ + hypre_iluk()
+         }
 #endif
          break;
       case 1:
@@ -520,10 +529,48 @@ hypre_ILUSetup( void               *ilu_vdata,
                                   &matBL_info, &matBU_info, &matSL_info, &matSU_info, &matBLU_d, &matS,
                                   &matE_d, &matF_d, &A_diag_fake);//BJ + cusparse_ilu0()
 #else
-         hypre_ILUSetupILU0(matA, perm, perm, n, n, &matL, &matD, &matU, &matS, &u_end);//BJ + hypre_ilu0()
+         if (hypre_NumThreads() > 1 || hypre_ParILUDataIterSetupType(ilu_data))
+         {
+            hypre_ILUSetupILUKThreaded(matA, 0, perm, hypre_ParILUDataIterSetupType(ilu_data),
+                                       hypre_ParILUDataIterSetupMaxIter(ilu_data), &matL, &matD, &matU,
+                                       &u_end); //BJ + threaded hypre_ilu0()
+         }
+         else
+         {
+            hypre_ILUSetupILU0(matA, perm, perm, n, n, &matL, &matD, &matU, &matS, &u_end);//BJ + hypre_ilu0()
+         }
+#endif
+         break;
+   }
+#ifndef HYPRE_USING_CUDA
+   /* setup the host triangular solves of the BJ variants */
+   hypre_ILUDestroyTriSolveData(ilu_data);
+   switch (ilu_type)
+   {
+      case 10: case 11: case 20: case 21: case 30: case 31: case 40: case 41: case 50:
+         break;
+      default:
+         if (hypre_ParILUDataTriSolve(ilu_data))
+         {
+#ifdef HYPRE_USING_OPENMP
+            /* level schedules, only worth it when the solves are threaded */
+            hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matL), n, 1,
+                                        &hypre_ParILUDataNumLevelsL(ilu_data),
+                                        &hypre_ParILUDataLevelPtrL(ilu_data),
+                                        &hypre_ParILUDataLevelRowsL(ilu_data));
+            hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matU), n, 0,
+                                        &hypre_ParILUDataNumLevelsU(ilu_data),
+                                        &hypre_ParILUDataLevelPtrU(ilu_data),
+                                        &hypre_ParILUDataLevelRowsU(ilu_data));
 #endif
+         }
+         else
+         {
+            hypre_ParILUDataTriWork(ilu_data) = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+         }
          break;
    }
+#endif
    /* setup Schur solver */
    switch (ilu_type)
    {
@@ -5271,6 +5318,752 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *permp, HYPR
    return hypre_error_flag;
 }
 
+/* ILU(k) symbolic factorization with OpenMP threads, BJ only (nLU = n)
+ * n = total rows of input
+ * lfil = level of fill-in, the k in ILU(k)
+ * perm = permutation array indicating ordering of factorization
+ * rperm = reverse permutation array
+ * A_diag_i/j = the I and J slot of A
+ * L/U_diag_i = the I slot of L and U, allocated by the caller
+ * L/U_diag_j = the J slot of L and U, rows sorted by column
+ *
+ * The levels are computed in lfil passes over the rows. Each pass
+ * combines the entries of the previous pass with the U part of the rows they
+ * point to, and the rows are independent inside a pass. An entry of level p is
+ * exact after pass p, so the final pattern is the one of
+ * hypre_ILUSetupILUKSymbolic.
+ */
+HYPRE_Int
+hypre_ILUSetupILUKSymbolicThreaded(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j,
+                                   HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm,
+                                   HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i,
+                                   HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j)
+{
+   /*
+    * P_i/j/lev: pattern and levels of the current pass, diagonal excluded
+    * Pn_i/j/lev: pattern and levels of the next pass
+    */
+   HYPRE_Int         *P_i, *P_j, *P_lev;
+   HYPRE_Int         *Pn_i, *Pn_j = NULL, *Pn_lev = NULL;
+   HYPRE_Int         *temp_L_diag_j, *temp_U_diag_j;
+   HYPRE_Int         ii, i, j, col, pass;
+
+   /* pattern of A in the new ordering, all entries are level 0 */
+   P_i = hypre_CTAlloc(HYPRE_Int, n + 1, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii, i, j) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      i = perm[ii];
+      for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+      {
+         if (rperm[A_diag_j[j]] != ii)
+         {
+            P_i[ii + 1]++;
+         }
+      }
+   }
+   for (ii = 0; ii < n; ii++)
+   {
+      P_i[ii + 1] += P_i[ii];
+   }
+   P_j = hypre_TAlloc(HYPRE_Int, P_i[n], HYPRE_MEMORY_HOST);
+   P_lev = hypre_CTAlloc(HYPRE_Int, P_i[n], HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii, i, j, col) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      HYPRE_Int pos = P_i[ii];
+      i = perm[ii];
+      for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+      {
+         col = rperm[A_diag_j[j]];
+         if (col != ii)
+         {
+            P_j[pos++] = col;
+         }
+      }
+   }
+
+   /* fill passes */
+   for (pass = 0; pass < lfil; pass++)
+   {
+      Pn_i = hypre_CTAlloc(HYPRE_Int, n + 1, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel private(ii, j, col)
+#endif
+      {
+         HYPRE_Int   my_thread_num = hypre_GetThreadNum();
+         HYPRE_Int   num_threads = hypre_NumActiveThreads();
+         HYPRE_Int   ns, ne, k, k1, lk, lev, len, pos, capacity;
+         HYPRE_Int   *iw, *iL, *iLev, *buf_j, *buf_lev;
+
+         hypre_partition1D(n, num_threads, my_thread_num, &ns, &ne);
+
+         iw = hypre_TAlloc(HYPRE_Int, 3 * n, HYPRE_MEMORY_HOST);
+         iL = iw + n;
+         iLev = iw + 2 * n;
+         for (j = 0; j < n; j++)
+         {
+            iw[j] = -1;
+         }
+         capacity = P_i[ne] - P_i[ns] + (ne - ns);
+         buf_j = hypre_TAlloc(HYPRE_Int, capacity, HYPRE_MEMORY_HOST);
+         buf_lev = hypre_TAlloc(HYPRE_Int, capacity, HYPRE_MEMORY_HOST);
+
+         pos = 0;
+         for (ii = ns; ii < ne; ii++)
+         {
+            /* entries of the previous pass */
+            len = 0;
+            for (j = P_i[ii]; j < P_i[ii + 1]; j++)
+            {
+               col = P_j[j];
+               iL[len] = col;
+               iLev[len] = P_lev[j];
+               iw[col] = len++;
+            }
+            /* eliminate with the U part of the rows in the L part */
+            for (j = P_i[ii]; j < P_i[ii + 1]; j++)
+            {
+               k = P_j[j];
+               if (k >= ii)
+               {
+                  continue;
+               }
+               lk = P_lev[j];
+               for (k1 = P_i[k]; k1 < P_i[k + 1]; k1++)
+               {
+                  col = P_j[k1];
+                  lev = lk + P_lev[k1] + 1;
+                  if (col <= k || col == ii || lev > lfil)
+                  {
+                     continue;
+                  }
+                  if (iw[col] < 0)
+                  {
+                     iL[len] = col;
+                     iLev[len] = lev;
+                     iw[col] = len++;
+                  }
+                  else
+                  {
+                     iLev[iw[col]] = hypre_min(lev, iLev[iw[col]]);
+                  }
+               }
+            }
+            /* save the row in the thread buffer */
+            if (pos + len > capacity)
+            {
+               HYPRE_Int tmp = capacity;
+               capacity = hypre_max(capacity * EXPAND_FACT + 1, pos + len);
+               buf_j = hypre_TReAlloc_v2(buf_j, HYPRE_Int, tmp, HYPRE_Int, capacity, HYPRE_MEMORY_HOST);
+               buf_lev = hypre_TReAlloc_v2(buf_lev, HYPRE_Int, tmp, HYPRE_Int, capacity, HYPRE_MEMORY_HOST);
+            }
+            for (j = 0; j < len; j++)
+            {
+               buf_j[pos + j] = iL[j];
+               buf_lev[pos + j] = iLev[j];
+               iw[iL[j]] = -1;
+            }
+            Pn_i[ii + 1] = len;
+            pos += len;
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp barrier
+         #pragma omp single
+#endif
+         {
+            for (ii = 0; ii < n; ii++)
+            {
+               Pn_i[ii + 1] += Pn_i[ii];
+            }
+            Pn_j = hypre_TAlloc(HYPRE_Int, Pn_i[n], HYPRE_MEMORY_HOST);
+            Pn_lev = hypre_TAlloc(HYPRE_Int, Pn_i[n], HYPRE_MEMORY_HOST);
+         }
+
+         /* rows of this thread are contiguous in the new pattern */
+         hypre_TMemcpy(Pn_j + Pn_i[ns], buf_j, HYPRE_Int, pos, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(Pn_lev + Pn_i[ns], buf_lev, HYPRE_Int, pos, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+         hypre_TFree(iw, HYPRE_MEMORY_HOST);
+         hypre_TFree(buf_j, HYPRE_MEMORY_HOST);
+         hypre_TFree(buf_lev, HYPRE_MEMORY_HOST);
+      } /* end of parallel region */
+
+      hypre_TFree(P_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(P_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(P_lev, HYPRE_MEMORY_HOST);
+      P_i = Pn_i;
+      P_j = Pn_j;
+      P_lev = Pn_lev;
+   }
+
+   /* split into L and U */
+   L_diag_i[0] = U_diag_i[0] = 0;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii, j) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      HYPRE_Int lenl = 0;
+      for (j = P_i[ii]; j < P_i[ii + 1]; j++)
+      {
+         if (P_j[j] < ii)
+         {
+            lenl++;
+         }
+      }
+      L_diag_i[ii + 1] = lenl;
+      U_diag_i[ii + 1] = P_i[ii + 1] - P_i[ii] - lenl;
+   }
+   for (ii = 0; ii < n; ii++)
+   {
+      L_diag_i[ii + 1] += L_diag_i[ii];
+      U_diag_i[ii + 1] += U_diag_i[ii];
+   }
+   temp_L_diag_j = hypre_TAlloc(HYPRE_Int, L_diag_i[n], HYPRE_MEMORY_DEVICE);
+   temp_U_diag_j = hypre_TAlloc(HYPRE_Int, U_diag_i[n], HYPRE_MEMORY_DEVICE);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii, j, col) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      HYPRE_Int ctrL = L_diag_i[ii];
+      HYPRE_Int ctrU = U_diag_i[ii];
+      for (j = P_i[ii]; j < P_i[ii + 1]; j++)
+      {
+         col = P_j[j];
+         if (col < ii)
+         {
+            temp_L_diag_j[ctrL++] = col;
+         }
+         else
+         {
+            temp_U_diag_j[ctrU++] = col;
+         }
+      }
+      /* L must be sorted for the numeric factorization */
+      hypre_qsort0(temp_L_diag_j, L_diag_i[ii], L_diag_i[ii + 1] - 1);
+      hypre_qsort0(temp_U_diag_j, U_diag_i[ii], U_diag_i[ii + 1] - 1);
+   }
+
+   hypre_TFree(P_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(P_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(P_lev, HYPRE_MEMORY_HOST);
+
+   *L_diag_j = temp_L_diag_j;
+   *U_diag_j = temp_U_diag_j;
+
+   return hypre_error_flag;
+}
+
+/* ILU(k) with OpenMP threads, BJ only (nLU = n)
+ * A: input matrix
+ * lfil: level of fill-in, the k in ILU(k), 0 gives ILU(0)
+ * perm: permutation array indicating ordering of factorization, used for both
+ *    rows and columns
+ * iter_type: 0 = exact factorization, the rows of each level of L are factored
+ *    in parallel and the factors are the ones of hypre_ILUSetupILUK
+ *            1 = iterative factorization, Jacobi-type fixed-point sweeps on
+ *    the ILU(k) pattern (Chow and Patel); every entry of a sweep is computed
+ *    independently from the previous sweep
+ * max_iter: number of sweeps when iter_type is 1
+ * Lptr, Dptr, Uptr: L, D, U factors
+ * u_end: end of U rows, same as in hypre_ILUSetupILUK
+ */
+HYPRE_Int
+hypre_ILUSetupILUKThreaded(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *permp,
+                           HYPRE_Int iter_type, HYPRE_Int max_iter,
+                           hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr,
+                           HYPRE_Int **u_end)
+{
+   HYPRE_Real              local_nnz, total_nnz;
+   HYPRE_Int               i, ii, j, lev;
+   MPI_Comm                comm = hypre_ParCSRMatrixComm(A);
+
+   /* data objects for A */
+   hypre_CSRMatrix         *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real              *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int               *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+
+   /* data objects for L, D, U */
+   hypre_ParCSRMatrix      *matL;
+   hypre_ParCSRMatrix      *matU;
+   hypre_CSRMatrix         *L_diag;
+   hypre_CSRMatrix         *U_diag;
+   HYPRE_Real              *D_data;
+   HYPRE_Real              *L_diag_data   = NULL;
+   HYPRE_Int               *L_diag_i;
+   HYPRE_Int               *L_diag_j      = NULL;
+   HYPRE_Real              *U_diag_data   = NULL;
+   HYPRE_Int               *U_diag_i;
+   HYPRE_Int               *U_diag_j      = NULL;
+   HYPRE_Int               *u_end_array;
+
+   /* level schedule of L */
+   HYPRE_Int               num_levels;
+   HYPRE_Int               *level_ptr, *level_rows;
+
+   HYPRE_Int               n = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int               *perm, *rperm;
+
+   /* start setup */
+   D_data = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_DEVICE);
+   L_diag_i = hypre_CTAlloc(HYPRE_Int, (n + 1), HYPRE_MEMORY_DEVICE);
+   U_diag_i = hypre_CTAlloc(HYPRE_Int, (n + 1), HYPRE_MEMORY_DEVICE);
+
+   /* get reverse permutation (rperm) */
+   perm = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   rperm = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      perm[i] = permp ? permp[i] : i;
+   }
+   for (i = 0; i < n; i++)
+   {
+      rperm[perm[i]] = i;
+   }
+
+   /*
+    * 1: Symbolic factorization
+    */
+   hypre_ILUSetupILUKSymbolicThreaded(n, A_diag_i, A_diag_j, lfil, perm, rperm,
+                                      L_diag_i, U_diag_i, &L_diag_j, &U_diag_j);
+   L_diag_data = hypre_CTAlloc(HYPRE_Real, L_diag_i[n], HYPRE_MEMORY_DEVICE);
+   U_diag_data = hypre_CTAlloc(HYPRE_Real, U_diag_i[n], HYPRE_MEMORY_DEVICE);
+
+   /*
+    * 2: Numeric factorization
+    */
+   if (iter_type == 0)
+   {
+      /* rows of a level of L only depend on rows of earlier levels */
+      hypre_CSRMatrix *L_pattern = hypre_CSRMatrixCreate(n, n, L_diag_i[n]);
+      hypre_CSRMatrixI(L_pattern) = L_diag_i;
+      hypre_CSRMatrixJ(L_pattern) = L_diag_j;
+      hypre_ILUSetupLevelSchedule(L_pattern, n, 1, &num_levels, &level_ptr, &level_rows);
+      hypre_CSRMatrixI(L_pattern) = NULL;
+      hypre_CSRMatrixJ(L_pattern) = NULL;
+      hypre_CSRMatrixDestroy(L_pattern);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel private(lev, ii, i, j)
+#endif
+      {
+         HYPRE_Int   k, kl, ku, jpiv, col, icol, r;
+         HYPRE_Int   *iw = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+         for (j = 0; j < n; j++)
+         {
+            iw[j] = -1;
+         }
+
+         for (lev = 0; lev < num_levels; lev++)
+         {
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+            for (r = level_ptr[lev]; r < level_ptr[lev + 1]; r++)
+            {
+               ii = level_rows[r];
+               i = perm[ii];
+               kl = L_diag_i[ii + 1];
+               ku = U_diag_i[ii + 1];
+               /* set up working arrays */
+               for (j = L_diag_i[ii]; j < kl; j++)
+               {
+                  iw[L_diag_j[j]] = j;
+               }
+               D_data[ii] = 0.0;
+               iw[ii] = ii;
+               for (j = U_diag_i[ii]; j < ku; j++)
+               {
+                  iw[U_diag_j[j]] = j;
+               }
+               /* copy data from A into L, D and U */
+               for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+               {
+                  col = rperm[A_diag_j[j]];
+                  icol = iw[col];
+                  if (col < ii)
+                  {
+                     L_diag_data[icol] = A_diag_data[j];
+                  }
+                  else if (col == ii)
+                  {
+                     D_data[ii] = A_diag_data[j];
+                  }
+                  else
+                  {
+                     U_diag_data[icol] = A_diag_data[j];
+                  }
+               }
+               /* elimination */
+               for (j = L_diag_i[ii]; j < kl; j++)
+               {
+                  jpiv = L_diag_j[j];
+                  L_diag_data[j] *= D_data[jpiv];
+                  for (k = U_diag_i[jpiv]; k < U_diag_i[jpiv + 1]; k++)
+                  {
+                     col = U_diag_j[k];
+                     icol = iw[col];
+                     if (icol < 0)
+                     {
+                        continue;
+                     }
+                     if (col < ii)
+                     {
+                        L_diag_data[icol] -= L_diag_data[j] * U_diag_data[k];
+                     }
+                     else if (col == ii)
+                     {
+                        D_data[icol] -= L_diag_data[j] * U_diag_data[k];
+                     }
+                     else
+                     {
+                        U_diag_data[icol] -= L_diag_data[j] * U_diag_data[k];
+                     }
+                  }
+               }
+               /* reset working array */
+               for (j = L_diag_i[ii]; j < kl; j++)
+               {
+                  iw[L_diag_j[j]] = -1;
+               }
+               iw[ii] = -1;
+               for (j = U_diag_i[ii]; j < ku; j++)
+               {
+                  iw[U_diag_j[j]] = -1;
+               }
+
+               /* diagonal part (we store the inverse) */
+               if (fabs(D_data[ii]) < MAT_TOL)
+               {
+                  D_data[ii] = 1e-06;
+               }
+               D_data[ii] = 1. / D_data[ii];
+            }
+         }
+
+         hypre_TFree(iw, HYPRE_MEMORY_HOST);
+      }
+
+      hypre_TFree(level_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(level_rows, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      /*
+       * aL/aD/aU: entries of A on the pattern of L, D and U
+       * Ln/Dn/Un: factors of the next sweep, D is not inverted here
+       * Ut_i/j/k: U stored by columns, Ut_k is the position in U_diag_data
+       */
+      HYPRE_Real  *aL, *aD, *aU, *Ln, *Dn, *Un, *tmp;
+      HYPRE_Int   *Ut_i, *Ut_j, *Ut_k;
+      HYPRE_Int   iter;
+
+      aL = hypre_CTAlloc(HYPRE_Real, L_diag_i[n], HYPRE_MEMORY_HOST);
+      aU = hypre_CTAlloc(HYPRE_Real, U_diag_i[n], HYPRE_MEMORY_HOST);
+      aD = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+      Ln = hypre_TAlloc(HYPRE_Real, L_diag_i[n], HYPRE_MEMORY_DEVICE);
+      Un = hypre_TAlloc(HYPRE_Real, U_diag_i[n], HYPRE_MEMORY_DEVICE);
+      Dn = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_DEVICE);
+
+      /* scatter A into the pattern */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel private(ii, i, j)
+#endif
+      {
+         HYPRE_Int   col;
+         HYPRE_Int   *iw = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+         for (j = 0; j < n; j++)
+         {
+            iw[j] = -1;
+         }
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = 0; ii < n; ii++)
+         {
+            i = perm[ii];
+            for (j = L_diag_i[ii]; j < L_diag_i[ii + 1]; j++)
+            {
+               iw[L_diag_j[j]] = j;
+            }
+            for (j = U_diag_i[ii]; j < U_diag_i[ii + 1]; j++)
+            {
+               iw[U_diag_j[j]] = j;
+            }
+            for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+            {
+               col = rperm[A_diag_j[j]];
+               if (col < ii)
+               {
+                  aL[iw[col]] = A_diag_data[j];
+               }
+               else if (col == ii)
+               {
+                  aD[ii] = A_diag_data[j];
+               }
+               else
+               {
+                  aU[iw[col]] = A_diag_data[j];
+               }
+            }
+            for (j = L_diag_i[ii]; j < L_diag_i[ii + 1]; j++)
+            {
+               iw[L_diag_j[j]] = -1;
+            }
+            for (j = U_diag_i[ii]; j < U_diag_i[ii + 1]; j++)
+            {
+               iw[U_diag_j[j]] = -1;
+            }
+         }
+         hypre_TFree(iw, HYPRE_MEMORY_HOST);
+      }
+
+      /* initial guess: L = tril(A) diag(A)^{-1}, D = diag(A), U = triu(A) */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ii) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < n; ii++)
+      {
+         D_data[ii] = fabs(aD[ii]) < MAT_TOL ? 1e-06 : aD[ii];
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ii, j) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < n; ii++)
+      {
+         for (j = L_diag_i[ii]; j < L_diag_i[ii + 1]; j++)
+         {
+            L_diag_data[j] = aL[j] / D_data[L_diag_j[j]];
+         }
+         for (j = U_diag_i[ii]; j < U_diag_i[ii + 1]; j++)
+         {
+            U_diag_data[j] = aU[j];
+         }
+      }
+
+      /* transpose the pattern of U, rows of each column come out sorted */
+      Ut_i = hypre_CTAlloc(HYPRE_Int, n + 1, HYPRE_MEMORY_HOST);
+      Ut_j = hypre_TAlloc(HYPRE_Int, U_diag_i[n], HYPRE_MEMORY_HOST);
+      Ut_k = hypre_TAlloc(HYPRE_Int, U_diag_i[n], HYPRE_MEMORY_HOST);
+      for (j = 0; j < U_diag_i[n]; j++)
+      {
+         Ut_i[U_diag_j[j] + 1]++;
+      }
+      for (ii = 0; ii < n; ii++)
+      {
+         Ut_i[ii + 1] += Ut_i[ii];
+      }
+      for (ii = 0; ii < n; ii++)
+      {
+         for (j = U_diag_i[ii]; j < U_diag_i[ii + 1]; j++)
+         {
+            HYPRE_Int pos = Ut_i[U_diag_j[j]]++;
+            Ut_j[pos] = ii;
+            Ut_k[pos] = j;
+         }
+      }
+      for (ii = n; ii > 0; ii--)
+      {
+         Ut_i[ii] = Ut_i[ii - 1];
+      }
+      Ut_i[0] = 0;
+
+      /* fixed-point sweeps, a(i,j) = sum_{k <= min(i,j)} l(i,k) u(k,j) on the pattern */
+      for (iter = 0; iter < max_iter; iter++)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ii, j) HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = 0; ii < n; ii++)
+         {
+            HYPRE_Int   kl = L_diag_i[ii + 1];
+            HYPRE_Int   col, jl, jt, kt;
+            HYPRE_Real  s;
+
+            /* L part, l(ii,col) = (a(ii,col) - sum_{k < col} l(ii,k) u(k,col)) / u(col,col) */
+            for (j = L_diag_i[ii]; j < kl; j++)
+            {
+               col = L_diag_j[j];
+               s = aL[j];
+               jl = L_diag_i[ii];
+               jt = Ut_i[col];
+               kt = Ut_i[col + 1];
+               while (jl < j && jt < kt)
+               {
+                  if (L_diag_j[jl] == Ut_j[jt])
+                  {
+                     s -= L_diag_data[jl++] * U_diag_data[Ut_k[jt++]];
+                  }
+                  else if (L_diag_j[jl] < Ut_j[jt])
+                  {
+                     jl++;
+                  }
+                  else
+                  {
+                     jt++;
+                  }
+               }
+               Ln[j] = s / D_data[col];
+            }
+
+            /* diagonal, u(ii,ii) = a(ii,ii) - sum_{k < ii} l(ii,k) u(k,ii) */
+            s = aD[ii];
+            jl = L_diag_i[ii];
+            jt = Ut_i[ii];
+            kt = Ut_i[ii + 1];
+            while (jl < kl && jt < kt)
+            {
+               if (L_diag_j[jl] == Ut_j[jt])
+               {
+                  s -= L_diag_data[jl++] * U_diag_data[Ut_k[jt++]];
+               }
+               else if (L_diag_j[jl] < Ut_j[jt])
+               {
+                  jl++;
+               }
+               else
+               {
+                  jt++;
+               }
+            }
+            Dn[ii] = fabs(s) < MAT_TOL ? 1e-06 : s;
+
+            /* U part, u(ii,col) = a(ii,col) - sum_{k < ii} l(ii,k) u(k,col) */
+            for (j = U_diag_i[ii]; j < U_diag_i[ii + 1]; j++)
+            {
+               col = U_diag_j[j];
+               s = aU[j];
+               jl = L_diag_i[ii];
+               jt = Ut_i[col];
+               kt = Ut_i[col + 1];
+               while (jl < kl && jt < kt && Ut_j[jt] < ii)
+               {
+                  if (L_diag_j[jl] == Ut_j[jt])
+                  {
+                     s -= L_diag_data[jl++] * U_diag_data[Ut_k[jt++]];
+                  }
+                  else if (L_diag_j[jl] < Ut_j[jt])
+                  {
+                     jl++;
+                  }
+                  else
+                  {
+                     jt++;
+                  }
+               }
+               Un[j] = s;
+            }
+         }
+
+         tmp = L_diag_data; L_diag_data = Ln; Ln = tmp;
+         tmp = U_diag_data; U_diag_data = Un; Un = tmp;
+         tmp = D_data; D_data = Dn; Dn = tmp;
+      }
+
+      /* we store the inverse of D */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ii) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < n; ii++)
+      {
+         D_data[ii] = 1. / D_data[ii];
+      }
+
+      hypre_TFree(Ln, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(Un, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(Dn, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(aL, HYPRE_MEMORY_HOST);
+      hypre_TFree(aU, HYPRE_MEMORY_HOST);
+      hypre_TFree(aD, HYPRE_MEMORY_HOST);
+      hypre_TFree(Ut_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(Ut_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(Ut_k, HYPRE_MEMORY_HOST);
+   }
+
+   /* end of U rows, there is no Schur complement */
+   u_end_array = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (ii = 0; ii < n; ii++)
+   {
+      u_end_array[ii] = U_diag_i[ii + 1];
+   }
+
+   /*
+    * 3: Assemble LDU matrices
+    */
+   matL = hypre_ParCSRMatrixCreate( comm,
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixRowStarts(A),
+                                    hypre_ParCSRMatrixColStarts(A),
+                                    0 /* num_cols_offd */,
+                                    L_diag_i[n],
+                                    0 /* num_nonzeros_offd */);
+
+   L_diag = hypre_ParCSRMatrixDiag(matL);
+   hypre_CSRMatrixI(L_diag) = L_diag_i;
+   if (L_diag_i[n] > 0)
+   {
+      hypre_CSRMatrixData(L_diag) = L_diag_data;
+      hypre_CSRMatrixJ(L_diag) = L_diag_j;
+   }
+   else
+   {
+      hypre_TFree(L_diag_j, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(L_diag_data, HYPRE_MEMORY_DEVICE);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) (L_diag_i[n]);
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matL) = total_nnz;
+
+   matU = hypre_ParCSRMatrixCreate( comm,
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixRowStarts(A),
+                                    hypre_ParCSRMatrixColStarts(A),
+                                    0,
+                                    U_diag_i[n],
+                                    0 );
+
+   U_diag = hypre_ParCSRMatrixDiag(matU);
+   hypre_CSRMatrixI(U_diag) = U_diag_i;
+   if (U_diag_i[n] > 0)
+   {
+      hypre_CSRMatrixData(U_diag) = U_diag_data;
+      hypre_CSRMatrixJ(U_diag) = U_diag_j;
+   }
+   else
+   {
+      hypre_TFree(U_diag_j, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(U_diag_data, HYPRE_MEMORY_DEVICE);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) (U_diag_i[n]);
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matU) = total_nnz;
+
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(rperm, HYPRE_MEMORY_HOST);
+
+   /* set matrix pointers */
+   *Lptr = matL;
+   *Dptr = D_data;
+   *Uptr = matU;
+   *u_end = u_end_array;
+
+   return hypre_error_flag;
+}
+
 /* ILUT
  * A: input matrix
  * lfil: maximum nnz per row in L and U
@@ -102,7 +102,9 @@ hypre_ILUSolve( void               *ilu_vdata,
 #endif
 
    /* problem size */
+#ifdef HYPRE_USING_CUDA
    HYPRE_Int            n              = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+#endif
    HYPRE_Int            nLU            = hypre_ParILUDataNLU(ilu_data);
    HYPRE_Int            *u_end         = hypre_ParILUDataUEnd(ilu_data);
 
@@ -253,7 +255,7 @@ hypre_ILUSolve( void               *ilu_vdata,
                                      ilu_solve_policy,
                                      ilu_solve_buffer, F_array, U_array, perm, n, Utemp, Ftemp);//BJ-cusparse
 #else
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            hypre_ILUSolveLUHost(ilu_data, matA, F_array, U_array); //BJ
 #endif
             break;
          case 10: case 11:
@@ -299,7 +301,7 @@ hypre_ILUSolve( void               *ilu_vdata,
                                      ilu_solve_policy,
                                      ilu_solve_buffer, F_array, U_array, perm, n, Utemp, Ftemp);//BJ-cusparse
 #else
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            hypre_ILUSolveLUHost(ilu_data, matA, F_array, U_array); //BJ
 #endif
             break;
 
@@ -720,6 +722,50 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    return hypre_error_flag;
 }
 
+/* Incomplete LU solve for the BJ variants on the host
+ * Picks the triangular solve set up in hypre_ILUSetup: Jacobi sweeps, the
+ * level scheduled solve when running with more than one thread, or the plain
+ * forward and backward substitution.
+*/
+
+HYPRE_Int
+hypre_ILUSolveLUHost(void *ilu_vdata, hypre_ParCSRMatrix *A,
+                     hypre_ParVector *f, hypre_ParVector *u)
+{
+   hypre_ParILUData     *ilu_data      = (hypre_ParILUData*) ilu_vdata;
+   HYPRE_Int            *perm          = hypre_ParILUDataPerm(ilu_data);
+   hypre_ParCSRMatrix   *matL          = hypre_ParILUDataMatL(ilu_data);
+   HYPRE_Real           *matD          = hypre_ParILUDataMatD(ilu_data);
+   hypre_ParCSRMatrix   *matU          = hypre_ParILUDataMatU(ilu_data);
+   hypre_ParVector      *Ftemp         = hypre_ParILUDataFTemp(ilu_data);
+   hypre_ParVector      *Utemp         = hypre_ParILUDataUTemp(ilu_data);
+   HYPRE_Int            n              = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+
+   if (!hypre_ParILUDataTriSolve(ilu_data) && hypre_ParILUDataTriWork(ilu_data))
+   {
+      hypre_ILUSolveLUIter(A, f, u, perm, n, matL, matD, matU, Utemp, Ftemp,
+                           hypre_ParILUDataTriWork(ilu_data),
+                           hypre_ParILUDataLowerJacobiIters(ilu_data),
+                           hypre_ParILUDataUpperJacobiIters(ilu_data));
+   }
+   else if (hypre_ParILUDataLevelPtrL(ilu_data) && hypre_NumThreads() > 1)
+   {
+      hypre_ILUSolveLULevel(A, f, u, perm, n, matL, matD, matU, Utemp, Ftemp,
+                            hypre_ParILUDataNumLevelsL(ilu_data),
+                            hypre_ParILUDataLevelPtrL(ilu_data),
+                            hypre_ParILUDataLevelRowsL(ilu_data),
+                            hypre_ParILUDataNumLevelsU(ilu_data),
+                            hypre_ParILUDataLevelPtrU(ilu_data),
+                            hypre_ParILUDataLevelRowsU(ilu_data));
+   }
+   else
+   {
+      hypre_ILUSolveLU(A, f, u, perm, n, matL, matD, matU, Utemp, Ftemp);
+   }
+
+   return hypre_error_flag;
+}
+
 /* Incomplete LU solve
  * L, D and U factors only have local scope (no off-diagonal processor terms)
  * so apart from the residual calculation (which uses A), the solves with the
@@ -801,6 +847,190 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 }
 
 
+/* Incomplete LU solve, level scheduled
+ * Same as hypre_ILUSolveLU, but the rows of each level of L and U (see
+ * hypre_ILUSetupLevelSchedule) are independent and are split over the threads.
+*/
+
+HYPRE_Int
+hypre_ILUSolveLULevel(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
+                      hypre_ParVector    *u, HYPRE_Int *perm,
+                      HYPRE_Int nLU, hypre_ParCSRMatrix *L,
+                      HYPRE_Real* D, hypre_ParCSRMatrix *U,
+                      hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                      HYPRE_Int num_levels_L, HYPRE_Int *level_ptr_L, HYPRE_Int *level_rows_L,
+                      HYPRE_Int num_levels_U, HYPRE_Int *level_ptr_U, HYPRE_Int *level_rows_U)
+{
+   hypre_CSRMatrix *L_diag = hypre_ParCSRMatrixDiag(L);
+   HYPRE_Real      *L_diag_data = hypre_CSRMatrixData(L_diag);
+   HYPRE_Int       *L_diag_i = hypre_CSRMatrixI(L_diag);
+   HYPRE_Int       *L_diag_j = hypre_CSRMatrixJ(L_diag);
+
+   hypre_CSRMatrix *U_diag = hypre_ParCSRMatrixDiag(U);
+   HYPRE_Real      *U_diag_data = hypre_CSRMatrixData(U_diag);
+   HYPRE_Int       *U_diag_i = hypre_CSRMatrixI(U_diag);
+   HYPRE_Int       *U_diag_j = hypre_CSRMatrixJ(U_diag);
+
+   HYPRE_Real      *utemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(utemp));
+   HYPRE_Real      *ftemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(ftemp));
+
+   HYPRE_Real      sum;
+   HYPRE_Int       lev, ii, i, j;
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, ftemp);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(lev, ii, i, j, sum)
+#endif
+   {
+      /* L solve - Forward solve, L has a unit diagonal */
+      for (lev = 0; lev < num_levels_L; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = level_ptr_L[lev]; ii < level_ptr_L[lev + 1]; ii++)
+         {
+            i = level_rows_L[ii];
+            sum = ftemp_data[perm[i]];
+            for (j = L_diag_i[i]; j < L_diag_i[i + 1]; j++)
+            {
+               sum -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
+            }
+            utemp_data[perm[i]] = sum;
+         }
+      }
+
+      /* U solve - Backward substitution, D is stored as its inverse */
+      for (lev = 0; lev < num_levels_U; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = level_ptr_U[lev]; ii < level_ptr_U[lev + 1]; ii++)
+         {
+            i = level_rows_U[ii];
+            sum = utemp_data[perm[i]];
+            for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+            {
+               sum -= U_diag_data[j] * utemp_data[perm[U_diag_j[j]]];
+            }
+            utemp_data[perm[i]] = sum * D[i];
+         }
+      }
+   }
+
+   /* Update solution */
+   hypre_ParVectorAxpy(1.0, utemp, u);
+
+   return hypre_error_flag;
+}
+
+/* Incomplete LU solve with approximate triangular solves
+ * Instead of the exact forward and backward substitutions, a fixed number of
+ * Jacobi sweeps is applied to L and U. Each sweep is a sparse matrix-vector
+ * product, so this runs at full thread parallelism regardless of the
+ * dependency structure of the factors.
+ * work is a host array of size nLU.
+*/
+
+HYPRE_Int
+hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
+                     hypre_ParVector    *u, HYPRE_Int *perm,
+                     HYPRE_Int nLU, hypre_ParCSRMatrix *L,
+                     HYPRE_Real* D, hypre_ParCSRMatrix *U,
+                     hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                     HYPRE_Real *work, HYPRE_Int lower_iters, HYPRE_Int upper_iters)
+{
+   hypre_CSRMatrix *L_diag = hypre_ParCSRMatrixDiag(L);
+   HYPRE_Real      *L_diag_data = hypre_CSRMatrixData(L_diag);
+   HYPRE_Int       *L_diag_i = hypre_CSRMatrixI(L_diag);
+   HYPRE_Int       *L_diag_j = hypre_CSRMatrixJ(L_diag);
+
+   hypre_CSRMatrix *U_diag = hypre_ParCSRMatrixDiag(U);
+   HYPRE_Real      *U_diag_data = hypre_CSRMatrixData(U_diag);
+   HYPRE_Int       *U_diag_i = hypre_CSRMatrixI(U_diag);
+   HYPRE_Int       *U_diag_j = hypre_CSRMatrixJ(U_diag);
+
+   HYPRE_Real      *utemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(utemp));
+   HYPRE_Real      *ftemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(ftemp));
+
+   HYPRE_Real      sum;
+   HYPRE_Int       iter, i, j;
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, ftemp);
+
+   /* L solve: x = r, then x <- r - (L - I) x */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < nLU; i++)
+   {
+      utemp_data[perm[i]] = ftemp_data[perm[i]];
+   }
+   for (iter = 0; iter < lower_iters; iter++)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nLU; i++)
+      {
+         work[i] = utemp_data[perm[i]];
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j, sum) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nLU; i++)
+      {
+         sum = ftemp_data[perm[i]];
+         for (j = L_diag_i[i]; j < L_diag_i[i + 1]; j++)
+         {
+            sum -= L_diag_data[j] * work[L_diag_j[j]];
+         }
+         utemp_data[perm[i]] = sum;
+      }
+   }
+
+   /* U solve: keep y in ftemp, x = D y, then x <- D (y - U x) */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < nLU; i++)
+   {
+      ftemp_data[perm[i]] = utemp_data[perm[i]];
+      utemp_data[perm[i]] *= D[i];
+   }
+   for (iter = 0; iter < upper_iters; iter++)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nLU; i++)
+      {
+         work[i] = utemp_data[perm[i]];
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j, sum) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nLU; i++)
+      {
+         sum = ftemp_data[perm[i]];
+         for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+         {
+            sum -= U_diag_data[j] * work[U_diag_j[j]];
+         }
+         utemp_data[perm[i]] = sum * D[i];
+      }
+   }
+
+   /* Update solution */
+   hypre_ParVectorAxpy(1.0, utemp, u);
+
+   return hypre_error_flag;
+}
+
 /* Incomplete LU solve RAS
  * L, D and U factors only have local scope (no off-diagonal processor terms)
  * so apart from the residual calculation (which uses A), the solves with the
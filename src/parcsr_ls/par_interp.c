@@ -2651,6 +2651,159 @@ hypre_BoomerAMGInterpTruncation( hypre_ParCSRMatrix *P,
    }
 }
 
+/*------------------------------------------------
+ * Replace the weights of the interpolation matrix P
+ * by those of P_new, restricted to the sparsity pattern
+ * of P (pattern-frozen re-setup).  P_new must have been
+ * built with the splitting P was built with, i.e., have
+ * the same rows and coarse columns.  Entries of P_new
+ * outside of the pattern are dropped and each row is
+ * rescaled to keep the row sum of P_new, as in the
+ * interpolation truncation.
+ *------------------------------------------------*/
+HYPRE_Int
+hypre_BoomerAMGBuildInterpOnPattern( hypre_ParCSRMatrix *P_new,
+                                     hypre_ParCSRMatrix *P )
+{
+   hypre_CSRMatrix *Pn_diag = hypre_ParCSRMatrixDiag(P_new);
+   HYPRE_Real      *Pn_diag_data = hypre_CSRMatrixData(Pn_diag);
+   HYPRE_Int       *Pn_diag_i = hypre_CSRMatrixI(Pn_diag);
+   HYPRE_Int       *Pn_diag_j = hypre_CSRMatrixJ(Pn_diag);
+   hypre_CSRMatrix *Pn_offd = hypre_ParCSRMatrixOffd(P_new);
+   HYPRE_Real      *Pn_offd_data = hypre_CSRMatrixData(Pn_offd);
+   HYPRE_Int       *Pn_offd_i = hypre_CSRMatrixI(Pn_offd);
+   HYPRE_Int       *Pn_offd_j = hypre_CSRMatrixJ(Pn_offd);
+   HYPRE_Int        num_cols_Pn_offd = hypre_CSRMatrixNumCols(Pn_offd);
+   HYPRE_BigInt    *col_map_offd_Pn = hypre_ParCSRMatrixColMapOffd(P_new);
+
+   hypre_CSRMatrix *P_diag = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Real      *P_diag_data = hypre_CSRMatrixData(P_diag);
+   HYPRE_Int       *P_diag_i = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int       *P_diag_j = hypre_CSRMatrixJ(P_diag);
+   hypre_CSRMatrix *P_offd = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Real      *P_offd_data = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int       *P_offd_i = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int       *P_offd_j = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Int        num_cols_P_offd = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_BigInt    *col_map_offd_P = hypre_ParCSRMatrixColMapOffd(P);
+
+   HYPRE_Int        n_fine = hypre_CSRMatrixNumRows(P_diag);
+   HYPRE_Int        n_coarse = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int       *Pn_to_P_offd = NULL;
+   HYPRE_Int        i, j, k;
+
+   if (hypre_CSRMatrixNumRows(Pn_diag) != n_fine ||
+       hypre_CSRMatrixNumCols(Pn_diag) != n_coarse ||
+       hypre_ParCSRMatrixFirstColDiag(P_new) != hypre_ParCSRMatrixFirstColDiag(P))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Interpolation pattern does not match.\n");
+      return hypre_error_flag;
+   }
+
+   /* off-processor columns of P_new in the column numbering of P_offd */
+   if (num_cols_Pn_offd)
+   {
+      Pn_to_P_offd = hypre_TAlloc(HYPRE_Int, num_cols_Pn_offd, HYPRE_MEMORY_HOST);
+   }
+   for (i = 0; i < num_cols_Pn_offd; i++)
+   {
+      Pn_to_P_offd[i] = hypre_BigBinarySearch(col_map_offd_P, col_map_offd_Pn[i], num_cols_P_offd);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, j, k)
+#endif
+   {
+      HYPRE_Int   *diag_marker = hypre_TAlloc(HYPRE_Int, n_coarse, HYPRE_MEMORY_HOST);
+      HYPRE_Int   *offd_marker = hypre_TAlloc(HYPRE_Int, num_cols_P_offd, HYPRE_MEMORY_HOST);
+      HYPRE_Real   row_sum, scale;
+
+      for (j = 0; j < n_coarse; j++)
+      {
+         diag_marker[j] = -1;
+      }
+      for (j = 0; j < num_cols_P_offd; j++)
+      {
+         offd_marker[j] = -1;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n_fine; i++)
+      {
+         for (j = P_diag_i[i]; j < P_diag_i[i + 1]; j++)
+         {
+            diag_marker[P_diag_j[j]] = j;
+            P_diag_data[j] = 0.0;
+         }
+         for (j = P_offd_i[i]; j < P_offd_i[i + 1]; j++)
+         {
+            offd_marker[P_offd_j[j]] = j;
+            P_offd_data[j] = 0.0;
+         }
+
+         row_sum = 0.0;
+         scale   = 0.0;
+         for (j = Pn_diag_i[i]; j < Pn_diag_i[i + 1]; j++)
+         {
+            row_sum += Pn_diag_data[j];
+            k = diag_marker[Pn_diag_j[j]];
+            if (k > -1)
+            {
+               P_diag_data[k] = Pn_diag_data[j];
+               scale += Pn_diag_data[j];
+            }
+         }
+         for (j = Pn_offd_i[i]; j < Pn_offd_i[i + 1]; j++)
+         {
+            row_sum += Pn_offd_data[j];
+            k = Pn_to_P_offd[Pn_offd_j[j]];
+            k = (k > -1) ? offd_marker[k] : -1;
+            if (k > -1)
+            {
+               P_offd_data[k] = Pn_offd_data[j];
+               scale += Pn_offd_data[j];
+            }
+         }
+
+         /* rescale the row as in hypre_ParCSRMatrixTruncate */
+         scale = (scale != 0.0 && scale != row_sum) ? row_sum / scale : 1.0;
+         for (j = P_diag_i[i]; j < P_diag_i[i + 1]; j++)
+         {
+            diag_marker[P_diag_j[j]] = -1;
+            P_diag_data[j] *= scale;
+         }
+         for (j = P_offd_i[i]; j < P_offd_i[i + 1]; j++)
+         {
+            offd_marker[P_offd_j[j]] = -1;
+            P_offd_data[j] *= scale;
+         }
+      }
+
+      hypre_TFree(diag_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(offd_marker, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(Pn_to_P_offd, HYPRE_MEMORY_HOST);
+
+   /* the values changed: drop the saved transposes and SELL copies */
+   if (hypre_ParCSRMatrixDiagT(P))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(P));
+      hypre_ParCSRMatrixDiagT(P) = NULL;
+   }
+   if (hypre_ParCSRMatrixOffdT(P))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(P));
+      hypre_ParCSRMatrixOffdT(P) = NULL;
+   }
+   hypre_CSRMatrixSellInvalidate(P_diag);
+   hypre_CSRMatrixSellInvalidate(P_offd);
+
+   return hypre_error_flag;
+}
+
 /*---------------------------------------------------------------------------
  * hypre_BoomerAMGBuildInterpModUnk - this is a modified interpolation for the unknown approach.
  * here we need to pass in a strength matrix built on the entire matrix.
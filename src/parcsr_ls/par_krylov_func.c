@@ -176,6 +176,33 @@ hypre_ParKrylovInnerProd( void *x,
                                       (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdStart
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdStart( HYPRE_Int          n,
+                               void             **x,
+                               void             **y,
+                               HYPRE_Real        *local_result,
+                               HYPRE_Real        *result,
+                               hypre_MPI_Request *request )
+{
+   return ( hypre_ParVectorInnerProdStart( n, (hypre_ParVector **) x,
+                                           (hypre_ParVector **) y,
+                                           local_result, result, request ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdWait
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdWait( hypre_MPI_Request *request )
+{
+   return ( hypre_ParVectorInnerProdWait( request ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -187,6 +214,18 @@ hypre_ParKrylovMassInnerProd( void *x,
                                           (HYPRE_Real*)result ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMassInnerProdBlock
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_ParKrylovMassInnerProdBlock( void **x, HYPRE_Int nx,
+                                   void **y, HYPRE_Int k, HYPRE_Int unroll, void *result )
+{
+   return ( hypre_ParVectorMassInnerProdBlock( (hypre_ParVector **) x, nx,
+                                               (hypre_ParVector **) y, k, unroll,
+                                               (HYPRE_Real *) result ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassDotpTwo
  *--------------------------------------------------------------------------*/
@@ -212,6 +212,17 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       send_map_elmts_RT = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_RT);
    }
 
+   /* With per-row hash/heap accumulators requested for the host SpGEMM, form
+      the product with the modular RAP, which avoids the marker arrays below */
+   if (hypre_HandleSpgemmHostAlgorithm(hypre_handle()) == 1)
+   {
+      *RAP_ptr = hypre_ParCSRMatrixRAPKT(RT, A, P, keepTranspose);
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_RAP] += hypre_MPI_Wtime();
+#endif
+      return hypre_error_flag;
+   }
+
    hypre_CSRMatrixTranspose(RT_diag, &R_diag, 1);
    if (num_cols_offd_RT)
    {
@@ -2086,3 +2097,59 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
    return (0);
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildCoarseOperatorPlan
+ *
+ * Galerkin product RAP = RT^T*A*P computed as AP = A*P and RAP = RT^T*AP
+ * with symbolic plans. The plans are created if *AP_plan_ptr or
+ * *RAP_plan_ptr is NULL; later calls for matrices with the same patterns
+ * only redo the numeric products and the exchange of values.  A plan whose
+ * patterns do not match is created again by hypre_ParMatmulPlanExecute.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGBuildCoarseOperatorPlan( hypre_ParCSRMatrix   *RT,
+                                        hypre_ParCSRMatrix   *A,
+                                        hypre_ParCSRMatrix   *P,
+                                        hypre_ParMatmulPlan **AP_plan_ptr,
+                                        hypre_ParMatmulPlan **RAP_plan_ptr,
+                                        hypre_ParCSRMatrix  **RAP_ptr )
+{
+   hypre_ParCSRMatrix *AP  = NULL;
+   hypre_ParCSRMatrix *RAP = NULL;
+   HYPRE_Int           num_procs;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RAP] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A), &num_procs);
+
+   if (!*AP_plan_ptr)
+   {
+      hypre_ParMatmulPlanCreate(A, P, 0, AP_plan_ptr);
+   }
+   hypre_ParMatmulPlanExecute(*AP_plan_ptr, A, P, &AP);
+
+   if (!*RAP_plan_ptr)
+   {
+      hypre_ParMatmulPlanCreate(RT, AP, 1, RAP_plan_ptr);
+   }
+   hypre_ParMatmulPlanExecute(*RAP_plan_ptr, RT, AP, &RAP);
+
+   hypre_ParCSRMatrixDestroy(AP);
+
+   if (num_procs > 1)
+   {
+      hypre_MatvecCommPkgCreate(RAP);
+   }
+
+   *RAP_ptr = RAP;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RAP] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
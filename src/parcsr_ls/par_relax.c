@@ -1718,3 +1718,377 @@ hypre_BoomerAMGRelax12TwoStageGaussSeidel( hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVecSupported
+ *
+ * Returns 1 if relax_type has a fused multivector implementation in
+ * hypre_BoomerAMGRelaxMultiVec, i.e., all columns of f and u are relaxed
+ * while streaming A only once per sweep.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMultiVecSupported( HYPRE_Int relax_type )
+{
+   switch (relax_type)
+   {
+      case 0:  case 3:  case 4:  case 6:  case 7:
+      case 8:  case 13: case 14: case 18:
+         return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Weighted (l1-)Jacobi on multivectors:
+ *
+ *    u(i,:) += w * (f(i,:) - A(i,:) u) / d_i,
+ *
+ * where d_i = l1_norms[i], or the diagonal of A if l1_norms is NULL.
+ * The residual is computed by one fused multivector matvec.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGRelaxJacobiMultiVec( hypre_ParCSRMatrix *A,
+                                    hypre_ParVector    *f,
+                                    HYPRE_Int          *cf_marker,
+                                    HYPRE_Int           relax_points,
+                                    HYPRE_Real          relax_weight,
+                                    HYPRE_Real         *l1_norms,
+                                    hypre_ParVector    *u,
+                                    hypre_ParVector    *Vtemp )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int        num_rows    = hypre_CSRMatrixNumRows(A_diag);
+   hypre_Vector    *u_local     = hypre_ParVectorLocalVector(u);
+   HYPRE_Complex   *u_data      = hypre_VectorData(u_local);
+   HYPRE_Int        u_vs        = hypre_VectorVectorStride(u_local);
+   HYPRE_Int        u_is        = hypre_VectorIndexStride(u_local);
+   hypre_Vector    *v_local     = hypre_ParVectorLocalVector(Vtemp);
+   HYPRE_Complex   *v_data      = hypre_VectorData(v_local);
+   HYPRE_Int        v_vs        = hypre_VectorVectorStride(v_local);
+   HYPRE_Int        v_is        = hypre_VectorIndexStride(v_local);
+   HYPRE_Int        num_vectors = hypre_VectorNumVectors(u_local);
+   HYPRE_Int        i, jv;
+
+   /* Vtemp = f - A u */
+   hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, Vtemp);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != 0.0 )
+      {
+         const HYPRE_Complex scale = relax_weight / di;
+
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            u_data[i * u_is + jv * u_vs] += scale * v_data[i * v_is + jv * v_vs];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Hybrid (l1-)Gauss-Seidel/SOR on multivectors. Same semantics as
+ * hypre_BoomerAMGRelaxHybridGaussSeidel_core, but the off-processor part of
+ * all columns of u is exchanged in one message per neighbor and every
+ * nonzero of A is applied to all columns before moving to the next one.
+ * u and Vtemp must be stored rowwise (multivec storage method 1).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec( hypre_ParCSRMatrix *A,
+                                               hypre_ParVector    *f,
+                                               HYPRE_Int          *cf_marker,
+                                               HYPRE_Int           relax_points,
+                                               HYPRE_Real          relax_weight,
+                                               HYPRE_Real          omega,
+                                               HYPRE_Real         *l1_norms,
+                                               hypre_ParVector    *u,
+                                               hypre_ParVector    *Vtemp,
+                                               HYPRE_Int           GS_order,
+                                               HYPRE_Int           Symm,
+                                               HYPRE_Int           Skip_diag )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_Vector        *u_local       = hypre_ParVectorLocalVector(u);
+   HYPRE_Complex       *u_data        = hypre_VectorData(u_local);
+   hypre_Vector        *f_local       = hypre_ParVectorLocalVector(f);
+   HYPRE_Complex       *f_data        = hypre_VectorData(f_local);
+   HYPRE_Int            f_vs          = hypre_VectorVectorStride(f_local);
+   HYPRE_Int            f_is          = hypre_VectorIndexStride(f_local);
+   HYPRE_Int            num_vectors   = hypre_VectorNumVectors(u_local);
+   HYPRE_Complex       *Vtemp_data    = NULL;
+   HYPRE_Complex       *v_ext_data    = NULL;
+   HYPRE_Complex       *v_buf_data    = NULL;
+   HYPRE_Complex       *work;
+
+   const HYPRE_Real     one_minus_omega = 1.0 - omega;
+   const HYPRE_Int      gs_order        = GS_order > 0 ? 1 : -1;
+   const HYPRE_Int      num_sweeps      = Symm ? 2 : 1;
+   const HYPRE_Int      non_scale       = relax_weight == 1.0 && omega == 1.0;
+   const HYPRE_Real     prod            = 1.0 - relax_weight * omega;
+
+   HYPRE_Int            num_procs, num_threads, j, jv, num_sends;
+   hypre_ParCSRCommHandle *comm_handle;
+
+   /* u (and Vtemp) must be stored rowwise */
+   hypre_assert(hypre_VectorVectorStride(u_local) == 1);
+   hypre_assert(hypre_VectorIndexStride(u_local) == num_vectors);
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_threads = hypre_NumThreads();
+
+   if (num_procs > 1)
+   {
+      HYPRE_Int begin, end;
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+      num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin      = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+      end        = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      v_buf_data = hypre_TAlloc(HYPRE_Complex, num_vectors * (end - begin), HYPRE_MEMORY_HOST);
+      v_ext_data = hypre_TAlloc(HYPRE_Complex, num_vectors * num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j,jv) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = begin; j < end; j++)
+      {
+         const HYPRE_Int elmt = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j);
+
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            v_buf_data[(j - begin) * num_vectors + jv] = u_data[elmt * num_vectors + jv];
+         }
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+      comm_handle = hypre_ParCSRCommHandleCreateMultiVec(1, comm_pkg, num_vectors,
+                                                         HYPRE_MEMORY_HOST, v_buf_data,
+                                                         HYPRE_MEMORY_HOST, v_ext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   /* Vtemp has the same layout as u */
+   if (num_threads > 1 || !non_scale)
+   {
+      hypre_ParVectorCopy(u, Vtemp);
+      Vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   }
+
+   work = hypre_TAlloc(HYPRE_Complex, 3 * num_vectors * num_threads, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(j,jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < num_threads; j++)
+   {
+      HYPRE_Complex *res  = work + 3 * num_vectors * j;
+      HYPRE_Complex *res0 = res  + num_vectors;
+      HYPRE_Complex *res2 = res0 + num_vectors;
+      HYPRE_Int      ns, ne, sweep, i, jj;
+
+      hypre_partition1D(num_rows, num_threads, j, &ns, &ne);
+
+      for (sweep = 0; sweep < num_sweeps; sweep++)
+      {
+         const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
+         const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
+         const HYPRE_Int iend   = iorder > 0 ? ne : ns - 1;
+
+         for (i = ibegin; i != iend; i += iorder)
+         {
+            const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+            if ( !(relax_points == 0 || cf_marker[i] == relax_points) || di == 0.0 )
+            {
+               continue;
+            }
+
+            for (jv = 0; jv < num_vectors; jv++)
+            {
+               res[jv]  = f_data[i * f_is + jv * f_vs];
+               res0[jv] = 0.0;
+               res2[jv] = 0.0;
+            }
+
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+            {
+               const HYPRE_Int      ii = A_diag_j[jj];
+               const HYPRE_Complex  a  = A_diag_data[jj];
+               const HYPRE_Complex *vi = Vtemp_data ? Vtemp_data + ii * num_vectors : NULL;
+
+               if (ii >= ns && ii < ne)
+               {
+                  const HYPRE_Complex *ui = u_data + ii * num_vectors;
+
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     res0[jv] -= a * ui[jv];
+                  }
+                  if (!non_scale)
+                  {
+                     for (jv = 0; jv < num_vectors; jv++)
+                     {
+                        res2[jv] += a * vi[jv];
+                     }
+                  }
+               }
+               else
+               {
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     res[jv] -= a * vi[jv];
+                  }
+               }
+            }
+
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               const HYPRE_Complex  a  = A_offd_data[jj];
+               const HYPRE_Complex *xi = v_ext_data + A_offd_j[jj] * num_vectors;
+
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  res[jv] -= a * xi[jv];
+               }
+            }
+
+            {
+               HYPRE_Complex *ui = u_data + i * num_vectors;
+
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  const HYPRE_Complex upd = relax_weight *
+                                            (omega * res[jv] + res0[jv] + one_minus_omega * res2[jv]) / di;
+
+                  ui[jv] = Skip_diag ? prod * ui[jv] + upd : ui[jv] + upd;
+               }
+            }
+         }
+      } /* for (sweep = 0; sweep < num_sweeps; sweep++) */
+   } /* for (j = 0; j < num_threads; j++) */
+
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVec
+ *
+ * Relaxation for multivectors f and u (num_vectors > 1, host memory). Only
+ * the relaxation types for which hypre_BoomerAMGRelaxMultiVecSupported
+ * returns 1 are available. u and Vtemp must be stored rowwise
+ * (multivec storage method 1); f may use either storage method.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMultiVec( hypre_ParCSRMatrix *A,
+                              hypre_ParVector    *f,
+                              HYPRE_Int          *cf_marker,
+                              HYPRE_Int           relax_type,
+                              HYPRE_Int           relax_points,
+                              HYPRE_Real          relax_weight,
+                              HYPRE_Real          omega,
+                              HYPRE_Real         *l1_norms,
+                              hypre_ParVector    *u,
+                              hypre_ParVector    *Vtemp )
+{
+   const HYPRE_Int l1_skip_diag = relax_weight == 1.0 && omega == 1.0 ? 0 : 1;
+
+   switch (relax_type)
+   {
+      case 0: /* Weighted Jacobi */
+         return hypre_BoomerAMGRelaxJacobiMultiVec(A, f, cf_marker, relax_points, relax_weight,
+                                                   NULL, u, Vtemp);
+
+      case 7:  /* Jacobi */
+      case 18: /* weighted L1 Jacobi */
+         return hypre_BoomerAMGRelaxJacobiMultiVec(A, f, cf_marker, relax_points, relax_weight,
+                                                   l1_norms, u, Vtemp);
+
+      case 3: /* forward hybrid G-S */
+         return hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec(A, f, cf_marker, relax_points,
+                                                              relax_weight, omega, NULL, u, Vtemp,
+                                                              1, 0, 1);
+
+      case 4: /* backward hybrid G-S */
+         return hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec(A, f, cf_marker, relax_points,
+                                                              relax_weight, omega, NULL, u, Vtemp,
+                                                              -1, 0, 1);
+
+      case 6: /* hybrid SSOR */
+         return hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec(A, f, cf_marker, relax_points,
+                                                              relax_weight, omega, NULL, u, Vtemp,
+                                                              1, 1, 1);
+
+      case 8: /* hybrid L1 SSOR */
+         return hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec(A, f, cf_marker, relax_points,
+                                                              relax_weight, omega, l1_norms, u, Vtemp,
+                                                              1, 1, l1_skip_diag);
+
+      case 13: /* hybrid L1 Gauss-Seidel forward solve */
+         return hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec(A, f, cf_marker, relax_points,
+                                                              relax_weight, omega, l1_norms, u, Vtemp,
+                                                              1, 0, l1_skip_diag);
+
+      case 14: /* hybrid L1 Gauss-Seidel backward solve */
+         return hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec(A, f, cf_marker, relax_points,
+                                                              relax_weight, omega, l1_norms, u, Vtemp,
+                                                              -1, 0, l1_skip_diag);
+   }
+
+   hypre_error_in_arg(4);
+
+   return hypre_error_flag;
+}
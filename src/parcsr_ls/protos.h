@@ -508,6 +508,11 @@ HYPRE_Int HYPRE_BoomerAMGSetILUMaxRowNnz( HYPRE_Solver  solver, HYPRE_Int ilu_ma
 HYPRE_Int HYPRE_BoomerAMGSetILUMaxIter( HYPRE_Solver solver, HYPRE_Int ilu_max_iter);
 HYPRE_Int HYPRE_BoomerAMGSetILUDroptol( HYPRE_Solver solver, HYPRE_Real ilu_droptol);
 HYPRE_Int HYPRE_BoomerAMGSetILULocalReordering( HYPRE_Solver solver, HYPRE_Int ilu_reordering_type);
+HYPRE_Int HYPRE_BoomerAMGSetILUTriSolve( HYPRE_Solver solver, HYPRE_Int ilu_tri_solve);
+HYPRE_Int HYPRE_BoomerAMGSetILULowerJacobiIters( HYPRE_Solver solver,
+                                                 HYPRE_Int ilu_lower_jacobi_iters);
+HYPRE_Int HYPRE_BoomerAMGSetILUUpperJacobiIters( HYPRE_Solver solver,
+                                                 HYPRE_Int ilu_upper_jacobi_iters);
 HYPRE_Int HYPRE_BoomerAMGSetNumFunctions ( HYPRE_Solver solver, HYPRE_Int num_functions );
 HYPRE_Int HYPRE_BoomerAMGGetNumFunctions ( HYPRE_Solver solver, HYPRE_Int *num_functions );
 HYPRE_Int HYPRE_BoomerAMGSetNodal ( HYPRE_Solver solver, HYPRE_Int nodal );
@@ -573,6 +578,10 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetSellNumLevels ( HYPRE_Solver solver, HYPRE_Int sell_num_levels );
+HYPRE_Int HYPRE_BoomerAMGGetSellNumLevels ( HYPRE_Solver solver, HYPRE_Int *sell_num_levels );
+HYPRE_Int HYPRE_BoomerAMGSetFrozenPattern ( HYPRE_Solver solver, HYPRE_Int frozen_pattern );
+HYPRE_Int HYPRE_BoomerAMGGetFrozenPattern ( HYPRE_Solver solver, HYPRE_Int *frozen_pattern );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -737,6 +746,7 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
                                      HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetKDim ( HYPRE_Solver solver, HYPRE_Int k_dim );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS2 ( HYPRE_Solver solver, HYPRE_Int cgs2 );
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStep ( HYPRE_Solver solver, HYPRE_Int s_step );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetMinIter ( HYPRE_Solver solver, HYPRE_Int min_iter );
@@ -923,6 +933,33 @@ HYPRE_Int HYPRE_ParCSROnProcTriSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix H
 HYPRE_Int HYPRE_ParCSROnProcTriSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix HA,
                                        HYPRE_ParVector Hy, HYPRE_ParVector Hx );
 
+/* HYPRE_parcsr_pipelined_pcg.c */
+HYPRE_Int HYPRE_ParCSRPipelinedPCGCreate ( MPI_Comm comm, HYPRE_Solver *solver );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
+                                          HYPRE_ParVector b, HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
+                                          HYPRE_ParVector b, HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetMaxIter ( HYPRE_Solver solver, HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetTwoNorm ( HYPRE_Solver solver, HYPRE_Int two_norm );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetRecomputeResidualP ( HYPRE_Solver solver,
+                                                          HYPRE_Int recompute_residual_p );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetPrecond ( HYPRE_Solver solver,
+                                               HYPRE_PtrToParSolverFcn precond,
+                                               HYPRE_PtrToParSolverFcn precond_setup,
+                                               HYPRE_Solver precond_solver );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetPrecond ( HYPRE_Solver solver,
+                                               HYPRE_Solver *precond_data_ptr );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetPrintLevel ( HYPRE_Solver solver, HYPRE_Int level );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetLogging ( HYPRE_Solver solver, HYPRE_Int level );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetNumIterations ( HYPRE_Solver solver,
+                                                     HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver,
+                                                                 HYPRE_Real *norm );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetResidual ( HYPRE_Solver solver, HYPRE_ParVector *residual );
+
 /* HYPRE_parcsr_pilut.c */
 HYPRE_Int HYPRE_ParCSRPilutCreate ( MPI_Comm comm, HYPRE_Solver *solver );
 HYPRE_Int HYPRE_ParCSRPilutDestroy ( HYPRE_Solver solver );
@@ -1115,6 +1152,9 @@ HYPRE_Int hypre_BoomerAMGSetILUDroptol( void *data, HYPRE_Real ilu_droptol);
 HYPRE_Int hypre_BoomerAMGSetILUMaxIter( void *data, HYPRE_Int ilu_max_iter);
 HYPRE_Int hypre_BoomerAMGSetILUMaxRowNnz( void *data, HYPRE_Int ilu_max_row_nnz);
 HYPRE_Int hypre_BoomerAMGSetILULocalReordering( void *data, HYPRE_Int ilu_reordering_type);
+HYPRE_Int hypre_BoomerAMGSetILUTriSolve( void *data, HYPRE_Int ilu_tri_solve);
+HYPRE_Int hypre_BoomerAMGSetILULowerJacobiIters( void *data, HYPRE_Int ilu_lower_jacobi_iters);
+HYPRE_Int hypre_BoomerAMGSetILUUpperJacobiIters( void *data, HYPRE_Int ilu_upper_jacobi_iters);
 HYPRE_Int hypre_BoomerAMGSetChebyOrder ( void *data, HYPRE_Int order );
 HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data, HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data, HYPRE_Int eig_est );
@@ -1143,6 +1183,11 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetSellNumLevels ( void *data, HYPRE_Int sell_num_levels );
+HYPRE_Int hypre_BoomerAMGGetSellNumLevels ( void *data, HYPRE_Int *sell_num_levels );
+HYPRE_Int hypre_BoomerAMGSetFrozenPattern ( void *data, HYPRE_Int frozen_pattern );
+HYPRE_Int hypre_BoomerAMGGetFrozenPattern ( void *data, HYPRE_Int *frozen_pattern );
+HYPRE_Int hypre_BoomerAMGDestroyFrozenPattern ( void *data );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -1158,6 +1203,8 @@ HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_P
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGSolveMultiVec ( void *amg_vdata, hypre_ParCSRMatrix *A,
+                                         hypre_ParVector *f, hypre_ParVector *u );
 
 /* par_amg_solveT.c */
 HYPRE_Int hypre_BoomerAMGSolveT ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
@@ -1290,6 +1337,9 @@ HYPRE_Int hypre_BoomerAMGCoarsenCR ( hypre_ParCSRMatrix *A, hypre_IntArray **CF_
 /* par_cycle.c */
 HYPRE_Int hypre_BoomerAMGCycle ( void *amg_vdata, hypre_ParVector **F_array,
                                  hypre_ParVector **U_array );
+HYPRE_Int hypre_BoomerAMGCycleMultiVec ( void *amg_vdata, hypre_ParVector **F_array,
+                                         hypre_ParVector **U_array, hypre_ParVector **Vtemp_array,
+                                         hypre_ParVector *f_col, hypre_ParVector *u_col );
 
 /* par_difconv.c */
 HYPRE_ParCSRMatrix GenerateDifConv ( MPI_Comm comm, HYPRE_BigInt nx, HYPRE_BigInt ny,
@@ -1352,6 +1402,7 @@ HYPRE_Int hypre_BoomerAMGInterpTruncation ( hypre_ParCSRMatrix *P, HYPRE_Real tr
                                             HYPRE_Int max_elmts );
 HYPRE_Int hypre_BoomerAMGInterpTruncationDevice( hypre_ParCSRMatrix *P, HYPRE_Real trunc_factor,
                                                  HYPRE_Int max_elmts );
+HYPRE_Int hypre_BoomerAMGBuildInterpOnPattern ( hypre_ParCSRMatrix *P_new, hypre_ParCSRMatrix *P );
 
 HYPRE_Int hypre_BoomerAMGBuildInterpModUnk ( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
                                              hypre_ParCSRMatrix *S, HYPRE_BigInt *num_cpts_global, HYPRE_Int num_functions, HYPRE_Int *dof_func,
@@ -1581,6 +1632,9 @@ HYPRE_Int hypre_BoomerAMGBuildCoarseOperator ( hypre_ParCSRMatrix *RT, hypre_Par
                                                hypre_ParCSRMatrix *P, hypre_ParCSRMatrix **RAP_ptr );
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorKT ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
                                                  hypre_ParCSRMatrix *P, HYPRE_Int keepTranspose, hypre_ParCSRMatrix **RAP_ptr );
+HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorPlan ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
+                                                   hypre_ParCSRMatrix *P, hypre_ParMatmulPlan **AP_plan_ptr,
+                                                   hypre_ParMatmulPlan **RAP_plan_ptr, hypre_ParCSRMatrix **RAP_ptr );
 
 /* par_rap_communication.c */
 HYPRE_Int hypre_GetCommPkgRTFromCommPkgA ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
@@ -1674,6 +1728,11 @@ HYPRE_Int hypre_BoomerAMGRelax11TwoStageGaussSeidel( hypre_ParCSRMatrix *A, hypr
 HYPRE_Int hypre_BoomerAMGRelax12TwoStageGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                                      HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
                                                      hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxMultiVecSupported( HYPRE_Int relax_type );
+HYPRE_Int hypre_BoomerAMGRelaxMultiVec( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                        HYPRE_Int *cf_marker, HYPRE_Int relax_type, HYPRE_Int relax_points,
+                                        HYPRE_Real relax_weight, HYPRE_Real omega, HYPRE_Real *l1_norms,
+                                        hypre_ParVector *u, hypre_ParVector *Vtemp );
 
 /* par_realx_device.c */
 HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidelDevice( hypre_ParCSRMatrix *A, hypre_ParVector *f,
@@ -1864,8 +1923,13 @@ HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data, HYPRE_Complex alpha, void
                                    HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x, void *y );
+HYPRE_Int hypre_ParKrylovInnerProdStart ( HYPRE_Int n, void **x, void **y, HYPRE_Real *local_result,
+                                         HYPRE_Real *result, hypre_MPI_Request *request );
+HYPRE_Int hypre_ParKrylovInnerProdWait ( hypre_MPI_Request *request );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
                                          void *result );
+HYPRE_Int hypre_ParKrylovMassInnerProdBlock ( void **x, HYPRE_Int nx, void **y, HYPRE_Int k,
+                                              HYPRE_Int unroll, void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
                                        void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
@@ -2103,6 +2167,11 @@ HYPRE_Int hypre_ILUSolve( void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVecto
 HYPRE_Int hypre_ILUSetPrintLevel( void *ilu_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_ILUSetLogging( void *ilu_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type );
+HYPRE_Int hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve );
+HYPRE_Int hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters );
+HYPRE_Int hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters );
+HYPRE_Int hypre_ILUSetIterativeSetupType( void *ilu_vdata, HYPRE_Int iter_setup_type );
+HYPRE_Int hypre_ILUSetIterativeSetupMaxIter( void *ilu_vdata, HYPRE_Int iter_setup_max_iter );
 HYPRE_Int hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim );
 HYPRE_Int hypre_ILUSetSchurSolverMaxIter( void *ilu_vdata, HYPRE_Int ss_max_iter );
 HYPRE_Int hypre_ILUSetSchurSolverTol( void *ilu_vdata, HYPRE_Real ss_tol );
@@ -2151,6 +2220,9 @@ HYPRE_Int hypre_ILUGetInteriorExteriorPerm(hypre_ParCSRMatrix *A, HYPRE_Int **pe
 HYPRE_Int hypre_ILUGetLocalPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU,
                                 HYPRE_Int reordering_type);
 HYPRE_Int hypre_ILUWriteSolverParams(void *ilu_vdata);
+HYPRE_Int hypre_ILUDestroyTriSolveData( void *ilu_vdata );
+HYPRE_Int hypre_ILUSetupLevelSchedule( hypre_CSRMatrix *M, HYPRE_Int n, HYPRE_Int lower,
+                                       HYPRE_Int *num_levelsp, HYPRE_Int **level_ptrp, HYPRE_Int **level_rowsp );
 HYPRE_Int hypre_ILUBuildRASExternalMatrix(hypre_ParCSRMatrix *A, HYPRE_Int *rperm, HYPRE_Int **E_i,
                                           HYPRE_Int **E_j, HYPRE_Real **E_data);
 HYPRE_Int hypre_ILUSetupILU0(hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_Int *qperm,
@@ -2166,6 +2238,12 @@ HYPRE_Int hypre_ILUSetupILUKSymbolic(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int
                                      HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm, HYPRE_Int *iw, HYPRE_Int nLU,
                                      HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i, HYPRE_Int *S_diag_i, HYPRE_Int **L_diag_j,
                                      HYPRE_Int **U_diag_j, HYPRE_Int **S_diag_j, HYPRE_Int **u_end);
+HYPRE_Int hypre_ILUSetupILUKSymbolicThreaded(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j,
+                                             HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm, HYPRE_Int *L_diag_i,
+                                             HYPRE_Int *U_diag_i, HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j);
+HYPRE_Int hypre_ILUSetupILUKThreaded(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *permp,
+                                     HYPRE_Int iter_type, HYPRE_Int max_iter, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr,
+                                     hypre_ParCSRMatrix **Uptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILUT(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol,
                              HYPRE_Int *permp, HYPRE_Int *qpermp, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr,
                              HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
@@ -2180,9 +2258,19 @@ HYPRE_Int hypre_ILUSetupILUKRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int
 HYPRE_Int hypre_ILUSetupILUTRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol,
                                 HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr,
                                 hypre_ParCSRMatrix **Uptr);
+HYPRE_Int hypre_ILUSolveLUHost(void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                               hypre_ParVector *u);
 HYPRE_Int hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u,
                            HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U,
                            hypre_ParVector *utemp, hypre_ParVector *ftemp);
+HYPRE_Int hypre_ILUSolveLULevel(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u,
+                                HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U,
+                                hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Int num_levels_L, HYPRE_Int *level_ptr_L,
+                                HYPRE_Int *level_rows_L, HYPRE_Int num_levels_U, HYPRE_Int *level_ptr_U, HYPRE_Int *level_rows_U);
+HYPRE_Int hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u,
+                               HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U,
+                               hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *work, HYPRE_Int lower_iters,
+                               HYPRE_Int upper_iters);
 HYPRE_Int hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u,
                                    HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D,
                                    hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp,
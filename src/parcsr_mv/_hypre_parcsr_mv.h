@@ -470,6 +470,129 @@ typedef struct
 #define hypre_ParCSRBooleanMatrix_Get_Rowindices(matrix)    ((matrix)->rowindices)
 #define hypre_ParCSRBooleanMatrix_Get_Getrowactive(matrix)  ((matrix)->getrowactive)
 
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlan:
+ *   Symbolic data of the host products C = A*B (trans = 0) and C = A^T*B
+ *   (trans = 1), see par_csr_matop_plan.c
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             trans;
+   HYPRE_Int             A_nnz;        /* local patterns of A and B the plan */
+   HYPRE_Int             B_nnz;        /* was created for                    */
+   hypre_ulonglongint    A_hash;
+   hypre_ulonglongint    B_hash;
+   hypre_ParCSRMatrix   *C;            /* pattern of the product */
+   HYPRE_Int            *map_B_to_C;   /* offd columns of B to offd columns of C */
+
+   /* exchanged rows: rows of B (trans = 0) or partial rows of C (trans = 1) */
+   hypre_ParCSRCommPkg  *comm_pkg;     /* package for the nonzeros of the rows */
+   HYPRE_Int             num_send_rows;
+   HYPRE_Int            *send_rows;    /* rows of B to send (trans = 0) */
+   HYPRE_Int            *send_i;
+   HYPRE_Complex        *send_data;
+   HYPRE_Int            *ext_i;        /* received rows, columns in C */
+   HYPRE_Int            *ext_j;
+   HYPRE_Complex        *ext_data;
+
+   /* trans = 1 only */
+   HYPRE_Int            *E_i;          /* received rows of each row of C */
+   HYPRE_Int            *E_j;
+   HYPRE_Int            *AT_diag_i;    /* transposed patterns of A, with the */
+   HYPRE_Int            *AT_diag_j;    /* positions of the entries in A      */
+   HYPRE_Int            *AT_diag_perm;
+   HYPRE_Int            *AT_offd_i;
+   HYPRE_Int            *AT_offd_j;
+   HYPRE_Int            *AT_offd_perm;
+   HYPRE_Int            *int_diag_i;   /* partial rows A_offd^T*B */
+   HYPRE_Int            *int_diag_j;
+   HYPRE_Complex        *int_diag_data;
+   HYPRE_Int            *int_offd_i;
+   HYPRE_Int            *int_offd_j;
+   HYPRE_Complex        *int_offd_data;
+
+} hypre_ParMatmulPlan;
+
+/*--------------------------------------------------------------------------
+ * Accessor functions for the hypre_ParMatmulPlan structure
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParMatmulPlanTrans(plan)         ((plan) -> trans)
+#define hypre_ParMatmulPlanANnz(plan)          ((plan) -> A_nnz)
+#define hypre_ParMatmulPlanBNnz(plan)          ((plan) -> B_nnz)
+#define hypre_ParMatmulPlanAHash(plan)         ((plan) -> A_hash)
+#define hypre_ParMatmulPlanBHash(plan)         ((plan) -> B_hash)
+#define hypre_ParMatmulPlanC(plan)             ((plan) -> C)
+#define hypre_ParMatmulPlanMapBToC(plan)       ((plan) -> map_B_to_C)
+#define hypre_ParMatmulPlanCommPkg(plan)       ((plan) -> comm_pkg)
+#define hypre_ParMatmulPlanNumSendRows(plan)   ((plan) -> num_send_rows)
+#define hypre_ParMatmulPlanSendRows(plan)      ((plan) -> send_rows)
+#define hypre_ParMatmulPlanSendI(plan)         ((plan) -> send_i)
+#define hypre_ParMatmulPlanSendData(plan)      ((plan) -> send_data)
+#define hypre_ParMatmulPlanExtI(plan)          ((plan) -> ext_i)
+#define hypre_ParMatmulPlanExtJ(plan)          ((plan) -> ext_j)
+#define hypre_ParMatmulPlanExtData(plan)       ((plan) -> ext_data)
+#define hypre_ParMatmulPlanEI(plan)            ((plan) -> E_i)
+#define hypre_ParMatmulPlanEJ(plan)            ((plan) -> E_j)
+#define hypre_ParMatmulPlanATDiagI(plan)       ((plan) -> AT_diag_i)
+#define hypre_ParMatmulPlanATDiagJ(plan)       ((plan) -> AT_diag_j)
+#define hypre_ParMatmulPlanATDiagPerm(plan)    ((plan) -> AT_diag_perm)
+#define hypre_ParMatmulPlanATOffdI(plan)       ((plan) -> AT_offd_i)
+#define hypre_ParMatmulPlanATOffdJ(plan)       ((plan) -> AT_offd_j)
+#define hypre_ParMatmulPlanATOffdPerm(plan)    ((plan) -> AT_offd_perm)
+#define hypre_ParMatmulPlanIntDiagI(plan)      ((plan) -> int_diag_i)
+#define hypre_ParMatmulPlanIntDiagJ(plan)      ((plan) -> int_diag_j)
+#define hypre_ParMatmulPlanIntDiagData(plan)   ((plan) -> int_diag_data)
+#define hypre_ParMatmulPlanIntOffdI(plan)      ((plan) -> int_offd_i)
+#define hypre_ParMatmulPlanIntOffdJ(plan)      ((plan) -> int_offd_j)
+#define hypre_ParMatmulPlanIntOffdData(plan)   ((plan) -> int_offd_data)
+
+/*--------------------------------------------------------------------------
+ * Binary IJ files (par_binary_io.c)
+ *
+ * A file holds one matrix or vector in global row order, so it can be read
+ * back on any number of processes.  All integers below are 64-bit and in the
+ * byte order of the writer:
+ *
+ *   header          hypre_BINARY_IJ_HEADER_SIZE entries (indices below)
+ *   row partition   num_procs+1 entries, as written
+ *   col partition   num_procs+1 entries, as written (a vector repeats its
+ *                   row partition)
+ *   row_ptr         global_num_rows+1 entries        (matrix only)
+ *   cols            num_nonzeros x int_size bytes    (matrix only)
+ *   values          num_nonzeros (vector: global_num_rows) x real_size bytes,
+ *                   twice that for complex values
+ *
+ * Each section starts on an 8-byte boundary.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_BINARY_IJ_MAGIC              0x4a49425250594800LL  /* "\0HYPRBIJ" */
+#define hypre_BINARY_IJ_VERSION            1
+#define hypre_BINARY_IJ_MATRIX             1
+#define hypre_BINARY_IJ_VECTOR             2
+
+#define hypre_BINARY_IJ_HEADER_SIZE        16
+#define hypre_BINARY_IJ_HDR_MAGIC          0
+#define hypre_BINARY_IJ_HDR_VERSION        1
+#define hypre_BINARY_IJ_HDR_OBJECT         2
+#define hypre_BINARY_IJ_HDR_INT_SIZE       3
+#define hypre_BINARY_IJ_HDR_REAL_SIZE      4
+#define hypre_BINARY_IJ_HDR_COMPLEX        5
+#define hypre_BINARY_IJ_HDR_GLOBAL_ROWS    6
+#define hypre_BINARY_IJ_HDR_GLOBAL_COLS    7
+#define hypre_BINARY_IJ_HDR_FIRST_ROW      8
+#define hypre_BINARY_IJ_HDR_FIRST_COL      9
+#define hypre_BINARY_IJ_HDR_NUM_NONZEROS   10
+#define hypre_BINARY_IJ_HDR_NUM_PROCS      11
+
+/* file sections, in order */
+#define hypre_BINARY_IJ_ROW_PARTITION      0
+#define hypre_BINARY_IJ_COL_PARTITION      1
+#define hypre_BINARY_IJ_ROW_PTR            2
+#define hypre_BINARY_IJ_COLS               3
+#define hypre_BINARY_IJ_VALUES             4
+
 #endif
 /******************************************************************************
  * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
@@ -776,6 +899,25 @@ HYPRE_Int hypre_ParChordMatrixToParCSRMatrix ( hypre_ParChordMatrix *Ac, MPI_Com
 HYPRE_Int hypre_ParCSRMatrixToParChordMatrix ( hypre_ParCSRMatrix *Ap, MPI_Comm comm,
                                                hypre_ParChordMatrix **pAc );
 
+/* par_binary_io.c */
+hypre_ulonglongint hypre_BinaryIJSectionOffset ( const hypre_longlongint *header,
+                                                 HYPRE_Int section );
+HYPRE_Int hypre_ParCSRMatrixPrintBinaryIJ ( hypre_ParCSRMatrix *matrix, HYPRE_Int base_i,
+                                            HYPRE_Int base_j, const char *filename );
+HYPRE_Int hypre_ParVectorPrintBinaryIJ ( hypre_ParVector *vector, HYPRE_Int base_j,
+                                         const char *filename );
+HYPRE_Int hypre_BinaryIJReadHeader ( const char *filename, HYPRE_Int object,
+                                     hypre_longlongint *header );
+HYPRE_Int hypre_BinaryIJGetLocalRange ( MPI_Comm comm, const char *filename,
+                                        const hypre_longlongint *header, HYPRE_Int section,
+                                        HYPRE_BigInt *lower_ptr, HYPRE_BigInt *upper_ptr );
+HYPRE_Int hypre_BinaryIJReadRows ( const char *filename, const hypre_longlongint *header,
+                                   HYPRE_BigInt lower, HYPRE_BigInt upper, HYPRE_Int **row_ptr_ptr,
+                                   HYPRE_BigInt **cols_ptr, HYPRE_Complex **values_ptr );
+HYPRE_Int hypre_BinaryIJReadValues ( const char *filename, const hypre_longlongint *header,
+                                     HYPRE_BigInt lower, HYPRE_BigInt upper,
+                                     HYPRE_Complex *values );
+
 /* par_csr_aat.c */
 void hypre_ParAat_RowSizes ( HYPRE_Int **C_diag_i, HYPRE_Int **C_offd_i, HYPRE_Int *B_marker,
                              HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int *A_offd_i, HYPRE_Int *A_offd_j,
@@ -862,6 +1004,10 @@ hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate ( HYPRE_Int job, hypre_ParC
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int job,
                                                           hypre_ParCSRCommPkg *comm_pkg, HYPRE_MemoryLocation send_memory_location, void *send_data_in,
                                                           HYPRE_MemoryLocation recv_memory_location, void *recv_data_in );
+hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreateMultiVec ( HYPRE_Int job,
+                                                               hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_vectors,
+                                                               HYPRE_MemoryLocation send_memory_location, void *send_data_in,
+                                                               HYPRE_MemoryLocation recv_memory_location, void *recv_data_in );
 HYPRE_Int hypre_ParCSRCommHandleDestroy ( hypre_ParCSRCommHandle *comm_handle );
 void hypre_ParCSRCommPkgCreate_core ( MPI_Comm comm, HYPRE_BigInt *col_map_offd,
                                       HYPRE_BigInt first_col_diag, HYPRE_BigInt *col_starts, HYPRE_Int num_cols_diag,
@@ -999,6 +1145,15 @@ HYPRE_Int hypre_ParCSRMatrixAddHost( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
 HYPRE_Int hypre_ParCSRMatrixAddDevice( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                        HYPRE_Complex beta, hypre_ParCSRMatrix *B, hypre_ParCSRMatrix **Cout);
 
+/* par_csr_matop_plan.c */
+HYPRE_Int hypre_ParMatmulPlanCreate ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                      HYPRE_Int trans, hypre_ParMatmulPlan **plan_ptr );
+HYPRE_Int hypre_ParMatmulPlanMatches ( hypre_ParMatmulPlan *plan, hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *B );
+HYPRE_Int hypre_ParMatmulPlanExecute ( hypre_ParMatmulPlan *plan, hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *B, hypre_ParCSRMatrix **C_ptr );
+HYPRE_Int hypre_ParMatmulPlanDestroy ( hypre_ParMatmulPlan *plan );
+
 /* par_csr_matop_marked.c */
 void hypre_ParMatmul_RowSizes_Marked ( HYPRE_Int **C_diag_i, HYPRE_Int **C_offd_i,
                                        HYPRE_Int **B_marker, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int *A_offd_i,
@@ -1032,6 +1187,9 @@ HYPRE_Int hypre_ParCSRMatrixSetNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumRownnz ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix, HYPRE_Int owns_data );
+HYPRE_Int hypre_ParCSRMatrixSetSellSigma ( hypre_ParCSRMatrix *matrix, HYPRE_Int sigma );
+HYPRE_Int hypre_ParCSRMatrixSellInvalidate ( hypre_ParCSRMatrix *matrix );
+hypre_ulonglongint hypre_ParCSRMatrixPatternHash ( hypre_ParCSRMatrix *matrix );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrint ( hypre_ParCSRMatrix *matrix, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrintIJ ( const hypre_ParCSRMatrix *matrix, const HYPRE_Int base_i,
@@ -1069,6 +1227,10 @@ void hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A);
 // y = alpha*A*x + beta*b
 HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                                hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *b, hypre_ParVector *y );
+HYPRE_Int hypre_ParCSRMatrixMatvecMultiVecHost ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
+                                                  hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *b, hypre_ParVector *y );
+HYPRE_Int hypre_ParCSRMatrixMatvecTMultiVecHost ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
+                                                  hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
 // y = alpha*A*x + beta*y
 HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A, hypre_ParVector *x,
                                      HYPRE_Complex beta, hypre_ParVector *y );
@@ -1129,10 +1291,21 @@ HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha, hypre_ParVector *x, hypre_P
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y,
                                     HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorInnerProdStart ( HYPRE_Int n, hypre_ParVector **x, hypre_ParVector **y,
+                                         HYPRE_Real *local_result, HYPRE_Real *result,
+                                         hypre_MPI_Request *request );
+HYPRE_Int hypre_ParVectorInnerProdWait ( hypre_MPI_Request *request );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y, HYPRE_Int k,
                                          HYPRE_Int unroll, HYPRE_Real *prod );
+HYPRE_Int hypre_ParVectorMassInnerProdBlock ( hypre_ParVector **x, HYPRE_Int nx,
+                                              hypre_ParVector **y, HYPRE_Int k, HYPRE_Int unroll,
+                                              HYPRE_Real *result );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
                                        HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x, HYPRE_Real *prod_y );
+HYPRE_Int hypre_ParMultiVectorGetColumn ( hypre_ParVector *x, HYPRE_Int j, hypre_ParVector *y );
+HYPRE_Int hypre_ParMultiVectorSetColumn ( hypre_ParVector *x, HYPRE_Int j, hypre_ParVector *y );
+HYPRE_Int hypre_ParMultiVectorColumnInnerProds ( hypre_ParVector *x, hypre_ParVector *y,
+                                                 HYPRE_Real *result );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm, hypre_Vector *v,
                                            HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
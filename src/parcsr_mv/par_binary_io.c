@@ -0,0 +1,616 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Binary IJ files for ParCSR matrices and ParVectors.  The layout is
+ * described in par_csr_matrix.h.  Files are written collectively into a
+ * single file and read back through file mappings, by any number of
+ * processes.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+#define hypre_BinaryIJValueSize(header) \
+   ((header)[hypre_BINARY_IJ_HDR_REAL_SIZE] * ((header)[hypre_BINARY_IJ_HDR_COMPLEX] ? 2 : 1))
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryIJSectionOffset
+ *
+ * Returns the byte offset of the given file section.
+ *--------------------------------------------------------------------------*/
+
+hypre_ulonglongint
+hypre_BinaryIJSectionOffset( const hypre_longlongint *header,
+                             HYPRE_Int                section )
+{
+   hypre_ulonglongint  sizes[hypre_BINARY_IJ_VALUES];
+   hypre_ulonglongint  offset;
+   hypre_longlongint   num_procs    = header[hypre_BINARY_IJ_HDR_NUM_PROCS];
+   hypre_longlongint   num_rows     = header[hypre_BINARY_IJ_HDR_GLOBAL_ROWS];
+   hypre_longlongint   num_nonzeros = header[hypre_BINARY_IJ_HDR_NUM_NONZEROS];
+   HYPRE_Int           is_matrix, k;
+
+   is_matrix = (header[hypre_BINARY_IJ_HDR_OBJECT] == hypre_BINARY_IJ_MATRIX);
+
+   sizes[hypre_BINARY_IJ_ROW_PARTITION] = (num_procs + 1) * 8;
+   sizes[hypre_BINARY_IJ_COL_PARTITION] = (num_procs + 1) * 8;
+   sizes[hypre_BINARY_IJ_ROW_PTR]       = is_matrix ? (num_rows + 1) * 8 : 0;
+   sizes[hypre_BINARY_IJ_COLS]          = is_matrix ?
+                                          (num_nonzeros * header[hypre_BINARY_IJ_HDR_INT_SIZE] + 7) / 8 * 8 : 0;
+
+   offset = hypre_BINARY_IJ_HEADER_SIZE * 8;
+   for (k = 0; k < section; k++)
+   {
+      offset += sizes[k];
+   }
+
+   return offset;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryIJWritePartitions
+ *
+ * Fills in the header (except the object-specific entries set by the
+ * caller), gathers the row and column partitions, and writes both on
+ * process 0.  Collective.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryIJWritePartitions( MPI_Comm            comm,
+                               void               *file,
+                               hypre_longlongint  *header,
+                               HYPRE_BigInt        row_start,
+                               HYPRE_BigInt        col_start,
+                               hypre_longlongint  *row_position_ptr )
+{
+   HYPRE_BigInt       *starts, send_starts[2];
+   hypre_longlongint  *row_part, *col_part;
+   HYPRE_Int           myid, num_procs, p, np;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   starts = hypre_TAlloc(HYPRE_BigInt, 2 * num_procs, HYPRE_MEMORY_HOST);
+   send_starts[0] = row_start;
+   send_starts[1] = col_start;
+   hypre_MPI_Allgather(send_starts, 2, HYPRE_MPI_BIG_INT, starts, 2, HYPRE_MPI_BIG_INT, comm);
+
+   row_part = hypre_TAlloc(hypre_longlongint, 2 * (num_procs + 1), HYPRE_MEMORY_HOST);
+   col_part = row_part + num_procs + 1;
+   for (p = 0; p < num_procs; p++)
+   {
+      row_part[p] = (hypre_longlongint) starts[2 * p];
+      col_part[p] = (hypre_longlongint) starts[2 * p + 1];
+   }
+   row_part[num_procs] = row_part[0] + header[hypre_BINARY_IJ_HDR_GLOBAL_ROWS];
+   col_part[num_procs] = col_part[0] + header[hypre_BINARY_IJ_HDR_GLOBAL_COLS];
+
+   header[hypre_BINARY_IJ_HDR_MAGIC]     = hypre_BINARY_IJ_MAGIC;
+   header[hypre_BINARY_IJ_HDR_VERSION]   = hypre_BINARY_IJ_VERSION;
+   header[hypre_BINARY_IJ_HDR_INT_SIZE]  = (hypre_longlongint) sizeof(HYPRE_BigInt);
+   header[hypre_BINARY_IJ_HDR_REAL_SIZE] = (hypre_longlongint) sizeof(HYPRE_Real);
+#ifdef HYPRE_COMPLEX
+   header[hypre_BINARY_IJ_HDR_COMPLEX]   = 1;
+#else
+   header[hypre_BINARY_IJ_HDR_COMPLEX]   = 0;
+#endif
+   header[hypre_BINARY_IJ_HDR_FIRST_ROW] = row_part[0];
+   header[hypre_BINARY_IJ_HDR_FIRST_COL] = col_part[0];
+   header[hypre_BINARY_IJ_HDR_NUM_PROCS] = (hypre_longlongint) num_procs;
+
+   /* partitions are contiguous in the file, right after the header */
+   np = (myid == 0);
+   hypre_BinaryFileWriteAt(file, 0, header, np * hypre_BINARY_IJ_HEADER_SIZE * 8);
+   hypre_BinaryFileWriteAt(file, hypre_BinaryIJSectionOffset(header, hypre_BINARY_IJ_ROW_PARTITION),
+                           row_part, np * 2 * (num_procs + 1) * 8);
+
+   *row_position_ptr = row_part[myid] - row_part[0];
+
+   hypre_TFree(starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_part, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPrintBinaryIJ
+ *
+ * Writes the matrix to a single binary IJ file.  Row i of the file holds
+ * the diag entries followed by the offd entries of that row, with global
+ * column indices.  Row and column indices are shifted by base_i and base_j.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPrintBinaryIJ( hypre_ParCSRMatrix *matrix,
+                                 HYPRE_Int           base_i,
+                                 HYPRE_Int           base_j,
+                                 const char         *filename )
+{
+   MPI_Comm             comm;
+   hypre_CSRMatrix     *diag;
+   hypre_CSRMatrix     *offd;
+   HYPRE_BigInt        *col_map_offd;
+   HYPRE_BigInt         first_col_diag;
+   HYPRE_Int           *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex       *diag_data, *offd_data;
+   HYPRE_Int            num_rows, num_nonzeros, num_row_ptr;
+   HYPRE_Int           *all_nonzeros;
+   HYPRE_Int            myid, num_procs, i, j, k, p;
+   hypre_longlongint    header[hypre_BINARY_IJ_HEADER_SIZE];
+   hypre_longlongint    row_position, nnz_position, num_nonzeros_global;
+   hypre_longlongint   *row_ptr;
+   HYPRE_BigInt        *cols;
+   HYPRE_Complex       *values;
+   void                *file;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   comm           = hypre_ParCSRMatrixComm(matrix);
+   diag           = hypre_ParCSRMatrixDiag(matrix);
+   offd           = hypre_ParCSRMatrixOffd(matrix);
+   col_map_offd   = hypre_ParCSRMatrixColMapOffd(matrix);
+   first_col_diag = hypre_ParCSRMatrixFirstColDiag(matrix);
+   num_rows       = hypre_ParCSRMatrixNumRows(matrix);
+   diag_i         = hypre_CSRMatrixI(diag);
+   diag_j         = hypre_CSRMatrixJ(diag);
+   diag_data      = hypre_CSRMatrixData(diag);
+   offd_i         = hypre_CSRMatrixI(offd);
+   offd_j         = hypre_CSRMatrixJ(offd);
+   offd_data      = hypre_CSRMatrixData(offd);
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* position of the local nonzeros in the file */
+   num_nonzeros = diag_i[num_rows] + offd_i[num_rows];
+   all_nonzeros = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&num_nonzeros, 1, HYPRE_MPI_INT, all_nonzeros, 1, HYPRE_MPI_INT, comm);
+   nnz_position = 0;
+   num_nonzeros_global = 0;
+   for (p = 0; p < num_procs; p++)
+   {
+      if (p == myid)
+      {
+         nnz_position = num_nonzeros_global;
+      }
+      num_nonzeros_global += (hypre_longlongint) all_nonzeros[p];
+   }
+   hypre_TFree(all_nonzeros, HYPRE_MEMORY_HOST);
+
+   /* the last process also writes the closing row_ptr entry */
+   num_row_ptr = num_rows + (myid == num_procs - 1);
+   row_ptr = hypre_TAlloc(hypre_longlongint, num_row_ptr, HYPRE_MEMORY_HOST);
+   cols    = hypre_TAlloc(HYPRE_BigInt, num_nonzeros, HYPRE_MEMORY_HOST);
+   values  = hypre_TAlloc(HYPRE_Complex, num_nonzeros, HYPRE_MEMORY_HOST);
+
+   k = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      row_ptr[i] = nnz_position + (hypre_longlongint) k;
+      for (j = diag_i[i]; j < diag_i[i + 1]; j++, k++)
+      {
+         cols[k]   = first_col_diag + (HYPRE_BigInt)(diag_j[j] + base_j);
+         values[k] = diag_data ? diag_data[j] : 0.0;
+      }
+      for (j = offd_i[i]; j < offd_i[i + 1]; j++, k++)
+      {
+         cols[k]   = col_map_offd[offd_j[j]] + (HYPRE_BigInt) base_j;
+         values[k] = offd_data ? offd_data[j] : 0.0;
+      }
+   }
+   if (num_row_ptr > num_rows)
+   {
+      row_ptr[num_rows] = num_nonzeros_global;
+   }
+
+   header[hypre_BINARY_IJ_HDR_OBJECT]       = hypre_BINARY_IJ_MATRIX;
+   header[hypre_BINARY_IJ_HDR_GLOBAL_ROWS]  = (hypre_longlongint) hypre_ParCSRMatrixGlobalNumRows(matrix);
+   header[hypre_BINARY_IJ_HDR_GLOBAL_COLS]  = (hypre_longlongint) hypre_ParCSRMatrixGlobalNumCols(matrix);
+   header[hypre_BINARY_IJ_HDR_NUM_NONZEROS] = num_nonzeros_global;
+   for (k = hypre_BINARY_IJ_HDR_NUM_PROCS + 1; k < hypre_BINARY_IJ_HEADER_SIZE; k++)
+   {
+      header[k] = 0;
+   }
+
+   hypre_BinaryFileOpenWrite(comm, filename, &file);
+   if (!file)
+   {
+      hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(values, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   hypre_BinaryIJWritePartitions(comm, file, header,
+                                 hypre_ParCSRMatrixFirstRowIndex(matrix) + (HYPRE_BigInt) base_i,
+                                 first_col_diag + (HYPRE_BigInt) base_j, &row_position);
+
+   hypre_BinaryFileWriteAt(file, hypre_BinaryIJSectionOffset(header, hypre_BINARY_IJ_ROW_PTR) +
+                           row_position * 8,
+                           row_ptr, (hypre_ulonglongint) num_row_ptr * 8);
+   hypre_BinaryFileWriteAt(file, hypre_BinaryIJSectionOffset(header, hypre_BINARY_IJ_COLS) +
+                           nnz_position * sizeof(HYPRE_BigInt),
+                           cols, (hypre_ulonglongint) num_nonzeros * sizeof(HYPRE_BigInt));
+   hypre_BinaryFileWriteAt(file, hypre_BinaryIJSectionOffset(header, hypre_BINARY_IJ_VALUES) +
+                           nnz_position * sizeof(HYPRE_Complex),
+                           values, (hypre_ulonglongint) num_nonzeros * sizeof(HYPRE_Complex));
+
+   hypre_BinaryFileClose(file);
+
+   hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPrintBinaryIJ
+ *
+ * Writes the vector to a single binary IJ file, with indices shifted by
+ * base_j.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorPrintBinaryIJ( hypre_ParVector *vector,
+                              HYPRE_Int        base_j,
+                              const char      *filename )
+{
+   MPI_Comm             comm;
+   HYPRE_BigInt        *partitioning;
+   HYPRE_Int            local_size, k;
+   hypre_longlongint    header[hypre_BINARY_IJ_HEADER_SIZE];
+   hypre_longlongint    row_position;
+   void                *file;
+
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* multivector code not written yet */
+   if ( hypre_ParVectorNumVectors(vector) != 1 )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   comm         = hypre_ParVectorComm(vector);
+   partitioning = hypre_ParVectorPartitioning(vector);
+   local_size   = hypre_VectorSize(hypre_ParVectorLocalVector(vector));
+
+   header[hypre_BINARY_IJ_HDR_OBJECT]       = hypre_BINARY_IJ_VECTOR;
+   header[hypre_BINARY_IJ_HDR_GLOBAL_ROWS]  = (hypre_longlongint) hypre_ParVectorGlobalSize(vector);
+   header[hypre_BINARY_IJ_HDR_GLOBAL_COLS]  = header[hypre_BINARY_IJ_HDR_GLOBAL_ROWS];
+   header[hypre_BINARY_IJ_HDR_NUM_NONZEROS] = header[hypre_BINARY_IJ_HDR_GLOBAL_ROWS];
+   for (k = hypre_BINARY_IJ_HDR_NUM_PROCS + 1; k < hypre_BINARY_IJ_HEADER_SIZE; k++)
+   {
+      header[k] = 0;
+   }
+
+   hypre_BinaryFileOpenWrite(comm, filename, &file);
+   if (!file)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_BinaryIJWritePartitions(comm, file, header,
+                                 partitioning[0] + (HYPRE_BigInt) base_j,
+                                 partitioning[0] + (HYPRE_BigInt) base_j, &row_position);
+
+   hypre_BinaryFileWriteAt(file, hypre_BinaryIJSectionOffset(header, hypre_BINARY_IJ_VALUES) +
+                           row_position * sizeof(HYPRE_Complex),
+                           hypre_VectorData(hypre_ParVectorLocalVector(vector)),
+                           (hypre_ulonglongint) local_size * sizeof(HYPRE_Complex));
+
+   hypre_BinaryFileClose(file);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryIJReadHeader
+ *
+ * Reads and checks the header of a binary IJ file holding the given object
+ * (hypre_BINARY_IJ_MATRIX or hypre_BINARY_IJ_VECTOR).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryIJReadHeader( const char         *filename,
+                          HYPRE_Int           object,
+                          hypre_longlongint  *header )
+{
+   void               *mapping, *data;
+   hypre_longlongint   real_size, int_size, last;
+#ifdef HYPRE_COMPLEX
+   hypre_longlongint   is_complex = 1;
+#else
+   hypre_longlongint   is_complex = 0;
+#endif
+
+   hypre_BinaryFileMap(filename, 0, hypre_BINARY_IJ_HEADER_SIZE * 8, &mapping, &data);
+   if (!mapping)
+   {
+      return hypre_error_flag;
+   }
+   hypre_TMemcpy(header, data, hypre_longlongint, hypre_BINARY_IJ_HEADER_SIZE,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_BinaryFileUnmap(mapping);
+
+   if (header[hypre_BINARY_IJ_HDR_MAGIC] != hypre_BINARY_IJ_MAGIC)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Error: not a binary IJ file, or written with another byte order\n");
+      return hypre_error_flag;
+   }
+   if (header[hypre_BINARY_IJ_HDR_VERSION] > hypre_BINARY_IJ_VERSION ||
+       header[hypre_BINARY_IJ_HDR_OBJECT] != object)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: unexpected binary IJ file contents\n");
+      return hypre_error_flag;
+   }
+
+   int_size  = header[hypre_BINARY_IJ_HDR_INT_SIZE];
+   real_size = header[hypre_BINARY_IJ_HDR_REAL_SIZE];
+   if ((int_size != 4 && int_size != 8) ||
+       (real_size != 4 && real_size != 8 && real_size != (hypre_longlongint) sizeof(HYPRE_Real)) ||
+       header[hypre_BINARY_IJ_HDR_COMPLEX] != is_complex)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Error: binary IJ file value types do not match this build\n");
+      return hypre_error_flag;
+   }
+
+   /* indices must fit in HYPRE_BigInt */
+   last = hypre_max(header[hypre_BINARY_IJ_HDR_FIRST_ROW] + header[hypre_BINARY_IJ_HDR_GLOBAL_ROWS],
+                    header[hypre_BINARY_IJ_HDR_FIRST_COL] + header[hypre_BINARY_IJ_HDR_GLOBAL_COLS]);
+   if ((hypre_longlongint)(HYPRE_BigInt) last != last)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Error: binary IJ file indices do not fit in HYPRE_BigInt\n");
+      return hypre_error_flag;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryIJGetLocalRange
+ *
+ * Returns the rows (section = hypre_BINARY_IJ_ROW_PARTITION) or columns
+ * (hypre_BINARY_IJ_COL_PARTITION) owned by the calling process.  The
+ * partition stored in the file is used when comm has as many processes as
+ * the writer; otherwise the range is split into equal blocks.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryIJGetLocalRange( MPI_Comm                 comm,
+                             const char              *filename,
+                             const hypre_longlongint *header,
+                             HYPRE_Int                section,
+                             HYPRE_BigInt            *lower_ptr,
+                             HYPRE_BigInt            *upper_ptr )
+{
+   void               *mapping, *data;
+   hypre_longlongint  *part;
+   hypre_longlongint   first, size;
+   HYPRE_Int           myid, num_procs;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if ((hypre_longlongint) num_procs == header[hypre_BINARY_IJ_HDR_NUM_PROCS])
+   {
+      hypre_BinaryFileMap(filename, hypre_BinaryIJSectionOffset(header, section) + myid * 8,
+                          2 * 8, &mapping, &data);
+      if (!mapping)
+      {
+         return hypre_error_flag;
+      }
+      part = (hypre_longlongint *) data;
+      *lower_ptr = (HYPRE_BigInt) part[0];
+      *upper_ptr = (HYPRE_BigInt) part[1] - 1;
+      hypre_BinaryFileUnmap(mapping);
+   }
+   else
+   {
+      if (section == hypre_BINARY_IJ_ROW_PARTITION)
+      {
+         first = header[hypre_BINARY_IJ_HDR_FIRST_ROW];
+         size  = header[hypre_BINARY_IJ_HDR_GLOBAL_ROWS];
+      }
+      else
+      {
+         first = header[hypre_BINARY_IJ_HDR_FIRST_COL];
+         size  = header[hypre_BINARY_IJ_HDR_GLOBAL_COLS];
+      }
+      *lower_ptr = (HYPRE_BigInt) (first + size * myid / num_procs);
+      *upper_ptr = (HYPRE_BigInt) (first + size * (myid + 1) / num_procs - 1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryIJCopyValues
+ *
+ * Converts n mapped values of the file's precision to HYPRE_Complex.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BinaryIJCopyValues( const hypre_longlongint *header,
+                          const void              *src,
+                          hypre_longlongint        n,
+                          HYPRE_Complex           *values )
+{
+   HYPRE_Real         *dst = (HYPRE_Real *) values;
+   hypre_longlongint   real_size = header[hypre_BINARY_IJ_HDR_REAL_SIZE];
+   hypre_longlongint   i;
+
+   if (n == 0)
+   {
+      return;
+   }
+
+   /* complex values are stored as pairs of reals */
+   if (header[hypre_BINARY_IJ_HDR_COMPLEX])
+   {
+      n *= 2;
+   }
+
+   if (real_size == (hypre_longlongint) sizeof(HYPRE_Real))
+   {
+      hypre_TMemcpy(dst, src, HYPRE_Real, n, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   else if (real_size == 4)
+   {
+      for (i = 0; i < n; i++)
+      {
+         dst[i] = (HYPRE_Real) ((const float *) src)[i];
+      }
+   }
+   else
+   {
+      for (i = 0; i < n; i++)
+      {
+         dst[i] = (HYPRE_Real) ((const double *) src)[i];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryIJReadRows
+ *
+ * Reads rows lower through upper of a binary IJ matrix file.  Returns
+ * local row pointers (num_rows+1 entries), global column indices and
+ * values, all allocated on the host.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryIJReadRows( const char               *filename,
+                        const hypre_longlongint  *header,
+                        HYPRE_BigInt              lower,
+                        HYPRE_BigInt              upper,
+                        HYPRE_Int               **row_ptr_ptr,
+                        HYPRE_BigInt            **cols_ptr,
+                        HYPRE_Complex           **values_ptr )
+{
+   void                *mapping, *data;
+   hypre_longlongint   *file_row_ptr;
+   hypre_longlongint    first_nonzero, num_nonzeros, k;
+   hypre_longlongint    int_size   = header[hypre_BINARY_IJ_HDR_INT_SIZE];
+   hypre_longlongint    value_size = hypre_BinaryIJValueSize(header);
+   HYPRE_Int            num_rows, i;
+   HYPRE_Int           *row_ptr;
+   HYPRE_BigInt        *cols;
+   HYPRE_Complex       *values;
+
+   *row_ptr_ptr = NULL;
+   *cols_ptr    = NULL;
+   *values_ptr  = NULL;
+
+   num_rows = (HYPRE_Int) (upper - lower + 1);
+
+   hypre_BinaryFileMap(filename, hypre_BinaryIJSectionOffset(header, hypre_BINARY_IJ_ROW_PTR) +
+                       (hypre_longlongint) (lower - header[hypre_BINARY_IJ_HDR_FIRST_ROW]) * 8,
+                       (hypre_ulonglongint) (num_rows + 1) * 8, &mapping, &data);
+   if (!mapping)
+   {
+      return hypre_error_flag;
+   }
+   file_row_ptr  = (hypre_longlongint *) data;
+   first_nonzero = file_row_ptr[0];
+   num_nonzeros  = file_row_ptr[num_rows] - first_nonzero;
+
+   row_ptr = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_rows; i++)
+   {
+      row_ptr[i] = (HYPRE_Int) (file_row_ptr[i] - first_nonzero);
+   }
+   hypre_BinaryFileUnmap(mapping);
+
+   cols   = hypre_TAlloc(HYPRE_BigInt, num_nonzeros, HYPRE_MEMORY_HOST);
+   values = hypre_TAlloc(HYPRE_Complex, num_nonzeros, HYPRE_MEMORY_HOST);
+
+   hypre_BinaryFileMap(filename, hypre_BinaryIJSectionOffset(header, hypre_BINARY_IJ_COLS) +
+                       first_nonzero * int_size,
+                       num_nonzeros * int_size, &mapping, &data);
+   if (mapping)
+   {
+      if (int_size == 4)
+      {
+         for (k = 0; k < num_nonzeros; k++)
+         {
+            cols[k] = (HYPRE_BigInt) ((const hypre_int *) data)[k];
+         }
+      }
+      else
+      {
+         for (k = 0; k < num_nonzeros; k++)
+         {
+            cols[k] = (HYPRE_BigInt) ((const hypre_longlongint *) data)[k];
+         }
+      }
+      hypre_BinaryFileUnmap(mapping);
+
+      hypre_BinaryFileMap(filename, hypre_BinaryIJSectionOffset(header, hypre_BINARY_IJ_VALUES) +
+                          first_nonzero * value_size,
+                          num_nonzeros * value_size, &mapping, &data);
+   }
+   if (!mapping)
+   {
+      hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(values, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+   hypre_BinaryIJCopyValues(header, data, num_nonzeros, values);
+   hypre_BinaryFileUnmap(mapping);
+
+   *row_ptr_ptr = row_ptr;
+   *cols_ptr    = cols;
+   *values_ptr  = values;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryIJReadValues
+ *
+ * Reads entries lower through upper of a binary IJ vector file into
+ * values (host memory).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryIJReadValues( const char               *filename,
+                          const hypre_longlongint  *header,
+                          HYPRE_BigInt              lower,
+                          HYPRE_BigInt              upper,
+                          HYPRE_Complex            *values )
+{
+   void                *mapping, *data;
+   hypre_longlongint    value_size = hypre_BinaryIJValueSize(header);
+   hypre_longlongint    n = (hypre_longlongint) (upper - lower + 1);
+
+   hypre_BinaryFileMap(filename, hypre_BinaryIJSectionOffset(header, hypre_BINARY_IJ_VALUES) +
+                       (hypre_longlongint) (lower - header[hypre_BINARY_IJ_HDR_FIRST_ROW]) * value_size,
+                       n * value_size, &mapping, &data);
+   if (!mapping)
+   {
+      return hypre_error_flag;
+   }
+   hypre_BinaryIJCopyValues(header, data, n, values);
+   hypre_BinaryFileUnmap(mapping);
+
+   return hypre_error_flag;
+}
@@ -328,6 +328,20 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
                                   void                *send_data_in,
                                   HYPRE_MemoryLocation recv_memory_location,
                                   void                *recv_data_in )
+{
+   return hypre_ParCSRCommHandleCreateMultiVec(job, comm_pkg, 1,
+                                               send_memory_location, send_data_in,
+                                               recv_memory_location, recv_data_in);
+}
+
+hypre_ParCSRCommHandle*
+hypre_ParCSRCommHandleCreateMultiVec ( HYPRE_Int            job,
+                                       hypre_ParCSRCommPkg *comm_pkg,
+                                       HYPRE_Int            num_vectors,
+                                       HYPRE_MemoryLocation send_memory_location,
+                                       void                *send_data_in,
+                                       HYPRE_MemoryLocation recv_memory_location,
+                                       void                *recv_data_in )
 {
    HYPRE_Int                  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
    HYPRE_Int                  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
@@ -368,6 +382,9 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
     * job = 22: similar to job = 2, but exchanges data of type HYPRE_BigInt (not HYPRE_Complex),
     *           requires send_data and recv_data to be ints
     *           recv_vec_starts and send_map_starts need to be set in comm_pkg.
+    * For hypre_ParCSRCommHandleCreateMultiVec, each element carries the
+    * values of num_vectors vectors, stored contiguously (rowwise multivector
+    * storage), so that all vectors travel in one message per neighbor.
     * default: ignores send_data and recv_data, requires send_mpi_types
     *           and recv_mpi_types to be set in comm_pkg.
     *           datatypes need to point to absolute
@@ -377,28 +394,40 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    switch (job)
    {
       case 1:
-         num_send_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * sizeof(HYPRE_Complex);
-         num_recv_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * sizeof(HYPRE_Complex);
+         num_send_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors *
+                          sizeof(HYPRE_Complex);
+         num_recv_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * num_vectors *
+                          sizeof(HYPRE_Complex);
          break;
       case 2:
-         num_send_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * sizeof(HYPRE_Complex);
-         num_recv_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * sizeof(HYPRE_Complex);
+         num_send_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * num_vectors *
+                          sizeof(HYPRE_Complex);
+         num_recv_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors *
+                          sizeof(HYPRE_Complex);
          break;
       case 11:
-         num_send_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * sizeof(HYPRE_Int);
-         num_recv_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * sizeof(HYPRE_Int);
+         num_send_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors *
+                          sizeof(HYPRE_Int);
+         num_recv_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * num_vectors *
+                          sizeof(HYPRE_Int);
          break;
       case 12:
-         num_send_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * sizeof(HYPRE_Int);
-         num_recv_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * sizeof(HYPRE_Int);
+         num_send_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * num_vectors *
+                          sizeof(HYPRE_Int);
+         num_recv_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors *
+                          sizeof(HYPRE_Int);
          break;
       case 21:
-         num_send_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * sizeof(HYPRE_BigInt);
-         num_recv_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * sizeof(HYPRE_BigInt);
+         num_send_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors *
+                          sizeof(HYPRE_BigInt);
+         num_recv_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * num_vectors *
+                          sizeof(HYPRE_BigInt);
          break;
       case 22:
-         num_send_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * sizeof(HYPRE_BigInt);
-         num_recv_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * sizeof(HYPRE_BigInt);
+         num_send_bytes = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * num_vectors *
+                          sizeof(HYPRE_BigInt);
+         num_recv_bytes = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors *
+                          sizeof(HYPRE_BigInt);
          break;
    }
 
@@ -453,16 +482,16 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
          for (i = 0; i < num_recvs; i++)
          {
             ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
             hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
                             ip, 0, comm, &requests[j++]);
          }
          for (i = 0; i < num_sends; i++)
          {
             ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
             hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
                             ip, 0, comm, &requests[j++]);
          }
@@ -475,16 +504,16 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
          for (i = 0; i < num_sends; i++)
          {
             ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
             hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
                             ip, 0, comm, &requests[j++]);
          }
          for (i = 0; i < num_recvs; i++)
          {
             ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
             hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
                             ip, 0, comm, &requests[j++]);
          }
@@ -497,16 +526,16 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
          for (i = 0; i < num_recvs; i++)
          {
             ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
             hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
                             ip, 0, comm, &requests[j++]);
          }
          for (i = 0; i < num_sends; i++)
          {
             ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
             hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
                             ip, 0, comm, &requests[j++]);
          }
@@ -519,16 +548,16 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
          for (i = 0; i < num_sends; i++)
          {
             ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
             hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
                             ip, 0, comm, &requests[j++]);
          }
          for (i = 0; i < num_recvs; i++)
          {
             ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
             hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
                             ip, 0, comm, &requests[j++]);
          }
@@ -541,15 +570,15 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
          for (i = 0; i < num_recvs; i++)
          {
             ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
             hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
                             ip, 0, comm, &requests[j++]);
          }
          for (i = 0; i < num_sends; i++)
          {
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
             ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
             hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
                             ip, 0, comm, &requests[j++]);
@@ -562,8 +591,8 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
          HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
          for (i = 0; i < num_sends; i++)
          {
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
             ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
             hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
                             ip, 0, comm, &requests[j++]);
@@ -571,8 +600,8 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
          for (i = 0; i < num_recvs; i++)
          {
             ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+            vec_start = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+            vec_len = num_vectors * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
             hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
                             ip, 0, comm, &requests[j++]);
          }
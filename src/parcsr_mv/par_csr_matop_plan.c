@@ -0,0 +1,1049 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Two-phase (symbolic/numeric) host products C = A*B and C = A^T*B.
+ *
+ * hypre_ParMatmulPlanCreate computes the sparsity pattern of C, the pattern
+ * of the external rows and a communication package for their values.
+ * hypre_ParMatmulPlanExecute then only exchanges values and accumulates
+ * them into C, as long as the patterns of A and B do not change.  The plan
+ * keeps the number of nonzeros and a hash of the local patterns of A and B,
+ * and is created again if they do not match.
+ *
+ * Columns of C are numbered in a combined space: [0, num_cols_diag) are the
+ * columns of C_diag and num_cols_diag + j is column j of C_offd.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlanTransposePattern
+ *
+ * Transposes the pattern of a CSR matrix and returns, for each entry of
+ * the transpose, the position of the corresponding entry in the matrix.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParMatmulPlanTransposePattern( hypre_CSRMatrix  *A,
+                                     HYPRE_Int         num_cols,
+                                     HYPRE_Int       **AT_i_ptr,
+                                     HYPRE_Int       **AT_j_ptr,
+                                     HYPRE_Int       **AT_perm_ptr )
+{
+   HYPRE_Int  num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int  nnz      = A_i[num_rows];
+   HYPRE_Int *AT_i, *AT_j, *AT_perm;
+   HYPRE_Int  i, j, k;
+
+   AT_i    = hypre_CTAlloc(HYPRE_Int, num_cols + 1, HYPRE_MEMORY_HOST);
+   AT_j    = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   AT_perm = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < nnz; j++)
+   {
+      AT_i[A_j[j] + 1]++;
+   }
+   for (i = 0; i < num_cols; i++)
+   {
+      AT_i[i + 1] += AT_i[i];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      for (j = A_i[i]; j < A_i[i + 1]; j++)
+      {
+         k = AT_i[A_j[j]]++;
+         AT_j[k]    = i;
+         AT_perm[k] = j;
+      }
+   }
+   for (i = num_cols; i > 0; i--)
+   {
+      AT_i[i] = AT_i[i - 1];
+   }
+   AT_i[0] = 0;
+
+   *AT_i_ptr    = AT_i;
+   *AT_j_ptr    = AT_j;
+   *AT_perm_ptr = AT_perm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlanAddCol
+ *
+ * Adds column col to row i of C if it is not there yet. Only counts the
+ * entries if fill is zero.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_ParMatmulPlanAddCol( HYPRE_Int *marker,
+                           HYPRE_Int  i,
+                           HYPRE_Int  num_cols_diag,
+                           HYPRE_Int  fill,
+                           HYPRE_Int *C_diag_j,
+                           HYPRE_Int *C_offd_j,
+                           HYPRE_Int *cnt_diag,
+                           HYPRE_Int *cnt_offd,
+                           HYPRE_Int  col )
+{
+   if (marker[col] != i)
+   {
+      marker[col] = i;
+      if (col < num_cols_diag)
+      {
+         if (fill)
+         {
+            C_diag_j[*cnt_diag] = col;
+         }
+         (*cnt_diag)++;
+      }
+      else
+      {
+         if (fill)
+         {
+            C_offd_j[*cnt_offd] = col - num_cols_diag;
+         }
+         (*cnt_offd)++;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlanSymbolic
+ *
+ * Computes the pattern of the rows
+ *
+ *    C(i,:) = sum_{k in L(i,:)} B(k,:) + sum_{k in E(i,:)} B_ext(k,:)
+ *
+ * where B is local (offd columns mapped by map_B_to_C, or kept if NULL) and
+ * B_ext is given in the combined column space of C. The diagonal is stored
+ * first in each row if diag_first is set.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParMatmulPlanSymbolic( HYPRE_Int        num_rows,
+                             HYPRE_Int        diag_first,
+                             HYPRE_Int        num_cols_diag,
+                             HYPRE_Int        num_cols_offd,
+                             HYPRE_Int       *L_i,
+                             HYPRE_Int       *L_j,
+                             hypre_CSRMatrix *B_diag,
+                             hypre_CSRMatrix *B_offd,
+                             HYPRE_Int       *map_B_to_C,
+                             HYPRE_Int       *E_i,
+                             HYPRE_Int       *E_j,
+                             HYPRE_Int       *B_ext_i,
+                             HYPRE_Int       *B_ext_j,
+                             HYPRE_Int      **C_diag_i_ptr,
+                             HYPRE_Int      **C_diag_j_ptr,
+                             HYPRE_Int      **C_offd_i_ptr,
+                             HYPRE_Int      **C_offd_j_ptr )
+{
+   HYPRE_Int *B_diag_i = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int *B_diag_j = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Int *B_offd_i = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int *B_offd_j = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Int  num_cols = num_cols_diag + num_cols_offd;
+
+   HYPRE_Int *C_diag_i, *C_offd_i;
+   HYPRE_Int *C_diag_j = NULL;
+   HYPRE_Int *C_offd_j = NULL;
+
+   C_diag_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   C_offd_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int  ns, ne, i, jj, kk, k, c, pass;
+      HYPRE_Int  cnt_diag = 0, cnt_offd = 0;
+      HYPRE_Int *marker = hypre_TAlloc(HYPRE_Int, num_cols, HYPRE_MEMORY_HOST);
+
+      hypre_partition1D(num_rows, hypre_NumActiveThreads(), hypre_GetThreadNum(), &ns, &ne);
+
+      /* first pass counts, second pass fills */
+      for (pass = 0; pass < 2; pass++)
+      {
+         for (c = 0; c < num_cols; c++)
+         {
+            marker[c] = -1;
+         }
+
+         for (i = ns; i < ne; i++)
+         {
+            if (pass)
+            {
+               cnt_diag = C_diag_i[i];
+               cnt_offd = C_offd_i[i];
+            }
+            else
+            {
+               cnt_diag = 0;
+               cnt_offd = 0;
+            }
+
+            if (diag_first)
+            {
+               hypre_ParMatmulPlanAddCol(marker, i, num_cols_diag, pass, C_diag_j, C_offd_j,
+                                         &cnt_diag, &cnt_offd, i);
+            }
+            for (jj = L_i[i]; jj < L_i[i + 1]; jj++)
+            {
+               k = L_j[jj];
+               for (kk = B_diag_i[k]; kk < B_diag_i[k + 1]; kk++)
+               {
+                  hypre_ParMatmulPlanAddCol(marker, i, num_cols_diag, pass, C_diag_j, C_offd_j,
+                                            &cnt_diag, &cnt_offd, B_diag_j[kk]);
+               }
+               for (kk = B_offd_i[k]; kk < B_offd_i[k + 1]; kk++)
+               {
+                  c = map_B_to_C ? map_B_to_C[B_offd_j[kk]] : B_offd_j[kk];
+                  hypre_ParMatmulPlanAddCol(marker, i, num_cols_diag, pass, C_diag_j, C_offd_j,
+                                            &cnt_diag, &cnt_offd, num_cols_diag + c);
+               }
+            }
+            if (E_i)
+            {
+               for (jj = E_i[i]; jj < E_i[i + 1]; jj++)
+               {
+                  k = E_j[jj];
+                  for (kk = B_ext_i[k]; kk < B_ext_i[k + 1]; kk++)
+                  {
+                     hypre_ParMatmulPlanAddCol(marker, i, num_cols_diag, pass, C_diag_j, C_offd_j,
+                                               &cnt_diag, &cnt_offd, B_ext_j[kk]);
+                  }
+               }
+            }
+
+            if (!pass)
+            {
+               C_diag_i[i + 1] = cnt_diag;
+               C_offd_i[i + 1] = cnt_offd;
+            }
+         }
+
+         if (!pass)
+         {
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp barrier
+            #pragma omp single
+#endif
+            {
+               for (i = 0; i < num_rows; i++)
+               {
+                  C_diag_i[i + 1] += C_diag_i[i];
+                  C_offd_i[i + 1] += C_offd_i[i];
+               }
+               C_diag_j = hypre_TAlloc(HYPRE_Int, C_diag_i[num_rows], HYPRE_MEMORY_HOST);
+               C_offd_j = hypre_TAlloc(HYPRE_Int, C_offd_i[num_rows], HYPRE_MEMORY_HOST);
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   *C_diag_i_ptr = C_diag_i;
+   *C_diag_j_ptr = C_diag_j;
+   *C_offd_i_ptr = C_offd_i;
+   *C_offd_j_ptr = C_offd_j;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlanNumeric
+ *
+ * Numeric counterpart of hypre_ParMatmulPlanSymbolic. L_data (through L_perm
+ * if not NULL) and E_data (one if NULL) are the weights of the rows of B and
+ * B_ext. The pattern of C must contain all the products.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParMatmulPlanNumeric( HYPRE_Int        num_rows,
+                            HYPRE_Int        num_cols_diag,
+                            HYPRE_Int        num_cols_offd,
+                            HYPRE_Int       *L_i,
+                            HYPRE_Int       *L_j,
+                            HYPRE_Int       *L_perm,
+                            HYPRE_Complex   *L_data,
+                            hypre_CSRMatrix *B_diag,
+                            hypre_CSRMatrix *B_offd,
+                            HYPRE_Int       *map_B_to_C,
+                            HYPRE_Int       *E_i,
+                            HYPRE_Int       *E_j,
+                            HYPRE_Complex   *E_data,
+                            HYPRE_Int       *B_ext_i,
+                            HYPRE_Int       *B_ext_j,
+                            HYPRE_Complex   *B_ext_data,
+                            HYPRE_Int       *C_diag_i,
+                            HYPRE_Int       *C_diag_j,
+                            HYPRE_Complex   *C_diag_data,
+                            HYPRE_Int       *C_offd_i,
+                            HYPRE_Int       *C_offd_j,
+                            HYPRE_Complex   *C_offd_data )
+{
+   HYPRE_Int     *B_diag_i    = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int     *B_diag_j    = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Complex *B_diag_data = hypre_CSRMatrixData(B_diag);
+   HYPRE_Int     *B_offd_i    = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int     *B_offd_j    = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Complex *B_offd_data = hypre_CSRMatrixData(B_offd);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int      ns, ne, i, jj, kk, k, c;
+      HYPRE_Complex  a;
+      /* every column touched in row i is set from the pattern of row i,
+         so the marker needs no initialization */
+      HYPRE_Int     *marker = hypre_TAlloc(HYPRE_Int, num_cols_diag + num_cols_offd,
+                                           HYPRE_MEMORY_HOST);
+
+      hypre_partition1D(num_rows, hypre_NumActiveThreads(), hypre_GetThreadNum(), &ns, &ne);
+
+      for (i = ns; i < ne; i++)
+      {
+         for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+         {
+            marker[C_diag_j[jj]] = jj;
+            C_diag_data[jj] = 0.0;
+         }
+         for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+         {
+            marker[num_cols_diag + C_offd_j[jj]] = jj;
+            C_offd_data[jj] = 0.0;
+         }
+
+         for (jj = L_i[i]; jj < L_i[i + 1]; jj++)
+         {
+            k = L_j[jj];
+            a = L_data[L_perm ? L_perm[jj] : jj];
+            for (kk = B_diag_i[k]; kk < B_diag_i[k + 1]; kk++)
+            {
+               C_diag_data[marker[B_diag_j[kk]]] += a * B_diag_data[kk];
+            }
+            for (kk = B_offd_i[k]; kk < B_offd_i[k + 1]; kk++)
+            {
+               c = map_B_to_C ? map_B_to_C[B_offd_j[kk]] : B_offd_j[kk];
+               C_offd_data[marker[num_cols_diag + c]] += a * B_offd_data[kk];
+            }
+         }
+         if (E_i)
+         {
+            for (jj = E_i[i]; jj < E_i[i + 1]; jj++)
+            {
+               k = E_j[jj];
+               a = E_data ? E_data[jj] : 1.0;
+               for (kk = B_ext_i[k]; kk < B_ext_i[k + 1]; kk++)
+               {
+                  c = B_ext_j[kk];
+                  if (c < num_cols_diag)
+                  {
+                     C_diag_data[marker[c]] += a * B_ext_data[kk];
+                  }
+                  else
+                  {
+                     C_offd_data[marker[c]] += a * B_ext_data[kk];
+                  }
+               }
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlanCreate
+ *
+ * Symbolic phase of C = A*B (trans = 0) or C = A^T*B (trans = 1).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMatmulPlanCreate( hypre_ParCSRMatrix   *A,
+                           hypre_ParCSRMatrix   *B,
+                           HYPRE_Int             trans,
+                           hypre_ParMatmulPlan **plan_ptr )
+{
+   MPI_Comm             comm            = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg *comm_pkg_A;
+
+   hypre_CSRMatrix     *A_diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix     *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int            num_rows_A      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_diag_A = hypre_CSRMatrixNumCols(A_diag);
+   HYPRE_Int            num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_CSRMatrix     *B_diag          = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix     *B_offd          = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int           *B_diag_i        = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int           *B_diag_j        = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Int           *B_offd_i        = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int           *B_offd_j        = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Int            num_rows_B      = hypre_CSRMatrixNumRows(B_diag);
+   HYPRE_Int            num_cols_diag_B = hypre_CSRMatrixNumCols(B_diag);
+   HYPRE_Int            num_cols_offd_B = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_BigInt         first_col_B     = hypre_ParCSRMatrixFirstColDiag(B);
+   HYPRE_BigInt        *col_map_offd_B  = hypre_ParCSRMatrixColMapOffd(B);
+
+   hypre_ParMatmulPlan *plan;
+   hypre_ParCSRCommPkg *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_ParCSRMatrix  *C;
+   hypre_CSRMatrix     *C_diag, *C_offd;
+   HYPRE_Int           *C_diag_i, *C_diag_j, *C_offd_i, *C_offd_j;
+   HYPRE_BigInt        *col_map_offd_C = NULL;
+   HYPRE_Int            num_rows_C, num_cols_offd_C = 0;
+   HYPRE_Int            diag_first;
+
+   HYPRE_Int            num_sends, num_recvs;
+   HYPRE_Int           *send_map_starts, *send_map_elmts, *recv_vec_starts;
+   HYPRE_Int            num_send_rows, num_ext_rows, num_send_nnz, num_ext_nnz;
+   HYPRE_Int           *send_i, *ext_i, *ext_j, *row_len;
+   HYPRE_BigInt        *send_big_j, *ext_big_j;
+   HYPRE_Int           *int_diag_i = NULL, *int_diag_j = NULL;
+   HYPRE_Int           *int_offd_i = NULL, *int_offd_j = NULL;
+   HYPRE_Int           *map_B_to_C = NULL;
+   HYPRE_Int           *marker;
+   HYPRE_BigInt        *big_buf;
+   HYPRE_Int            i, j, k, cnt;
+
+   if (hypre_GetExecPolicy2(hypre_ParCSRMatrixMemoryLocation(A),
+                            hypre_ParCSRMatrixMemoryLocation(B)) != HYPRE_EXEC_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matmul plans are only available on the host\n");
+      return hypre_error_flag;
+   }
+   if ( (!trans && (hypre_ParCSRMatrixGlobalNumCols(A) != hypre_ParCSRMatrixGlobalNumRows(B) ||
+                    num_cols_diag_A != num_rows_B)) ||
+        ( trans && (hypre_ParCSRMatrixGlobalNumRows(A) != hypre_ParCSRMatrixGlobalNumRows(B) ||
+                    num_rows_A != num_rows_B)) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, " Error! Incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg_A      = hypre_ParCSRMatrixCommPkg(A);
+   num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+   num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+   send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg_A);
+   send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_A);
+   recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_A);
+
+   plan = hypre_CTAlloc(hypre_ParMatmulPlan, 1, HYPRE_MEMORY_HOST);
+   hypre_ParMatmulPlanTrans(plan) = trans;
+
+   /*-----------------------------------------------------------------------
+    * Rows exchanged: rows of B needed by A_offd (trans = 0), or the partial
+    * rows A_offd^T*B of C owned by the neighbors (trans = 1). The latter
+    * travel backwards through the communication package of A.
+    *-----------------------------------------------------------------------*/
+
+   num_send_rows = trans ? num_cols_offd_A : send_map_starts[num_sends];
+   num_ext_rows  = trans ? send_map_starts[num_sends] : num_cols_offd_A;
+
+   if (trans)
+   {
+      hypre_ParMatmulPlanTransposePattern(A_diag, num_cols_diag_A,
+                                          &hypre_ParMatmulPlanATDiagI(plan),
+                                          &hypre_ParMatmulPlanATDiagJ(plan),
+                                          &hypre_ParMatmulPlanATDiagPerm(plan));
+      hypre_ParMatmulPlanTransposePattern(A_offd, num_cols_offd_A,
+                                          &hypre_ParMatmulPlanATOffdI(plan),
+                                          &hypre_ParMatmulPlanATOffdJ(plan),
+                                          &hypre_ParMatmulPlanATOffdPerm(plan));
+      hypre_ParMatmulPlanSymbolic(num_cols_offd_A, 0, num_cols_diag_B, num_cols_offd_B,
+                                  hypre_ParMatmulPlanATOffdI(plan),
+                                  hypre_ParMatmulPlanATOffdJ(plan),
+                                  B_diag, B_offd, NULL, NULL, NULL, NULL, NULL,
+                                  &int_diag_i, &int_diag_j, &int_offd_i, &int_offd_j);
+   }
+
+   send_i  = hypre_CTAlloc(HYPRE_Int, num_send_rows + 1, HYPRE_MEMORY_HOST);
+   ext_i   = hypre_CTAlloc(HYPRE_Int, num_ext_rows + 1, HYPRE_MEMORY_HOST);
+   row_len = hypre_CTAlloc(HYPRE_Int, num_send_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_send_rows; i++)
+   {
+      if (trans)
+      {
+         row_len[i] = int_diag_i[i + 1] - int_diag_i[i] + int_offd_i[i + 1] - int_offd_i[i];
+      }
+      else
+      {
+         k = send_map_elmts[i];
+         row_len[i] = B_diag_i[k + 1] - B_diag_i[k] + B_offd_i[k + 1] - B_offd_i[k];
+      }
+      send_i[i + 1] = send_i[i] + row_len[i];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(trans ? 12 : 11, comm_pkg_A, row_len, ext_i + 1);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   for (i = 0; i < num_ext_rows; i++)
+   {
+      ext_i[i + 1] += ext_i[i];
+   }
+   hypre_TFree(row_len, HYPRE_MEMORY_HOST);
+   num_send_nnz = send_i[num_send_rows];
+   num_ext_nnz  = ext_i[num_ext_rows];
+
+   /* communication package for the nonzeros of the exchanged rows */
+   comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgComm(comm_pkg)     = comm;
+   hypre_ParCSRCommPkgNumSends(comm_pkg) = trans ? num_recvs : num_sends;
+   hypre_ParCSRCommPkgNumRecvs(comm_pkg) = trans ? num_sends : num_recvs;
+   hypre_ParCSRCommPkgSendProcs(comm_pkg) =
+      hypre_TAlloc(HYPRE_Int, hypre_ParCSRCommPkgNumSends(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgRecvProcs(comm_pkg) =
+      hypre_TAlloc(HYPRE_Int, hypre_ParCSRCommPkgNumRecvs(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgSendMapStarts(comm_pkg) =
+      hypre_TAlloc(HYPRE_Int, hypre_ParCSRCommPkgNumSends(comm_pkg) + 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) =
+      hypre_TAlloc(HYPRE_Int, hypre_ParCSRCommPkgNumRecvs(comm_pkg) + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < hypre_ParCSRCommPkgNumSends(comm_pkg); i++)
+   {
+      hypre_ParCSRCommPkgSendProc(comm_pkg, i) = trans ?
+                                                 hypre_ParCSRCommPkgRecvProc(comm_pkg_A, i) :
+                                                 hypre_ParCSRCommPkgSendProc(comm_pkg_A, i);
+   }
+   for (i = 0; i <= hypre_ParCSRCommPkgNumSends(comm_pkg); i++)
+   {
+      hypre_ParCSRCommPkgSendMapStart(comm_pkg, i) =
+         send_i[trans ? recv_vec_starts[i] : send_map_starts[i]];
+   }
+   for (i = 0; i < hypre_ParCSRCommPkgNumRecvs(comm_pkg); i++)
+   {
+      hypre_ParCSRCommPkgRecvProc(comm_pkg, i) = trans ?
+                                                 hypre_ParCSRCommPkgSendProc(comm_pkg_A, i) :
+                                                 hypre_ParCSRCommPkgRecvProc(comm_pkg_A, i);
+   }
+   for (i = 0; i <= hypre_ParCSRCommPkgNumRecvs(comm_pkg); i++)
+   {
+      hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i) =
+         ext_i[trans ? send_map_starts[i] : recv_vec_starts[i]];
+   }
+
+   /* exchange the global column indices of the rows */
+   send_big_j = hypre_TAlloc(HYPRE_BigInt, num_send_nnz, HYPRE_MEMORY_HOST);
+   ext_big_j  = hypre_TAlloc(HYPRE_BigInt, num_ext_nnz, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_send_rows; i++)
+   {
+      cnt = send_i[i];
+      if (trans)
+      {
+         for (j = int_diag_i[i]; j < int_diag_i[i + 1]; j++)
+         {
+            send_big_j[cnt++] = first_col_B + (HYPRE_BigInt) int_diag_j[j];
+         }
+         for (j = int_offd_i[i]; j < int_offd_i[i + 1]; j++)
+         {
+            send_big_j[cnt++] = col_map_offd_B[int_offd_j[j]];
+         }
+      }
+      else
+      {
+         k = send_map_elmts[i];
+         for (j = B_diag_i[k]; j < B_diag_i[k + 1]; j++)
+         {
+            send_big_j[cnt++] = first_col_B + (HYPRE_BigInt) B_diag_j[j];
+         }
+         for (j = B_offd_i[k]; j < B_offd_i[k + 1]; j++)
+         {
+            send_big_j[cnt++] = col_map_offd_B[B_offd_j[j]];
+         }
+      }
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(21, comm_pkg, send_big_j, ext_big_j);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   hypre_TFree(send_big_j, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Offd columns of C: offd columns of B and those of the external rows
+    *-----------------------------------------------------------------------*/
+
+   big_buf = hypre_TAlloc(HYPRE_BigInt, num_ext_nnz + num_cols_offd_B, HYPRE_MEMORY_HOST);
+   cnt = 0;
+   for (j = 0; j < num_ext_nnz; j++)
+   {
+      if (ext_big_j[j] < first_col_B || ext_big_j[j] >= first_col_B + num_cols_diag_B)
+      {
+         big_buf[cnt++] = ext_big_j[j];
+      }
+   }
+   for (j = 0; j < num_cols_offd_B; j++)
+   {
+      big_buf[cnt++] = col_map_offd_B[j];
+   }
+   if (cnt)
+   {
+      hypre_BigQsort0(big_buf, 0, cnt - 1);
+      num_cols_offd_C = 1;
+      for (j = 1; j < cnt; j++)
+      {
+         if (big_buf[j] > big_buf[num_cols_offd_C - 1])
+         {
+            big_buf[num_cols_offd_C++] = big_buf[j];
+         }
+      }
+   }
+   col_map_offd_C = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_C, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(col_map_offd_C, big_buf, HYPRE_BigInt, num_cols_offd_C,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_buf, HYPRE_MEMORY_HOST);
+
+   if (num_cols_offd_B)
+   {
+      map_B_to_C = hypre_TAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+      for (j = 0, k = 0; j < num_cols_offd_B; j++)
+      {
+         while (col_map_offd_C[k] < col_map_offd_B[j])
+         {
+            k++;
+         }
+         map_B_to_C[j] = k;
+      }
+   }
+
+   ext_j = hypre_TAlloc(HYPRE_Int, num_ext_nnz, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < num_ext_nnz; j++)
+   {
+      if (ext_big_j[j] < first_col_B || ext_big_j[j] >= first_col_B + num_cols_diag_B)
+      {
+         ext_j[j] = num_cols_diag_B + hypre_BigBinarySearch(col_map_offd_C, ext_big_j[j],
+                                                            num_cols_offd_C);
+      }
+      else
+      {
+         ext_j[j] = (HYPRE_Int) (ext_big_j[j] - first_col_B);
+      }
+   }
+   hypre_TFree(ext_big_j, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Pattern of C
+    *-----------------------------------------------------------------------*/
+
+   if (trans)
+   {
+      HYPRE_Int *E_i, *E_j;
+
+      /* received partial rows, grouped by their row of C */
+      E_i = hypre_CTAlloc(HYPRE_Int, num_cols_diag_A + 1, HYPRE_MEMORY_HOST);
+      E_j = hypre_TAlloc(HYPRE_Int, num_ext_rows, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_ext_rows; i++)
+      {
+         E_i[send_map_elmts[i] + 1]++;
+      }
+      for (i = 0; i < num_cols_diag_A; i++)
+      {
+         E_i[i + 1] += E_i[i];
+      }
+      for (i = 0; i < num_ext_rows; i++)
+      {
+         E_j[E_i[send_map_elmts[i]]++] = i;
+      }
+      for (i = num_cols_diag_A; i > 0; i--)
+      {
+         E_i[i] = E_i[i - 1];
+      }
+      E_i[0] = 0;
+      hypre_ParMatmulPlanEI(plan) = E_i;
+      hypre_ParMatmulPlanEJ(plan) = E_j;
+
+      num_rows_C = num_cols_diag_A;
+      diag_first = (num_cols_diag_A == num_cols_diag_B &&
+                    hypre_ParCSRMatrixGlobalNumCols(A) == hypre_ParCSRMatrixGlobalNumCols(B));
+      hypre_ParMatmulPlanSymbolic(num_rows_C, diag_first, num_cols_diag_B, num_cols_offd_C,
+                                  hypre_ParMatmulPlanATDiagI(plan),
+                                  hypre_ParMatmulPlanATDiagJ(plan),
+                                  B_diag, B_offd, map_B_to_C, E_i, E_j, ext_i, ext_j,
+                                  &C_diag_i, &C_diag_j, &C_offd_i, &C_offd_j);
+   }
+   else
+   {
+      num_rows_C = num_rows_A;
+      diag_first = (num_rows_A == num_cols_diag_B &&
+                    hypre_ParCSRMatrixGlobalNumRows(A) == hypre_ParCSRMatrixGlobalNumCols(B));
+      hypre_ParMatmulPlanSymbolic(num_rows_C, diag_first, num_cols_diag_B, num_cols_offd_C,
+                                  hypre_CSRMatrixI(A_diag), hypre_CSRMatrixJ(A_diag),
+                                  B_diag, B_offd, map_B_to_C,
+                                  hypre_CSRMatrixI(A_offd), hypre_CSRMatrixJ(A_offd),
+                                  ext_i, ext_j,
+                                  &C_diag_i, &C_diag_j, &C_offd_i, &C_offd_j);
+   }
+
+   /* drop the offd columns of C that are not used */
+   marker = hypre_CTAlloc(HYPRE_Int, num_cols_offd_C, HYPRE_MEMORY_HOST);
+   for (j = 0; j < C_offd_i[num_rows_C]; j++)
+   {
+      marker[C_offd_j[j]] = 1;
+   }
+   for (j = 0, cnt = 0; j < num_cols_offd_C; j++)
+   {
+      if (marker[j])
+      {
+         col_map_offd_C[cnt] = col_map_offd_C[j];
+         marker[j] = cnt++;
+      }
+      else
+      {
+         marker[j] = -1;
+      }
+   }
+   if (cnt < num_cols_offd_C)
+   {
+      for (j = 0; j < C_offd_i[num_rows_C]; j++)
+      {
+         C_offd_j[j] = marker[C_offd_j[j]];
+      }
+      for (j = 0; j < num_cols_offd_B; j++)
+      {
+         map_B_to_C[j] = marker[map_B_to_C[j]];
+      }
+      for (j = 0; j < num_ext_nnz; j++)
+      {
+         if (ext_j[j] >= num_cols_diag_B)
+         {
+            ext_j[j] = num_cols_diag_B + marker[ext_j[j] - num_cols_diag_B];
+         }
+      }
+      num_cols_offd_C = cnt;
+   }
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+
+   C = hypre_ParCSRMatrixCreate(comm,
+                                trans ? hypre_ParCSRMatrixGlobalNumCols(A) :
+                                hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixGlobalNumCols(B),
+                                trans ? hypre_ParCSRMatrixColStarts(A) :
+                                hypre_ParCSRMatrixRowStarts(A),
+                                hypre_ParCSRMatrixColStarts(B),
+                                num_cols_offd_C,
+                                C_diag_i[num_rows_C],
+                                C_offd_i[num_rows_C]);
+   C_diag = hypre_ParCSRMatrixDiag(C);
+   C_offd = hypre_ParCSRMatrixOffd(C);
+   hypre_CSRMatrixI(C_diag) = C_diag_i;
+   hypre_CSRMatrixJ(C_diag) = C_diag_j;
+   hypre_CSRMatrixI(C_offd) = C_offd_i;
+   hypre_CSRMatrixJ(C_offd) = C_offd_j;
+   hypre_CSRMatrixInitialize_v2(C_diag, 0, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixInitialize_v2(C_offd, 0, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixSetRownnz(C_diag);
+   hypre_CSRMatrixSetRownnz(C_offd);
+   hypre_ParCSRMatrixColMapOffd(C) = col_map_offd_C;
+   hypre_ParCSRMatrixSetNumNonzeros(C);
+   hypre_ParCSRMatrixSetDNumNonzeros(C);
+
+   hypre_ParMatmulPlanANnz(plan)        = hypre_CSRMatrixNumNonzeros(A_diag) +
+                                          hypre_CSRMatrixNumNonzeros(A_offd);
+   hypre_ParMatmulPlanBNnz(plan)        = hypre_CSRMatrixNumNonzeros(B_diag) +
+                                          hypre_CSRMatrixNumNonzeros(B_offd);
+   hypre_ParMatmulPlanAHash(plan)       = hypre_ParCSRMatrixPatternHash(A);
+   hypre_ParMatmulPlanBHash(plan)       = hypre_ParCSRMatrixPatternHash(B);
+   hypre_ParMatmulPlanC(plan)           = C;
+   hypre_ParMatmulPlanMapBToC(plan)     = map_B_to_C;
+   hypre_ParMatmulPlanCommPkg(plan)     = comm_pkg;
+   hypre_ParMatmulPlanNumSendRows(plan) = num_send_rows;
+   hypre_ParMatmulPlanSendI(plan)       = send_i;
+   hypre_ParMatmulPlanSendData(plan)    = hypre_TAlloc(HYPRE_Complex, num_send_nnz,
+                                                       HYPRE_MEMORY_HOST);
+   hypre_ParMatmulPlanExtI(plan)        = ext_i;
+   hypre_ParMatmulPlanExtJ(plan)        = ext_j;
+   hypre_ParMatmulPlanExtData(plan)     = hypre_TAlloc(HYPRE_Complex, num_ext_nnz,
+                                                       HYPRE_MEMORY_HOST);
+   hypre_ParMatmulPlanIntDiagI(plan)    = int_diag_i;
+   hypre_ParMatmulPlanIntDiagJ(plan)    = int_diag_j;
+   hypre_ParMatmulPlanIntOffdI(plan)    = int_offd_i;
+   hypre_ParMatmulPlanIntOffdJ(plan)    = int_offd_j;
+   if (trans)
+   {
+      hypre_ParMatmulPlanIntDiagData(plan) =
+         hypre_TAlloc(HYPRE_Complex, int_diag_i[num_cols_offd_A], HYPRE_MEMORY_HOST);
+      hypre_ParMatmulPlanIntOffdData(plan) =
+         hypre_TAlloc(HYPRE_Complex, int_offd_i[num_cols_offd_A], HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      hypre_ParMatmulPlanSendRows(plan) = hypre_TAlloc(HYPRE_Int, num_send_rows, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParMatmulPlanSendRows(plan), send_map_elmts, HYPRE_Int, num_send_rows,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   *plan_ptr = plan;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlanMatches
+ *
+ * Returns 1 if the local patterns of A and B (number of nonzeros and hash)
+ * are those the plan was created for, on all processes.  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMatmulPlanMatches( hypre_ParMatmulPlan  *plan,
+                            hypre_ParCSRMatrix   *A,
+                            hypre_ParCSRMatrix   *B )
+{
+   HYPRE_Int local_match, match;
+
+   local_match = (hypre_ParMatmulPlanANnz(plan) ==
+                  hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) +
+                  hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A)) &&
+                  hypre_ParMatmulPlanBNnz(plan) ==
+                  hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(B)) +
+                  hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(B)));
+   if (local_match)
+   {
+      local_match = (hypre_ParMatmulPlanAHash(plan) == hypre_ParCSRMatrixPatternHash(A) &&
+                     hypre_ParMatmulPlanBHash(plan) == hypre_ParCSRMatrixPatternHash(B));
+   }
+   hypre_MPI_Allreduce(&local_match, &match, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+
+   return match;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlanExecute
+ *
+ * Numeric phase: computes the values of C = A*B or C = A^T*B.  If *C_ptr is
+ * NULL, C is created with the pattern of the plan, otherwise *C_ptr must
+ * have been obtained from the same plan.  If the patterns of A and B are not
+ * those given to hypre_ParMatmulPlanCreate, the plan is created again for
+ * them (a full symbolic product) and *C_ptr is replaced.  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMatmulPlanExecute( hypre_ParMatmulPlan  *plan,
+                            hypre_ParCSRMatrix   *A,
+                            hypre_ParCSRMatrix   *B,
+                            hypre_ParCSRMatrix  **C_ptr )
+{
+   HYPRE_Int            trans         = hypre_ParMatmulPlanTrans(plan);
+   hypre_ParCSRMatrix  *C             = *C_ptr;
+
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix     *B_diag        = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix     *B_offd        = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int           *B_diag_i      = hypre_CSRMatrixI(B_diag);
+   HYPRE_Complex       *B_diag_data   = hypre_CSRMatrixData(B_diag);
+   HYPRE_Int           *B_offd_i      = hypre_CSRMatrixI(B_offd);
+   HYPRE_Complex       *B_offd_data   = hypre_CSRMatrixData(B_offd);
+   HYPRE_Int            num_cols_diag = hypre_CSRMatrixNumCols(B_diag);
+   HYPRE_Int            num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+
+   HYPRE_Int            num_send_rows = hypre_ParMatmulPlanNumSendRows(plan);
+   HYPRE_Int           *send_i        = hypre_ParMatmulPlanSendI(plan);
+   HYPRE_Complex       *send_data     = hypre_ParMatmulPlanSendData(plan);
+   HYPRE_Complex       *ext_data      = hypre_ParMatmulPlanExtData(plan);
+
+   hypre_CSRMatrix     *C_diag, *C_offd;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int            i;
+
+   if (!hypre_ParMatmulPlanMatches(plan, A, B))
+   {
+      hypre_ParMatmulPlan *new_plan = NULL, tmp;
+
+      if (hypre_ParMatmulPlanCreate(A, B, trans, &new_plan) || !new_plan)
+      {
+         return hypre_error_flag;
+      }
+      /* the caller's plan now holds the new symbolic data */
+      tmp       = *plan;
+      *plan     = *new_plan;
+      *new_plan = tmp;
+      hypre_ParMatmulPlanDestroy(new_plan);
+
+      hypre_ParCSRMatrixDestroy(C);
+      C = NULL;
+      num_send_rows = hypre_ParMatmulPlanNumSendRows(plan);
+      send_i        = hypre_ParMatmulPlanSendI(plan);
+      send_data     = hypre_ParMatmulPlanSendData(plan);
+      ext_data      = hypre_ParMatmulPlanExtData(plan);
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (!C)
+   {
+      C = hypre_ParCSRMatrixClone(hypre_ParMatmulPlanC(plan), 0);
+   }
+   C_diag = hypre_ParCSRMatrixDiag(C);
+   C_offd = hypre_ParCSRMatrixOffd(C);
+
+   if (trans)
+   {
+      HYPRE_Int     *int_diag_i    = hypre_ParMatmulPlanIntDiagI(plan);
+      HYPRE_Int     *int_offd_i    = hypre_ParMatmulPlanIntOffdI(plan);
+      HYPRE_Complex *int_diag_data = hypre_ParMatmulPlanIntDiagData(plan);
+      HYPRE_Complex *int_offd_data = hypre_ParMatmulPlanIntOffdData(plan);
+
+      /* partial rows A_offd^T*B, sent to the owners */
+      hypre_ParMatmulPlanNumeric(num_cols_offd_A, num_cols_diag, hypre_CSRMatrixNumCols(B_offd),
+                                 hypre_ParMatmulPlanATOffdI(plan),
+                                 hypre_ParMatmulPlanATOffdJ(plan),
+                                 hypre_ParMatmulPlanATOffdPerm(plan),
+                                 hypre_CSRMatrixData(A_offd),
+                                 B_diag, B_offd, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                                 int_diag_i, hypre_ParMatmulPlanIntDiagJ(plan), int_diag_data,
+                                 int_offd_i, hypre_ParMatmulPlanIntOffdJ(plan), int_offd_data);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_send_rows; i++)
+      {
+         HYPRE_Int nd = int_diag_i[i + 1] - int_diag_i[i];
+
+         hypre_TMemcpy(send_data + send_i[i], int_diag_data + int_diag_i[i],
+                       HYPRE_Complex, nd, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(send_data + send_i[i] + nd, int_offd_data + int_offd_i[i],
+                       HYPRE_Complex, int_offd_i[i + 1] - int_offd_i[i],
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+   }
+   else
+   {
+      HYPRE_Int *send_rows = hypre_ParMatmulPlanSendRows(plan);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_send_rows; i++)
+      {
+         HYPRE_Int k  = send_rows[i];
+         HYPRE_Int nd = B_diag_i[k + 1] - B_diag_i[k];
+
+         hypre_TMemcpy(send_data + send_i[i], B_diag_data + B_diag_i[k],
+                       HYPRE_Complex, nd, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(send_data + send_i[i] + nd, B_offd_data + B_offd_i[k],
+                       HYPRE_Complex, B_offd_i[k + 1] - B_offd_i[k],
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, hypre_ParMatmulPlanCommPkg(plan),
+                                              send_data, ext_data);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   if (trans)
+   {
+      hypre_ParMatmulPlanNumeric(hypre_CSRMatrixNumRows(C_diag), num_cols_diag,
+                                 hypre_CSRMatrixNumCols(C_offd),
+                                 hypre_ParMatmulPlanATDiagI(plan),
+                                 hypre_ParMatmulPlanATDiagJ(plan),
+                                 hypre_ParMatmulPlanATDiagPerm(plan),
+                                 hypre_CSRMatrixData(A_diag),
+                                 B_diag, B_offd, hypre_ParMatmulPlanMapBToC(plan),
+                                 hypre_ParMatmulPlanEI(plan), hypre_ParMatmulPlanEJ(plan), NULL,
+                                 hypre_ParMatmulPlanExtI(plan), hypre_ParMatmulPlanExtJ(plan),
+                                 ext_data,
+                                 hypre_CSRMatrixI(C_diag), hypre_CSRMatrixJ(C_diag),
+                                 hypre_CSRMatrixData(C_diag),
+                                 hypre_CSRMatrixI(C_offd), hypre_CSRMatrixJ(C_offd),
+                                 hypre_CSRMatrixData(C_offd));
+   }
+   else
+   {
+      hypre_ParMatmulPlanNumeric(hypre_CSRMatrixNumRows(C_diag), num_cols_diag,
+                                 hypre_CSRMatrixNumCols(C_offd),
+                                 hypre_CSRMatrixI(A_diag), hypre_CSRMatrixJ(A_diag), NULL,
+                                 hypre_CSRMatrixData(A_diag),
+                                 B_diag, B_offd, hypre_ParMatmulPlanMapBToC(plan),
+                                 hypre_CSRMatrixI(A_offd), hypre_CSRMatrixJ(A_offd),
+                                 hypre_CSRMatrixData(A_offd),
+                                 hypre_ParMatmulPlanExtI(plan), hypre_ParMatmulPlanExtJ(plan),
+                                 ext_data,
+                                 hypre_CSRMatrixI(C_diag), hypre_CSRMatrixJ(C_diag),
+                                 hypre_CSRMatrixData(C_diag),
+                                 hypre_CSRMatrixI(C_offd), hypre_CSRMatrixJ(C_offd),
+                                 hypre_CSRMatrixData(C_offd));
+   }
+
+   /* values of C changed */
+   hypre_CSRMatrixSellInvalidate(C_diag);
+   hypre_CSRMatrixSellInvalidate(C_offd);
+   if (hypre_ParCSRMatrixDiagT(C))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(C));
+      hypre_ParCSRMatrixDiagT(C) = NULL;
+   }
+   if (hypre_ParCSRMatrixOffdT(C))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(C));
+      hypre_ParCSRMatrixOffdT(C) = NULL;
+   }
+
+   *C_ptr = C;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMatmulPlanDestroy( hypre_ParMatmulPlan *plan )
+{
+   if (plan)
+   {
+      hypre_ParCSRMatrixDestroy(hypre_ParMatmulPlanC(plan));
+      hypre_MatvecCommPkgDestroy(hypre_ParMatmulPlanCommPkg(plan));
+      hypre_TFree(hypre_ParMatmulPlanMapBToC(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanSendRows(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanSendI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanSendData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanExtI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanExtJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanExtData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanEI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanEJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanATDiagI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanATDiagJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanATDiagPerm(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanATOffdI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanATOffdJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanATOffdPerm(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanIntDiagI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanIntDiagJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanIntDiagData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanIntOffdI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanIntOffdJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParMatmulPlanIntOffdData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
@@ -453,6 +453,100 @@ hypre_ParCSRMatrixSetDataOwner( hypre_ParCSRMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetSellSigma
+ *
+ * Turns on (sigma > 0) or off (sigma = 0) the SELL-C-sigma host matvecs for
+ * the local blocks of the matrix, including the stored transposes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetSellSigma( hypre_ParCSRMatrix *matrix,
+                                HYPRE_Int           sigma )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSetSellSigma(hypre_ParCSRMatrixDiag(matrix), sigma);
+   hypre_CSRMatrixSetSellSigma(hypre_ParCSRMatrixOffd(matrix), sigma);
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixSetSellSigma(hypre_ParCSRMatrixDiagT(matrix), sigma);
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixSetSellSigma(hypre_ParCSRMatrixOffdT(matrix), sigma);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSellInvalidate
+ *
+ * Drops the SELL-C-sigma shadows of the local blocks; must be called when
+ * the values or the pattern of the matrix change.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSellInvalidate( hypre_ParCSRMatrix *matrix )
+{
+   if (matrix)
+   {
+      hypre_CSRMatrixSellInvalidate(hypre_ParCSRMatrixDiag(matrix));
+      hypre_CSRMatrixSellInvalidate(hypre_ParCSRMatrixOffd(matrix));
+      hypre_CSRMatrixSellInvalidate(hypre_ParCSRMatrixDiagT(matrix));
+      hypre_CSRMatrixSellInvalidate(hypre_ParCSRMatrixOffdT(matrix));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPatternHash
+ *
+ * Returns a hash (64-bit FNV-1a) of the local sparsity pattern: the row
+ * pointers and column indices of diag, and those of offd with the columns
+ * in the global numbering.  Matrices with the same local pattern, stored in
+ * the same order, have the same hash.  Host memory only.
+ *--------------------------------------------------------------------------*/
+
+hypre_ulonglongint
+hypre_ParCSRMatrixPatternHash( hypre_ParCSRMatrix *matrix )
+{
+   hypre_CSRMatrix    *diag         = hypre_ParCSRMatrixDiag(matrix);
+   hypre_CSRMatrix    *offd         = hypre_ParCSRMatrixOffd(matrix);
+   HYPRE_Int           num_rows     = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int          *diag_i       = hypre_CSRMatrixI(diag);
+   HYPRE_Int          *diag_j       = hypre_CSRMatrixJ(diag);
+   HYPRE_Int          *offd_i       = hypre_CSRMatrixI(offd);
+   HYPRE_Int          *offd_j       = hypre_CSRMatrixJ(offd);
+   HYPRE_BigInt       *col_map_offd = hypre_ParCSRMatrixColMapOffd(matrix);
+   hypre_ulonglongint  prime        = 1099511628211ULL;
+   hypre_ulonglongint  hash         = 14695981039346656037ULL;
+   HYPRE_Int           i, j;
+
+   hash = (hash ^ (hypre_ulonglongint) num_rows) * prime;
+   for (i = 0; i < num_rows; i++)
+   {
+      hash = (hash ^ (hypre_ulonglongint) (diag_i[i + 1] - diag_i[i])) * prime;
+      for (j = diag_i[i]; j < diag_i[i + 1]; j++)
+      {
+         hash = (hash ^ (hypre_ulonglongint) diag_j[j]) * prime;
+      }
+      hash = (hash ^ (hypre_ulonglongint) (offd_i[i + 1] - offd_i[i])) * prime;
+      for (j = offd_i[i]; j < offd_i[i + 1]; j++)
+      {
+         hash = (hash ^ (hypre_ulonglongint) col_map_offd[offd_j[j]]) * prime;
+      }
+   }
+
+   return hash;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixRead
  *--------------------------------------------------------------------------*/
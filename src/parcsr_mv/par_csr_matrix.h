@@ -196,4 +196,127 @@ typedef struct
 #define hypre_ParCSRBooleanMatrix_Get_Rowindices(matrix)    ((matrix)->rowindices)
 #define hypre_ParCSRBooleanMatrix_Get_Getrowactive(matrix)  ((matrix)->getrowactive)
 
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlan:
+ *   Symbolic data of the host products C = A*B (trans = 0) and C = A^T*B
+ *   (trans = 1), see par_csr_matop_plan.c
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             trans;
+   HYPRE_Int             A_nnz;        /* local patterns of A and B the plan */
+   HYPRE_Int             B_nnz;        /* was created for                    */
+   hypre_ulonglongint    A_hash;
+   hypre_ulonglongint    B_hash;
+   hypre_ParCSRMatrix   *C;            /* pattern of the product */
+   HYPRE_Int            *map_B_to_C;   /* offd columns of B to offd columns of C */
+
+   /* exchanged rows: rows of B (trans = 0) or partial rows of C (trans = 1) */
+   hypre_ParCSRCommPkg  *comm_pkg;     /* package for the nonzeros of the rows */
+   HYPRE_Int             num_send_rows;
+   HYPRE_Int            *send_rows;    /* rows of B to send (trans = 0) */
+   HYPRE_Int            *send_i;
+   HYPRE_Complex        *send_data;
+   HYPRE_Int            *ext_i;        /* received rows, columns in C */
+   HYPRE_Int            *ext_j;
+   HYPRE_Complex        *ext_data;
+
+   /* trans = 1 only */
+   HYPRE_Int            *E_i;          /* received rows of each row of C */
+   HYPRE_Int            *E_j;
+   HYPRE_Int            *AT_diag_i;    /* transposed patterns of A, with the */
+   HYPRE_Int            *AT_diag_j;    /* positions of the entries in A      */
+   HYPRE_Int            *AT_diag_perm;
+   HYPRE_Int            *AT_offd_i;
+   HYPRE_Int            *AT_offd_j;
+   HYPRE_Int            *AT_offd_perm;
+   HYPRE_Int            *int_diag_i;   /* partial rows A_offd^T*B */
+   HYPRE_Int            *int_diag_j;
+   HYPRE_Complex        *int_diag_data;
+   HYPRE_Int            *int_offd_i;
+   HYPRE_Int            *int_offd_j;
+   HYPRE_Complex        *int_offd_data;
+
+} hypre_ParMatmulPlan;
+
+/*--------------------------------------------------------------------------
+ * Accessor functions for the hypre_ParMatmulPlan structure
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParMatmulPlanTrans(plan)         ((plan) -> trans)
+#define hypre_ParMatmulPlanANnz(plan)          ((plan) -> A_nnz)
+#define hypre_ParMatmulPlanBNnz(plan)          ((plan) -> B_nnz)
+#define hypre_ParMatmulPlanAHash(plan)         ((plan) -> A_hash)
+#define hypre_ParMatmulPlanBHash(plan)         ((plan) -> B_hash)
+#define hypre_ParMatmulPlanC(plan)             ((plan) -> C)
+#define hypre_ParMatmulPlanMapBToC(plan)       ((plan) -> map_B_to_C)
+#define hypre_ParMatmulPlanCommPkg(plan)       ((plan) -> comm_pkg)
+#define hypre_ParMatmulPlanNumSendRows(plan)   ((plan) -> num_send_rows)
+#define hypre_ParMatmulPlanSendRows(plan)      ((plan) -> send_rows)
+#define hypre_ParMatmulPlanSendI(plan)         ((plan) -> send_i)
+#define hypre_ParMatmulPlanSendData(plan)      ((plan) -> send_data)
+#define hypre_ParMatmulPlanExtI(plan)          ((plan) -> ext_i)
+#define hypre_ParMatmulPlanExtJ(plan)          ((plan) -> ext_j)
+#define hypre_ParMatmulPlanExtData(plan)       ((plan) -> ext_data)
+#define hypre_ParMatmulPlanEI(plan)            ((plan) -> E_i)
+#define hypre_ParMatmulPlanEJ(plan)            ((plan) -> E_j)
+#define hypre_ParMatmulPlanATDiagI(plan)       ((plan) -> AT_diag_i)
+#define hypre_ParMatmulPlanATDiagJ(plan)       ((plan) -> AT_diag_j)
+#define hypre_ParMatmulPlanATDiagPerm(plan)    ((plan) -> AT_diag_perm)
+#define hypre_ParMatmulPlanATOffdI(plan)       ((plan) -> AT_offd_i)
+#define hypre_ParMatmulPlanATOffdJ(plan)       ((plan) -> AT_offd_j)
+#define hypre_ParMatmulPlanATOffdPerm(plan)    ((plan) -> AT_offd_perm)
+#define hypre_ParMatmulPlanIntDiagI(plan)      ((plan) -> int_diag_i)
+#define hypre_ParMatmulPlanIntDiagJ(plan)      ((plan) -> int_diag_j)
+#define hypre_ParMatmulPlanIntDiagData(plan)   ((plan) -> int_diag_data)
+#define hypre_ParMatmulPlanIntOffdI(plan)      ((plan) -> int_offd_i)
+#define hypre_ParMatmulPlanIntOffdJ(plan)      ((plan) -> int_offd_j)
+#define hypre_ParMatmulPlanIntOffdData(plan)   ((plan) -> int_offd_data)
+
+/*--------------------------------------------------------------------------
+ * Binary IJ files (par_binary_io.c)
+ *
+ * A file holds one matrix or vector in global row order, so it can be read
+ * back on any number of processes.  All integers below are 64-bit and in the
+ * byte order of the writer:
+ *
+ *   header          hypre_BINARY_IJ_HEADER_SIZE entries (indices below)
+ *   row partition   num_procs+1 entries, as written
+ *   col partition   num_procs+1 entries, as written (a vector repeats its
+ *                   row partition)
+ *   row_ptr         global_num_rows+1 entries        (matrix only)
+ *   cols            num_nonzeros x int_size bytes    (matrix only)
+ *   values          num_nonzeros (vector: global_num_rows) x real_size bytes,
+ *                   twice that for complex values
+ *
+ * Each section starts on an 8-byte boundary.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_BINARY_IJ_MAGIC              0x4a49425250594800LL  /* "\0HYPRBIJ" */
+#define hypre_BINARY_IJ_VERSION            1
+#define hypre_BINARY_IJ_MATRIX             1
+#define hypre_BINARY_IJ_VECTOR             2
+
+#define hypre_BINARY_IJ_HEADER_SIZE        16
+#define hypre_BINARY_IJ_HDR_MAGIC          0
+#define hypre_BINARY_IJ_HDR_VERSION        1
+#define hypre_BINARY_IJ_HDR_OBJECT         2
+#define hypre_BINARY_IJ_HDR_INT_SIZE       3
+#define hypre_BINARY_IJ_HDR_REAL_SIZE      4
+#define hypre_BINARY_IJ_HDR_COMPLEX        5
+#define hypre_BINARY_IJ_HDR_GLOBAL_ROWS    6
+#define hypre_BINARY_IJ_HDR_GLOBAL_COLS    7
+#define hypre_BINARY_IJ_HDR_FIRST_ROW      8
+#define hypre_BINARY_IJ_HDR_FIRST_COL      9
+#define hypre_BINARY_IJ_HDR_NUM_NONZEROS   10
+#define hypre_BINARY_IJ_HDR_NUM_PROCS      11
+
+/* file sections, in order */
+#define hypre_BINARY_IJ_ROW_PARTITION      0
+#define hypre_BINARY_IJ_COL_PARTITION      1
+#define hypre_BINARY_IJ_ROW_PTR            2
+#define hypre_BINARY_IJ_COLS               3
+#define hypre_BINARY_IJ_VALUES             4
+
 #endif
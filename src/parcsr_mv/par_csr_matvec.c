@@ -14,6 +14,121 @@
 #include "_hypre_parcsr_mv.h"
 #include "_hypre_utilities.hpp" //RL: TODO par_csr_matvec_device.c, include cuda there
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecMultiVecHost
+ *
+ * y = alpha*A*x + beta*b for multivectors on the host.  The off-processor
+ * values of all num_vectors vectors are packed together (rowwise) and sent
+ * in a single message per neighbor; the received values form a rowwise
+ * multivector, so that the offd product reads them with unit stride.  Both
+ * the diag and offd products read the matrix once for all vectors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecMultiVecHost( HYPRE_Complex       alpha,
+                                      hypre_ParCSRMatrix *A,
+                                      hypre_ParVector    *x,
+                                      HYPRE_Complex       beta,
+                                      hypre_ParVector    *b,
+                                      hypre_ParVector    *y )
+{
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(A);
+
+   hypre_Vector *x_local  = hypre_ParVectorLocalVector(x);
+   hypre_Vector *b_local  = hypre_ParVectorLocalVector(b);
+   hypre_Vector *y_local  = hypre_ParVectorLocalVector(y);
+   hypre_Vector *x_tmp;
+
+   HYPRE_Int num_vectors   = hypre_VectorNumVectors(x_local);
+   HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int vecstride     = hypre_VectorVectorStride(x_local);
+   HYPRE_Int idxstride     = hypre_VectorIndexStride(x_local);
+   HYPRE_Int num_sends, i, jv, elmt;
+
+   HYPRE_Complex *x_local_data = hypre_VectorData(x_local);
+   HYPRE_Complex *x_buf_data;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_assert( hypre_VectorNumVectors(b_local) == num_vectors );
+   hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+   x_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
+   hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   /* pack all vectors rowwise: one message per neighbor */
+   x_buf_data = hypre_TAlloc(HYPRE_Complex,
+                             num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                             HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,jv,elmt) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+        i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+        i++)
+   {
+      elmt = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         x_buf_data[i * num_vectors + jv] = x_local_data[elmt + jv * vecstride];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreateMultiVec(1, comm_pkg, num_vectors,
+                                                      HYPRE_MEMORY_HOST, x_buf_data,
+                                                      HYPRE_MEMORY_HOST, hypre_VectorData(x_tmp));
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /* overlapped local computation */
+   hypre_CSRMatrixMatvecOutOfPlace(alpha, diag, x_local, beta, b_local, y_local, 0);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   if (num_cols_offd)
+   {
+      hypre_CSRMatrixMatvec(alpha, offd, x_tmp, 1.0, y_local);
+   }
+
+   hypre_SeqVectorDestroy(x_tmp);
+   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -92,6 +207,16 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(b_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
 
+#if !defined(HYPRE_USING_GPU)
+   if ( num_vectors > 1 )
+   {
+      hypre_ParCSRMatrixMatvecMultiVecHost(alpha, A, x, beta, b, y);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return ierr;
+   }
+#endif
+
    if ( num_vectors == 1 )
    {
       x_tmp = hypre_SeqVectorCreate( num_cols_offd );
@@ -371,6 +496,131 @@ hypre_ParCSRMatrixMatvec( HYPRE_Complex       alpha,
    return hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, x, beta, y, y);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecTMultiVecHost
+ *
+ * y = alpha*A^T*x + beta*y for multivectors on the host.  The offd
+ * contributions of all num_vectors vectors are computed into a rowwise
+ * multivector and sent back in a single message per neighbor.  Unlike the
+ * per-vector path, x and y may use either multivector storage method.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecTMultiVecHost( HYPRE_Complex       alpha,
+                                       hypre_ParCSRMatrix *A,
+                                       hypre_ParVector    *x,
+                                       HYPRE_Complex       beta,
+                                       hypre_ParVector    *y )
+{
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+   hypre_CSRMatrix *diag  = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd  = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *diagT = hypre_ParCSRMatrixDiagT(A);
+   hypre_CSRMatrix *offdT = hypre_ParCSRMatrixOffdT(A);
+
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector *y_tmp;
+
+   HYPRE_Int num_vectors   = hypre_VectorNumVectors(y_local);
+   HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int vecstride     = hypre_VectorVectorStride(y_local);
+   HYPRE_Int idxstride     = hypre_VectorIndexStride(y_local);
+   HYPRE_Int num_sends, i, jv, elmt;
+
+   HYPRE_Complex *y_local_data = hypre_VectorData(y_local);
+   HYPRE_Complex *y_buf_data;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_assert( hypre_VectorNumVectors(x_local) == num_vectors );
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+   y_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(y_tmp) = 1;
+   hypre_SeqVectorInitialize_v2(y_tmp, HYPRE_MEMORY_HOST);
+
+   y_buf_data = hypre_TAlloc(HYPRE_Complex,
+                             num_vectors * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                             HYPRE_MEMORY_HOST);
+
+   if (num_cols_offd)
+   {
+      if (offdT)
+      {
+         hypre_CSRMatrixMatvec(alpha, offdT, x_local, 0.0, y_tmp);
+      }
+      else
+      {
+         hypre_CSRMatrixMatvecT(alpha, offd, x_local, 0.0, y_tmp);
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreateMultiVec(2, comm_pkg, num_vectors,
+                                                      HYPRE_MEMORY_HOST, hypre_VectorData(y_tmp),
+                                                      HYPRE_MEMORY_HOST, y_buf_data);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /* overlapped local computation */
+   if (diagT)
+   {
+      hypre_CSRMatrixMatvec(alpha, diagT, x_local, beta, y_local);
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecT(alpha, diag, x_local, beta, y_local);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   /* unpack: send_map_elmts may repeat, so this loop is not threaded */
+   for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+        i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+        i++)
+   {
+      elmt = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         y_local_data[elmt + jv * vecstride] += y_buf_data[i * num_vectors + jv];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   hypre_SeqVectorDestroy(y_tmp);
+   hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvecT
  *
@@ -449,6 +699,16 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(x_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
 
+#if !defined(HYPRE_USING_GPU)
+   if (num_vectors > 1)
+   {
+      hypre_ParCSRMatrixMatvecTMultiVecHost(alpha, A, x, beta, y);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return ierr;
+   }
+#endif
+
    if ( num_vectors == 1 )
    {
       y_tmp = hypre_SeqVectorCreate(num_cols_offd);
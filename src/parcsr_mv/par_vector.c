@@ -422,6 +422,71 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorInnerProdStart
+ *
+ * Computes the local parts of the n inner products (x[i], y[i]) and starts
+ * a single non-blocking reduction of all of them.  The results are
+ * available in result[0..n-1] only after hypre_ParVectorInnerProdWait.
+ * Both local_result and result must stay valid until then.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorInnerProdStart( HYPRE_Int           n,
+                               hypre_ParVector   **x,
+                               hypre_ParVector   **y,
+                               HYPRE_Real         *local_result,
+                               HYPRE_Real         *result,
+                               hypre_MPI_Request  *request )
+{
+   MPI_Comm   comm;
+   HYPRE_Int  i;
+
+   if (n < 1)
+   {
+      *request = hypre_MPI_REQUEST_NULL;
+      return hypre_error_flag;
+   }
+
+   comm = hypre_ParVectorComm(x[0]);
+   for (i = 0; i < n; i++)
+   {
+      local_result[i] = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x[i]),
+                                                 hypre_ParVectorLocalVector(y[i]));
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Iallreduce(local_result, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, request);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorInnerProdWait
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorInnerProdWait( hypre_MPI_Request *request )
+{
+   hypre_MPI_Status status;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Wait(request, &status);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorElmdivpy
  * y = y + x ./ b [MATLAB Notation]
@@ -458,6 +523,129 @@ hypre_ParVectorElmdivpyMarked( hypre_ParVector *x,
    return hypre_SeqVectorElmdivpyMarked(x_local, b_local, y_local, marker, marker_val);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParMultiVectorGetColumn
+ * y = x(:,j), where x is a multivector and y a single vector (host only)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMultiVectorGetColumn( hypre_ParVector *x,
+                               HYPRE_Int        j,
+                               hypre_ParVector *y )
+{
+   hypre_Vector  *x_local   = hypre_ParVectorLocalVector(x);
+   hypre_Vector  *y_local   = hypre_ParVectorLocalVector(y);
+   HYPRE_Complex *x_data    = hypre_VectorData(x_local);
+   HYPRE_Complex *y_data    = hypre_VectorData(y_local);
+   HYPRE_Int      size      = hypre_VectorSize(x_local);
+   HYPRE_Int      vecstride = hypre_VectorVectorStride(x_local);
+   HYPRE_Int      idxstride = hypre_VectorIndexStride(x_local);
+   HYPRE_Int      i;
+
+   hypre_assert(j >= 0 && j < hypre_VectorNumVectors(x_local));
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      y_data[i] = x_data[j * vecstride + i * idxstride];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMultiVectorSetColumn
+ * x(:,j) = y, where x is a multivector and y a single vector (host only)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMultiVectorSetColumn( hypre_ParVector *x,
+                               HYPRE_Int        j,
+                               hypre_ParVector *y )
+{
+   hypre_Vector  *x_local   = hypre_ParVectorLocalVector(x);
+   hypre_Vector  *y_local   = hypre_ParVectorLocalVector(y);
+   HYPRE_Complex *x_data    = hypre_VectorData(x_local);
+   HYPRE_Complex *y_data    = hypre_VectorData(y_local);
+   HYPRE_Int      size      = hypre_VectorSize(x_local);
+   HYPRE_Int      vecstride = hypre_VectorVectorStride(x_local);
+   HYPRE_Int      idxstride = hypre_VectorIndexStride(x_local);
+   HYPRE_Int      i;
+
+   hypre_assert(j >= 0 && j < hypre_VectorNumVectors(x_local));
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      x_data[j * vecstride + i * idxstride] = y_data[i];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMultiVectorColumnInnerProds
+ * result[j] = (x(:,j), y(:,j)) for all columns, with a single reduction.
+ * x and y may use different storage methods (host only).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMultiVectorColumnInnerProds( hypre_ParVector *x,
+                                      hypre_ParVector *y,
+                                      HYPRE_Real      *result )
+{
+   MPI_Comm       comm        = hypre_ParVectorComm(x);
+   hypre_Vector  *x_local     = hypre_ParVectorLocalVector(x);
+   hypre_Vector  *y_local     = hypre_ParVectorLocalVector(y);
+   HYPRE_Complex *x_data      = hypre_VectorData(x_local);
+   HYPRE_Complex *y_data      = hypre_VectorData(y_local);
+   HYPRE_Int      size        = hypre_VectorSize(x_local);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x_local);
+   HYPRE_Int      x_vs        = hypre_VectorVectorStride(x_local);
+   HYPRE_Int      x_is        = hypre_VectorIndexStride(x_local);
+   HYPRE_Int      y_vs        = hypre_VectorVectorStride(y_local);
+   HYPRE_Int      y_is        = hypre_VectorIndexStride(y_local);
+   HYPRE_Real    *local_result;
+   HYPRE_Int      i, j;
+
+   hypre_assert(hypre_VectorNumVectors(y_local) == num_vectors);
+
+   local_result = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      HYPRE_Real sum = 0.0;
+      HYPRE_Complex *xj = x_data + j * x_vs;
+      HYPRE_Complex *yj = y_data + j * y_vs;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) reduction(+:sum) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         sum += hypre_conj(yj[i * y_is]) * xj[i * x_is];
+      }
+      local_result[j] = sum;
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, num_vectors, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_VectorToParVector:
  * generates a ParVector from a Vector on proc 0 and distributes the pieces
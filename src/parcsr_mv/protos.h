@@ -147,6 +147,25 @@ HYPRE_Int hypre_ParChordMatrixToParCSRMatrix ( hypre_ParChordMatrix *Ac, MPI_Com
 HYPRE_Int hypre_ParCSRMatrixToParChordMatrix ( hypre_ParCSRMatrix *Ap, MPI_Comm comm,
                                                hypre_ParChordMatrix **pAc );
 
+/* par_binary_io.c */
+hypre_ulonglongint hypre_BinaryIJSectionOffset ( const hypre_longlongint *header,
+                                                 HYPRE_Int section );
+HYPRE_Int hypre_ParCSRMatrixPrintBinaryIJ ( hypre_ParCSRMatrix *matrix, HYPRE_Int base_i,
+                                            HYPRE_Int base_j, const char *filename );
+HYPRE_Int hypre_ParVectorPrintBinaryIJ ( hypre_ParVector *vector, HYPRE_Int base_j,
+                                         const char *filename );
+HYPRE_Int hypre_BinaryIJReadHeader ( const char *filename, HYPRE_Int object,
+                                     hypre_longlongint *header );
+HYPRE_Int hypre_BinaryIJGetLocalRange ( MPI_Comm comm, const char *filename,
+                                        const hypre_longlongint *header, HYPRE_Int section,
+                                        HYPRE_BigInt *lower_ptr, HYPRE_BigInt *upper_ptr );
+HYPRE_Int hypre_BinaryIJReadRows ( const char *filename, const hypre_longlongint *header,
+                                   HYPRE_BigInt lower, HYPRE_BigInt upper, HYPRE_Int **row_ptr_ptr,
+                                   HYPRE_BigInt **cols_ptr, HYPRE_Complex **values_ptr );
+HYPRE_Int hypre_BinaryIJReadValues ( const char *filename, const hypre_longlongint *header,
+                                     HYPRE_BigInt lower, HYPRE_BigInt upper,
+                                     HYPRE_Complex *values );
+
 /* par_csr_aat.c */
 void hypre_ParAat_RowSizes ( HYPRE_Int **C_diag_i, HYPRE_Int **C_offd_i, HYPRE_Int *B_marker,
                              HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int *A_offd_i, HYPRE_Int *A_offd_j,
@@ -233,6 +252,10 @@ hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate ( HYPRE_Int job, hypre_ParC
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int job,
                                                           hypre_ParCSRCommPkg *comm_pkg, HYPRE_MemoryLocation send_memory_location, void *send_data_in,
                                                           HYPRE_MemoryLocation recv_memory_location, void *recv_data_in );
+hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreateMultiVec ( HYPRE_Int job,
+                                                               hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_vectors,
+                                                               HYPRE_MemoryLocation send_memory_location, void *send_data_in,
+                                                               HYPRE_MemoryLocation recv_memory_location, void *recv_data_in );
 HYPRE_Int hypre_ParCSRCommHandleDestroy ( hypre_ParCSRCommHandle *comm_handle );
 void hypre_ParCSRCommPkgCreate_core ( MPI_Comm comm, HYPRE_BigInt *col_map_offd,
                                       HYPRE_BigInt first_col_diag, HYPRE_BigInt *col_starts, HYPRE_Int num_cols_diag,
@@ -370,6 +393,15 @@ HYPRE_Int hypre_ParCSRMatrixAddHost( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
 HYPRE_Int hypre_ParCSRMatrixAddDevice( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                        HYPRE_Complex beta, hypre_ParCSRMatrix *B, hypre_ParCSRMatrix **Cout);
 
+/* par_csr_matop_plan.c */
+HYPRE_Int hypre_ParMatmulPlanCreate ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                      HYPRE_Int trans, hypre_ParMatmulPlan **plan_ptr );
+HYPRE_Int hypre_ParMatmulPlanMatches ( hypre_ParMatmulPlan *plan, hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *B );
+HYPRE_Int hypre_ParMatmulPlanExecute ( hypre_ParMatmulPlan *plan, hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *B, hypre_ParCSRMatrix **C_ptr );
+HYPRE_Int hypre_ParMatmulPlanDestroy ( hypre_ParMatmulPlan *plan );
+
 /* par_csr_matop_marked.c */
 void hypre_ParMatmul_RowSizes_Marked ( HYPRE_Int **C_diag_i, HYPRE_Int **C_offd_i,
                                        HYPRE_Int **B_marker, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int *A_offd_i,
@@ -403,6 +435,9 @@ HYPRE_Int hypre_ParCSRMatrixSetNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumRownnz ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix, HYPRE_Int owns_data );
+HYPRE_Int hypre_ParCSRMatrixSetSellSigma ( hypre_ParCSRMatrix *matrix, HYPRE_Int sigma );
+HYPRE_Int hypre_ParCSRMatrixSellInvalidate ( hypre_ParCSRMatrix *matrix );
+hypre_ulonglongint hypre_ParCSRMatrixPatternHash ( hypre_ParCSRMatrix *matrix );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrint ( hypre_ParCSRMatrix *matrix, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrintIJ ( const hypre_ParCSRMatrix *matrix, const HYPRE_Int base_i,
@@ -440,6 +475,10 @@ void hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A);
 // y = alpha*A*x + beta*b
 HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                                hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *b, hypre_ParVector *y );
+HYPRE_Int hypre_ParCSRMatrixMatvecMultiVecHost ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
+                                                  hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *b, hypre_ParVector *y );
+HYPRE_Int hypre_ParCSRMatrixMatvecTMultiVecHost ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
+                                                  hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
 // y = alpha*A*x + beta*y
 HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A, hypre_ParVector *x,
                                      HYPRE_Complex beta, hypre_ParVector *y );
@@ -500,10 +539,21 @@ HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha, hypre_ParVector *x, hypre_P
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y,
                                     HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorInnerProdStart ( HYPRE_Int n, hypre_ParVector **x, hypre_ParVector **y,
+                                         HYPRE_Real *local_result, HYPRE_Real *result,
+                                         hypre_MPI_Request *request );
+HYPRE_Int hypre_ParVectorInnerProdWait ( hypre_MPI_Request *request );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y, HYPRE_Int k,
                                          HYPRE_Int unroll, HYPRE_Real *prod );
+HYPRE_Int hypre_ParVectorMassInnerProdBlock ( hypre_ParVector **x, HYPRE_Int nx,
+                                              hypre_ParVector **y, HYPRE_Int k, HYPRE_Int unroll,
+                                              HYPRE_Real *result );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
                                        HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x, HYPRE_Real *prod_y );
+HYPRE_Int hypre_ParMultiVectorGetColumn ( hypre_ParVector *x, HYPRE_Int j, hypre_ParVector *y );
+HYPRE_Int hypre_ParMultiVectorSetColumn ( hypre_ParVector *x, HYPRE_Int j, hypre_ParVector *y );
+HYPRE_Int hypre_ParMultiVectorColumnInnerProds ( hypre_ParVector *x, hypre_ParVector *y,
+                                                 HYPRE_Real *result );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm, hypre_Vector *v,
                                            HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
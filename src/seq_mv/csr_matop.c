@@ -649,6 +649,9 @@ hypre_CSRMatrixBigAdd( hypre_CSRMatrix *A,
  * Note: The routine does not check for 0-elements which might be generated
  *       through cancellation of elements in A and B or already contained
  *       in A and B. To remove those, use hypre_CSRMatrixDeleteZeros
+ *
+ * Dispatches to hypre_CSRMatrixMultiplyHostHash when the host SpGEMM
+ * algorithm is set to 1 (see HYPRE_SetSpGemmHostAlgorithm).
  *--------------------------------------------------------------------------*/
 
 hypre_CSRMatrix*
@@ -715,6 +718,12 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
       return C;
    }
 
+   /* Per-row hash/heap accumulators instead of ncols_B-sized markers */
+   if (hypre_HandleSpgemmHostAlgorithm(hypre_handle()) == 1)
+   {
+      return hypre_CSRMatrixMultiplyHostHash(A, B);
+   }
+
    /* Allocate memory */
    twspace = hypre_TAlloc(HYPRE_Int, hypre_NumThreads(), HYPRE_MEMORY_HOST);
    C_i = hypre_CTAlloc(HYPRE_Int, nrows_A + 1, memory_location_C);
@@ -1573,6 +1582,8 @@ hypre_CSRMatrixReorder(hypre_CSRMatrix *A)
 {
    HYPRE_Int ierr = 0;
 
+   hypre_CSRMatrixSellInvalidate(A);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -1985,6 +1996,8 @@ hypre_CSRMatrixScale( hypre_CSRMatrix *A,
    HYPRE_Int      i;
    HYPRE_Int      k = hypre_CSRMatrixNumNonzeros(A);
 
+   hypre_CSRMatrixSellInvalidate(A);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -2011,6 +2024,8 @@ hypre_CSRMatrixSetConstantValues( hypre_CSRMatrix *A,
    HYPRE_Int i;
    HYPRE_Int nnz = hypre_CSRMatrixNumNonzeros(A);
 
+   hypre_CSRMatrixSellInvalidate(A);
+
    if (!hypre_CSRMatrixData(A))
    {
       hypre_CSRMatrixData(A) = hypre_TAlloc(HYPRE_Complex, nnz, hypre_CSRMatrixMemoryLocation(A));
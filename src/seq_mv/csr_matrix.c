@@ -43,6 +43,8 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
 
    /* set defaults */
    hypre_CSRMatrixOwnsData(matrix)       = 1;
+   hypre_CSRMatrixSellSigma(matrix)      = 0;
+   hypre_CSRMatrixSellData(matrix)       = NULL;
 
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE)
    hypre_CSRMatrixSortedJ(matrix)        = NULL;
@@ -78,6 +80,8 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
          hypre_TFree(hypre_CSRMatrixBigJ(matrix), memory_location);
       }
 
+      hypre_CSRSellDataDestroy(hypre_CSRMatrixSellData(matrix));
+
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE)
       hypre_TFree(hypre_CSRMatrixSortedData(matrix), memory_location);
       hypre_TFree(hypre_CSRMatrixSortedJ(matrix), memory_location);
@@ -181,6 +185,7 @@ hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows, HYPRE_In
    }
 
    hypre_CSRMatrixNumCols(matrix) = new_num_cols;
+   hypre_CSRMatrixSellInvalidate(matrix);
 
    if (new_num_nonzeros != hypre_CSRMatrixNumNonzeros(matrix))
    {
@@ -740,6 +745,8 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
    HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
    HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
 
+   hypre_CSRMatrixSellInvalidate(B);
+
    hypre_TMemcpy(B_i, A_i, HYPRE_Int, num_rows + 1, memory_location_B, memory_location_A);
 
    if (A_j && B_j)
@@ -13,6 +13,150 @@
 
 #include "seq_mv.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMMHost
+ *
+ * y += A*x for multivectors x and y with k components, reading each row of
+ * A once for all components.  If rownnz is not NULL, only the num_rows rows
+ * listed in it are visited.  When x is stored rowwise (vecstride 1, so the
+ * k values of one column are contiguous) and k is 2, 4 or 8, the k partial
+ * sums of a row are kept in registers; otherwise they are accumulated in
+ * blocks of 8 components.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixSpMMHost( HYPRE_Int      num_rows,
+                         HYPRE_Int     *rownnz,
+                         HYPRE_Int     *A_i,
+                         HYPRE_Int     *A_j,
+                         HYPRE_Complex *A_data,
+                         HYPRE_Int      k,
+                         HYPRE_Complex *x_data,
+                         HYPRE_Int      idxstride_x,
+                         HYPRE_Int      vecstride_x,
+                         HYPRE_Complex *y_data,
+                         HYPRE_Int      idxstride_y,
+                         HYPRE_Int      vecstride_y )
+{
+   HYPRE_Int      ii, i, jj, v, v0, nv;
+   HYPRE_Complex  a, t0, t1, t2, t3, t4, t5, t6, t7, t[8];
+   HYPRE_Complex *xp, *yp;
+
+   if (vecstride_x == 1 && idxstride_x == 2 && k == 2)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ii,i,jj,a,t0,t1,xp,yp) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < num_rows; ii++)
+      {
+         i = rownnz ? rownnz[ii] : ii;
+         t0 = t1 = 0.0;
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            a  = A_data[jj];
+            xp = x_data + 2 * A_j[jj];
+            t0 += a * xp[0];
+            t1 += a * xp[1];
+         }
+         yp = y_data + i * idxstride_y;
+         yp[0]           += t0;
+         yp[vecstride_y] += t1;
+      }
+   }
+   else if (vecstride_x == 1 && idxstride_x == 4 && k == 4)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ii,i,jj,a,t0,t1,t2,t3,xp,yp) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < num_rows; ii++)
+      {
+         i = rownnz ? rownnz[ii] : ii;
+         t0 = t1 = t2 = t3 = 0.0;
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            a  = A_data[jj];
+            xp = x_data + 4 * A_j[jj];
+            t0 += a * xp[0];
+            t1 += a * xp[1];
+            t2 += a * xp[2];
+            t3 += a * xp[3];
+         }
+         yp = y_data + i * idxstride_y;
+         yp[0]               += t0;
+         yp[vecstride_y]     += t1;
+         yp[2 * vecstride_y] += t2;
+         yp[3 * vecstride_y] += t3;
+      }
+   }
+   else if (vecstride_x == 1 && idxstride_x == 8 && k == 8)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ii,i,jj,a,t0,t1,t2,t3,t4,t5,t6,t7,xp,yp) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < num_rows; ii++)
+      {
+         i = rownnz ? rownnz[ii] : ii;
+         t0 = t1 = t2 = t3 = t4 = t5 = t6 = t7 = 0.0;
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            a  = A_data[jj];
+            xp = x_data + 8 * A_j[jj];
+            t0 += a * xp[0];
+            t1 += a * xp[1];
+            t2 += a * xp[2];
+            t3 += a * xp[3];
+            t4 += a * xp[4];
+            t5 += a * xp[5];
+            t6 += a * xp[6];
+            t7 += a * xp[7];
+         }
+         yp = y_data + i * idxstride_y;
+         yp[0]               += t0;
+         yp[vecstride_y]     += t1;
+         yp[2 * vecstride_y] += t2;
+         yp[3 * vecstride_y] += t3;
+         yp[4 * vecstride_y] += t4;
+         yp[5 * vecstride_y] += t5;
+         yp[6 * vecstride_y] += t6;
+         yp[7 * vecstride_y] += t7;
+      }
+   }
+   else
+   {
+      /* any k and storage: the components are taken in blocks of 8 whose
+         partial sums are kept in local accumulators, so y is written once */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ii,i,jj,v,v0,nv,a,t,xp,yp) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < num_rows; ii++)
+      {
+         i  = rownnz ? rownnz[ii] : ii;
+         yp = y_data + i * idxstride_y;
+         for (v0 = 0; v0 < k; v0 += 8)
+         {
+            nv = hypre_min(k - v0, 8);
+            for (v = 0; v < nv; v++)
+            {
+               t[v] = 0.0;
+            }
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               a  = A_data[jj];
+               xp = x_data + A_j[jj] * idxstride_x + v0 * vecstride_x;
+               for (v = 0; v < nv; v++)
+               {
+                  t[v] += a * xp[v * vecstride_x];
+               }
+            }
+            for (v = 0; v < nv; v++)
+            {
+               yp[(v0 + v) * vecstride_y] += t[v];
+            }
+         }
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -161,45 +305,20 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
       }
 
       /*-----------------------------------------------------------------
-       * y += A*x
+       * y += A*x, streaming A once for all vectors
        *-----------------------------------------------------------------*/
 
       if (num_rownnz < xpar * num_rows)
       {
-#ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(i,j,jj,m,tempx) HYPRE_SMP_SCHEDULE
-#endif
-         for (i = 0; i < num_rownnz; i++)
-         {
-            m = A_rownnz[i];
-            for (j = 0; j < num_vectors; j++)
-            {
-               tempx = 0.0;
-               for (jj = A_i[m]; jj < A_i[m + 1]; jj++)
-               {
-                  tempx += A_data[jj] * x_data[j * vecstride_x + A_j[jj] * idxstride_x];
-               }
-               y_data[j * vecstride_y + m * idxstride_y] += tempx;
-            }
-         }
+         hypre_CSRMatrixSpMMHost(num_rownnz, A_rownnz, A_i, A_j, A_data, num_vectors,
+                                 x_data, idxstride_x, vecstride_x,
+                                 y_data, idxstride_y, vecstride_y);
       }
       else
       {
-#ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(i,j,jj,tempx) HYPRE_SMP_SCHEDULE
-#endif
-         for (i = 0; i < num_rows; i++)
-         {
-            for (j = 0; j < num_vectors; ++j)
-            {
-               tempx = 0.0;
-               for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-               {
-                  tempx += A_data[jj] * x_data[j * vecstride_x + A_j[jj] * idxstride_x];
-               }
-               y_data[j * vecstride_y + i * idxstride_y] += tempx;
-            }
-         }
+         hypre_CSRMatrixSpMMHost(num_rows, NULL, A_i, A_j, A_data, num_vectors,
+                                 x_data, idxstride_x, vecstride_x,
+                                 y_data, idxstride_y, vecstride_y);
       }
 
       /*-----------------------------------------------------------------
@@ -722,6 +841,11 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (offset == 0 && hypre_CSRMatrixSellEnabled(A, hypre_VectorNumVectors(x)))
+   {
+      ierr = hypre_CSRMatrixMatvecSellHost(alpha, A, x, beta, b, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y, offset);
    }
@@ -914,14 +1038,15 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
       }
       else
       {
-         /* multiple vector case is not threaded */
+         /* multiple vector case is not threaded; each nonzero of A is
+            applied to all vectors, so that A is read only once */
          for (i = 0; i < num_rows; i++)
          {
-            for ( jv = 0; jv < num_vectors; ++jv )
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
             {
-               for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+               j = A_j[jj];
+               for ( jv = 0; jv < num_vectors; ++jv )
                {
-                  j = A_j[jj];
                   y_data[ j * idxstride_y + jv * vecstride_y ] +=
                      A_data[jj] * x_data[ i * idxstride_x + jv * vecstride_x];
                }
@@ -946,11 +1071,11 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
          }
          else
          {
-            for ( jv = 0; jv < num_vectors; ++jv )
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
             {
-               for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+               j = A_j[jj];
+               for ( jv = 0; jv < num_vectors; ++jv )
                {
-                  j = A_j[jj];
                   y_data[ j * idxstride_y + jv * vecstride_y ] +=
                      A_data[jj] * x_data[ i * idxstride_x + jv * vecstride_x ];
                }
@@ -1002,6 +1127,11 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (hypre_CSRMatrixSellEnabled(A, hypre_VectorNumVectors(x)))
+   {
+      ierr = hypre_CSRMatrixMatvecTSellHost(alpha, A, x, beta, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecTHost(alpha, A, x, beta, y);
    }
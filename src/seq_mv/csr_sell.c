@@ -0,0 +1,480 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma (sliced ELLPACK) shadow storage for hypre_CSRMatrix and the
+ * corresponding host Matvec and MatvecT kernels.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellDataCreate
+ *
+ * Builds the SELL-C-sigma representation of the host CSR matrix A. The
+ * sorting window sigma is rounded up to a multiple of the chunk height.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRSellData *
+hypre_CSRSellDataCreate( hypre_CSRMatrix *A,
+                         HYPRE_Int        sigma )
+{
+   HYPRE_Int          *A_i        = hypre_CSRMatrixI(A);
+   HYPRE_Int          *A_j        = hypre_CSRMatrixJ(A);
+   HYPRE_Complex      *A_data     = hypre_CSRMatrixData(A);
+   HYPRE_Int           num_rows   = hypre_CSRMatrixNumRows(A);
+
+   hypre_CSRSellData  *sell;
+   HYPRE_Int           num_chunks, num_slots;
+   HYPRE_Int          *chunk_ptr, *chunk_len, *rows, *sell_j;
+   HYPRE_Complex      *sell_data;
+   HYPRE_Int          *row_len, *count;
+   HYPRE_Int           c, r, k, i, w, w_end, row, len, width, pos, pad_j, max_len;
+
+   if (sigma < hypre_CSR_SELL_C)
+   {
+      sigma = hypre_CSR_SELL_C;
+   }
+   sigma = ((sigma + hypre_CSR_SELL_C - 1) / hypre_CSR_SELL_C) * hypre_CSR_SELL_C;
+
+   num_chunks = (num_rows + hypre_CSR_SELL_C - 1) / hypre_CSR_SELL_C;
+   num_slots  = num_chunks * hypre_CSR_SELL_C;
+
+   rows      = hypre_TAlloc(HYPRE_Int, num_slots, HYPRE_MEMORY_HOST);
+   row_len   = hypre_TAlloc(HYPRE_Int, num_slots, HYPRE_MEMORY_HOST);
+   chunk_len = hypre_CTAlloc(HYPRE_Int, num_chunks, HYPRE_MEMORY_HOST);
+   chunk_ptr = hypre_CTAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+
+   max_len = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      max_len = hypre_max(max_len, A_i[i + 1] - A_i[i]);
+   }
+   count = hypre_TAlloc(HYPRE_Int, max_len + 2, HYPRE_MEMORY_HOST);
+
+   /* sort rows by decreasing length within each window of sigma rows; a
+      counting sort, since row lengths take few distinct values and a
+      comparison sort degrades badly on the many ties */
+   for (w = 0; w < num_rows; w += sigma)
+   {
+      w_end = hypre_min(w + sigma, num_rows);
+      width = 0;
+      for (i = w; i < w_end; i++)
+      {
+         width = hypre_max(width, A_i[i + 1] - A_i[i]);
+      }
+      for (len = 0; len <= width + 1; len++)
+      {
+         count[len] = 0;
+      }
+      for (i = w; i < w_end; i++)
+      {
+         count[width - (A_i[i + 1] - A_i[i]) + 1]++;
+      }
+      for (len = 1; len <= width + 1; len++)
+      {
+         count[len] += count[len - 1];
+      }
+      for (i = w; i < w_end; i++)
+      {
+         pos = w + count[width - (A_i[i + 1] - A_i[i])]++;
+         rows[pos]    = i;
+         row_len[pos] = A_i[i + 1] - A_i[i];
+      }
+   }
+   for (i = num_rows; i < num_slots; i++)
+   {
+      rows[i]    = -1;
+      row_len[i] = 0;
+   }
+   hypre_TFree(count, HYPRE_MEMORY_HOST);
+
+   /* chunk widths and offsets */
+   for (c = 0; c < num_chunks; c++)
+   {
+      width = 0;
+      for (r = 0; r < hypre_CSR_SELL_C; r++)
+      {
+         width = hypre_max(width, row_len[c * hypre_CSR_SELL_C + r]);
+      }
+      chunk_len[c]     = width;
+      chunk_ptr[c + 1] = chunk_ptr[c] + width * hypre_CSR_SELL_C;
+   }
+   hypre_TFree(row_len, HYPRE_MEMORY_HOST);
+
+   sell_j    = hypre_TAlloc(HYPRE_Int,     chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+   sell_data = hypre_TAlloc(HYPRE_Complex, chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+
+   /* fill column-major chunks; padding entries get a zero coefficient and a
+      valid column index so that the kernels need no masking */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c,r,k,row,len,pos,pad_j) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      pad_j = 0;
+      for (r = 0; r < hypre_CSR_SELL_C; r++)
+      {
+         row = rows[c * hypre_CSR_SELL_C + r];
+         len = (row < 0) ? 0 : A_i[row + 1] - A_i[row];
+         if (len > 0)
+         {
+            pad_j = A_j[A_i[row]];
+         }
+         for (k = 0; k < len; k++)
+         {
+            pos = chunk_ptr[c] + k * hypre_CSR_SELL_C + r;
+            sell_j[pos]    = A_j[A_i[row] + k];
+            sell_data[pos] = A_data[A_i[row] + k];
+         }
+         for (k = len; k < chunk_len[c]; k++)
+         {
+            pos = chunk_ptr[c] + k * hypre_CSR_SELL_C + r;
+            sell_j[pos]    = pad_j;
+            sell_data[pos] = 0.0;
+         }
+      }
+   }
+
+   sell = hypre_CTAlloc(hypre_CSRSellData, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CSRSellDataNumRows(sell)   = num_rows;
+   hypre_CSRSellDataNumChunks(sell) = num_chunks;
+   hypre_CSRSellDataSigma(sell)     = sigma;
+   hypre_CSRSellDataChunkPtr(sell)  = chunk_ptr;
+   hypre_CSRSellDataChunkLen(sell)  = chunk_len;
+   hypre_CSRSellDataRows(sell)      = rows;
+   hypre_CSRSellDataJ(sell)         = sell_j;
+   hypre_CSRSellDataData(sell)      = sell_data;
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellDataDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRSellDataDestroy( hypre_CSRSellData *sell )
+{
+   if (sell)
+   {
+      hypre_TFree(hypre_CSRSellDataChunkPtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataChunkLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataRows(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataJ(sell),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataData(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetSellSigma
+ *
+ * sigma > 0 turns on the SELL-C-sigma shadow for host matvecs with A,
+ * sigma = 0 turns it off. Any existing shadow is discarded and, for a host
+ * matrix, rebuilt right away so that its cost is paid here rather than in
+ * the first matvec.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetSellSigma( hypre_CSRMatrix *A,
+                             HYPRE_Int        sigma )
+{
+   hypre_CSRMatrixSellInvalidate(A);
+   hypre_CSRMatrixSellSigma(A) = hypre_max(sigma, 0);
+   hypre_CSRMatrixSellEnabled(A, 1);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellInvalidate
+ *
+ * Must be called whenever the values or the pattern of A change; the shadow
+ * is rebuilt on the next matvec.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellInvalidate( hypre_CSRMatrix *A )
+{
+   if (A && hypre_CSRMatrixSellData(A))
+   {
+      hypre_CSRSellDataDestroy(hypre_CSRMatrixSellData(A));
+      hypre_CSRMatrixSellData(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellEnabled
+ *
+ * Returns 1 if a host matvec with A (and num_vectors vectors) should use the
+ * SELL-C-sigma kernels, building the shadow first if needed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellEnabled( hypre_CSRMatrix *A,
+                            HYPRE_Int        num_vectors )
+{
+   if (hypre_CSRMatrixSellSigma(A) <= 0 || num_vectors != 1 ||
+       hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      return 0;
+   }
+
+   if (!hypre_CSRMatrixSellData(A))
+   {
+      hypre_CSRMatrixSellData(A) = hypre_CSRSellDataCreate(A, hypre_CSRMatrixSellSigma(A));
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSellHost
+ *
+ * y = alpha*A*x + beta*b using the SELL-C-sigma shadow of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSellHost( HYPRE_Complex    alpha,
+                               hypre_CSRMatrix *A,
+                               hypre_Vector    *x,
+                               HYPRE_Complex    beta,
+                               hypre_Vector    *b,
+                               hypre_Vector    *y )
+{
+   hypre_CSRSellData *sell       = hypre_CSRMatrixSellData(A);
+   HYPRE_Int          num_chunks = hypre_CSRSellDataNumChunks(sell);
+   HYPRE_Int         *chunk_ptr  = hypre_CSRSellDataChunkPtr(sell);
+   HYPRE_Int         *chunk_len  = hypre_CSRSellDataChunkLen(sell);
+   HYPRE_Int         *rows       = hypre_CSRSellDataRows(sell);
+   HYPRE_Int         *sell_j     = hypre_CSRSellDataJ(sell);
+   HYPRE_Complex     *sell_data  = hypre_CSRSellDataData(sell);
+
+   HYPRE_Complex     *x_data = hypre_VectorData(x);
+   HYPRE_Complex     *b_data = hypre_VectorData(b);
+   HYPRE_Complex     *y_data = hypre_VectorData(y);
+   hypre_Vector      *x_tmp  = NULL;
+
+   HYPRE_Int          c, r, k, row;
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c,r,k,row) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      HYPRE_Complex  sum[hypre_CSR_SELL_C];
+      HYPRE_Int     *cj = sell_j + chunk_ptr[c];
+      HYPRE_Complex *ca = sell_data + chunk_ptr[c];
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp simd
+#endif
+      for (r = 0; r < hypre_CSR_SELL_C; r++)
+      {
+         sum[r] = 0.0;
+      }
+
+      /* one column slice of the chunk per step; the C lanes are independent
+         rows and are vectorized together */
+      for (k = 0; k < chunk_len[c]; k++)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp simd
+#endif
+         for (r = 0; r < hypre_CSR_SELL_C; r++)
+         {
+            sum[r] += ca[r] * x_data[cj[r]];
+         }
+         cj += hypre_CSR_SELL_C;
+         ca += hypre_CSR_SELL_C;
+      }
+
+      for (r = 0; r < hypre_CSR_SELL_C; r++)
+      {
+         row = rows[c * hypre_CSR_SELL_C + r];
+         if (row < 0)
+         {
+            continue;
+         }
+         if (beta == 0.0)
+         {
+            y_data[row] = alpha * sum[r];
+         }
+         else
+         {
+            y_data[row] = alpha * sum[r] + beta * b_data[row];
+         }
+      }
+   }
+
+   if (x_tmp)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSellChunk
+ *
+ * y += alpha*A_c^T*x for one chunk A_c, walking its column-major storage
+ * in order. The lane weights alpha*x(row) are formed once per chunk, with
+ * zero for empty slots so that padding entries need no test.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_CSRMatrixMatvecTSellChunk( HYPRE_Complex  alpha,
+                                 HYPRE_Int      len,
+                                 HYPRE_Int     *cj,
+                                 HYPRE_Complex *ca,
+                                 HYPRE_Int     *crows,
+                                 HYPRE_Complex *x_data,
+                                 HYPRE_Complex *y_data )
+{
+   HYPRE_Complex  xr[hypre_CSR_SELL_C];
+   HYPRE_Int      r, k;
+
+   for (r = 0; r < hypre_CSR_SELL_C; r++)
+   {
+      xr[r] = (crows[r] < 0) ? 0.0 : alpha * x_data[crows[r]];
+   }
+
+   /* lanes of a slice may share a column, so the updates stay scalar */
+   for (k = 0; k < len; k++)
+   {
+      for (r = 0; r < hypre_CSR_SELL_C; r++)
+      {
+         y_data[cj[r]] += ca[r] * xr[r];
+      }
+      cj += hypre_CSR_SELL_C;
+      ca += hypre_CSR_SELL_C;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSellHost
+ *
+ * y = alpha*A^T*x + beta*y using the SELL-C-sigma shadow of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSellHost( HYPRE_Complex    alpha,
+                                hypre_CSRMatrix *A,
+                                hypre_Vector    *x,
+                                HYPRE_Complex    beta,
+                                hypre_Vector    *y )
+{
+   hypre_CSRSellData *sell       = hypre_CSRMatrixSellData(A);
+   HYPRE_Int          num_chunks = hypre_CSRSellDataNumChunks(sell);
+   HYPRE_Int         *chunk_ptr  = hypre_CSRSellDataChunkPtr(sell);
+   HYPRE_Int         *chunk_len  = hypre_CSRSellDataChunkLen(sell);
+   HYPRE_Int         *rows       = hypre_CSRSellDataRows(sell);
+   HYPRE_Int         *sell_j     = hypre_CSRSellDataJ(sell);
+   HYPRE_Complex     *sell_data  = hypre_CSRSellDataData(sell);
+   HYPRE_Int          num_cols   = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex     *x_data = hypre_VectorData(x);
+   HYPRE_Complex     *y_data = hypre_VectorData(y);
+   HYPRE_Int          y_size = hypre_VectorSize(y);
+   hypre_Vector      *x_tmp  = NULL;
+
+   HYPRE_Complex     *y_data_expand = NULL;
+   HYPRE_Int          num_threads   = hypre_NumThreads();
+   HYPRE_Int          c, k, i;
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   /*-----------------------------------------------------------------------
+    * y = beta*y
+    *-----------------------------------------------------------------------*/
+
+   if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols; i++)
+      {
+         y_data[i] = (beta == 0.0) ? 0.0 : beta * y_data[i];
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * y += alpha*A^T*x
+    *-----------------------------------------------------------------*/
+
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel private(c,i,k)
+#endif
+      {
+         HYPRE_Complex *y_loc = y_data_expand + y_size * hypre_GetThreadNum();
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (c = 0; c < num_chunks; c++)
+         {
+            hypre_CSRMatrixMatvecTSellChunk(alpha, chunk_len[c], sell_j + chunk_ptr[c],
+                                            sell_data + chunk_ptr[c],
+                                            rows + c * hypre_CSR_SELL_C, x_data, y_loc);
+         }
+
+         /* implied barrier (for threads)*/
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (k = 0; k < num_threads; k++)
+            {
+               y_data[i] += y_data_expand[k * y_size + i];
+            }
+         }
+      }
+
+      hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      for (c = 0; c < num_chunks; c++)
+      {
+         hypre_CSRMatrixMatvecTSellChunk(alpha, chunk_len[c], sell_j + chunk_ptr[c],
+                                         sell_data + chunk_ptr[c],
+                                         rows + c * hypre_CSR_SELL_C, x_data, y_data);
+      }
+   }
+
+   if (x_tmp)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,461 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host sparse matrix-matrix product with per-row accumulators.
+ *
+ * For every row of C = A*B the upper bound
+ *
+ *    ub(i) = sum_{k in A(i,:)} nnz(B(k,:))
+ *
+ * is computed (cf. the naive estimate of csr_spgemm_device_rowest.c) and an
+ * accumulator is picked from it: rows with a small bound expand the products
+ * into a short thread-local buffer that is heap-sorted and compressed, all
+ * other rows use a thread-local open addressing hash table sized to the next
+ * power of two >= 2*min(ub(i), ncols(B)). No marker array of size ncols(B)
+ * is allocated.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/* rows with an upper bound up to this size use the heap-sort accumulator */
+#define HYPRE_SPGEMM_HOST_HEAP_MAX 32
+
+static inline HYPRE_Int
+hypre_SpGemmHostHashSize( HYPRE_Int ub )
+{
+   HYPRE_Int size = 1;
+
+   while (size < 2 * ub)
+   {
+      size <<= 1;
+   }
+
+   return size;
+}
+
+static inline HYPRE_Int
+hypre_SpGemmHostHashSlot( HYPRE_Int *hash_j,
+                          HYPRE_Int  mask,
+                          HYPRE_Int  key )
+{
+   HYPRE_Int slot = (HYPRE_Int) (((hypre_uint) key * 2654435761u) & (hypre_uint) mask);
+
+   while (hash_j[slot] != -1 && hash_j[slot] != key)
+   {
+      slot = (slot + 1) & mask;
+   }
+
+   return slot;
+}
+
+static inline void
+hypre_SpGemmHostSiftDown( HYPRE_Int     *j,
+                          HYPRE_Complex *data,
+                          HYPRE_Int      root,
+                          HYPRE_Int      n )
+{
+   HYPRE_Int     child, jtmp;
+   HYPRE_Complex dtmp;
+
+   while ((child = 2 * root + 1) < n)
+   {
+      if (child + 1 < n && j[child + 1] > j[child])
+      {
+         child++;
+      }
+      if (j[root] >= j[child])
+      {
+         return;
+      }
+      jtmp = j[root]; j[root] = j[child]; j[child] = jtmp;
+      if (data)
+      {
+         dtmp = data[root]; data[root] = data[child]; data[child] = dtmp;
+      }
+      root = child;
+   }
+}
+
+/* in-place heap sort of j (and data, if not NULL) by increasing j */
+static void
+hypre_SpGemmHostHeapSort( HYPRE_Int     *j,
+                          HYPRE_Complex *data,
+                          HYPRE_Int      n )
+{
+   HYPRE_Int     k, jtmp;
+   HYPRE_Complex dtmp;
+
+   for (k = n / 2 - 1; k >= 0; k--)
+   {
+      hypre_SpGemmHostSiftDown(j, data, k, n);
+   }
+   for (k = n - 1; k > 0; k--)
+   {
+      jtmp = j[0]; j[0] = j[k]; j[k] = jtmp;
+      if (data)
+      {
+         dtmp = data[0]; data[0] = data[k]; data[k] = dtmp;
+      }
+      hypre_SpGemmHostSiftDown(j, data, 0, k);
+   }
+}
+
+/* moves the entry with column index 'diag' to the front of a row of C */
+static inline void
+hypre_SpGemmHostDiagFirst( HYPRE_Int     *C_j,
+                           HYPRE_Complex *C_data,
+                           HYPRE_Int      diag )
+{
+   HYPRE_Int     k = 0;
+   HYPRE_Complex dval;
+
+   while (C_j[k] != diag)
+   {
+      k++;
+   }
+   dval = C_data[k];
+   for (; k > 0; k--)
+   {
+      C_j[k] = C_j[k - 1];
+      C_data[k] = C_data[k - 1];
+   }
+   C_j[0] = diag;
+   C_data[0] = dval;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHostHash
+ *
+ * Same result as hypre_CSRMatrixMultiplyHost (up to the order of the
+ * off-diagonal entries within a row), including the convention that the
+ * diagonal is stored first when A has no rownnz array and C is square.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrix*
+hypre_CSRMatrixMultiplyHostHash( hypre_CSRMatrix *A,
+                                 hypre_CSRMatrix *B )
+{
+   HYPRE_Complex        *A_data    = hypre_CSRMatrixData(A);
+   HYPRE_Int            *A_i       = hypre_CSRMatrixI(A);
+   HYPRE_Int            *A_j       = hypre_CSRMatrixJ(A);
+   HYPRE_Int             nrows_A   = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int             ncols_A   = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int             num_nnz_A = hypre_CSRMatrixNumNonzeros(A);
+
+   HYPRE_Complex        *B_data    = hypre_CSRMatrixData(B);
+   HYPRE_Int            *B_i       = hypre_CSRMatrixI(B);
+   HYPRE_Int            *B_j       = hypre_CSRMatrixJ(B);
+   HYPRE_Int             nrows_B   = hypre_CSRMatrixNumRows(B);
+   HYPRE_Int             ncols_B   = hypre_CSRMatrixNumCols(B);
+   HYPRE_Int             num_nnz_B = hypre_CSRMatrixNumNonzeros(B);
+
+   HYPRE_MemoryLocation  memory_location_C = hypre_max(hypre_CSRMatrixMemoryLocation(A),
+                                                       hypre_CSRMatrixMemoryLocation(B));
+
+   hypre_CSRMatrix      *C;
+   HYPRE_Complex        *C_data = NULL;
+   HYPRE_Int            *C_i;
+   HYPRE_Int            *C_j = NULL;
+
+   HYPRE_Int             insert_diag;
+   HYPRE_Int            *twspace;
+
+   if (ncols_A != nrows_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Warning! incompatible matrix dimensions!\n");
+      return NULL;
+   }
+
+   if ((num_nnz_A == 0) || (num_nnz_B == 0))
+   {
+      C = hypre_CSRMatrixCreate(nrows_A, ncols_B, 0);
+      hypre_CSRMatrixNumRownnz(C) = 0;
+      hypre_CSRMatrixInitialize_v2(C, 0, memory_location_C);
+
+      return C;
+   }
+
+   insert_diag = (nrows_A == ncols_B) && (hypre_CSRMatrixRownnz(A) == NULL);
+
+   twspace = hypre_TAlloc(HYPRE_Int, hypre_NumThreads(), HYPRE_MEMORY_HOST);
+   C_i = hypre_CTAlloc(HYPRE_Int, nrows_A + 1, memory_location_C);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int      *hash_j = NULL, *hash_pos = NULL, *hash_list = NULL, *heap_j = NULL;
+      HYPRE_Complex  *heap_data = NULL;
+      HYPRE_Int       ns, ne, ii, i, i1, ia, ib, ja, jb, k;
+      HYPRE_Int       num_threads, ub, max_ub, hash_max, heap_max;
+      HYPRE_Int       mask, slot, cnt, pos, num_nonzeros;
+      HYPRE_Complex   a_entry;
+
+      ii = hypre_GetThreadNum();
+      num_threads = hypre_NumActiveThreads();
+      hypre_partition1D(nrows_A, num_threads, ii, &ns, &ne);
+
+      /* Row upper bounds (number of products); C_i temporarily holds ub(i) */
+      max_ub = 0;
+      for (i = ns; i < ne; i++)
+      {
+         ub = insert_diag;
+         for (ia = A_i[i]; ia < A_i[i + 1]; ia++)
+         {
+            ja = A_j[ia];
+            ub += B_i[ja + 1] - B_i[ja];
+         }
+         C_i[i] = ub;
+         max_ub = hypre_max(max_ub, ub);
+      }
+
+      /* Thread-local accumulators, sized for the largest row of this thread.
+         hash_list records the occupied slots of the table in insertion order,
+         so that neither output nor reset has to scan the whole table */
+      heap_max = hypre_min(max_ub, HYPRE_SPGEMM_HOST_HEAP_MAX);
+      hash_max = (max_ub > HYPRE_SPGEMM_HOST_HEAP_MAX) ?
+                 hypre_SpGemmHostHashSize(hypre_min(max_ub, ncols_B)) : 0;
+      heap_j    = hypre_TAlloc(HYPRE_Int, heap_max, HYPRE_MEMORY_HOST);
+      heap_data = hypre_TAlloc(HYPRE_Complex, heap_max, HYPRE_MEMORY_HOST);
+      hash_j    = hypre_TAlloc(HYPRE_Int, hash_max, HYPRE_MEMORY_HOST);
+      hash_list = hypre_TAlloc(HYPRE_Int, hash_max / 2, HYPRE_MEMORY_HOST);
+      hash_pos  = hypre_TAlloc(HYPRE_Int, hash_max, HYPRE_MEMORY_HOST);
+      for (k = 0; k < hash_max; k++)
+      {
+         hash_j[k] = -1;
+      }
+
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "First pass");
+
+      /* First pass: compute sizes of C rows. */
+      num_nonzeros = 0;
+      for (i = ns; i < ne; i++)
+      {
+         ub = C_i[i];
+         C_i[i] = num_nonzeros;
+         cnt = 0;
+
+         if (ub == 0)
+         {
+            continue;
+         }
+         else if (ub <= HYPRE_SPGEMM_HOST_HEAP_MAX)
+         {
+            /* heap accumulator: expand, sort, count distinct columns */
+            if (insert_diag)
+            {
+               heap_j[cnt++] = i;
+            }
+            for (ia = A_i[i]; ia < A_i[i + 1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+               {
+                  heap_j[cnt++] = B_j[ib];
+               }
+            }
+            hypre_SpGemmHostHeapSort(heap_j, NULL, cnt);
+            for (k = 1, pos = 1; k < cnt; k++)
+            {
+               pos += (heap_j[k] != heap_j[k - 1]);
+            }
+            cnt = pos;
+         }
+         else
+         {
+            /* hash accumulator: count distinct keys, then clear the table */
+            mask = hypre_SpGemmHostHashSize(hypre_min(ub, ncols_B)) - 1;
+            if (insert_diag)
+            {
+               slot = hypre_SpGemmHostHashSlot(hash_j, mask, i);
+               hash_j[slot] = i;
+               hash_list[cnt++] = slot;
+            }
+            for (ia = A_i[i]; ia < A_i[i + 1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+               {
+                  jb = B_j[ib];
+                  slot = hypre_SpGemmHostHashSlot(hash_j, mask, jb);
+                  if (hash_j[slot] == -1)
+                  {
+                     hash_j[slot] = jb;
+                     hash_list[cnt++] = slot;
+                  }
+               }
+            }
+            for (k = 0; k < cnt; k++)
+            {
+               hash_j[hash_list[k]] = -1;
+            }
+         }
+         num_nonzeros += cnt;
+      }
+      twspace[ii] = num_nonzeros;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      /* Correct C_i */
+      if (ii)
+      {
+         pos = twspace[0];
+         for (i1 = 1; i1 < ii; i1++)
+         {
+            pos += twspace[i1];
+         }
+
+         for (i = ns; i < ne; i++)
+         {
+            C_i[i] += pos;
+         }
+      }
+      else
+      {
+         C_i[nrows_A] = 0;
+         for (i1 = 0; i1 < num_threads; i1++)
+         {
+            C_i[nrows_A] += twspace[i1];
+         }
+
+         C = hypre_CSRMatrixCreate(nrows_A, ncols_B, C_i[nrows_A]);
+         hypre_CSRMatrixI(C) = C_i;
+         hypre_CSRMatrixInitialize_v2(C, 0, memory_location_C);
+         C_j = hypre_CSRMatrixJ(C);
+         C_data = hypre_CSRMatrixData(C);
+      }
+      HYPRE_ANNOTATE_REGION_END("%s", "First pass");
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      /* Second pass: Fill in C_data and C_j. */
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "Second pass");
+      for (i = ns; i < ne; i++)
+      {
+         pos = C_i[i];
+         cnt = C_i[i + 1] - pos;
+
+         if (cnt == 0)
+         {
+            continue;
+         }
+
+         ub = insert_diag;
+         for (ia = A_i[i]; ia < A_i[i + 1]; ia++)
+         {
+            ja = A_j[ia];
+            ub += B_i[ja + 1] - B_i[ja];
+         }
+
+         if (ub <= HYPRE_SPGEMM_HOST_HEAP_MAX)
+         {
+            cnt = 0;
+            if (insert_diag)
+            {
+               heap_j[cnt] = i;
+               heap_data[cnt++] = 0.0;
+            }
+            for (ia = A_i[i]; ia < A_i[i + 1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+               {
+                  heap_j[cnt] = B_j[ib];
+                  heap_data[cnt++] = a_entry * B_data[ib];
+               }
+            }
+            hypre_SpGemmHostHeapSort(heap_j, heap_data, cnt);
+
+            C_j[pos] = heap_j[0];
+            C_data[pos] = heap_data[0];
+            for (k = 1; k < cnt; k++)
+            {
+               if (heap_j[k] == C_j[pos])
+               {
+                  C_data[pos] += heap_data[k];
+               }
+               else
+               {
+                  pos++;
+                  C_j[pos] = heap_j[k];
+                  C_data[pos] = heap_data[k];
+               }
+            }
+
+            if (insert_diag)
+            {
+               hypre_SpGemmHostDiagFirst(C_j + C_i[i], C_data + C_i[i], i);
+            }
+         }
+         else
+         {
+            /* the exact row size is known now, so the table can be smaller;
+               the table maps a column to its position in C, and inserting the
+               diagonal first keeps it first in the output */
+            mask = hypre_SpGemmHostHashSize(cnt) - 1;
+            if (insert_diag)
+            {
+               slot = hypre_SpGemmHostHashSlot(hash_j, mask, i);
+               hash_j[slot] = i;
+               hash_pos[slot] = pos;
+               hash_list[pos - C_i[i]] = slot;
+               C_j[pos] = i;
+               C_data[pos++] = 0.0;
+            }
+            for (ia = A_i[i]; ia < A_i[i + 1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+               {
+                  jb = B_j[ib];
+                  slot = hypre_SpGemmHostHashSlot(hash_j, mask, jb);
+                  if (hash_j[slot] == -1)
+                  {
+                     hash_j[slot] = jb;
+                     hash_pos[slot] = pos;
+                     hash_list[pos - C_i[i]] = slot;
+                     C_j[pos] = jb;
+                     C_data[pos++] = a_entry * B_data[ib];
+                  }
+                  else
+                  {
+                     C_data[hash_pos[slot]] += a_entry * B_data[ib];
+                  }
+               }
+            }
+            for (k = 0; k < cnt; k++)
+            {
+               hash_j[hash_list[k]] = -1;
+            }
+         }
+      }
+      HYPRE_ANNOTATE_REGION_END("%s", "Second pass");
+
+      hypre_TFree(heap_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(heap_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_list, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_pos, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   // Set rownnz and num_rownnz
+   hypre_CSRMatrixSetRownnz(C);
+
+   /* Free memory */
+   hypre_TFree(twspace, HYPRE_MEMORY_HOST);
+
+   return C;
+}
@@ -115,6 +115,20 @@ HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows,
                                  HYPRE_Int new_num_cols, HYPRE_Int new_num_nonzeros );
 
+/* csr_sell.c */
+hypre_CSRSellData *hypre_CSRSellDataCreate ( hypre_CSRMatrix *A, HYPRE_Int sigma );
+HYPRE_Int hypre_CSRSellDataDestroy ( hypre_CSRSellData *sell );
+HYPRE_Int hypre_CSRMatrixSetSellSigma ( hypre_CSRMatrix *A, HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSellInvalidate ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellEnabled ( hypre_CSRMatrix *A, HYPRE_Int num_vectors );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                          HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                           HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_spgemm_host.c */
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHostHash ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
+
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
 HYPRE_Int hypre_CSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
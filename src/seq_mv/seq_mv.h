@@ -46,6 +46,39 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma shadow of a CSR Matrix (host only)
+ *
+ * Rows are sorted by decreasing length inside windows of sigma rows and
+ * grouped into chunks of hypre_CSR_SELL_C rows. Each chunk is stored
+ * column-major and padded to its longest row, so that the inner loop of the
+ * matvec runs over the rows of a chunk with unit stride.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CSR_SELL_C     8
+#define hypre_CSR_SELL_SIGMA 256
+
+typedef struct
+{
+   HYPRE_Int            num_rows;
+   HYPRE_Int            num_chunks;
+   HYPRE_Int            sigma;
+   HYPRE_Int           *chunk_ptr;       /* offset of each chunk in j and data */
+   HYPRE_Int           *chunk_len;       /* width (padded row length) of each chunk */
+   HYPRE_Int           *rows;            /* original row of each slot, -1 for padding */
+   HYPRE_Int           *j;
+   HYPRE_Complex       *data;
+} hypre_CSRSellData;
+
+#define hypre_CSRSellDataNumRows(sell)              ((sell) -> num_rows)
+#define hypre_CSRSellDataNumChunks(sell)            ((sell) -> num_chunks)
+#define hypre_CSRSellDataSigma(sell)                ((sell) -> sigma)
+#define hypre_CSRSellDataChunkPtr(sell)             ((sell) -> chunk_ptr)
+#define hypre_CSRSellDataChunkLen(sell)             ((sell) -> chunk_len)
+#define hypre_CSRSellDataRows(sell)                 ((sell) -> rows)
+#define hypre_CSRSellDataJ(sell)                    ((sell) -> j)
+#define hypre_CSRSellDataData(sell)                 ((sell) -> data)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -65,6 +98,8 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   HYPRE_Int             sell_sigma;      /* > 0: use a SELL-C-sigma shadow in host matvecs */
+   hypre_CSRSellData    *sell_data;       /* built when sell_sigma is set, rebuilt lazily */
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE)
    HYPRE_Int            *sorted_j;        /* some cusparse routines require sorted CSR */
    HYPRE_Complex        *sorted_data;
@@ -88,6 +123,8 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)            ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSellSigma(matrix)            ((matrix) -> sell_sigma)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell_data)
 
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE)
 #define hypre_CSRMatrixSortedJ(matrix)              ((matrix) -> sorted_j)
@@ -387,6 +424,20 @@ HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows,
                                  HYPRE_Int new_num_cols, HYPRE_Int new_num_nonzeros );
 
+/* csr_sell.c */
+hypre_CSRSellData *hypre_CSRSellDataCreate ( hypre_CSRMatrix *A, HYPRE_Int sigma );
+HYPRE_Int hypre_CSRSellDataDestroy ( hypre_CSRSellData *sell );
+HYPRE_Int hypre_CSRMatrixSetSellSigma ( hypre_CSRMatrix *A, HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSellInvalidate ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellEnabled ( hypre_CSRMatrix *A, HYPRE_Int num_vectors );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                          HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                           HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_spgemm_host.c */
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHostHash ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
+
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
 HYPRE_Int hypre_CSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
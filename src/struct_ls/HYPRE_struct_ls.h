@@ -265,6 +265,8 @@ HYPRE_Int HYPRE_StructPFMGSetNonZeroGuess(HYPRE_StructSolver solver);
  *    - 1 : Weighted Jacobi (default)
  *    - 2 : Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation)
  *    - 3 : Red/Black Gauss-Seidel (nonsymmetric: RB pre- and post-relaxation)
+ *    - 4 : Weighted line Jacobi, with lines along each level's coarsening
+ *          direction (variable coefficient matrices only; otherwise 1 is used)
  **/
 HYPRE_Int HYPRE_StructPFMGSetRelaxType(HYPRE_StructSolver solver,
                                        HYPRE_Int          relax_type);
@@ -328,6 +330,75 @@ HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGGetSkipRelax(HYPRE_StructSolver solver,
                                        HYPRE_Int *skip_relax);
 
+/**
+ * (Optional) Set the number of Jacobi relaxation sweeps done per ghost-layer
+ * exchange.  With \e fused_relax_sweeps = k > 1, the Jacobi and weighted
+ * Jacobi smoothers exchange k ghost layers once and then do up to k sweeps in
+ * a single pass over the grid, recomputing the neighboring points in the
+ * ghost layers instead of communicating them.  This reduces communication
+ * and memory traffic at the cost of a copy of the matrix with k ghost layers
+ * on each level.  It applies to variable-coefficient matrices with stencils
+ * within distance one and is ignored otherwise.  The default is 1.
+ **/
+HYPRE_Int HYPRE_StructPFMGSetFusedRelaxSweeps(HYPRE_StructSolver solver,
+                                              HYPRE_Int          fused_relax_sweeps);
+
+HYPRE_Int HYPRE_StructPFMGGetFusedRelaxSweeps(HYPRE_StructSolver solver,
+                                              HYPRE_Int *fused_relax_sweeps);
+
+/**
+ * (Optional) Use single-precision matrix coefficients in the solve phase.
+ * If \e mixed_precision is nonzero, the setup keeps a single-precision copy
+ * of the coefficients of each level matrix, which the host Jacobi
+ * relaxation and residual kernels read while vectors and sums stay in
+ * double precision.  This nearly halves the matrix memory traffic of these
+ * kernels.  The coarse operators are still computed in double precision,
+ * but with relaxation types 0 and 1 (and no fused sweeps) only the
+ * single-precision copies of the coarse matrices are kept once the setup is
+ * done.  The copy of the fine grid matrix is released when the solver is
+ * destroyed.  It is meant for PFMG as a preconditioner, and applies to
+ * variable-coefficient matrices with relaxation types 0 and 1.  The default
+ * is 0.
+ **/
+HYPRE_Int HYPRE_StructPFMGSetMixedPrecision(HYPRE_StructSolver solver,
+                                            HYPRE_Int          mixed_precision);
+
+HYPRE_Int HYPRE_StructPFMGGetMixedPrecision(HYPRE_StructSolver solver,
+                                            HYPRE_Int *mixed_precision);
+
+/**
+ * (Optional) Store spatially constant coarse-grid operators compressed.
+ * If \e compress_coarse is nonzero, the boxes of each coarse operator whose
+ * off-diagonal coefficients are the same at every grid point of the box,
+ * boundaries included, store one value per off-diagonal stencil entry and
+ * the variable diagonal.  The operator is unchanged, but the residual and
+ * relaxation kernels on these boxes read a single array of coefficients.
+ * This is typical of coarse levels of periodic problems and of boxes away
+ * from coefficient jumps and boundaries.  It applies with relaxation types 0
+ * and 1.  The default is 0.
+ **/
+HYPRE_Int HYPRE_StructPFMGSetCompressCoarse(HYPRE_StructSolver solver,
+                                            HYPRE_Int          compress_coarse);
+
+HYPRE_Int HYPRE_StructPFMGGetCompressCoarse(HYPRE_StructSolver solver,
+                                            HYPRE_Int *compress_coarse);
+
+/**
+ * (Optional) Agglomerate coarse grids onto fewer processes.  When the coarse
+ * grid has fewer than \e agglom_size points per process, coarsening stops
+ * and the remaining levels are solved by a PFMG V-cycle on a copy of the
+ * coarse grid gathered onto groups of processes, so that each owning process
+ * again has about \e agglom_size points.  Only the owning processes take part
+ * in that V-cycle.  This is repeated as the grids get smaller, which reduces
+ * the number of messages on the coarsest levels of large runs.  The default
+ * is 0, which turns agglomeration off.
+ **/
+HYPRE_Int HYPRE_StructPFMGSetAgglomSize(HYPRE_StructSolver solver,
+                                        HYPRE_Int          agglom_size);
+
+HYPRE_Int HYPRE_StructPFMGGetAgglomSize(HYPRE_StructSolver solver,
+                                        HYPRE_Int *agglom_size);
+
 /*
  * RE-VISIT
  **/
@@ -668,6 +739,82 @@ HYPRE_Int HYPRE_StructDiagScale(HYPRE_StructSolver solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Struct Pipelined PCG Solver
+ *
+ * Pipelined PCG with one fused, non-blocking global reduction per
+ * iteration.  See the generic pipelined PCG interface in \ref KrylovSolvers.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_StructPipelinedPCGCreate(MPI_Comm           comm,
+                                         HYPRE_StructSolver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_StructPipelinedPCGDestroy(HYPRE_StructSolver solver);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetup(HYPRE_StructSolver solver,
+                                        HYPRE_StructMatrix A,
+                                        HYPRE_StructVector b,
+                                        HYPRE_StructVector x);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSolve(HYPRE_StructSolver solver,
+                                        HYPRE_StructMatrix A,
+                                        HYPRE_StructVector b,
+                                        HYPRE_StructVector x);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetTol(HYPRE_StructSolver solver,
+                                         HYPRE_Real         tol);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetAbsoluteTol(HYPRE_StructSolver solver,
+                                                 HYPRE_Real         a_tol);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetMaxIter(HYPRE_StructSolver solver,
+                                             HYPRE_Int          max_iter);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetTwoNorm(HYPRE_StructSolver solver,
+                                             HYPRE_Int          two_norm);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetRecomputeResidualP(HYPRE_StructSolver solver,
+                                                        HYPRE_Int          recompute_residual_p);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetPrecond(HYPRE_StructSolver         solver,
+                                             HYPRE_PtrToStructSolverFcn precond,
+                                             HYPRE_PtrToStructSolverFcn precond_setup,
+                                             HYPRE_StructSolver         precond_solver);
+
+HYPRE_Int HYPRE_StructPipelinedPCGGetPrecond(HYPRE_StructSolver solver,
+                                             HYPRE_StructSolver *precond_data);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetLogging(HYPRE_StructSolver solver,
+                                             HYPRE_Int          logging);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetPrintLevel(HYPRE_StructSolver solver,
+                                                HYPRE_Int          print_level);
+
+HYPRE_Int HYPRE_StructPipelinedPCGGetNumIterations(HYPRE_StructSolver solver,
+                                                   HYPRE_Int          *num_iterations);
+
+HYPRE_Int HYPRE_StructPipelinedPCGGetFinalRelativeResidualNorm(HYPRE_StructSolver solver,
+                                                               HYPRE_Real         *norm);
+
+/**
+ * Returns the residual.
+ **/
+HYPRE_Int HYPRE_StructPipelinedPCGGetResidual(HYPRE_StructSolver solver,
+                                              void               **residual);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
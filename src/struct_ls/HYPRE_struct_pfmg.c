@@ -250,6 +250,74 @@ HYPRE_StructPFMGGetSkipRelax( HYPRE_StructSolver solver,
    return ( hypre_PFMGGetSkipRelax( (void *) solver, skip_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetFusedRelaxSweeps( HYPRE_StructSolver solver,
+                                     HYPRE_Int          fused_relax_sweeps )
+{
+   return ( hypre_PFMGSetFusedRelaxSweeps( (void *) solver, fused_relax_sweeps) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetFusedRelaxSweeps( HYPRE_StructSolver solver,
+                                     HYPRE_Int        * fused_relax_sweeps )
+{
+   return ( hypre_PFMGGetFusedRelaxSweeps( (void *) solver, fused_relax_sweeps) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetMixedPrecision( HYPRE_StructSolver solver,
+                                   HYPRE_Int          mixed_precision )
+{
+   return ( hypre_PFMGSetMixedPrecision( (void *) solver, mixed_precision) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetMixedPrecision( HYPRE_StructSolver solver,
+                                   HYPRE_Int        * mixed_precision )
+{
+   return ( hypre_PFMGGetMixedPrecision( (void *) solver, mixed_precision) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetCompressCoarse( HYPRE_StructSolver solver,
+                                   HYPRE_Int          compress_coarse )
+{
+   return ( hypre_PFMGSetCompressCoarse( (void *) solver, compress_coarse) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetCompressCoarse( HYPRE_StructSolver solver,
+                                   HYPRE_Int        * compress_coarse )
+{
+   return ( hypre_PFMGGetCompressCoarse( (void *) solver, compress_coarse) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetAgglomSize( HYPRE_StructSolver solver,
+                               HYPRE_Int          agglom_size )
+{
+   return ( hypre_PFMGSetAgglomSize( (void *) solver, agglom_size) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetAgglomSize( HYPRE_StructSolver solver,
+                               HYPRE_Int        * agglom_size )
+{
+   return ( hypre_PFMGGetAgglomSize( (void *) solver, agglom_size) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
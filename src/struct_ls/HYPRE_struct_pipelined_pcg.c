@@ -0,0 +1,219 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
+{
+   hypre_PCGFunctions * pcg_functions;
+
+   if (!solver)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   pcg_functions =
+      hypre_PCGFunctionsCreate(
+         hypre_StructKrylovCAlloc, hypre_StructKrylovFree, hypre_StructKrylovCommInfo,
+         hypre_StructKrylovCreateVector,
+         hypre_StructKrylovDestroyVector, hypre_StructKrylovMatvecCreate,
+         hypre_StructKrylovMatvec, hypre_StructKrylovMatvecDestroy,
+         hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
+         hypre_StructKrylovClearVector,
+         hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
+         hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_PCGFunctionsSetNonBlockingInnerProd(pcg_functions,
+                                             hypre_StructKrylovInnerProdStart,
+                                             hypre_StructKrylovInnerProdWait);
+   *solver = ( (HYPRE_StructSolver) hypre_PipelinedPCGCreate( pcg_functions ) );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGDestroy( HYPRE_StructSolver solver )
+{
+   return ( hypre_PipelinedPCGDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetup( HYPRE_StructSolver solver,
+                               HYPRE_StructMatrix A,
+                               HYPRE_StructVector b,
+                               HYPRE_StructVector x )
+{
+   return ( HYPRE_PipelinedPCGSetup( (HYPRE_Solver) solver,
+                                     (HYPRE_Matrix) A,
+                                     (HYPRE_Vector) b,
+                                     (HYPRE_Vector) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSolve( HYPRE_StructSolver solver,
+                               HYPRE_StructMatrix A,
+                               HYPRE_StructVector b,
+                               HYPRE_StructVector x )
+{
+   return ( HYPRE_PipelinedPCGSolve( (HYPRE_Solver) solver,
+                                     (HYPRE_Matrix) A,
+                                     (HYPRE_Vector) b,
+                                     (HYPRE_Vector) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetTol( HYPRE_StructSolver solver,
+                                HYPRE_Real         tol )
+{
+   return ( HYPRE_PipelinedPCGSetTol( (HYPRE_Solver) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGSetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetAbsoluteTol( HYPRE_StructSolver solver,
+                                        HYPRE_Real         a_tol )
+{
+   return ( HYPRE_PipelinedPCGSetAbsoluteTol( (HYPRE_Solver) solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetMaxIter( HYPRE_StructSolver solver,
+                                    HYPRE_Int          max_iter )
+{
+   return ( HYPRE_PipelinedPCGSetMaxIter( (HYPRE_Solver) solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGSetTwoNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetTwoNorm( HYPRE_StructSolver solver,
+                                    HYPRE_Int          two_norm )
+{
+   return ( HYPRE_PipelinedPCGSetTwoNorm( (HYPRE_Solver) solver, two_norm ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGSetRecomputeResidualP
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetRecomputeResidualP( HYPRE_StructSolver solver,
+                                               HYPRE_Int          recompute_residual_p )
+{
+   return ( HYPRE_PipelinedPCGSetRecomputeResidualP( (HYPRE_Solver) solver, recompute_residual_p ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetPrecond( HYPRE_StructSolver         solver,
+                                    HYPRE_PtrToStructSolverFcn precond,
+                                    HYPRE_PtrToStructSolverFcn precond_setup,
+                                    HYPRE_StructSolver         precond_solver )
+{
+   return ( HYPRE_PipelinedPCGSetPrecond( (HYPRE_Solver) solver,
+                                          (HYPRE_PtrToSolverFcn) precond,
+                                          (HYPRE_PtrToSolverFcn) precond_setup,
+                                          (HYPRE_Solver) precond_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGGetPrecond( HYPRE_StructSolver  solver,
+                                    HYPRE_StructSolver *precond_data_ptr )
+{
+   return ( HYPRE_PipelinedPCGGetPrecond( (HYPRE_Solver) solver, (HYPRE_Solver *) precond_data_ptr ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetPrintLevel( HYPRE_StructSolver solver,
+                                       HYPRE_Int          level )
+{
+   return ( HYPRE_PipelinedPCGSetPrintLevel( (HYPRE_Solver) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGSetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetLogging( HYPRE_StructSolver solver,
+                                    HYPRE_Int          level )
+{
+   return ( HYPRE_PipelinedPCGSetLogging( (HYPRE_Solver) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGGetNumIterations( HYPRE_StructSolver  solver,
+                                          HYPRE_Int          *num_iterations )
+{
+   return ( HYPRE_PipelinedPCGGetNumIterations( (HYPRE_Solver) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGGetFinalRelativeResidualNorm( HYPRE_StructSolver  solver,
+                                                      HYPRE_Real         *norm )
+{
+   return ( HYPRE_PipelinedPCGGetFinalRelativeResidualNorm( (HYPRE_Solver) solver, norm ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPipelinedPCGGetResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGGetResidual( HYPRE_StructSolver   solver,
+                                     void               **residual )
+{
+   return ( HYPRE_PipelinedPCGGetResidual( (HYPRE_Solver) solver, (void *) residual ) );
+}
@@ -77,6 +77,11 @@ typedef struct
    HYPRE_Int             time_index;
    HYPRE_BigInt          solve_flops;
    HYPRE_Int             max_levels;
+
+   /* batched tridiagonal line solves (see hypre_CycRedLineSetup) */
+   HYPRE_Int             line_solve;
+   HYPRE_Int            *line_offsets;
+   HYPRE_Real           *line_data;
 } hypre_CyclicReductionData;
 
 /*--------------------------------------------------------------------------
@@ -457,6 +462,345 @@ hypre_CycRedSetupCoarseOp( hypre_StructMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Batched tridiagonal line solves
+ *
+ * When every line in direction cdir lies entirely within one box (no box
+ * splits a line and the grid is not periodic in cdir), cyclic reduction
+ * reduces to independent tridiagonal solves.  These are done with the Thomas
+ * algorithm on blocks of HYPRE_CYCRED_LANES lines at a time.  The LU factors
+ * are computed at setup and stored lane-interleaved (structure-of-arrays) so
+ * that the forward and backward sweeps vectorize across the lines of a block.
+ * For each block of a line length n, the layout is
+ *
+ *    a[i*LANES + lane], m[i*LANES + lane], cp[i*LANES + lane]
+ *
+ * with a = lower coefficient, m = inverse pivot and cp = scaled upper
+ * coefficient.  A zero pivot (e.g., full Neumann problems) sets the
+ * corresponding unknown to zero, as in the coarsest-grid solve below.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_CYCRED_LANES 8
+
+/*--------------------------------------------------------------------------
+ * Compute the data index of the first point of each line of a base-points
+ * box, along with the data stride along the lines.  Line t of the box starts
+ * at rank + (t % ln[0]) * ls[0] + (t / ln[0]) * ls[1].
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CycRedLineGeometry( hypre_Box      *box,
+                          hypre_Box      *dbox,
+                          hypre_IndexRef  base_stride,
+                          HYPRE_Int       cdir,
+                          HYPRE_Int       ndim,
+                          HYPRE_Int      *rank,
+                          HYPRE_Int      *s,
+                          HYPRE_Int      *ln,
+                          HYPRE_Int      *ls )
+{
+   hypre_Index  loop_size;
+   HYPRE_Int    dstride, d, k;
+
+   hypre_BoxGetStrideSize(box, base_stride, loop_size);
+   *rank = hypre_BoxIndexRank(dbox, hypre_BoxIMin(box));
+
+   ln[0] = ln[1] = 1;
+   ls[0] = ls[1] = 0;
+   dstride = 1;
+   k = 0;
+   for (d = 0; d < ndim; d++)
+   {
+      if (d == cdir)
+      {
+         *s = dstride;
+      }
+      else
+      {
+         ln[k] = hypre_IndexD(loop_size, d);
+         ls[k] = dstride * hypre_IndexD(base_stride, d);
+         k++;
+      }
+      dstride *= hypre_BoxSizeD(dbox, d);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if the batched line solve can be used for A
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CycRedLineSolveEligible( hypre_CyclicReductionData *cyc_red_data,
+                               hypre_StructMatrix        *A )
+{
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_RAJA) || defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return 0;
+#else
+   MPI_Comm          comm  = (cyc_red_data -> comm);
+   HYPRE_Int         cdir  = (cyc_red_data -> cdir);
+   hypre_StructGrid *grid  = hypre_StructMatrixGrid(A);
+   hypre_Box        *bbox  = hypre_StructGridBoundingBox(grid);
+   hypre_BoxArray   *boxes = hypre_StructGridBoxes(grid);
+   hypre_Box        *box;
+   HYPRE_Int         local_ok, ok, i;
+
+   /* These are global properties, so no communication is needed */
+   if ( (cyc_red_data -> max_levels) > 0 ||
+        cdir >= hypre_StructGridNDim(grid) ||
+        hypre_IndexD((cyc_red_data -> base_stride), cdir) != 1 ||
+        hypre_IndexD(hypre_StructGridPeriodic(grid), cdir) != 0 ||
+        hypre_StructMatrixConstantCoefficient(A) != 0 )
+   {
+      return 0;
+   }
+
+   /* Every box must span the full grid extent in direction cdir */
+   local_ok = 1;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if ( hypre_BoxIMinD(box, cdir) != hypre_BoxIMinD(bbox, cdir) ||
+           hypre_BoxIMaxD(box, cdir) != hypre_BoxIMaxD(bbox, cdir) )
+      {
+         local_ok = 0;
+         break;
+      }
+   }
+   hypre_MPI_Allreduce(&local_ok, &ok, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+
+   return ok;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * Factor the tridiagonal line systems of A
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CycRedLineSetup( hypre_CyclicReductionData *cyc_red_data,
+                       hypre_StructMatrix        *A,
+                       hypre_StructVector        *x )
+{
+   HYPRE_Int        ndim        = hypre_StructMatrixNDim(A);
+   HYPRE_Int        cdir        = (cyc_red_data -> cdir);
+   hypre_IndexRef   base_index  = (cyc_red_data -> base_index);
+   hypre_IndexRef   base_stride = (cyc_red_data -> base_stride);
+   HYPRE_Int        V           = HYPRE_CYCRED_LANES;
+
+   hypre_BoxArray  *base_points;
+   hypre_Box       *box;
+   hypre_Box       *A_dbox;
+   HYPRE_Int       *line_offsets;
+   HYPRE_Real      *line_data;
+   HYPRE_Real      *Ap, *Awp, *Aep;
+   hypre_Index      index;
+   HYPRE_Int        rank, s, ln[2], ls[2];
+   HYPRE_Int        n, nlines, nblocks, data_size;
+   HYPRE_Int        fi, bk;
+   HYPRE_Int        flop_divisor;
+
+   base_points = hypre_BoxArrayDuplicate(hypre_StructGridBoxes(hypre_StructMatrixGrid(A)));
+   hypre_ProjectBoxArray(base_points, base_index, base_stride);
+
+   /* line_offsets[fi] is the start of box fi in line_data */
+   line_offsets = hypre_TAlloc(HYPRE_Int, hypre_BoxArraySize(base_points) + 1,
+                               HYPRE_MEMORY_HOST);
+   data_size = 0;
+   hypre_ForBoxI(fi, base_points)
+   {
+      box = hypre_BoxArrayBox(base_points, fi);
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+      line_offsets[fi] = data_size;
+      if (hypre_BoxVolume(box) > 0)
+      {
+         hypre_CycRedLineGeometry(box, A_dbox, base_stride, cdir, ndim,
+                                  &rank, &s, ln, ls);
+         n = hypre_BoxSizeD(box, cdir);
+         nblocks = (ln[0] * ln[1] + V - 1) / V;
+         data_size += 3 * n * V * nblocks;
+      }
+   }
+   line_offsets[fi] = data_size;
+   line_data = hypre_CTAlloc(HYPRE_Real, data_size, HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxI(fi, base_points)
+   {
+      box = hypre_BoxArrayBox(base_points, fi);
+      if (hypre_BoxVolume(box) <= 0)
+      {
+         continue;
+      }
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+
+      hypre_SetIndex3(index, 0, 0, 0);
+      Ap = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_IndexD(index, cdir) = -1;
+      Awp = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_IndexD(index, cdir) = 1;
+      Aep = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+      hypre_CycRedLineGeometry(box, A_dbox, base_stride, cdir, ndim,
+                               &rank, &s, ln, ls);
+      n = hypre_BoxSizeD(box, cdir);
+      nlines = ln[0] * ln[1];
+      nblocks = (nlines + V - 1) / V;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(bk) HYPRE_SMP_SCHEDULE
+#endif
+      for (bk = 0; bk < nblocks; bk++)
+      {
+         HYPRE_Real *a  = line_data + line_offsets[fi] + 3 * n * V * bk;
+         HYPRE_Real *m  = a + n * V;
+         HYPRE_Real *cp = m + n * V;
+         HYPRE_Real  piv;
+         HYPRE_Int   nl = hypre_min(V, nlines - bk * V);
+         HYPRE_Int   lane, t, i, Ai;
+
+         for (lane = 0; lane < nl; lane++)
+         {
+            t  = bk * V + lane;
+            Ai = rank + (t % ln[0]) * ls[0] + (t / ln[0]) * ls[1];
+            for (i = 0; i < n; i++, Ai += s)
+            {
+               a[i * V + lane] = (i > 0) ? Awp[Ai] : 0.0;
+               piv = Ap[Ai];
+               if (i > 0)
+               {
+                  piv -= a[i * V + lane] * cp[(i - 1) * V + lane];
+               }
+               m[i * V + lane]  = (piv != 0.0) ? (1.0 / piv) : 0.0;
+               cp[i * V + lane] = (i < n - 1) ? (Aep[Ai] * m[i * V + lane]) : 0.0;
+            }
+         }
+      }
+   }
+
+   (cyc_red_data -> ndim)         = ndim;
+   (cyc_red_data -> num_levels)   = 1;
+   (cyc_red_data -> base_points)  = base_points;
+   (cyc_red_data -> line_offsets) = line_offsets;
+   (cyc_red_data -> line_data)    = line_data;
+
+   flop_divisor = (hypre_IndexX(base_stride) *
+                   hypre_IndexY(base_stride) *
+                   hypre_IndexZ(base_stride)  );
+   (cyc_red_data -> solve_flops) =
+      5 * hypre_StructVectorGlobalSize(x) / (HYPRE_BigInt)flop_divisor;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Solve the factored line systems.  The forward sweep overwrites x with the
+ * intermediate solution, so b and x may be the same vector.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CycRedLineSolve( hypre_CyclicReductionData *cyc_red_data,
+                       hypre_StructVector        *b,
+                       hypre_StructVector        *x )
+{
+   HYPRE_Int        ndim         = (cyc_red_data -> ndim);
+   HYPRE_Int        cdir         = (cyc_red_data -> cdir);
+   hypre_IndexRef   base_stride  = (cyc_red_data -> base_stride);
+   hypre_BoxArray  *base_points  = (cyc_red_data -> base_points);
+   HYPRE_Int       *line_offsets = (cyc_red_data -> line_offsets);
+   HYPRE_Real      *line_data    = (cyc_red_data -> line_data);
+   HYPRE_Int        V            = HYPRE_CYCRED_LANES;
+
+   hypre_Box       *box;
+   hypre_Box       *x_dbox;
+   hypre_Box       *b_dbox;
+   HYPRE_Real      *xp, *bp;
+   HYPRE_Int        xrank, xs, xln[2], xls[2];
+   HYPRE_Int        brank, bs, bln[2], bls[2];
+   HYPRE_Int        n, nlines, nblocks;
+   HYPRE_Int        fi, bk;
+
+   hypre_ForBoxI(fi, base_points)
+   {
+      box = hypre_BoxArrayBox(base_points, fi);
+      if (hypre_BoxVolume(box) <= 0)
+      {
+         continue;
+      }
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), fi);
+      b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), fi);
+      xp = hypre_StructVectorBoxData(x, fi);
+      bp = hypre_StructVectorBoxData(b, fi);
+
+      hypre_CycRedLineGeometry(box, x_dbox, base_stride, cdir, ndim,
+                               &xrank, &xs, xln, xls);
+      hypre_CycRedLineGeometry(box, b_dbox, base_stride, cdir, ndim,
+                               &brank, &bs, bln, bls);
+      n = hypre_BoxSizeD(box, cdir);
+      nlines = xln[0] * xln[1];
+      nblocks = (nlines + V - 1) / V;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(bk) HYPRE_SMP_SCHEDULE
+#endif
+      for (bk = 0; bk < nblocks; bk++)
+      {
+         HYPRE_Real *a  = line_data + line_offsets[fi] + 3 * n * V * bk;
+         HYPRE_Real *m  = a + n * V;
+         HYPRE_Real *cp = m + n * V;
+         HYPRE_Int   xo[HYPRE_CYCRED_LANES];
+         HYPRE_Int   bo[HYPRE_CYCRED_LANES];
+         HYPRE_Int   nl = hypre_min(V, nlines - bk * V);
+         HYPRE_Int   lane, t, i;
+
+         for (lane = 0; lane < nl; lane++)
+         {
+            t = bk * V + lane;
+            xo[lane] = xrank + (t % xln[0]) * xls[0] + (t / xln[0]) * xls[1];
+            bo[lane] = brank + (t % bln[0]) * bls[0] + (t / bln[0]) * bls[1];
+         }
+
+         /* Forward sweep: x_i = (b_i - a_i x_{i-1}) m_i */
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp simd
+#endif
+         for (lane = 0; lane < nl; lane++)
+         {
+            xp[xo[lane]] = bp[bo[lane]] * m[lane];
+         }
+         for (i = 1; i < n; i++)
+         {
+            HYPRE_Real *ai = a + i * V;
+            HYPRE_Real *mi = m + i * V;
+            HYPRE_Int   xi = i * xs;
+            HYPRE_Int   bi = i * bs;
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp simd
+#endif
+            for (lane = 0; lane < nl; lane++)
+            {
+               xp[xo[lane] + xi] = (bp[bo[lane] + bi] -
+                                    ai[lane] * xp[xo[lane] + xi - xs]) * mi[lane];
+            }
+         }
+
+         /* Backward sweep: x_i -= cp_i x_{i+1} */
+         for (i = n - 2; i >= 0; i--)
+         {
+            HYPRE_Real *cpi = cp + i * V;
+            HYPRE_Int   xi  = i * xs;
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp simd
+#endif
+            for (lane = 0; lane < nl; lane++)
+            {
+               xp[xo[lane] + xi] -= cpi[lane] * xp[xo[lane] + xi + xs];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CyclicReductionSetup
  *--------------------------------------------------------------------------*/
@@ -511,6 +855,12 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
 
    grid = hypre_StructMatrixGrid(A);
 
+   (cyc_red_data -> line_solve) = hypre_CycRedLineSolveEligible(cyc_red_data, A);
+   if (cyc_red_data -> line_solve)
+   {
+      return hypre_CycRedLineSetup(cyc_red_data, A, x);
+   }
+
    /* Compute a preliminary num_levels value based on the grid */
    cbox = hypre_BoxDuplicate(hypre_StructGridBoundingBox(grid));
    num_levels = hypre_Log2(hypre_BoxSizeD(cbox, cdir)) + 2;
@@ -811,6 +1161,14 @@ hypre_CyclicReduction( void               *cyc_red_vdata,
 
    hypre_BeginTiming(cyc_red_data -> time_index);
 
+   if (cyc_red_data -> line_solve)
+   {
+      hypre_CycRedLineSolve(cyc_red_data, b, x);
+      hypre_IncFLOPCount(cyc_red_data -> solve_flops);
+      hypre_EndTiming(cyc_red_data -> time_index);
+
+      return hypre_error_flag;
+   }
 
    /*--------------------------------------------------
     * Initialize some things
@@ -1210,7 +1568,16 @@ hypre_CyclicReductionDestroy( void *cyc_red_vdata )
 
    HYPRE_Int l;
 
-   if (cyc_red_data)
+   if (cyc_red_data && (cyc_red_data -> line_solve))
+   {
+      hypre_BoxArrayDestroy(cyc_red_data -> base_points);
+      hypre_TFree(cyc_red_data -> line_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> line_data, HYPRE_MEMORY_HOST);
+
+      hypre_FinalizeTiming(cyc_red_data -> time_index);
+      hypre_TFree(cyc_red_data, HYPRE_MEMORY_HOST);
+   }
+   else if (cyc_red_data)
    {
       hypre_BoxArrayDestroy(cyc_red_data -> base_points);
       hypre_StructGridDestroy(cyc_red_data -> grid_l[0]);
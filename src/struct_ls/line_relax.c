@@ -0,0 +1,313 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Weighted line Jacobi relaxation.  Each sweep solves the tridiagonal systems
+ * given by the stencil entries along direction `dir' exactly (with cyclic
+ * reduction, which uses batched line solves when lines are not split across
+ * boxes) and damps the update:
+ *
+ *    x = x + weight * A_line^{-1} (b - A x)
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   HYPRE_Real              weight;
+   HYPRE_Int               dir;       /* line direction */
+
+   hypre_StructMatrix     *A_line;
+   hypre_StructVector     *t;
+
+   void                   *line_solve_data;
+   void                   *matvec_data;
+
+   /* log info (always logged) */
+   HYPRE_Int               num_iterations;
+   HYPRE_Int               time_index;
+
+} hypre_LineRelaxData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_LineRelaxCreate( MPI_Comm  comm )
+{
+   hypre_LineRelaxData *relax_data;
+
+   relax_data = hypre_CTAlloc(hypre_LineRelaxData,  1, HYPRE_MEMORY_HOST);
+
+   (relax_data -> comm)       = comm;
+   (relax_data -> time_index) = hypre_InitializeTiming("LineRelax");
+
+   /* set defaults */
+   (relax_data -> max_iter)        = 1000;
+   (relax_data -> zero_guess)      = 0;
+   (relax_data -> weight)          = 1.0;
+   (relax_data -> dir)             = 0;
+   (relax_data -> A_line)          = NULL;
+   (relax_data -> t)               = NULL;
+   (relax_data -> line_solve_data) = NULL;
+   (relax_data -> matvec_data)     = NULL;
+
+   return (void *) relax_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxDestroy( void *relax_vdata )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   if (relax_data)
+   {
+      hypre_StructMatrixDestroy(relax_data -> A_line);
+      hypre_StructVectorDestroy(relax_data -> t);
+      hypre_CyclicReductionDestroy(relax_data -> line_solve_data);
+      hypre_StructMatvecDestroy(relax_data -> matvec_data);
+
+      hypre_FinalizeTiming(relax_data -> time_index);
+      hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetup( void               *relax_vdata,
+                      hypre_StructMatrix *A,
+                      hypre_StructVector *b,
+                      hypre_StructVector *x           )
+{
+   hypre_LineRelaxData  *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   HYPRE_Int             dir           = (relax_data -> dir);
+   hypre_StructVector   *t             = (relax_data -> t);
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int             ndim          = hypre_StructStencilNDim(stencil);
+
+   hypre_StructMatrix   *A_line;
+   void                 *line_solve_data;
+   void                 *matvec_data;
+   HYPRE_Int            *stencil_indices;
+   HYPRE_Int             num_stencil_indices;
+   HYPRE_Int             i, d;
+
+   /*----------------------------------------------------------
+    * Free up old data before putting new data into structure
+    *----------------------------------------------------------*/
+
+   hypre_StructMatrixDestroy(relax_data -> A_line);
+   hypre_CyclicReductionDestroy(relax_data -> line_solve_data);
+   hypre_StructMatvecDestroy(relax_data -> matvec_data);
+
+   /*----------------------------------------------------------
+    * Set up the line operator (stencil entries along dir)
+    *----------------------------------------------------------*/
+
+   stencil_indices = hypre_TAlloc(HYPRE_Int,  stencil_size, HYPRE_MEMORY_HOST);
+   num_stencil_indices = 0;
+   for (i = 0; i < stencil_size; i++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if ((d != dir) && (hypre_IndexD(stencil_shape[i], d) != 0))
+         {
+            break;
+         }
+      }
+      if (d == ndim)
+      {
+         stencil_indices[num_stencil_indices] = i;
+         num_stencil_indices++;
+      }
+   }
+
+   A_line = hypre_StructMatrixCreateMask(A, num_stencil_indices, stencil_indices);
+   hypre_TFree(stencil_indices, HYPRE_MEMORY_HOST);
+
+   line_solve_data = hypre_CyclicReductionCreate(relax_data -> comm);
+   hypre_CyclicReductionSetCDir(line_solve_data, dir);
+   hypre_CyclicReductionSetup(line_solve_data, A_line, t, x);
+
+   matvec_data = hypre_StructMatvecCreate();
+   hypre_StructMatvecSetup(matvec_data, A, x);
+
+   (relax_data -> A_line)          = A_line;
+   (relax_data -> line_solve_data) = line_solve_data;
+   (relax_data -> matvec_data)     = matvec_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelax( void               *relax_vdata,
+                 hypre_StructMatrix *A,
+                 hypre_StructVector *b,
+                 hypre_StructVector *x           )
+{
+   hypre_LineRelaxData  *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   HYPRE_Int             max_iter        = (relax_data -> max_iter);
+   HYPRE_Int             zero_guess      = (relax_data -> zero_guess);
+   HYPRE_Real            weight          = (relax_data -> weight);
+   hypre_StructMatrix   *A_line          = (relax_data -> A_line);
+   hypre_StructVector   *t               = (relax_data -> t);
+   void                 *line_solve_data = (relax_data -> line_solve_data);
+   void                 *matvec_data     = (relax_data -> matvec_data);
+
+   HYPRE_Int             iter = 0;
+
+   /*----------------------------------------------------------
+    * Initialize some things and deal with special cases
+    *----------------------------------------------------------*/
+
+   hypre_BeginTiming(relax_data -> time_index);
+
+   (relax_data -> num_iterations) = 0;
+
+   /* if max_iter is zero, return */
+   if (max_iter == 0)
+   {
+      /* if using a zero initial guess, return zero */
+      if (zero_guess)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
+   /*----------------------------------------------------------
+    * Do zero_guess iteration
+    *----------------------------------------------------------*/
+
+   if (zero_guess)
+   {
+      hypre_CyclicReduction(line_solve_data, A_line, b, x);
+      if (weight != 1.0)
+      {
+         hypre_StructScale(weight, x);
+      }
+
+      iter++;
+   }
+
+   /*----------------------------------------------------------
+    * Do regular iterations
+    *----------------------------------------------------------*/
+
+   for (; iter < max_iter; iter++)
+   {
+      /* t = b - A x */
+      hypre_StructCopy(b, t);
+      hypre_StructMatvecCompute(matvec_data, -1.0, A, x, 1.0, t);
+
+      /* x = x + weight * A_line^{-1} t */
+      hypre_CyclicReduction(line_solve_data, A_line, t, t);
+      hypre_StructAxpy(weight, t, x);
+   }
+
+   (relax_data -> num_iterations) = iter;
+
+   hypre_EndTiming(relax_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetMaxIter( void      *relax_vdata,
+                           HYPRE_Int  max_iter    )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetZeroGuess( void      *relax_vdata,
+                             HYPRE_Int  zero_guess  )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> zero_guess) = zero_guess;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetWeight( void       *relax_vdata,
+                          HYPRE_Real  weight      )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> weight) = weight;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetDirection( void      *relax_vdata,
+                             HYPRE_Int  dir         )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> dir) = dir;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetTempVec( void               *relax_vdata,
+                           hypre_StructVector *t           )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   hypre_StructVectorDestroy(relax_data -> t);
+   (relax_data -> t) = hypre_StructVectorRef(t);
+
+   return hypre_error_flag;
+}
@@ -138,6 +138,31 @@ hypre_StructKrylovInnerProd( void *x,
                                    (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovInnerProdStart( HYPRE_Int          n,
+                                  void             **x,
+                                  void             **y,
+                                  HYPRE_Real        *local_result,
+                                  HYPRE_Real        *result,
+                                  hypre_MPI_Request *request )
+{
+   return ( hypre_StructInnerProdStart( n, (hypre_StructVector **) x,
+                                        (hypre_StructVector **) y,
+                                        local_result, result, request ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovInnerProdWait( hypre_MPI_Request *request )
+{
+   return ( hypre_StructInnerProdWait( request ) );
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -37,6 +37,11 @@ hypre_PFMGCreate( MPI_Comm  comm )
    (pfmg_data -> num_pre_relax)    = 1;
    (pfmg_data -> num_post_relax)   = 1;
    (pfmg_data -> skip_relax)       = 1;
+   (pfmg_data -> fused_relax_sweeps) = 1;
+   (pfmg_data -> agglom_size)      = 0;
+   (pfmg_data -> mixed_precision)  = 0;
+   (pfmg_data -> compress_coarse)  = 0;
+   (pfmg_data -> agglom_comm)      = hypre_MPI_COMM_NULL;
    (pfmg_data -> logging)          = 0;
    (pfmg_data -> print_level)      = 0;
 
@@ -90,6 +95,11 @@ hypre_PFMGDestroy( void *pfmg_vdata )
 
          hypre_StructVectorDestroy(pfmg_data -> tx_l[0]);
          hypre_StructGridDestroy(pfmg_data -> grid_l[0]);
+         if (pfmg_data -> mixed_precision)
+         {
+            /* the fine grid matrix is the user's */
+            hypre_StructMatrixDestroyDataFloat(pfmg_data -> A_l[0]);
+         }
          hypre_StructMatrixDestroy(pfmg_data -> A_l[0]);
          hypre_StructVectorDestroy(pfmg_data -> b_l[0]);
          hypre_StructVectorDestroy(pfmg_data -> x_l[0]);
@@ -117,6 +127,23 @@ hypre_PFMGDestroy( void *pfmg_vdata )
          hypre_TFree(pfmg_data -> b_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> x_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> tx_l, HYPRE_MEMORY_HOST);
+
+         if (pfmg_data -> agglom_data)
+         {
+            hypre_PFMGDestroy(pfmg_data -> agglom_data);
+            hypre_StructMatrixDestroy(pfmg_data -> agglom_sub_A);
+            hypre_StructVectorDestroy(pfmg_data -> agglom_sub_b);
+            hypre_StructVectorDestroy(pfmg_data -> agglom_sub_x);
+            hypre_MPI_Comm_free(&(pfmg_data -> agglom_comm));
+         }
+         if (pfmg_data -> agglom_A)
+         {
+            hypre_StructMatrixDestroy(pfmg_data -> agglom_A);
+            hypre_StructVectorDestroy(pfmg_data -> agglom_b);
+            hypre_StructVectorDestroy(pfmg_data -> agglom_x);
+            hypre_CommPkgDestroy(pfmg_data -> agglom_b_pkg);
+            hypre_CommPkgDestroy(pfmg_data -> agglom_x_pkg);
+         }
       }
 
       hypre_FinalizeTiming(pfmg_data -> time_index);
@@ -404,6 +431,106 @@ hypre_PFMGGetSkipRelax( void *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetFusedRelaxSweeps( void *pfmg_vdata,
+                               HYPRE_Int  fused_relax_sweeps )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> fused_relax_sweeps) = fused_relax_sweeps;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetFusedRelaxSweeps( void *pfmg_vdata,
+                               HYPRE_Int *fused_relax_sweeps )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *fused_relax_sweeps = (pfmg_data -> fused_relax_sweeps);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetMixedPrecision( void *pfmg_vdata,
+                             HYPRE_Int  mixed_precision )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> mixed_precision) = mixed_precision;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetMixedPrecision( void *pfmg_vdata,
+                             HYPRE_Int *mixed_precision )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *mixed_precision = (pfmg_data -> mixed_precision);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetCompressCoarse( void *pfmg_vdata,
+                             HYPRE_Int  compress_coarse )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> compress_coarse) = compress_coarse;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetCompressCoarse( void *pfmg_vdata,
+                             HYPRE_Int *compress_coarse )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *compress_coarse = (pfmg_data -> compress_coarse);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetAgglomSize( void *pfmg_vdata,
+                         HYPRE_Int  agglom_size )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> agglom_size) = agglom_size;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetAgglomSize( void *pfmg_vdata,
+                         HYPRE_Int *agglom_size )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *agglom_size = (pfmg_data -> agglom_size);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
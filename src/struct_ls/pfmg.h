@@ -36,6 +36,9 @@ typedef struct
    HYPRE_Int             num_pre_relax;  /* number of pre relaxation sweeps */
    HYPRE_Int             num_post_relax; /* number of post relaxation sweeps */
    HYPRE_Int             skip_relax;     /* flag to allow skipping relaxation */
+   HYPRE_Int             fused_relax_sweeps; /* Jacobi sweeps per ghost exchange */
+   HYPRE_Int             mixed_precision; /* single-precision matrix coefficients */
+   HYPRE_Int             compress_coarse; /* store constant coarse stencils compressed */
    HYPRE_Real            relax_weight;
    HYPRE_Real            dxyz[3];     /* parameters used to determine cdir */
 
@@ -65,6 +68,19 @@ typedef struct
    void                **restrict_data_l;
    void                **interp_data_l;
 
+   /* coarse-level agglomeration onto fewer processes */
+   HYPRE_Int             agglom_size;  /* points per process; 0 means off */
+   MPI_Comm              agglom_comm;  /* processes owning agglom grid boxes */
+   void                 *agglom_data;  /* PFMG solver on agglom_comm */
+   hypre_StructMatrix   *agglom_A;     /* agglom grid on comm; owns the data */
+   hypre_StructVector   *agglom_b;
+   hypre_StructVector   *agglom_x;
+   hypre_StructMatrix   *agglom_sub_A; /* the same data on agglom_comm */
+   hypre_StructVector   *agglom_sub_b;
+   hypre_StructVector   *agglom_sub_x;
+   hypre_CommPkg        *agglom_b_pkg; /* migrates b to the agglom grid */
+   hypre_CommPkg        *agglom_x_pkg; /* migrates x from the agglom grid */
+
    /* log info (always logged) */
    HYPRE_Int             num_iterations;
    HYPRE_Int             time_index;
@@ -80,4 +96,16 @@ typedef struct
 
 } hypre_PFMGData;
 
+/*--------------------------------------------------------------------------
+ * The fused residual-restriction (hypre_SemiRestrictResidual) is host only
+ * and requires variable coefficients (no compressed boxes).
+ *--------------------------------------------------------------------------*/
+
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_RAJA) || defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_DEVICE_OPENMP)
+#define hypre_PFMGFuseResidualRestrict(A) 0
+#else
+#define hypre_PFMGFuseResidualRestrict(A) \
+(hypre_StructMatrixConstantCoefficient(A) == 0 && hypre_StructMatrixConstantBoxes(A) == NULL)
+#endif
+
 #endif
@@ -14,6 +14,7 @@ typedef struct
 {
    void                   *relax_data;
    void                   *rb_relax_data;
+   void                   *line_relax_data;
    HYPRE_Int               relax_type;
    HYPRE_Real              jacobi_weight;
 
@@ -30,6 +31,7 @@ hypre_PFMGRelaxCreate( MPI_Comm  comm )
    pfmg_relax_data = hypre_CTAlloc(hypre_PFMGRelaxData,  1, HYPRE_MEMORY_HOST);
    (pfmg_relax_data -> relax_data) = hypre_PointRelaxCreate(comm);
    (pfmg_relax_data -> rb_relax_data) = hypre_RedBlackGSCreate(comm);
+   (pfmg_relax_data -> line_relax_data) = hypre_LineRelaxCreate(comm);
    (pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
    (pfmg_relax_data -> jacobi_weight) = 0.0;
 
@@ -48,6 +50,7 @@ hypre_PFMGRelaxDestroy( void *pfmg_relax_vdata )
    {
       hypre_PointRelaxDestroy(pfmg_relax_data -> relax_data);
       hypre_RedBlackGSDestroy(pfmg_relax_data -> rb_relax_data);
+      hypre_LineRelaxDestroy(pfmg_relax_data -> line_relax_data);
       hypre_TFree(pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
@@ -85,6 +88,9 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
             hypre_RedBlackGS((pfmg_relax_data -> rb_relax_data), A, b, x);
          }
 
+         break;
+      case 4:
+         hypre_LineRelax((pfmg_relax_data -> line_relax_data), A, b, x);
          break;
    }
 
@@ -104,6 +110,13 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
    HYPRE_Int            relax_type       = (pfmg_relax_data -> relax_type);
    HYPRE_Real           jacobi_weight    = (pfmg_relax_data -> jacobi_weight);
 
+   /* Line relaxation requires variable coefficients; use weighted Jacobi */
+   if (relax_type == 4 && hypre_StructMatrixConstantCoefficient(A))
+   {
+      relax_type = 1;
+      (pfmg_relax_data -> relax_type) = relax_type;
+   }
+
    switch (relax_type)
    {
       case 0:
@@ -114,6 +127,10 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
       case 3:
          hypre_RedBlackGSSetup((pfmg_relax_data -> rb_relax_data), A, b, x);
          break;
+      case 4:
+         hypre_LineRelaxSetWeight(pfmg_relax_data -> line_relax_data, jacobi_weight);
+         hypre_LineRelaxSetup((pfmg_relax_data -> line_relax_data), A, b, x);
+         break;
    }
 
    if (relax_type == 1)
@@ -154,6 +171,7 @@ hypre_PFMGRelaxSetType( void  *pfmg_relax_vdata,
 
       case 2: /* Red-Black Gauss-Seidel */
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
+      case 4: /* Weighted line Jacobi */
          break;
    }
 
@@ -254,6 +272,7 @@ hypre_PFMGRelaxSetMaxIter( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetMaxIter((pfmg_relax_data -> relax_data), max_iter);
    hypre_RedBlackGSSetMaxIter((pfmg_relax_data -> rb_relax_data), max_iter);
+   hypre_LineRelaxSetMaxIter((pfmg_relax_data -> line_relax_data), max_iter);
 
    return hypre_error_flag;
 }
@@ -269,6 +288,7 @@ hypre_PFMGRelaxSetZeroGuess( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetZeroGuess((pfmg_relax_data -> relax_data), zero_guess);
    hypre_RedBlackGSSetZeroGuess((pfmg_relax_data -> rb_relax_data), zero_guess);
+   hypre_LineRelaxSetZeroGuess((pfmg_relax_data -> line_relax_data), zero_guess);
 
    return hypre_error_flag;
 }
@@ -283,6 +303,49 @@ hypre_PFMGRelaxSetTempVec( void               *pfmg_relax_vdata,
    hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
 
    hypre_PointRelaxSetTempVec((pfmg_relax_data -> relax_data), t);
+   hypre_LineRelaxSetTempVec((pfmg_relax_data -> line_relax_data), t);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetLineDirection( void      *pfmg_relax_vdata,
+                                 HYPRE_Int  dir )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_LineRelaxSetDirection((pfmg_relax_data -> line_relax_data), dir);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetFusedSweeps( void      *pfmg_relax_vdata,
+                               HYPRE_Int  fused_sweeps )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_PointRelaxSetFusedSweeps((pfmg_relax_data -> relax_data), fused_sweeps);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetDataFloat( void      *pfmg_relax_vdata,
+                             HYPRE_Int  data_float )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_PointRelaxSetDataFloat((pfmg_relax_data -> relax_data), data_float);
 
    return hypre_error_flag;
 }
@@ -56,6 +56,206 @@ HYPRE_Int hypre_StructGetNonzeroDirection(hypre_Index shape)
    return Astenc;
 }
 
+/*--------------------------------------------------------------------------
+ * Returns the process group size to use for agglomerating a coarse grid of
+ * 'grid_size' points, or 0 if the grid should not be agglomerated.  The grid
+ * is agglomerated when it has fewer than 'agglom_size' points per process,
+ * and the new groups are chosen so that each owning process again has about
+ * 'agglom_size' points.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGAgglomGroupSize( hypre_PFMGData *pfmg_data,
+                           HYPRE_BigInt    grid_size )
+{
+   HYPRE_Int   agglom_size  = (pfmg_data -> agglom_size);
+   HYPRE_Int   num_procs, num_new;
+
+   if (agglom_size <= 0)
+   {
+      return 0;
+   }
+
+   hypre_MPI_Comm_size((pfmg_data -> comm), &num_procs);
+   if ((num_procs < 2) || (grid_size >= (HYPRE_BigInt) agglom_size * num_procs))
+   {
+      return 0;
+   }
+
+   num_new = hypre_max((HYPRE_Int) (grid_size / agglom_size), 1);
+
+   return (num_procs + num_new - 1) / num_new;
+}
+
+/*--------------------------------------------------------------------------
+ * Gathers the coarsest-level matrix onto groups of 'group_size' processes
+ * and sets up a PFMG solver for it on a communicator of the processes that
+ * own part of the gathered grid.  The solver does one V-cycle on the
+ * agglomerated grid in place of the coarsest-level relaxation.
+ *
+ * The gathered matrix and vectors live on the full communicator, so b and x
+ * can be migrated to and from them, and own the data.  The solver works on
+ * copies of them on the smaller communicator that share this data.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGSetupAgglom( hypre_PFMGData *pfmg_data,
+                       HYPRE_Int       group_size,
+                       HYPRE_Int       max_levels )
+{
+   MPI_Comm              comm = (pfmg_data -> comm);
+   HYPRE_Int             l    = (pfmg_data -> num_levels) - 1;
+   hypre_StructMatrix   *A    = (pfmg_data -> A_l)[l];
+   hypre_StructVector   *b    = (pfmg_data -> b_l)[l];
+   hypre_StructVector   *x    = (pfmg_data -> x_l)[l];
+   HYPRE_Int             ndim = hypre_StructMatrixNDim(A);
+   HYPRE_Int             constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   hypre_StructStencil  *stencil = hypre_StructMatrixStencil(A);
+   HYPRE_Int             stencil_size = hypre_StructStencilSize(stencil);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+
+   hypre_StructGrid     *grid, *sub_grid;
+   hypre_BoxArray       *boxes;
+   hypre_StructMatrix   *agglom_A, *sub_A;
+   hypre_StructVector   *agglom_b, *sub_b;
+   hypre_StructVector   *agglom_x, *sub_x;
+   MPI_Comm              agglom_comm;
+   void                 *agglom_data;
+   HYPRE_Complex        *values;
+   HYPRE_Int             num_procs, myid, owner, i, s;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   hypre_StructGridRedistribute(hypre_StructMatrixGrid(A), group_size, &grid);
+   boxes = hypre_StructGridBoxes(grid);
+
+   agglom_A = hypre_StructMatrixCreate(comm, grid, hypre_StructMatrixUserStencil(A));
+   hypre_StructMatrixSymmetric(agglom_A) = hypre_StructMatrixSymmetric(A);
+   hypre_StructMatrixSetConstantCoefficient(agglom_A, constant_coefficient);
+   hypre_StructMatrixSetNumGhost(agglom_A, hypre_StructMatrixNumGhost(A));
+   hypre_StructMatrixInitialize(agglom_A);
+   hypre_StructMatrixMigrate(A, agglom_A);
+
+   /* the constant coefficients are not migrated; they are the same on every
+      process that owns boxes of A, so send them from the first one */
+   if (constant_coefficient)
+   {
+      values = hypre_CTAlloc(HYPRE_Complex, stencil_size, HYPRE_MEMORY_HOST);
+      i = (hypre_StructGridNumBoxes(hypre_StructMatrixGrid(A)) > 0) ? myid : num_procs;
+      hypre_MPI_Allreduce(&i, &owner, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+      if (myid == owner)
+      {
+         for (s = 0; s < stencil_size; s++)
+         {
+            if ((constant_coefficient == 1) || !hypre_IndexEqual(stencil_shape[s], 0, ndim))
+            {
+               values[s] = *hypre_StructMatrixBoxData(A, 0, s);
+            }
+         }
+      }
+      hypre_MPI_Bcast(values, stencil_size, HYPRE_MPI_COMPLEX, owner, comm);
+      hypre_ForBoxI(i, boxes)
+      {
+         for (s = 0; s < stencil_size; s++)
+         {
+            if ((constant_coefficient == 1) || !hypre_IndexEqual(stencil_shape[s], 0, ndim))
+            {
+               *hypre_StructMatrixBoxData(agglom_A, i, s) = values[s];
+            }
+         }
+      }
+      hypre_TFree(values, HYPRE_MEMORY_HOST);
+   }
+
+   agglom_b = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(agglom_b, hypre_StructVectorNumGhost(b));
+   hypre_StructVectorInitialize(agglom_b);
+
+   agglom_x = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(agglom_x, hypre_StructVectorNumGhost(x));
+   hypre_StructVectorInitialize(agglom_x);
+
+   (pfmg_data -> agglom_A)     = agglom_A;
+   (pfmg_data -> agglom_b)     = agglom_b;
+   (pfmg_data -> agglom_x)     = agglom_x;
+   (pfmg_data -> agglom_b_pkg) = hypre_StructVectorGetMigrateCommPkg(b, agglom_b);
+   (pfmg_data -> agglom_x_pkg) = hypre_StructVectorGetMigrateCommPkg(agglom_x, x);
+
+   /*-----------------------------------------------------
+    * Only the processes that own boxes of the gathered grid
+    * set up (and later run) the nested solver
+    *-----------------------------------------------------*/
+
+   hypre_MPI_Comm_split(comm, (hypre_BoxArraySize(boxes) > 0) ? 0 : hypre_MPI_UNDEFINED,
+                        myid, &agglom_comm);
+   if (hypre_BoxArraySize(boxes) == 0)
+   {
+      hypre_StructGridDestroy(grid);
+      return hypre_error_flag;
+   }
+
+   /* same boxes and ghost layers as above, so the data layouts agree */
+   hypre_StructGridCreate(agglom_comm, ndim, &sub_grid);
+   hypre_StructGridSetPeriodic(sub_grid, hypre_StructGridPeriodic(grid));
+   hypre_AppendBoxArray(boxes, hypre_StructGridBoxes(sub_grid));
+   hypre_StructGridAssemble(sub_grid);
+   hypre_StructGridDestroy(grid);
+
+   sub_A = hypre_StructMatrixCreate(agglom_comm, sub_grid, hypre_StructMatrixUserStencil(A));
+   hypre_StructMatrixSymmetric(sub_A) = hypre_StructMatrixSymmetric(A);
+   hypre_StructMatrixSetConstantCoefficient(sub_A, constant_coefficient);
+   hypre_StructMatrixSetNumGhost(sub_A, hypre_StructMatrixNumGhost(A));
+   hypre_StructMatrixInitializeShell(sub_A);
+   hypre_StructMatrixInitializeData(sub_A, hypre_StructMatrixData(agglom_A),
+                                    hypre_StructMatrixDataConst(agglom_A));
+   hypre_StructMatrixAssemble(sub_A);
+
+   sub_b = hypre_StructVectorCreate(agglom_comm, sub_grid);
+   hypre_StructVectorSetNumGhost(sub_b, hypre_StructVectorNumGhost(b));
+   hypre_StructVectorInitializeShell(sub_b);
+   hypre_StructVectorInitializeData(sub_b, hypre_StructVectorData(agglom_b));
+   hypre_StructVectorAssemble(sub_b);
+
+   sub_x = hypre_StructVectorCreate(agglom_comm, sub_grid);
+   hypre_StructVectorSetNumGhost(sub_x, hypre_StructVectorNumGhost(x));
+   hypre_StructVectorInitializeShell(sub_x);
+   hypre_StructVectorInitializeData(sub_x, hypre_StructVectorData(agglom_x));
+   hypre_StructVectorAssemble(sub_x);
+
+   hypre_StructGridDestroy(sub_grid);
+
+   /* the nested solver inherits the relaxation and coarsening parameters */
+   agglom_data = hypre_PFMGCreate(agglom_comm);
+   hypre_PFMGSetTol(agglom_data, 0.0);
+   hypre_PFMGSetMaxIter(agglom_data, 1);
+   hypre_PFMGSetZeroGuess(agglom_data, 1);
+   hypre_PFMGSetMaxLevels(agglom_data, max_levels);
+   hypre_PFMGSetRelaxType(agglom_data, (pfmg_data -> relax_type));
+   if (pfmg_data -> usr_jacobi_weight)
+   {
+      hypre_PFMGSetJacobiWeight(agglom_data, (pfmg_data -> jacobi_weight));
+   }
+   hypre_PFMGSetRAPType(agglom_data, (pfmg_data -> rap_type));
+   hypre_PFMGSetNumPreRelax(agglom_data, (pfmg_data -> num_pre_relax));
+   hypre_PFMGSetNumPostRelax(agglom_data, (pfmg_data -> num_post_relax));
+   hypre_PFMGSetSkipRelax(agglom_data, (pfmg_data -> skip_relax));
+   hypre_PFMGSetFusedRelaxSweeps(agglom_data, (pfmg_data -> fused_relax_sweeps));
+   hypre_PFMGSetDxyz(agglom_data, (pfmg_data -> dxyz));
+   hypre_PFMGSetAgglomSize(agglom_data, (pfmg_data -> agglom_size));
+   hypre_PFMGSetMixedPrecision(agglom_data, (pfmg_data -> mixed_precision));
+   hypre_PFMGSetCompressCoarse(agglom_data, (pfmg_data -> compress_coarse));
+   hypre_PFMGSetup(agglom_data, sub_A, sub_b, sub_x);
+
+   (pfmg_data -> agglom_comm)  = agglom_comm;
+   (pfmg_data -> agglom_data)  = agglom_data;
+   (pfmg_data -> agglom_sub_A) = sub_A;
+   (pfmg_data -> agglom_sub_b) = sub_b;
+   (pfmg_data -> agglom_sub_x) = sub_x;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -72,6 +272,8 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             relax_type =       (pfmg_data -> relax_type);
    HYPRE_Int             usr_jacobi_weight = (pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
+   HYPRE_Int             fused_relax_sweeps = (pfmg_data -> fused_relax_sweeps);
+   HYPRE_Int             fused_sweeps;
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
    HYPRE_Int             rap_type;
@@ -125,6 +327,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             cdir, periodic, cmaxsize;
    HYPRE_Int             d, l;
    HYPRE_Int             dxyz_flag;
+   HYPRE_Int             agglom_group = 0;
 
    HYPRE_Int             b_num_ghost[]  = {0, 0, 0, 0, 0, 0};
    HYPRE_Int             x_num_ghost[]  = {1, 1, 1, 1, 1, 1};
@@ -291,6 +494,16 @@ hypre_PFMGSetup( void               *pfmg_vdata,
          }
       }
 
+      /* stop coarsening here and agglomerate if the grid has gotten small */
+      if ((cdir != -1) && (l > 0))
+      {
+         agglom_group = hypre_PFMGAgglomGroupSize(pfmg_data, hypre_BoxVolume(cbox));
+         if (agglom_group > 0)
+         {
+            cdir = -1;
+         }
+      }
+
       /* stop coarsening */
       if (cdir == -1)
       {
@@ -440,9 +653,18 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
       A_l[l + 1] = hypre_PFMGCreateRAPOp(RT_l[l], A_l[l], P_l[l],
                                          grid_l[l + 1], cdir, rap_type);
-      hypre_StructMatrixInitializeShell(A_l[l + 1]);
-      data_size += hypre_StructMatrixDataSize(A_l[l + 1]);
-      data_size_const += hypre_StructMatrixDataConstSize(A_l[l + 1]);
+      if ((pfmg_data -> mixed_precision) || (pfmg_data -> compress_coarse))
+      {
+         /* separate data, which can be freed or compressed once the setup
+            is done (see below) */
+         hypre_StructMatrixInitialize(A_l[l + 1]);
+      }
+      else
+      {
+         hypre_StructMatrixInitializeShell(A_l[l + 1]);
+         data_size += hypre_StructMatrixDataSize(A_l[l + 1]);
+         data_size_const += hypre_StructMatrixDataConstSize(A_l[l + 1]);
+      }
 
       b_l[l + 1] = hypre_StructVectorCreate(comm, grid_l[l + 1]);
       hypre_StructVectorSetNumGhost(b_l[l + 1], b_num_ghost);
@@ -517,9 +739,12 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       }
 #endif
 
-      hypre_StructMatrixInitializeData(A_l[l + 1], data, data_const);
-      data += hypre_StructMatrixDataSize(A_l[l + 1]);
-      data_const += hypre_StructMatrixDataConstSize(A_l[l + 1]);
+      if (!(pfmg_data -> mixed_precision) && !(pfmg_data -> compress_coarse))
+      {
+         hypre_StructMatrixInitializeData(A_l[l + 1], data, data_const);
+         data += hypre_StructMatrixDataSize(A_l[l + 1]);
+         data_const += hypre_StructMatrixDataConstSize(A_l[l + 1]);
+      }
 
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
       if (data_location != HYPRE_MEMORY_HOST)
@@ -624,6 +849,10 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       restrict_data_l[l] = hypre_SemiRestrictCreate();
       hypre_SemiRestrictSetup(restrict_data_l[l], RT_l[l], 1, r_l[l], b_l[l + 1],
                               cindex, findex, stride);
+      if (hypre_PFMGFuseResidualRestrict(A_l[l]))
+      {
+         hypre_SemiRestrictResidualSetup(restrict_data_l[l], A_l[l], x_l[l]);
+      }
    }
 
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -648,6 +877,12 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       active_l[l] = 0;
    }
 
+   /* the agglomerated solver replaces relaxation on the coarsest grid */
+   if (agglom_group > 0)
+   {
+      active_l[l] = 0;
+   }
+
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    if (hypre_StructGridDataLocation(grid) != HYPRE_MEMORY_HOST)
    {
@@ -666,7 +901,20 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGRelaxSetJacobiWeight(relax_data_l[0], relax_weights[0]);
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
+   if (num_levels > 1)
+   {
+      hypre_PFMGRelaxSetLineDirection(relax_data_l[0], cdir_l[0]);
+   }
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
+   /* with one sweep per relaxation call there is nothing to fuse, except on
+      the coarsest grid, which does more sweeps (see below) */
+   fused_sweeps = fused_relax_sweeps;
+   if ((pfmg_data -> num_pre_relax) < 2 && (pfmg_data -> num_post_relax) < 2)
+   {
+      fused_sweeps = 1;
+   }
+   hypre_PFMGRelaxSetFusedSweeps(relax_data_l[0],
+                                 (num_levels > 1) ? fused_sweeps : fused_relax_sweeps);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
    {
@@ -686,7 +934,13 @@ hypre_PFMGSetup( void               *pfmg_vdata,
                hypre_PFMGRelaxSetJacobiWeight(relax_data_l[l], relax_weights[l]);
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
+            if (l < (num_levels - 1))
+            {
+               hypre_PFMGRelaxSetLineDirection(relax_data_l[l], cdir_l[l]);
+            }
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
+            hypre_PFMGRelaxSetFusedSweeps(relax_data_l[l], (l < (num_levels - 1)) ?
+                                          fused_sweeps : fused_relax_sweeps);
          }
       }
 
@@ -724,9 +978,62 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       /* set up the residual routine */
       matvec_data_l[l] = hypre_StructMatvecCreate();
       hypre_StructMatvecSetup(matvec_data_l[l], A_l[l], x_l[l]);
+
+      /* store the boxes of the coarse operators with constant off-diagonal
+         coefficients compressed, now that the next level is set up; only
+         the point relaxation and the residual read them afterwards (the
+         agglomerated coarsest operator is migrated as is, see below) */
+      if ((pfmg_data -> compress_coarse) && l > 0 && (relax_type == 0 || relax_type == 1) &&
+          !(agglom_group > 0 && l == (num_levels - 1)))
+      {
+         hypre_StructMatrixCompressConstant(A_l[l]);
+      }
+
+      /* single-precision coefficients for the relaxation and residual */
+      if (pfmg_data -> mixed_precision)
+      {
+         hypre_StructMatrixCreateDataFloat(A_l[l]);
+         hypre_StructMatvecSetDataFloat(matvec_data_l[l], 1);
+         if (active_l[l])
+         {
+            hypre_PFMGRelaxSetDataFloat(relax_data_l[l], 1);
+         }
+         if (l < (num_levels - 1))
+         {
+            hypre_SemiRestrictSetDataFloat(restrict_data_l[l], 1);
+         }
+      }
    }
 
    (pfmg_data -> active_l)        = active_l;
+
+   /*-----------------------------------------------------
+    * Set up the solver for the agglomerated coarse grid
+    *-----------------------------------------------------*/
+
+   if (agglom_group > 0)
+   {
+      hypre_PFMGSetupAgglom(pfmg_data, agglom_group, max_levels - num_levels + 1);
+   }
+
+   /*-----------------------------------------------------
+    * With mixed precision, free the HYPRE_Complex coefficients
+    * of the coarse matrices that are only read in single precision
+    * (Jacobi relaxation and the stencil-specialized residual)
+    *-----------------------------------------------------*/
+
+   if ((pfmg_data -> mixed_precision) && (relax_type == 0 || relax_type == 1) &&
+       fused_relax_sweeps <= 1)
+   {
+      for (l = 1; l < num_levels; l++)
+      {
+         if (hypre_StructMatvecUsesDataFloat(matvec_data_l[l]) &&
+             !(l == (num_levels - 1) && agglom_group > 0))
+         {
+            hypre_StructMatrixDropData(A_l[l]);
+         }
+      }
+   }
    (pfmg_data -> relax_data_l)    = relax_data_l;
    (pfmg_data -> matvec_data_l)   = matvec_data_l;
    (pfmg_data -> restrict_data_l) = restrict_data_l;
@@ -63,6 +63,7 @@ hypre_PFMGSolve( void               *pfmg_vdata,
 
    HYPRE_Int             i, l;
    HYPRE_Int             constant_coefficient;
+   HYPRE_Int             fuse_residual;
 
 #if DEBUG
    char                  filename[255];
@@ -149,10 +150,16 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       hypre_PFMGRelax(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
       zero_guess = 0;
 
-      /* compute fine grid residual (b - Ax) */
-      hypre_StructCopy(b_l[0], r_l[0]);
-      hypre_StructMatvecCompute(matvec_data_l[0],
-                                -1.0, A_l[0], x_l[0], 1.0, r_l[0]);
+      /* compute fine grid residual (b - Ax), unless it can be fused with
+         restriction below (the convergence check needs all of r) */
+      fuse_residual = (hypre_PFMGFuseResidualRestrict(A) && !(tol > 0.0) &&
+                       (num_levels > 1));
+      if (!fuse_residual)
+      {
+         hypre_StructCopy(b_l[0], r_l[0]);
+         hypre_StructMatvecCompute(matvec_data_l[0],
+                                   -1.0, A_l[0], x_l[0], 1.0, r_l[0]);
+      }
 
       /* convergence check */
       if (tol > 0.0)
@@ -186,7 +193,15 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       if (num_levels > 1)
       {
          /* restrict fine grid residual */
-         hypre_SemiRestrict(restrict_data_l[0], RT_l[0], r_l[0], b_l[1]);
+         if (fuse_residual)
+         {
+            hypre_SemiRestrictResidual(restrict_data_l[0], RT_l[0], A_l[0],
+                                       x_l[0], b_l[0], r_l[0], b_l[1]);
+         }
+         else
+         {
+            hypre_SemiRestrict(restrict_data_l[0], RT_l[0], r_l[0], b_l[1]);
+         }
 #if DEBUG
          hypre_sprintf(filename, "zout_xdown.%02d", 0);
          hypre_StructVectorPrint(filename, x_l[0], 0);
@@ -220,20 +235,32 @@ hypre_PFMGSolve( void               *pfmg_vdata,
                hypre_PFMGRelaxSetZeroGuess(relax_data_l[l], 1);
                hypre_PFMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
 
-               /* compute residual (b - Ax) */
-               hypre_StructCopy(b_l[l], r_l[l]);
-               hypre_StructMatvecCompute(matvec_data_l[l],
-                                         -1.0, A_l[l], x_l[l], 1.0, r_l[l]);
+               if (hypre_PFMGFuseResidualRestrict(A_l[l]))
+               {
+                  /* compute and restrict residual (b - Ax) in one pass */
+                  hypre_SemiRestrictResidual(restrict_data_l[l], RT_l[l], A_l[l],
+                                             x_l[l], b_l[l], r_l[l], b_l[l + 1]);
+               }
+               else
+               {
+                  /* compute residual (b - Ax) */
+                  hypre_StructCopy(b_l[l], r_l[l]);
+                  hypre_StructMatvecCompute(matvec_data_l[l],
+                                            -1.0, A_l[l], x_l[l], 1.0, r_l[l]);
+
+                  /* restrict residual */
+                  hypre_SemiRestrict(restrict_data_l[l], RT_l[l], r_l[l], b_l[l + 1]);
+               }
             }
             else
             {
                /* inactive level, set x=0, so r=(b-Ax)=b */
                hypre_StructVectorSetConstantValues(x_l[l], 0.0);
                hypre_StructCopy(b_l[l], r_l[l]);
-            }
 
-            /* restrict residual */
-            hypre_SemiRestrict(restrict_data_l[l], RT_l[l], r_l[l], b_l[l + 1]);
+               /* restrict residual */
+               hypre_SemiRestrict(restrict_data_l[l], RT_l[l], r_l[l], b_l[l + 1]);
+            }
 #if DEBUG
             hypre_printf("Level %d: b_l = %.30e\n", l + 1, hypre_StructInnerProd(b_l[l + 1], b_l[l + 1]));
             hypre_sprintf(filename, "zout_xdown.%02d", l);
@@ -252,7 +279,21 @@ hypre_PFMGSolve( void               *pfmg_vdata,
           *--------------------------------------------------*/
          HYPRE_ANNOTATE_MGLEVEL_BEGIN(num_levels - 1);
 
-         if (active_l[l])
+         if (pfmg_data -> agglom_A)
+         {
+            /* solve on the agglomerated coarse grid (only the processes
+               that own part of it take part) */
+            hypre_StructVectorMigrate(pfmg_data -> agglom_b_pkg,
+                                      b_l[l], pfmg_data -> agglom_b);
+            if (pfmg_data -> agglom_data)
+            {
+               hypre_PFMGSolve(pfmg_data -> agglom_data, pfmg_data -> agglom_sub_A,
+                               pfmg_data -> agglom_sub_b, pfmg_data -> agglom_sub_x);
+            }
+            hypre_StructVectorMigrate(pfmg_data -> agglom_x_pkg,
+                                      pfmg_data -> agglom_x, x_l[l]);
+         }
+         else if (active_l[l])
          {
             hypre_PFMGRelaxSetZeroGuess(relax_data_l[l], 1);
             hypre_PFMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
@@ -284,8 +325,7 @@ hypre_PFMGSolve( void               *pfmg_vdata,
                hypre_StructVectorClearAllValues(e_l[l]);
             }
             /* interpolate error and correct (x = x + Pe_c) */
-            hypre_SemiInterp(interp_data_l[l], P_l[l], x_l[l + 1], e_l[l]);
-            hypre_StructAxpy(1.0, e_l[l], x_l[l]);
+            hypre_SemiInterpCorrect(interp_data_l[l], P_l[l], x_l[l + 1], e_l[l], x_l[l]);
             HYPRE_ANNOTATE_MGLEVEL_END(l + 1);
 #if DEBUG
             hypre_sprintf(filename, "zout_eup.%02d", l);
@@ -315,9 +355,17 @@ hypre_PFMGSolve( void               *pfmg_vdata,
          {
             hypre_StructVectorClearAllValues(e_l[0]);
          }
-         /* interpolate error and correct on fine grid (x = x + Pe_c) */
-         hypre_SemiInterp(interp_data_l[0], P_l[0], x_l[1], e_l[0]);
-         hypre_StructAxpy(1.0, e_l[0], x_l[0]);
+         /* interpolate error and correct on fine grid (x = x + Pe_c); the
+            relative change check below needs all of e */
+         if ((tol > 0.0) && (rel_change))
+         {
+            hypre_SemiInterp(interp_data_l[0], P_l[0], x_l[1], e_l[0]);
+            hypre_StructAxpy(1.0, e_l[0], x_l[0]);
+         }
+         else
+         {
+            hypre_SemiInterpCorrect(interp_data_l[0], P_l[0], x_l[1], e_l[0], x_l[0]);
+         }
          HYPRE_ANNOTATE_MGLEVEL_END(1);
 #if DEBUG
          hypre_printf("Level 0: x_l = %.15e\n", hypre_StructInnerProd(x_l[0], x_l[0]));
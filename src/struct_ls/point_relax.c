@@ -40,9 +40,21 @@ typedef struct
    hypre_StructVector     *t;
 
    HYPRE_Int               diag_rank;
+   HYPRE_Int              *symm_pairs;     /* see hypre_StructMatrixGetSymmPairs */
+   HYPRE_Int               num_symm_pairs;
+   HYPRE_Int               data_float;     /* read A from its single-precision copy */
 
    hypre_ComputePkg      **compute_pkgs;
 
+   /* fused sweeps (temporal blocking), see hypre_PointRelaxFusedSetup */
+   HYPRE_Int               fused_sweeps;
+   hypre_StructMatrix     *A_f;
+   hypre_StructVector     *b_f;
+   hypre_StructVector     *x_f;
+   hypre_StructVector     *t_f;
+   hypre_CommPkg          *comm_pkg_f;
+   hypre_BoxArrayArray    *fused_boxes;
+
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
    HYPRE_Int               time_index;
@@ -83,6 +95,14 @@ hypre_PointRelaxCreate( MPI_Comm  comm )
    (relax_data -> x)                = NULL;
    (relax_data -> t)                = NULL;
    (relax_data -> compute_pkgs)     = NULL;
+   (relax_data -> fused_sweeps)     = 1;
+   (relax_data -> data_float)       = 0;
+   (relax_data -> A_f)              = NULL;
+   (relax_data -> b_f)              = NULL;
+   (relax_data -> x_f)              = NULL;
+   (relax_data -> t_f)              = NULL;
+   (relax_data -> comm_pkg_f)       = NULL;
+   (relax_data -> fused_boxes)      = NULL;
 
    hypre_SetIndex3(stride, 1, 1, 1);
    hypre_SetIndex3(indices[0], 0, 0, 0);
@@ -123,6 +143,8 @@ hypre_PointRelaxDestroy( void *relax_vdata )
       hypre_StructVectorDestroy(relax_data -> x);
       hypre_StructVectorDestroy(relax_data -> t);
       hypre_TFree(relax_data -> compute_pkgs, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> symm_pairs, HYPRE_MEMORY_HOST);
+      hypre_PointRelaxFusedDestroy(relax_data);
 
       hypre_FinalizeTiming(relax_data -> time_index);
       hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
@@ -149,6 +171,8 @@ hypre_PointRelaxSetup( void               *relax_vdata,
    HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
    hypre_StructVector    *t;
    HYPRE_Int              diag_rank;
+   HYPRE_Int             *symm_pairs;
+   HYPRE_Int              num_symm_pairs;
    hypre_ComputeInfo     *compute_info;
    hypre_ComputePkg     **compute_pkgs;
 
@@ -199,6 +223,14 @@ hypre_PointRelaxSetup( void               *relax_vdata,
    hypre_SetIndex3(diag_index, 0, 0, 0);
    diag_rank = hypre_StructStencilElementRank(stencil, diag_index);
 
+   /* with symmetric storage, pair the stored entries with their transposes */
+   symm_pairs = hypre_TAlloc(HYPRE_Int, hypre_StructStencilSize(stencil), HYPRE_MEMORY_HOST);
+   hypre_StructMatrixGetSymmPairs(A, symm_pairs, &num_symm_pairs);
+   if ((diag_rank < 0) || (2 * num_symm_pairs + 1) != hypre_StructStencilSize(stencil))
+   {
+      num_symm_pairs = 0;
+   }
+
    /*----------------------------------------------------------
     * Set up the compute packages
     *----------------------------------------------------------*/
@@ -282,6 +314,9 @@ hypre_PointRelaxSetup( void               *relax_vdata,
    (relax_data -> x) = hypre_StructVectorRef(x);
    (relax_data -> b) = hypre_StructVectorRef(b);
    (relax_data -> diag_rank)    = diag_rank;
+   hypre_TFree(relax_data -> symm_pairs, HYPRE_MEMORY_HOST);
+   (relax_data -> symm_pairs)     = symm_pairs;
+   (relax_data -> num_symm_pairs) = num_symm_pairs;
    (relax_data -> compute_pkgs) = compute_pkgs;
 
    /*-----------------------------------------------------
@@ -300,6 +335,15 @@ hypre_PointRelaxSetup( void               *relax_vdata,
    (relax_data -> flops) = (HYPRE_BigInt)scale * (hypre_StructMatrixGlobalSize(A) +
                                                   hypre_StructVectorGlobalSize(x));
 
+   /*----------------------------------------------------------
+    * Set up the fused sweeps, if requested and applicable
+    *----------------------------------------------------------*/
+
+   if ((relax_data -> fused_sweeps) > 1)
+   {
+      hypre_PointRelaxFusedSetup(relax_vdata, A, b, x);
+   }
+
    return hypre_error_flag;
 }
 
@@ -386,6 +430,18 @@ hypre_PointRelax( void               *relax_vdata,
       return hypre_error_flag;
    }
 
+   /* fused sweeps: one exchange and one pass over the data per fused_sweeps
+      sweeps (no convergence testing) */
+   if ((relax_data -> A_f) != NULL && tol == 0.0 && max_iter > 1)
+   {
+      hypre_PointRelaxFused(relax_vdata, b, x);
+
+      (relax_data -> num_iterations) = max_iter;
+      hypre_IncFLOPCount(relax_data -> flops);
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
    if (constant_coefficient) { hypre_StructVectorClearBoundGhostValues(x, 0); }
 
@@ -472,6 +528,22 @@ hypre_PointRelax( void               *relax_vdata,
                   hypre_BoxLoop2End(bi, xi);
 #undef DEVICE_VAR
                }
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_DEVICE_OPENMP)
+               else if ( constant_coefficient == 0 && (relax_data -> data_float) &&
+                         hypre_StructMatrixDataFloat(A) != NULL )
+               {
+                  float *Fp = hypre_StructMatrixBoxDataFloat(A, i, diag_rank);
+
+                  hypre_BoxLoop3Begin(hypre_StructVectorNDim(x), loop_size,
+                                      A_data_box, start, stride, Ai,
+                                      b_data_box, start, stride, bi,
+                                      x_data_box, start, stride, xi);
+                  {
+                     xp[xi] = bp[bi] / (HYPRE_Real) Fp[Ai];
+                  }
+                  hypre_BoxLoop3End(Ai, bi, xi);
+               }
+#endif
                /* constant_coefficent 0 (variable) or 2 (variable diagonal
                   only) are the same for the diagonal */
                else
@@ -527,7 +599,7 @@ hypre_PointRelax( void               *relax_vdata,
       /*hypre_StructCopy(x, t); ... not needed as long as the copy at the end of the loop
         is restricted to the current pointset (hypre_relax_copy, hypre_relax_wtx */
 
-      for (compute_i = 0; compute_i < 2; compute_i++)
+      for (compute_i = 0; ; compute_i++)
       {
          switch (compute_i)
          {
@@ -539,14 +611,18 @@ hypre_PointRelax( void               *relax_vdata,
             }
             break;
 
-            case 1:
+            default:
             {
-               hypre_FinalizeIndtComputations(comm_handle);
-               compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+               hypre_NextDeptComputations(compute_pkg, &comm_handle, &compute_box_aa);
             }
             break;
          }
 
+         if (compute_box_aa == NULL)
+         {
+            break;
+         }
+
          hypre_ForBoxArrayI(i, compute_box_aa)
          {
             compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -578,6 +654,17 @@ hypre_PointRelax( void               *relax_vdata,
                   );
                }
 
+               else if ( hypre_StructMatrixBoxConstant(A, i) )
+               {
+                  /* compressed box, stored as for constant_coefficient 2 */
+                  hypre_PointRelax_core12(
+                     relax_vdata, A, 2,
+                     compute_box, bp, xp, tp, i,
+                     A_data_box, b_data_box, x_data_box, t_data_box,
+                     stride
+                  );
+               }
+
                else
                {
                   hypre_PointRelax_core0(
@@ -590,6 +677,24 @@ hypre_PointRelax( void               *relax_vdata,
 
                Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
 
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_DEVICE_OPENMP)
+               if ( constant_coefficient == 0 && (relax_data -> data_float) &&
+                    hypre_StructMatrixDataFloat(A) != NULL )
+               {
+                  float *Fp = hypre_StructMatrixBoxDataFloat(A, i, diag_rank);
+
+                  start  = hypre_BoxIMin(compute_box);
+                  hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+                  hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                                      A_data_box, start, stride, Ai,
+                                      t_data_box, start, stride, ti);
+                  {
+                     tp[ti] /= (HYPRE_Real) Fp[Ai];
+                  }
+                  hypre_BoxLoop2End(Ai, ti);
+               }
+               else
+#endif
                if ( constant_coefficient == 0 || constant_coefficient == 2 )
                   /* divide by the variable diagonal */
                {
@@ -697,9 +802,13 @@ hypre_PointRelax_core0( void               *relax_vdata,
    HYPRE_Int              stencil_size;
 
    HYPRE_Int              diag_rank        = (relax_data -> diag_rank);
+   HYPRE_Int             *symm_pairs       = (relax_data -> symm_pairs);
+   HYPRE_Int              num_symm_pairs   = (relax_data -> num_symm_pairs);
+   HYPRE_Int              data_float       = (relax_data -> data_float);
    hypre_IndexRef         start;
    hypre_Index            loop_size;
    HYPRE_Int              si, sk, ssi[MAX_DEPTH], depth, k;
+   HYPRE_Int              num_entries, step;
 
    stencil       = hypre_StructMatrixStencil(A);
    stencil_shape = hypre_StructStencilShape(stencil);
@@ -718,24 +827,81 @@ hypre_PointRelax_core0( void               *relax_vdata,
    hypre_BoxLoop2End(bi, ti);
 #undef DEVICE_VAR
 
+   /* With symmetric storage, the off-diagonal entries are visited as pairs of
+      a stored entry and its transpose, (MAX_DEPTH-1)/2 pairs per pass, so
+      that both uses of the stored coefficients are in the same pass */
+   if (num_symm_pairs > 0)
+   {
+      num_entries = 2 * num_symm_pairs;
+      step = MAX_DEPTH - 1;
+   }
+   else
+   {
+      num_entries = stencil_size;
+      step = MAX_DEPTH;
+   }
+
    /* unroll up to depth MAX_DEPTH */
-   for (si = 0; si < stencil_size; si += MAX_DEPTH)
+   for (si = 0; si < num_entries; si += step)
    {
-      depth = hypre_min(MAX_DEPTH, (stencil_size - si));
+      depth = hypre_min(step, (num_entries - si));
 
-      for (k = 0, sk = si; k < depth; sk++)
+      if (num_symm_pairs > 0)
       {
-         if (sk == diag_rank)
+         for (k = 0; k < depth; k++)
          {
-            depth--;
+            ssi[k] = symm_pairs[si + k];
          }
-         else
+      }
+      else
+      {
+         for (k = 0, sk = si; k < depth; sk++)
          {
-            ssi[k] = sk;
-            k++;
+            if (sk == diag_rank)
+            {
+               depth--;
+            }
+            else
+            {
+               ssi[k] = sk;
+               k++;
+            }
          }
       }
 
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_DEVICE_OPENMP)
+      /* single-precision coefficients, accumulated in HYPRE_Real */
+      if (data_float && hypre_StructMatrixDataFloat(A) != NULL)
+      {
+         float      *Fp[MAX_DEPTH];
+         HYPRE_Int   xoff[MAX_DEPTH];
+
+         for (k = 0; k < depth; k++)
+         {
+            Fp[k]   = hypre_StructMatrixBoxDataFloat(A, boxarray_id, ssi[k]);
+            xoff[k] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[ssi[k]]);
+         }
+
+         hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
+                             A_data_box, start, stride, Ai,
+                             x_data_box, start, stride, xi,
+                             t_data_box, start, stride, ti);
+         {
+            HYPRE_Real  sum = 0.0;
+            HYPRE_Int   kk;
+
+            for (kk = 0; kk < depth; kk++)
+            {
+               sum += (HYPRE_Real) Fp[kk][Ai] * xp[xi + xoff[kk]];
+            }
+            tp[ti] -= sum;
+         }
+         hypre_BoxLoop3End(Ai, xi, ti);
+
+         continue;
+      }
+#endif
+
       switch (depth)
       {
          case 7:
@@ -1202,6 +1368,711 @@ hypre_PointRelax_core12( void               *relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Fused sweeps (temporal blocking)
+ *
+ * With fused_sweeps = k > 1, Jacobi and weighted Jacobi do k sweeps per
+ * ghost exchange.  The setup makes copies of A, b, x, and t with k ghost
+ * layers and the ghost layers of A are filled once.  Each pass copies the
+ * grid points of x (and of b on the first pass) and exchanges the k ghost
+ * layers of x and b together, then sweep s (s = 1,...,k) updates each box
+ * grown by k-s layers, so that the points of the neighboring boxes in the
+ * ghost layers are recomputed redundantly instead of being communicated.
+ * The last sweep writes to x.  Ghost points outside of the grid are not
+ * updated.  The sweeps of one pass are
+ * done as a wavefront over the planes of the box (in the last dimension):
+ * sweep s works on plane z while sweep s-1 works on plane z+1, so that only
+ * a few planes of A, b, x, and t are touched at a time and stay in cache.
+ *
+ * This is only used with a single pointset of unit stride (Jacobi), for
+ * constant_coefficient = 0, stencils within distance one, and no
+ * convergence testing (tol = 0).  It assumes that stencil couplings to
+ * points outside of the grid are zero.
+ *--------------------------------------------------------------------------*/
+
+/* length of the row chunks in the fused sweeps */
+#define HYPRE_POINT_RELAX_FUSED_CHUNK 256
+
+HYPRE_Int
+hypre_PointRelaxFusedDestroy( void *relax_vdata )
+{
+   hypre_PointRelaxData *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   hypre_StructMatrixDestroy(relax_data -> A_f);
+   hypre_StructVectorDestroy(relax_data -> b_f);
+   hypre_StructVectorDestroy(relax_data -> x_f);
+   hypre_StructVectorDestroy(relax_data -> t_f);
+   hypre_CommPkgDestroy(relax_data -> comm_pkg_f);
+   hypre_BoxArrayArrayDestroy(relax_data -> fused_boxes);
+   (relax_data -> A_f)         = NULL;
+   (relax_data -> b_f)         = NULL;
+   (relax_data -> x_f)         = NULL;
+   (relax_data -> t_f)         = NULL;
+   (relax_data -> comm_pkg_f)  = NULL;
+   (relax_data -> fused_boxes) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PointRelaxFusedSetup
+ *
+ * Sets up the data for the fused sweeps if they apply.  Otherwise nothing is
+ * set up and hypre_PointRelax does one exchange per sweep as usual.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxFusedSetup( void               *relax_vdata,
+                            hypre_StructMatrix *A,
+                            hypre_StructVector *b,
+                            hypre_StructVector *x )
+{
+   hypre_PointRelaxData  *relax_data   = (hypre_PointRelaxData *)relax_vdata;
+   HYPRE_Int              k            = (relax_data -> fused_sweeps);
+   HYPRE_Int              ndim         = hypre_StructMatrixNDim(A);
+   MPI_Comm               comm         = hypre_StructMatrixComm(A);
+   hypre_StructGrid      *grid         = hypre_StructMatrixGrid(A);
+   hypre_BoxArray        *grid_boxes   = hypre_StructGridBoxes(grid);
+   hypre_BoxManager      *boxman       = hypre_StructGridBoxMan(grid);
+   hypre_IndexRef         periodic     = hypre_StructGridPeriodic(grid);
+   hypre_IndexRef         max_distance = hypre_StructGridMaxDistance(grid);
+   hypre_StructStencil   *stencil      = hypre_StructMatrixStencil(A);
+   hypre_Index           *shape        = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size = hypre_StructStencilSize(stencil);
+   HYPRE_Int             *symm_elements;
+
+   hypre_StructMatrix    *A_f;
+   hypre_StructVector    *vecs[3];
+   hypre_CommInfo        *comm_info;
+   hypre_BoxArrayArray   *fused_boxes;
+   hypre_BoxArray        *fused_box_a;
+   hypre_BoxManEntry    **entries;
+   hypre_Box             *grow_box, *shift_box, *entry_box;
+   hypre_Box             *A_data_box, *Af_data_box;
+   HYPRE_Real            *Ap, *Afp;
+   HYPRE_Complex         *fused_data;
+   hypre_IndexRef         start;
+   hypre_Index            loop_size, unit_stride;
+   HYPRE_Int              num_ghost[2 * HYPRE_MAXDIM];
+   HYPRE_Int              num_entries, ei, i, d, p, si, v, data_size;
+
+   hypre_PointRelaxFusedDestroy(relax_vdata);
+
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_RAJA) || defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return hypre_error_flag;
+#endif
+
+   /* Jacobi on all points with a variable coefficient compact stencil */
+   if ( hypre_StructMatrixConstantCoefficient(A) != 0 ||
+        (relax_data -> num_pointsets) != 1 ||
+        (relax_data -> pointset_sizes)[0] != 1 ||
+        !hypre_IndexEqual((relax_data -> pointset_strides)[0], 1, ndim) ||
+        !hypre_IndexEqual((relax_data -> pointset_indices)[0][0], 0, ndim) ||
+        stencil_size > 27 )
+   {
+      return hypre_error_flag;
+   }
+   for (si = 0; si < stencil_size; si++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_abs(hypre_IndexD(shape[si], d)) > 1)
+         {
+            return hypre_error_flag;
+         }
+      }
+   }
+
+   /* the neighbor information of the grid and the periodic images must
+      cover the k ghost layers */
+   for (d = 0; d < ndim; d++)
+   {
+      if (hypre_IndexD(max_distance, d) > 0)
+      {
+         k = hypre_min(k, hypre_IndexD(max_distance, d));
+      }
+      if (hypre_IndexD(periodic, d) > 0)
+      {
+         k = hypre_min(k, hypre_IndexD(periodic, d));
+      }
+   }
+   if (k < 2)
+   {
+      return hypre_error_flag;
+   }
+
+   for (d = 0; d < 2 * HYPRE_MAXDIM; d++)
+   {
+      num_ghost[d] = (d < 2 * ndim) ? k : 0;
+   }
+   hypre_SetIndex(unit_stride, 1);
+
+   /*----------------------------------------------------------
+    * Copy A into a matrix with k ghost layers and exchange them
+    *----------------------------------------------------------*/
+
+   A_f = hypre_StructMatrixCreate(comm, grid, hypre_StructMatrixUserStencil(A));
+   hypre_StructMatrixSymmetric(A_f) = hypre_StructMatrixSymmetric(A);
+   hypre_StructMatrixSetNumGhost(A_f, num_ghost);
+   hypre_StructMatrixInitialize(A_f);
+
+   symm_elements = hypre_StructMatrixSymmElements(A);
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      start = hypre_BoxIMin(hypre_BoxArrayBox(grid_boxes, i));
+      hypre_BoxGetSize(hypre_BoxArrayBox(grid_boxes, i), loop_size);
+      A_data_box  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      Af_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A_f), i);
+
+      /* only the stored entries (symmetric storage) */
+      for (si = 0; si < stencil_size; si++)
+      {
+         if (symm_elements[si] < 0)
+         {
+            Ap  = hypre_StructMatrixBoxData(A, i, si);
+            Afp = hypre_StructMatrixBoxData(A_f, i, si);
+
+#define DEVICE_VAR is_device_ptr(Afp,Ap)
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                A_data_box, start, unit_stride, Ai,
+                                Af_data_box, start, unit_stride, Afi);
+            {
+               Afp[Afi] = Ap[Ai];
+            }
+            hypre_BoxLoop2End(Ai, Afi);
+#undef DEVICE_VAR
+         }
+      }
+   }
+   hypre_StructMatrixAssemble(A_f);
+
+   /*----------------------------------------------------------
+    * Vectors with k ghost layers and their exchange.  x_f and b_f
+    * share one array, with the x_f and b_f data of each box next to
+    * each other, so that one exchange with two values per point
+    * fills the ghost layers of both.  t_f is zero outside of the
+    * points updated by the sweeps and is never copied to.
+    *----------------------------------------------------------*/
+
+   for (v = 0; v < 3; v++)
+   {
+      vecs[v] = hypre_StructVectorCreate(comm, grid);
+      hypre_StructVectorSetNumGhost(vecs[v], num_ghost);
+   }
+   hypre_StructVectorInitialize(vecs[2]);
+   hypre_StructVectorAssemble(vecs[2]);
+
+   hypre_StructVectorInitializeShell(vecs[0]);
+   hypre_StructVectorInitializeShell(vecs[1]);
+   data_size = hypre_StructVectorDataSize(vecs[0]);
+   fused_data = hypre_CTAlloc(HYPRE_Complex, 2 * data_size, HYPRE_MEMORY_DEVICE);
+   hypre_StructVectorInitializeData(vecs[0], fused_data);
+   hypre_StructVectorInitializeData(vecs[1], fused_data);
+   hypre_StructVectorDataAlloced(vecs[1]) = 1;
+   hypre_ForBoxI(i, hypre_StructVectorDataSpace(vecs[0]))
+   {
+      /* box i: x_f data, then b_f data */
+      hypre_StructVectorDataIndices(vecs[1])[i] *= 2;
+      hypre_StructVectorDataIndices(vecs[0])[i] = hypre_StructVectorDataIndices(vecs[1])[i] +
+                                                  hypre_BoxVolume(hypre_BoxArrayBox(
+                                                                     hypre_StructVectorDataSpace(vecs[0]), i));
+   }
+   hypre_StructVectorAssemble(vecs[0]);
+   hypre_StructVectorAssemble(vecs[1]);
+
+   hypre_CreateCommInfoFromNumGhost(grid, num_ghost, &comm_info);
+   hypre_CommPkgCreate(comm_info,
+                       hypre_StructVectorDataSpace(vecs[1]),
+                       hypre_StructVectorDataSpace(vecs[1]),
+                       2, NULL, 0, comm, &(relax_data -> comm_pkg_f));
+   hypre_CommInfoDestroy(comm_info);
+
+   /*----------------------------------------------------------
+    * For each box, the parts of the grid (including periodic
+    * images) in the box grown by k, i.e., the points to update
+    *----------------------------------------------------------*/
+
+   fused_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(grid_boxes), ndim);
+   grow_box  = hypre_BoxCreate(ndim);
+   shift_box = hypre_BoxCreate(ndim);
+   entry_box = hypre_BoxCreate(ndim);
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      fused_box_a = hypre_BoxArrayArrayBoxArray(fused_boxes, i);
+      hypre_CopyBox(hypre_BoxArrayBox(grid_boxes, i), grow_box);
+      hypre_BoxGrowByValue(grow_box, k);
+
+      for (p = 0; p < hypre_StructGridNumPeriods(grid); p++)
+      {
+         hypre_CopyBox(grow_box, shift_box);
+         hypre_BoxShiftPos(shift_box, hypre_StructGridPShift(grid, p));
+
+         hypre_BoxManIntersect(boxman, hypre_BoxIMin(shift_box),
+                               hypre_BoxIMax(shift_box), &entries, &num_entries);
+         for (ei = 0; ei < num_entries; ei++)
+         {
+            hypre_BoxManEntryGetExtents(entries[ei], hypre_BoxIMin(entry_box),
+                                        hypre_BoxIMax(entry_box));
+            hypre_IntersectBoxes(entry_box, shift_box, entry_box);
+            if (hypre_BoxVolume(entry_box) > 0)
+            {
+               hypre_BoxShiftNeg(entry_box, hypre_StructGridPShift(grid, p));
+               hypre_AppendBox(entry_box, fused_box_a);
+            }
+         }
+         hypre_TFree(entries, HYPRE_MEMORY_HOST);
+      }
+   }
+   hypre_BoxDestroy(grow_box);
+   hypre_BoxDestroy(shift_box);
+   hypre_BoxDestroy(entry_box);
+
+   (relax_data -> fused_sweeps) = k;
+   (relax_data -> A_f)          = A_f;
+   (relax_data -> b_f)          = vecs[0];
+   (relax_data -> x_f)          = vecs[1];
+   (relax_data -> t_f)          = vecs[2];
+   (relax_data -> fused_boxes)  = fused_boxes;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PointRelaxFusedRow
+ *
+ * One Jacobi sweep over a row of n points with num_off off-diagonal entries.
+ * The vector pointers point to the first point of the row, and Ap[j] + Ai to
+ * the first coefficient.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_PointRelaxFusedRow( HYPRE_Int    num_off,
+                          HYPRE_Real   weight,
+                          HYPRE_Real **Ap,
+                          HYPRE_Real  *Adp,
+                          HYPRE_Int    Ai,
+                          HYPRE_Int   *xoff,
+                          HYPRE_Real  *bp,
+                          HYPRE_Real  *xp,
+                          HYPRE_Real  *tp,
+                          HYPRE_Int    n )
+{
+   HYPRE_Real   r[HYPRE_POINT_RELAX_FUSED_CHUNK];
+   HYPRE_Real  *a0 = NULL, *a1 = NULL, *a2 = NULL, *a3 = NULL, *a4 = NULL, *a5 = NULL, *a6 = NULL;
+   HYPRE_Real  *x0 = NULL, *x1 = NULL, *x2 = NULL, *x3 = NULL, *x4 = NULL, *x5 = NULL, *x6 = NULL;
+   HYPRE_Int    m0, nm, m, j, depth;
+
+   /* strip-mined so that the residual chunk r stays in L1 */
+   for (m0 = 0; m0 < n; m0 += HYPRE_POINT_RELAX_FUSED_CHUNK)
+   {
+      nm = hypre_min(HYPRE_POINT_RELAX_FUSED_CHUNK, n - m0);
+
+      for (m = 0; m < nm; m++)
+      {
+         r[m] = bp[m0 + m];
+      }
+
+      /* unroll up to depth MAX_DEPTH */
+      for (j = 0; j < num_off; j += MAX_DEPTH)
+      {
+         depth = hypre_min(MAX_DEPTH, (num_off - j));
+
+         switch (depth)
+         {
+            case 7:
+               a6 = Ap[j + 6] + Ai + m0;
+               x6 = xp + xoff[j + 6] + m0;
+            case 6:
+               a5 = Ap[j + 5] + Ai + m0;
+               x5 = xp + xoff[j + 5] + m0;
+            case 5:
+               a4 = Ap[j + 4] + Ai + m0;
+               x4 = xp + xoff[j + 4] + m0;
+            case 4:
+               a3 = Ap[j + 3] + Ai + m0;
+               x3 = xp + xoff[j + 3] + m0;
+            case 3:
+               a2 = Ap[j + 2] + Ai + m0;
+               x2 = xp + xoff[j + 2] + m0;
+            case 2:
+               a1 = Ap[j + 1] + Ai + m0;
+               x1 = xp + xoff[j + 1] + m0;
+            case 1:
+               a0 = Ap[j] + Ai + m0;
+               x0 = xp + xoff[j] + m0;
+         }
+
+         switch (depth)
+         {
+            case 7:
+               for (m = 0; m < nm; m++)
+               {
+                  r[m] -= a0[m] * x0[m] +
+                           a1[m] * x1[m] +
+                           a2[m] * x2[m] +
+                           a3[m] * x3[m] +
+                           a4[m] * x4[m] +
+                           a5[m] * x5[m] +
+                           a6[m] * x6[m];
+               }
+               break;
+            case 6:
+               for (m = 0; m < nm; m++)
+               {
+                  r[m] -= a0[m] * x0[m] +
+                           a1[m] * x1[m] +
+                           a2[m] * x2[m] +
+                           a3[m] * x3[m] +
+                           a4[m] * x4[m] +
+                           a5[m] * x5[m];
+               }
+               break;
+            case 5:
+               for (m = 0; m < nm; m++)
+               {
+                  r[m] -= a0[m] * x0[m] +
+                           a1[m] * x1[m] +
+                           a2[m] * x2[m] +
+                           a3[m] * x3[m] +
+                           a4[m] * x4[m];
+               }
+               break;
+            case 4:
+               for (m = 0; m < nm; m++)
+               {
+                  r[m] -= a0[m] * x0[m] +
+                           a1[m] * x1[m] +
+                           a2[m] * x2[m] +
+                           a3[m] * x3[m];
+               }
+               break;
+            case 3:
+               for (m = 0; m < nm; m++)
+               {
+                  r[m] -= a0[m] * x0[m] +
+                           a1[m] * x1[m] +
+                           a2[m] * x2[m];
+               }
+               break;
+            case 2:
+               for (m = 0; m < nm; m++)
+               {
+                  r[m] -= a0[m] * x0[m] +
+                           a1[m] * x1[m];
+               }
+               break;
+            case 1:
+               for (m = 0; m < nm; m++)
+               {
+                  r[m] -= a0[m] * x0[m];
+               }
+               break;
+         }
+      }
+
+      if (weight == 1.0)
+      {
+         for (m = 0; m < nm; m++)
+         {
+            tp[m0 + m] = r[m] / Adp[m0 + m];
+         }
+      }
+      else
+      {
+         for (m = 0; m < nm; m++)
+         {
+            tp[m0 + m] = weight * (r[m] / Adp[m0 + m]) + (1.0 - weight) * xp[m0 + m];
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PointRelaxFusedBox
+ *
+ * Does ns fused sweeps on grid box i, reading the first sweep from x_f and
+ * alternating between t_f and x_f.  The last sweep, which only updates the
+ * grid box, writes to box i of x.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PointRelaxFusedBox( hypre_PointRelaxData *relax_data,
+                          hypre_StructVector   *x,
+                          HYPRE_Int             i,
+                          HYPRE_Int             ns )
+{
+   hypre_StructMatrix    *A_f          = (relax_data -> A_f);
+   HYPRE_Real             weight       = (relax_data -> weight);
+   HYPRE_Int              diag_rank    = (relax_data -> diag_rank);
+   HYPRE_Int              ndim         = hypre_StructMatrixNDim(A_f);
+   hypre_StructStencil   *stencil      = hypre_StructMatrixStencil(A_f);
+   hypre_Index           *shape        = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size = hypre_StructStencilSize(stencil);
+   hypre_Box             *grid_box     = hypre_BoxArrayBox(
+                                            hypre_StructGridBoxes(hypre_StructMatrixGrid(A_f)), i);
+   hypre_BoxArray        *fused_box_a  = hypre_BoxArrayArrayBoxArray(
+                                            (relax_data -> fused_boxes), i);
+   hypre_Box             *A_data_box   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A_f), i);
+   hypre_Box             *v_data_box   = hypre_BoxArrayBox(
+                                            hypre_StructVectorDataSpace(relax_data -> x_f), i);
+   hypre_Box             *x_data_box   = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+   HYPRE_Real            *bp           = hypre_StructVectorBoxData((relax_data -> b_f), i);
+   HYPRE_Real            *x_p          = hypre_StructVectorBoxData(x, i);
+   HYPRE_Real            *vp[2];
+   HYPRE_Real            *Ap[27];
+   HYPRE_Int              xoff[27];
+   HYPRE_Real            *Adp;
+   HYPRE_Int              lo[3], hi[3], glo[3], ghi[3];
+   HYPRE_Int              zd = ndim - 1;
+   HYPRE_Int              num_off, w, s, z, g, r, d, si, nrows;
+
+   vp[0] = hypre_StructVectorBoxData((relax_data -> x_f), i);
+   vp[1] = hypre_StructVectorBoxData((relax_data -> t_f), i);
+
+   num_off = 0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      if (si != diag_rank)
+      {
+         Ap[num_off]   = hypre_StructMatrixBoxData(A_f, i, si);
+         xoff[num_off] = hypre_BoxOffsetDistance(v_data_box, shape[si]);
+         num_off++;
+      }
+   }
+   Adp = hypre_StructMatrixBoxData(A_f, i, diag_rank);
+
+   for (d = 0; d < 3; d++)
+   {
+      glo[d] = (d < ndim) ? hypre_BoxIMinD(grid_box, d) : 0;
+      ghi[d] = (d < ndim) ? hypre_BoxIMaxD(grid_box, d) : 0;
+   }
+
+   /* wavefront: at step w, sweep s works on plane z = w - (s-1) */
+   for (w = glo[zd] - (ns - 1); w <= ghi[zd] + (ns - 1); w++)
+   {
+      for (s = 1; s <= ns; s++)
+      {
+         HYPRE_Real *xp = vp[(s - 1) % 2];
+         HYPRE_Real *tp = vp[s % 2];
+
+         z = w - (s - 1);
+         g = ns - s;
+         if (z < glo[zd] - g || z > ghi[zd] + g)
+         {
+            continue;
+         }
+
+         hypre_ForBoxI(r, fused_box_a)
+         {
+            hypre_Box  *fbox = hypre_BoxArrayBox(fused_box_a, r);
+            HYPRE_Int   row;
+
+            /* part of the box grown by g in plane z */
+            for (d = 0; d < 3; d++)
+            {
+               lo[d] = glo[d] - ((d < ndim) ? g : 0);
+               hi[d] = ghi[d] + ((d < ndim) ? g : 0);
+               if (d < ndim)
+               {
+                  lo[d] = hypre_max(lo[d], hypre_BoxIMinD(fbox, d));
+                  hi[d] = hypre_min(hi[d], hypre_BoxIMaxD(fbox, d));
+               }
+            }
+            if (z < lo[zd] || z > hi[zd])
+            {
+               continue;
+            }
+            lo[zd] = hi[zd] = z;
+            if (hi[0] < lo[0] || hi[1] < lo[1] || hi[2] < lo[2])
+            {
+               continue;
+            }
+            nrows = (hi[1] - lo[1] + 1) * (hi[2] - lo[2] + 1);
+
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(row) HYPRE_SMP_SCHEDULE
+#endif
+            for (row = 0; row < nrows; row++)
+            {
+               hypre_Index  index;
+               HYPRE_Int    Ai, vi, n;
+
+               hypre_SetIndex(index, 0);
+               hypre_IndexD(index, 0) = lo[0];
+               if (ndim > 1)
+               {
+                  hypre_IndexD(index, 1) = lo[1] + row % (hi[1] - lo[1] + 1);
+               }
+               if (ndim > 2)
+               {
+                  hypre_IndexD(index, 2) = lo[2] + row / (hi[1] - lo[1] + 1);
+               }
+               Ai = hypre_BoxIndexRank(A_data_box, index);
+               vi = hypre_BoxIndexRank(v_data_box, index);
+               n  = hi[0] - lo[0] + 1;
+
+               hypre_PointRelaxFusedRow(num_off, weight, Ap, Adp + Ai, Ai, xoff,
+                                        bp + vi, xp + vi,
+                                        (s < ns) ? (tp + vi) :
+                                        (x_p + hypre_BoxIndexRank(x_data_box, index)), n);
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PointRelaxFused
+ *
+ * Does max_iter Jacobi sweeps with fused_sweeps sweeps per exchange.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxFused( void               *relax_vdata,
+                       hypre_StructVector *b,
+                       hypre_StructVector *x )
+{
+   hypre_PointRelaxData  *relax_data  = (hypre_PointRelaxData *)relax_vdata;
+   HYPRE_Int              k           = (relax_data -> fused_sweeps);
+   HYPRE_Int              max_iter    = (relax_data -> max_iter);
+   HYPRE_Int              zero_guess  = (relax_data -> zero_guess);
+   hypre_StructVector    *b_f         = (relax_data -> b_f);
+   hypre_StructVector    *x_f         = (relax_data -> x_f);
+   hypre_CommPkg         *comm_pkg_f  = (relax_data -> comm_pkg_f);
+   hypre_BoxArrayArray   *fused_boxes = (relax_data -> fused_boxes);
+   HYPRE_Int              ndim        = hypre_StructVectorNDim(x);
+   hypre_BoxArray        *grid_boxes  = hypre_StructGridBoxes(hypre_StructVectorGrid(x));
+
+   hypre_CommHandle      *comm_handle;
+   hypre_BoxArray        *fused_box_a;
+   hypre_Box             *x_data_box;
+   hypre_Box             *b_data_box;
+   hypre_Box             *f_data_box;
+   HYPRE_Real            *xp, *bp, *fp, *gp;
+   hypre_IndexRef         start;
+   hypre_Index            loop_size, unit_stride;
+   HYPRE_Int              iter, ns, i, j;
+
+   hypre_SetIndex(unit_stride, 1);
+
+   for (iter = 0; iter < max_iter; iter += ns)
+   {
+      ns = hypre_min(k, max_iter - iter);
+
+      /* copy the grid points of x (and of b on the first pass) into x_f and
+         b_f; their ghost layers come from the exchange.  Ghost points
+         outside of the grid stay zero. */
+      if (iter > 0 || !zero_guess)
+      {
+         hypre_ForBoxI(i, grid_boxes)
+         {
+            x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+            b_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+            f_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x_f), i);
+            xp = hypre_StructVectorBoxData(x, i);
+            bp = hypre_StructVectorBoxData(b, i);
+            fp = hypre_StructVectorBoxData(x_f, i);
+            gp = hypre_StructVectorBoxData(b_f, i);
+
+            start = hypre_BoxIMin(hypre_BoxArrayBox(grid_boxes, i));
+            hypre_BoxGetSize(hypre_BoxArrayBox(grid_boxes, i), loop_size);
+
+            if (iter == 0)
+            {
+#define DEVICE_VAR is_device_ptr(fp,gp,xp,bp)
+               hypre_BoxLoop3Begin(ndim, loop_size,
+                                   x_data_box, start, unit_stride, xi,
+                                   b_data_box, start, unit_stride, bi,
+                                   f_data_box, start, unit_stride, fi);
+               {
+                  fp[fi] = xp[xi];
+                  gp[fi] = bp[bi];
+               }
+               hypre_BoxLoop3End(xi, bi, fi);
+#undef DEVICE_VAR
+            }
+            else
+            {
+#define DEVICE_VAR is_device_ptr(fp,xp)
+               hypre_BoxLoop2Begin(ndim, loop_size,
+                                   x_data_box, start, unit_stride, xi,
+                                   f_data_box, start, unit_stride, fi);
+               {
+                  fp[fi] = xp[xi];
+               }
+               hypre_BoxLoop2End(xi, fi);
+#undef DEVICE_VAR
+            }
+         }
+      }
+      else
+      {
+         hypre_ForBoxI(i, grid_boxes)
+         {
+            b_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+            f_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b_f), i);
+            bp = hypre_StructVectorBoxData(b, i);
+            gp = hypre_StructVectorBoxData(b_f, i);
+
+            start = hypre_BoxIMin(hypre_BoxArrayBox(grid_boxes, i));
+            hypre_BoxGetSize(hypre_BoxArrayBox(grid_boxes, i), loop_size);
+
+#define DEVICE_VAR is_device_ptr(gp,bp)
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                b_data_box, start, unit_stride, bi,
+                                f_data_box, start, unit_stride, fi);
+            {
+               gp[fi] = bp[bi];
+            }
+            hypre_BoxLoop2End(bi, fi);
+#undef DEVICE_VAR
+         }
+      }
+
+      /* one exchange of the k ghost layers of x_f and b_f.  On later passes
+         b_f is sent again, which costs volume but no extra messages. */
+      hypre_InitializeCommunication(comm_pkg_f, hypre_StructVectorData(x_f),
+                                    hypre_StructVectorData(x_f), 0, 0, &comm_handle);
+      hypre_FinalizeCommunication(comm_handle);
+
+      if (iter == 0 && zero_guess)
+      {
+         /* zero on all points to be updated, including the neighbors */
+         hypre_ForBoxI(i, grid_boxes)
+         {
+            f_data_box  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x_f), i);
+            fp          = hypre_StructVectorBoxData(x_f, i);
+            fused_box_a = hypre_BoxArrayArrayBoxArray(fused_boxes, i);
+
+            hypre_ForBoxI(j, fused_box_a)
+            {
+               start = hypre_BoxIMin(hypre_BoxArrayBox(fused_box_a, j));
+               hypre_BoxGetSize(hypre_BoxArrayBox(fused_box_a, j), loop_size);
+
+#define DEVICE_VAR is_device_ptr(fp)
+               hypre_BoxLoop1Begin(ndim, loop_size,
+                                   f_data_box, start, unit_stride, fi);
+               {
+                  fp[fi] = 0.0;
+               }
+               hypre_BoxLoop1End(fi);
+#undef DEVICE_VAR
+            }
+         }
+      }
+
+      /* the last sweep writes to x */
+      hypre_ForBoxI(i, grid_boxes)
+      {
+         hypre_PointRelaxFusedBox(relax_data, x, i, ns);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1398,6 +2269,23 @@ hypre_PointRelaxSetPointsetRank( void *relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * If data_float is set, the Jacobi sweeps read variable coefficients from the
+ * single-precision copy of A (see hypre_StructMatrixCreateDataFloat) when it
+ * has one.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxSetDataFloat( void      *relax_vdata,
+                              HYPRE_Int  data_float )
+{
+   hypre_PointRelaxData *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   (relax_data -> data_float) = data_float;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1415,6 +2303,20 @@ hypre_PointRelaxSetTempVec( void               *relax_vdata,
 
 
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxSetFusedSweeps( void      *relax_vdata,
+                                HYPRE_Int  fused_sweeps )
+{
+   hypre_PointRelaxData *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   (relax_data -> fused_sweeps) = hypre_max(fused_sweeps, 1);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -87,6 +87,19 @@ HYPRE_Int hypre_JacobiGetNumIterations ( void *jacobi_vdata, HYPRE_Int *num_iter
 HYPRE_Int hypre_JacobiSetTempVec ( void *jacobi_vdata, hypre_StructVector *t );
 HYPRE_Int hypre_JacobiGetFinalRelativeResidualNorm ( void *jacobi_vdata, HYPRE_Real *norm );
 
+/* line_relax.c */
+void *hypre_LineRelaxCreate ( MPI_Comm comm );
+HYPRE_Int hypre_LineRelaxDestroy ( void *relax_vdata );
+HYPRE_Int hypre_LineRelaxSetup ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                                 hypre_StructVector *x );
+HYPRE_Int hypre_LineRelax ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                            hypre_StructVector *x );
+HYPRE_Int hypre_LineRelaxSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
+HYPRE_Int hypre_LineRelaxSetZeroGuess ( void *relax_vdata, HYPRE_Int zero_guess );
+HYPRE_Int hypre_LineRelaxSetWeight ( void *relax_vdata, HYPRE_Real weight );
+HYPRE_Int hypre_LineRelaxSetDirection ( void *relax_vdata, HYPRE_Int dir );
+HYPRE_Int hypre_LineRelaxSetTempVec ( void *relax_vdata, hypre_StructVector *t );
+
 /* pcg_struct.c */
 void *hypre_StructKrylovCAlloc ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
 HYPRE_Int hypre_StructKrylovFree ( void *ptr );
@@ -98,6 +111,10 @@ HYPRE_Int hypre_StructKrylovMatvec ( void *matvec_data, HYPRE_Complex alpha, voi
                                      HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_StructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_StructKrylovInnerProd ( void *x, void *y );
+HYPRE_Int hypre_StructKrylovInnerProdStart ( HYPRE_Int n, void **x, void **y,
+                                            HYPRE_Real *local_result, HYPRE_Real *result,
+                                            hypre_MPI_Request *request );
+HYPRE_Int hypre_StructKrylovInnerProdWait ( hypre_MPI_Request *request );
 HYPRE_Int hypre_StructKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_StructKrylovClearVector ( void *x );
 HYPRE_Int hypre_StructKrylovScaleVector ( HYPRE_Complex alpha, void *x );
@@ -211,6 +228,14 @@ HYPRE_Int hypre_PFMGSetNumPostRelax ( void *pfmg_vdata, HYPRE_Int num_post_relax
 HYPRE_Int hypre_PFMGGetNumPostRelax ( void *pfmg_vdata, HYPRE_Int *num_post_relax );
 HYPRE_Int hypre_PFMGSetSkipRelax ( void *pfmg_vdata, HYPRE_Int skip_relax );
 HYPRE_Int hypre_PFMGGetSkipRelax ( void *pfmg_vdata, HYPRE_Int *skip_relax );
+HYPRE_Int hypre_PFMGSetFusedRelaxSweeps ( void *pfmg_vdata, HYPRE_Int fused_relax_sweeps );
+HYPRE_Int hypre_PFMGGetFusedRelaxSweeps ( void *pfmg_vdata, HYPRE_Int *fused_relax_sweeps );
+HYPRE_Int hypre_PFMGSetMixedPrecision ( void *pfmg_vdata, HYPRE_Int mixed_precision );
+HYPRE_Int hypre_PFMGGetMixedPrecision ( void *pfmg_vdata, HYPRE_Int *mixed_precision );
+HYPRE_Int hypre_PFMGSetCompressCoarse ( void *pfmg_vdata, HYPRE_Int compress_coarse );
+HYPRE_Int hypre_PFMGGetCompressCoarse ( void *pfmg_vdata, HYPRE_Int *compress_coarse );
+HYPRE_Int hypre_PFMGSetAgglomSize ( void *pfmg_vdata, HYPRE_Int agglom_size );
+HYPRE_Int hypre_PFMGGetAgglomSize ( void *pfmg_vdata, HYPRE_Int *agglom_size );
 HYPRE_Int hypre_PFMGSetDxyz ( void *pfmg_vdata, HYPRE_Real *dxyz );
 HYPRE_Int hypre_PFMGSetLogging ( void *pfmg_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_PFMGGetLogging ( void *pfmg_vdata, HYPRE_Int *logging );
@@ -236,6 +261,9 @@ HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PFMGRelaxSetMaxIter ( void *pfmg_relax_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_PFMGRelaxSetZeroGuess ( void *pfmg_relax_vdata, HYPRE_Int zero_guess );
 HYPRE_Int hypre_PFMGRelaxSetTempVec ( void *pfmg_relax_vdata, hypre_StructVector *t );
+HYPRE_Int hypre_PFMGRelaxSetFusedSweeps ( void *pfmg_relax_vdata, HYPRE_Int fused_sweeps );
+HYPRE_Int hypre_PFMGRelaxSetDataFloat ( void *pfmg_relax_vdata, HYPRE_Int data_float );
+HYPRE_Int hypre_PFMGRelaxSetLineDirection ( void *pfmg_relax_vdata, HYPRE_Int dir );
 
 /* pfmg_setup.c */
 HYPRE_Int hypre_PFMGSetup ( void *pfmg_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
@@ -349,6 +377,10 @@ HYPRE_Int hypre_PointRelax_core12 ( void *relax_vdata, hypre_StructMatrix *A,
                                     HYPRE_Int constant_coefficient, hypre_Box *compute_box, HYPRE_Real *bp, HYPRE_Real *xp,
                                     HYPRE_Real *tp, HYPRE_Int boxarray_id, hypre_Box *A_data_box, hypre_Box *b_data_box,
                                     hypre_Box *x_data_box, hypre_Box *t_data_box, hypre_IndexRef stride );
+HYPRE_Int hypre_PointRelaxFusedDestroy ( void *relax_vdata );
+HYPRE_Int hypre_PointRelaxFusedSetup ( void *relax_vdata, hypre_StructMatrix *A,
+                                       hypre_StructVector *b, hypre_StructVector *x );
+HYPRE_Int hypre_PointRelaxFused ( void *relax_vdata, hypre_StructVector *b, hypre_StructVector *x );
 HYPRE_Int hypre_PointRelaxSetTol ( void *relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PointRelaxGetTol ( void *relax_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_PointRelaxSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
@@ -362,7 +394,9 @@ HYPRE_Int hypre_PointRelaxSetPointset ( void *relax_vdata, HYPRE_Int pointset,
                                         HYPRE_Int pointset_size, hypre_Index pointset_stride, hypre_Index *pointset_indices );
 HYPRE_Int hypre_PointRelaxSetPointsetRank ( void *relax_vdata, HYPRE_Int pointset,
                                             HYPRE_Int pointset_rank );
+HYPRE_Int hypre_PointRelaxSetDataFloat ( void *relax_vdata, HYPRE_Int data_float );
 HYPRE_Int hypre_PointRelaxSetTempVec ( void *relax_vdata, hypre_StructVector *t );
+HYPRE_Int hypre_PointRelaxSetFusedSweeps ( void *relax_vdata, HYPRE_Int fused_sweeps );
 HYPRE_Int hypre_PointRelaxGetFinalRelativeResidualNorm ( void *relax_vdata, HYPRE_Real *norm );
 HYPRE_Int hypre_relax_wtx ( void *relax_vdata, HYPRE_Int pointset, hypre_StructVector *t,
                             hypre_StructVector *x );
@@ -397,6 +431,8 @@ HYPRE_Int hypre_SemiInterpSetup ( void *interp_vdata, hypre_StructMatrix *P,
                                   hypre_Index findex, hypre_Index stride );
 HYPRE_Int hypre_SemiInterp ( void *interp_vdata, hypre_StructMatrix *P, hypre_StructVector *xc,
                              hypre_StructVector *e );
+HYPRE_Int hypre_SemiInterpCorrect ( void *interp_vdata, hypre_StructMatrix *P,
+                                    hypre_StructVector *xc, hypre_StructVector *e, hypre_StructVector *x );
 HYPRE_Int hypre_SemiInterpDestroy ( void *interp_vdata );
 
 /* semi_restrict.c */
@@ -406,6 +442,12 @@ HYPRE_Int hypre_SemiRestrictSetup ( void *restrict_vdata, hypre_StructMatrix *R,
                                     hypre_Index findex, hypre_Index stride );
 HYPRE_Int hypre_SemiRestrict ( void *restrict_vdata, hypre_StructMatrix *R, hypre_StructVector *r,
                                hypre_StructVector *rc );
+HYPRE_Int hypre_SemiRestrictResidualSetup ( void *restrict_vdata, hypre_StructMatrix *A,
+                                            hypre_StructVector *x );
+HYPRE_Int hypre_SemiRestrictSetDataFloat ( void *restrict_vdata, HYPRE_Int data_float );
+HYPRE_Int hypre_SemiRestrictResidual ( void *restrict_vdata, hypre_StructMatrix *R,
+                                       hypre_StructMatrix *A, hypre_StructVector *x, hypre_StructVector *b, hypre_StructVector *r,
+                                       hypre_StructVector *rc );
 HYPRE_Int hypre_SemiRestrictDestroy ( void *restrict_vdata );
 
 /* semi_setup_rap.c */
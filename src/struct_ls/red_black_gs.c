@@ -309,7 +309,7 @@ hypre_RedBlackGS( void               *relax_vdata,
 
    while (iter < 2 * max_iter)
    {
-      for (compute_i = 0; compute_i < 2; compute_i++)
+      for (compute_i = 0; ; compute_i++)
       {
          switch (compute_i)
          {
@@ -321,14 +321,18 @@ hypre_RedBlackGS( void               *relax_vdata,
             }
             break;
 
-            case 1:
+            default:
             {
-               hypre_FinalizeIndtComputations(comm_handle);
-               compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+               hypre_NextDeptComputations(compute_pkg, &comm_handle, &compute_box_aa);
             }
             break;
          }
 
+         if (compute_box_aa == NULL)
+         {
+            break;
+         }
+
          hypre_ForBoxArrayI(i, compute_box_aa)
          {
             compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -17,8 +17,14 @@ typedef struct
    HYPRE_Int           R_stored_as_transpose;
    hypre_ComputePkg   *compute_pkg;
    hypre_Index         cindex;
+   hypre_Index         findex;
    hypre_Index         stride;
 
+   /* fused residual-restriction (see hypre_SemiRestrictResidual) */
+   hypre_ComputePkg   *residual_compute_pkg;
+   HYPRE_Int           residual_fpoints;
+   HYPRE_Int           residual_data_float; /* read A from its single-precision copy */
+
    HYPRE_Int           time_index;
 
 } hypre_SemiRestrictData;
@@ -81,6 +87,7 @@ hypre_SemiRestrictSetup( void               *restrict_vdata,
    (restrict_data -> R_stored_as_transpose) = R_stored_as_transpose;
    (restrict_data -> compute_pkg) = compute_pkg;
    hypre_CopyIndex(cindex, (restrict_data -> cindex));
+   hypre_CopyIndex(findex, (restrict_data -> findex));
    hypre_CopyIndex(stride, (restrict_data -> stride));
 
    return hypre_error_flag;
@@ -311,6 +318,669 @@ hypre_SemiRestrict( void               *restrict_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Fused residual-restriction kernels (host only).
+ *
+ * The residual y = b - A*x (plus the restriction terms R0*r0 + R1*r1 when
+ * computing the coarse residual) is accumulated in a register for up to DEPTH
+ * stencil entries per pass over a row in the unit-stride direction.  Rows
+ * may be strided in the other directions.
+ *--------------------------------------------------------------------------*/
+
+/* number of stencil entries accumulated in a register per pass over a row */
+#define HYPRE_SEMI_RESTRICT_DEPTH 9
+
+/*--------------------------------------------------------------------------
+ * yr = br - sum_si ar[si]*xr[si] (+ R0*r0 + R1*r1 if R0 is not NULL) over
+ * one row of length nx, with the single-precision rows fr in place of ar if
+ * fr is not NULL.  Called with a literal depth so that the entry loop is
+ * unrolled and the row loop vectorizes.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_SemiRestrictResidualRow( HYPRE_Int       depth,
+                               HYPRE_Complex **ar,
+                               float         **fr,
+                               HYPRE_Complex **xr,
+                               HYPRE_Complex  *br,
+                               HYPRE_Complex  *R0,
+                               HYPRE_Complex  *r0,
+                               HYPRE_Complex  *R1,
+                               HYPRE_Complex  *r1,
+                               HYPRE_Complex  *yr,
+                               HYPRE_Int       nx )
+{
+   HYPRE_Int  i, si;
+
+   if (fr != NULL)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp simd
+#endif
+      for (i = 0; i < nx; i++)
+      {
+         HYPRE_Complex t = br[i];
+         if (R0 != NULL)
+         {
+            t += R0[i] * r0[i] + R1[i] * r1[i];
+         }
+         for (si = 0; si < depth; si++)
+         {
+            t -= (HYPRE_Complex) fr[si][i] * xr[si][i];
+         }
+         yr[i] = t;
+      }
+   }
+   else if (R0 == NULL)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp simd
+#endif
+      for (i = 0; i < nx; i++)
+      {
+         HYPRE_Complex t = br[i];
+         for (si = 0; si < depth; si++)
+         {
+            t -= ar[si][i] * xr[si][i];
+         }
+         yr[i] = t;
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp simd
+#endif
+      for (i = 0; i < nx; i++)
+      {
+         HYPRE_Complex t = br[i] + R0[i] * r0[i] + R1[i] * r1[i];
+         for (si = 0; si < depth; si++)
+         {
+            t -= ar[si][i] * xr[si][i];
+         }
+         yr[i] = t;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Residual over a box of n[0] x n[1] x n[2] points.  All pointers are offset
+ * to the first point of the box, and *_s[1] and *_s[2] are the distances in
+ * the respective data boxes between consecutive rows and planes of the loop.
+ * If Rp0 is NULL, no restriction terms are added.  If Fp is not NULL, the
+ * coefficients are read from the single-precision arrays Fp instead of Ap.
+ * Called with a literal stencil_size so that it gets specialized per stencil.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_SemiRestrictResidualBox( HYPRE_Int       stencil_size,
+                               HYPRE_Complex **Ap,
+                               float         **Fp,
+                               HYPRE_Int      *A_s,
+                               HYPRE_Complex  *xp,
+                               HYPRE_Int      *xoff,
+                               HYPRE_Int      *x_s,
+                               HYPRE_Complex  *bp,
+                               HYPRE_Int      *b_s,
+                               HYPRE_Complex  *Rp0,
+                               HYPRE_Complex  *Rp1,
+                               HYPRE_Int      *R_s,
+                               HYPRE_Complex  *rp0,
+                               HYPRE_Complex  *rp1,
+                               HYPRE_Int      *r_s,
+                               HYPRE_Complex  *yp,
+                               HYPRE_Int      *y_s,
+                               HYPRE_Int      *n )
+{
+   HYPRE_Int  nx = n[0], ny = n[1], nz = n[2];
+   HYPRE_Int  t, j, k, si, s0, rem;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, j, k, si, s0, rem) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < ny * nz; t++)
+   {
+      HYPRE_Complex *ar[HYPRE_SEMI_RESTRICT_DEPTH] = {NULL};
+      float         *fr[HYPRE_SEMI_RESTRICT_DEPTH] = {NULL};
+      HYPRE_Complex *xr[HYPRE_SEMI_RESTRICT_DEPTH];
+      HYPRE_Complex *R0 = NULL, *R1 = NULL, *r0 = NULL, *r1 = NULL;
+      HYPRE_Complex *br, *yr;
+      HYPRE_Int      Ai, xi;
+
+      j  = t % ny;
+      k  = t / ny;
+      Ai = j * A_s[1] + k * A_s[2];
+      xi = j * x_s[1] + k * x_s[2];
+      br = bp + j * b_s[1] + k * b_s[2];
+      yr = yp + j * y_s[1] + k * y_s[2];
+      if (Rp0 != NULL)
+      {
+         R0 = Rp0 + j * R_s[1] + k * R_s[2];
+         R1 = Rp1 + j * R_s[1] + k * R_s[2];
+         r0 = rp0 + j * r_s[1] + k * r_s[2];
+         r1 = rp1 + j * r_s[1] + k * r_s[2];
+      }
+
+      /* the first pass starts from b, later passes accumulate into y */
+      rem = stencil_size % HYPRE_SEMI_RESTRICT_DEPTH;
+      for (s0 = 0; s0 + HYPRE_SEMI_RESTRICT_DEPTH <= stencil_size; s0 += HYPRE_SEMI_RESTRICT_DEPTH)
+      {
+         for (si = 0; si < HYPRE_SEMI_RESTRICT_DEPTH; si++)
+         {
+            if (Fp != NULL)
+            {
+               fr[si] = Fp[s0 + si] + Ai;
+            }
+            else
+            {
+               ar[si] = Ap[s0 + si] + Ai;
+            }
+            xr[si] = xp + xi + xoff[s0 + si];
+         }
+         hypre_SemiRestrictResidualRow(HYPRE_SEMI_RESTRICT_DEPTH, ar,
+                                       (Fp != NULL) ? fr : NULL, xr,
+                                       (s0 == 0) ? br : yr, R0, r0, R1, r1, yr, nx);
+         R0 = NULL;
+      }
+      if (rem > 0)
+      {
+         for (si = 0; si < rem; si++)
+         {
+            if (Fp != NULL)
+            {
+               fr[si] = Fp[s0 + si] + Ai;
+            }
+            else
+            {
+               ar[si] = Ap[s0 + si] + Ai;
+            }
+            xr[si] = xp + xi + xoff[s0 + si];
+         }
+         hypre_SemiRestrictResidualRow(rem, ar, (Fp != NULL) ? fr : NULL, xr,
+                                       (s0 == 0) ? br : yr, R0, r0, R1, r1, yr, nx);
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Dispatch to a hypre_SemiRestrictResidualBox specialized for the common
+ * PFMG stencil sizes.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_SemiRestrictResidualBoxes( HYPRE_Int       stencil_size,
+                                 HYPRE_Complex **Ap,
+                                 float         **Fp,
+                                 HYPRE_Int      *A_s,
+                                 HYPRE_Complex  *xp,
+                                 HYPRE_Int      *xoff,
+                                 HYPRE_Int      *x_s,
+                                 HYPRE_Complex  *bp,
+                                 HYPRE_Int      *b_s,
+                                 HYPRE_Complex  *Rp0,
+                                 HYPRE_Complex  *Rp1,
+                                 HYPRE_Int      *R_s,
+                                 HYPRE_Complex  *rp0,
+                                 HYPRE_Complex  *rp1,
+                                 HYPRE_Int      *r_s,
+                                 HYPRE_Complex  *yp,
+                                 HYPRE_Int      *y_s,
+                                 HYPRE_Int      *n )
+{
+   switch (stencil_size)
+   {
+      case 5:
+         hypre_SemiRestrictResidualBox(5, Ap, Fp, A_s, xp, xoff, x_s, bp, b_s,
+                                       Rp0, Rp1, R_s, rp0, rp1, r_s, yp, y_s, n);
+         break;
+      case 7:
+         hypre_SemiRestrictResidualBox(7, Ap, Fp, A_s, xp, xoff, x_s, bp, b_s,
+                                       Rp0, Rp1, R_s, rp0, rp1, r_s, yp, y_s, n);
+         break;
+      case 9:
+         hypre_SemiRestrictResidualBox(9, Ap, Fp, A_s, xp, xoff, x_s, bp, b_s,
+                                       Rp0, Rp1, R_s, rp0, rp1, r_s, yp, y_s, n);
+         break;
+      case 19:
+         hypre_SemiRestrictResidualBox(19, Ap, Fp, A_s, xp, xoff, x_s, bp, b_s,
+                                       Rp0, Rp1, R_s, rp0, rp1, r_s, yp, y_s, n);
+         break;
+      case 27:
+         hypre_SemiRestrictResidualBox(27, Ap, Fp, A_s, xp, xoff, x_s, bp, b_s,
+                                       Rp0, Rp1, R_s, rp0, rp1, r_s, yp, y_s, n);
+         break;
+      default:
+         hypre_SemiRestrictResidualBox(stencil_size, Ap, Fp, A_s, xp, xoff, x_s, bp, b_s,
+                                       Rp0, Rp1, R_s, rp0, rp1, r_s, yp, y_s, n);
+         break;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Distances in data box dbox between consecutive rows and planes of a loop
+ * with the given stride.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_SemiRestrictLoopStrides( hypre_Box      *dbox,
+                               hypre_IndexRef  stride,
+                               HYPRE_Int       ndim,
+                               HYPRE_Int      *s )
+{
+   HYPRE_Int  d, size = 1;
+
+   s[0] = 1;
+   for (d = 1; d < 3; d++)
+   {
+      size *= (d - 1 < ndim) ? hypre_BoxSizeD(dbox, d - 1) : 1;
+      s[d]  = (d < ndim) ? size * hypre_IndexD(stride, d) : 0;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Set up the fused residual-restriction routine hypre_SemiRestrictResidual.
+ * Must be called after hypre_SemiRestrictSetup, and only for matrices A with
+ * variable coefficients (constant_coefficient = 0).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiRestrictResidualSetup( void               *restrict_vdata,
+                                 hypre_StructMatrix *A,
+                                 hypre_StructVector *x )
+{
+   hypre_SemiRestrictData *restrict_data = (hypre_SemiRestrictData *)restrict_vdata;
+
+   hypre_StructGrid       *grid;
+   hypre_StructStencil    *stencil;
+
+   hypre_ComputeInfo      *compute_info;
+   hypre_ComputePkg       *compute_pkg;
+   HYPRE_Int               ndim, d;
+
+   if (hypre_StructMatrixConstantCoefficient(A) != 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   /*----------------------------------------------------------
+    * Set up the compute package for the residual.  It is only
+    * split into F-points and C-points when not coarsening in the
+    * unit-stride direction, since rows with stride two would cost
+    * more than the fusion saves.  Otherwise the residual is
+    * computed at all points and then restricted.
+    *----------------------------------------------------------*/
+
+   grid    = hypre_StructMatrixGrid(A);
+   stencil = hypre_StructMatrixStencil(A);
+
+   ndim = hypre_StructMatrixNDim(A);
+   (restrict_data -> residual_fpoints) = 1;
+   for (d = 0; d < ndim - 1; d++)
+   {
+      if (hypre_IndexD((restrict_data -> stride), d) != 1)
+      {
+         (restrict_data -> residual_fpoints) = 0;
+      }
+   }
+
+   hypre_CreateComputeInfo(grid, stencil, &compute_info);
+   if (restrict_data -> residual_fpoints)
+   {
+      hypre_ComputeInfoProjectComp(compute_info, (restrict_data -> findex),
+                                   (restrict_data -> stride));
+   }
+   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
+                          grid, &compute_pkg);
+
+   hypre_ComputePkgDestroy(restrict_data -> residual_compute_pkg);
+   (restrict_data -> residual_compute_pkg) = compute_pkg;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * If data_float is set, hypre_SemiRestrictResidual reads A from its
+ * single-precision copy (see hypre_StructMatrixCreateDataFloat) when it has
+ * one.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiRestrictSetDataFloat( void      *restrict_vdata,
+                                HYPRE_Int  data_float )
+{
+   hypre_SemiRestrictData *restrict_data = (hypre_SemiRestrictData *)restrict_vdata;
+
+   (restrict_data -> residual_data_float) = data_float;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Fused residual and restriction, rc = R*(b - A*x), host only.
+ *
+ * Same as computing r = b - A*x with hypre_StructCopy and a matvec followed
+ * by hypre_SemiRestrict, but without the copy, and without writing and
+ * re-reading the residual at C-points: r is computed at the F-points only,
+ * and the C-point residual is formed and restricted directly into rc.  On
+ * return, the C-point entries of r are not set.  When coarsening in the
+ * unit-stride direction, r is computed at all points in one pass and then
+ * restricted with hypre_SemiRestrict.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiRestrictResidual( void               *restrict_vdata,
+                            hypre_StructMatrix *R,
+                            hypre_StructMatrix *A,
+                            hypre_StructVector *x,
+                            hypre_StructVector *b,
+                            hypre_StructVector *r,
+                            hypre_StructVector *rc             )
+{
+   hypre_SemiRestrictData *restrict_data = (hypre_SemiRestrictData *)restrict_vdata;
+
+   HYPRE_Int               R_stored_as_transpose;
+   hypre_ComputePkg       *compute_pkg;
+   hypre_ComputePkg       *residual_compute_pkg;
+   HYPRE_Int               residual_fpoints;
+   hypre_IndexRef          cindex;
+   hypre_IndexRef          stride;
+   hypre_IndexRef          rstride;
+   HYPRE_Int               ndim;
+
+   hypre_StructGrid       *fgrid;
+   HYPRE_Int              *fgrid_ids;
+   hypre_StructGrid       *cgrid;
+   hypre_BoxArray         *cgrid_boxes;
+   HYPRE_Int              *cgrid_ids;
+
+   hypre_CommHandle       *comm_handle;
+
+   hypre_BoxArrayArray    *compute_box_aa;
+   hypre_BoxArray         *compute_box_a;
+   hypre_Box              *compute_box;
+
+   hypre_Box              *A_dbox;
+   hypre_Box              *x_dbox;
+   hypre_Box              *b_dbox;
+   hypre_Box              *R_dbox;
+   hypre_Box              *r_dbox;
+   hypre_Box              *rc_dbox;
+
+   HYPRE_Complex         **Ap;
+   float                 **Fp = NULL;
+   HYPRE_Int              *xoff;
+   HYPRE_Complex          *Rp0, *Rp1;
+   HYPRE_Complex          *xp, *rp, *rcp;
+   HYPRE_Int               A_s[3], x_s[3], b_s[3], R_s[3], r_s[3], y_s[3], n[3];
+   HYPRE_Int               Ai, xi, bi, Ri, ri, rci;
+   HYPRE_Int               Rp0_offset, rp0_offset, rp1_offset;
+
+   hypre_Index             loop_size;
+   hypre_IndexRef          start;
+   hypre_Index             startc;
+   hypre_Index             stridec;
+
+   hypre_Index            *A_shape;
+   hypre_Index            *R_shape;
+   HYPRE_Int               stencil_size;
+
+   HYPRE_Int               compute_i, fi, ci, j, d, si;
+
+   /*-----------------------------------------------------------------------
+    * Initialize some things.
+    *-----------------------------------------------------------------------*/
+
+   hypre_BeginTiming(restrict_data -> time_index);
+
+   R_stored_as_transpose = (restrict_data -> R_stored_as_transpose);
+   compute_pkg          = (restrict_data -> compute_pkg);
+   residual_compute_pkg = (restrict_data -> residual_compute_pkg);
+   residual_fpoints     = (restrict_data -> residual_fpoints);
+   cindex               = (restrict_data -> cindex);
+   stride               = (restrict_data -> stride);
+
+   hypre_assert( residual_compute_pkg != NULL );
+   hypre_assert( hypre_StructMatrixConstantCoefficient(R) == 0 );
+
+   ndim         = hypre_StructMatrixNDim(A);
+   A_shape      = hypre_StructStencilShape(hypre_StructMatrixStencil(A));
+   R_shape      = hypre_StructStencilShape(hypre_StructMatrixStencil(R));
+   stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+
+   Ap   = hypre_TAlloc(HYPRE_Complex *, stencil_size, HYPRE_MEMORY_HOST);
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   if ((restrict_data -> residual_data_float) && hypre_StructMatrixDataFloat(A) != NULL)
+   {
+      Fp = hypre_TAlloc(float *, stencil_size, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_SetIndex3(stridec, 1, 1, 1);
+   rstride = (residual_fpoints) ? stride : stridec;
+
+   /*--------------------------------------------------------------------
+    * Compute the residual r = b - A*x at F-points (or at all points)
+    *--------------------------------------------------------------------*/
+
+   for (compute_i = 0; compute_i < 2; compute_i++)
+   {
+      switch (compute_i)
+      {
+         case 0:
+         {
+            xp = hypre_StructVectorData(x);
+            hypre_InitializeIndtComputations(residual_compute_pkg, xp, &comm_handle);
+            compute_box_aa = hypre_ComputePkgIndtBoxes(residual_compute_pkg);
+         }
+         break;
+
+         case 1:
+         {
+            hypre_FinalizeIndtComputations(comm_handle);
+            compute_box_aa = hypre_ComputePkgDeptBoxes(residual_compute_pkg);
+         }
+         break;
+      }
+
+      hypre_ForBoxArrayI(fi, compute_box_aa)
+      {
+         compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, fi);
+
+         A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), fi);
+         b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), fi);
+         r_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(r), fi);
+
+         hypre_SemiRestrictLoopStrides(A_dbox, rstride, ndim, A_s);
+         hypre_SemiRestrictLoopStrides(x_dbox, rstride, ndim, x_s);
+         hypre_SemiRestrictLoopStrides(b_dbox, rstride, ndim, b_s);
+         hypre_SemiRestrictLoopStrides(r_dbox, rstride, ndim, y_s);
+         for (si = 0; si < stencil_size; si++)
+         {
+            xoff[si] = hypre_BoxOffsetDistance(x_dbox, A_shape[si]);
+         }
+
+         hypre_ForBoxI(j, compute_box_a)
+         {
+            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+            start = hypre_BoxIMin(compute_box);
+            hypre_BoxGetStrideSize(compute_box, rstride, loop_size);
+            for (d = 0; d < 3; d++)
+            {
+               n[d] = (d < ndim) ? hypre_IndexD(loop_size, d) : 1;
+            }
+            if (n[0] * n[1] * n[2] == 0)
+            {
+               continue;
+            }
+
+            Ai = hypre_BoxIndexRank(A_dbox, start);
+            xi = hypre_BoxIndexRank(x_dbox, start);
+            bi = hypre_BoxIndexRank(b_dbox, start);
+            ri = hypre_BoxIndexRank(r_dbox, start);
+            for (si = 0; si < stencil_size; si++)
+            {
+               Ap[si] = hypre_StructMatrixBoxData(A, fi, si) + Ai;
+               if (Fp != NULL)
+               {
+                  Fp[si] = hypre_StructMatrixBoxDataFloat(A, fi, si) + Ai;
+               }
+            }
+
+            hypre_SemiRestrictResidualBoxes(stencil_size, Ap, Fp, A_s,
+                                            hypre_StructVectorBoxData(x, fi) + xi, xoff, x_s,
+                                            hypre_StructVectorBoxData(b, fi) + bi, b_s,
+                                            NULL, NULL, NULL, NULL, NULL, NULL,
+                                            hypre_StructVectorBoxData(r, fi) + ri, y_s, n);
+         }
+      }
+   }
+
+   if (!residual_fpoints)
+   {
+      hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+      hypre_TFree(Fp, HYPRE_MEMORY_HOST);
+      hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+      hypre_IncFLOPCount(2 * hypre_StructMatrixGlobalSize(A));
+      hypre_EndTiming(restrict_data -> time_index);
+
+      return hypre_SemiRestrict(restrict_vdata, R, r, rc);
+   }
+
+   /*--------------------------------------------------------------------
+    * Compute the residual at C-points and restrict.  The F-point values of
+    * r are communicated while the independent C-points are computed.
+    *--------------------------------------------------------------------*/
+
+   fgrid = hypre_StructVectorGrid(r);
+   fgrid_ids = hypre_StructGridIDs(fgrid);
+   cgrid = hypre_StructVectorGrid(rc);
+   cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   cgrid_ids = hypre_StructGridIDs(cgrid);
+
+   for (compute_i = 0; compute_i < 2; compute_i++)
+   {
+      switch (compute_i)
+      {
+         case 0:
+         {
+            rp = hypre_StructVectorData(r);
+            hypre_InitializeIndtComputations(compute_pkg, rp, &comm_handle);
+            compute_box_aa = hypre_ComputePkgIndtBoxes(compute_pkg);
+         }
+         break;
+
+         case 1:
+         {
+            hypre_FinalizeIndtComputations(comm_handle);
+            compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+         }
+         break;
+      }
+
+      fi = 0;
+      hypre_ForBoxI(ci, cgrid_boxes)
+      {
+         while (fgrid_ids[fi] != cgrid_ids[ci])
+         {
+            fi++;
+         }
+
+         compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, fi);
+
+         A_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A),  fi);
+         x_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x),  fi);
+         b_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b),  fi);
+         R_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R),  fi);
+         r_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(r),  fi);
+         rc_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(rc), ci);
+
+         hypre_SemiRestrictLoopStrides(A_dbox, stride, ndim, A_s);
+         hypre_SemiRestrictLoopStrides(x_dbox, stride, ndim, x_s);
+         hypre_SemiRestrictLoopStrides(b_dbox, stride, ndim, b_s);
+         hypre_SemiRestrictLoopStrides(R_dbox, stridec, ndim, R_s);
+         hypre_SemiRestrictLoopStrides(r_dbox, stride, ndim, r_s);
+         hypre_SemiRestrictLoopStrides(rc_dbox, stridec, ndim, y_s);
+         for (si = 0; si < stencil_size; si++)
+         {
+            xoff[si] = hypre_BoxOffsetDistance(x_dbox, A_shape[si]);
+         }
+
+         Rp0_offset = 0;
+         if (R_stored_as_transpose)
+         {
+            Rp0 = hypre_StructMatrixBoxData(R, fi, 1);
+            Rp1 = hypre_StructMatrixBoxData(R, fi, 0);
+            Rp0_offset = -hypre_BoxOffsetDistance(R_dbox, R_shape[1]);
+         }
+         else
+         {
+            Rp0 = hypre_StructMatrixBoxData(R, fi, 0);
+            Rp1 = hypre_StructMatrixBoxData(R, fi, 1);
+         }
+         rp  = hypre_StructVectorBoxData(r, fi);
+         rcp = hypre_StructVectorBoxData(rc, ci);
+         rp0_offset = hypre_BoxOffsetDistance(r_dbox, R_shape[0]);
+         rp1_offset = hypre_BoxOffsetDistance(r_dbox, R_shape[1]);
+
+         hypre_ForBoxI(j, compute_box_a)
+         {
+            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+            start  = hypre_BoxIMin(compute_box);
+            hypre_StructMapFineToCoarse(start, cindex, stride, startc);
+
+            hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+            for (d = 0; d < 3; d++)
+            {
+               n[d] = (d < ndim) ? hypre_IndexD(loop_size, d) : 1;
+            }
+            if (n[0] * n[1] * n[2] == 0)
+            {
+               continue;
+            }
+
+            Ai  = hypre_BoxIndexRank(A_dbox, start);
+            xi  = hypre_BoxIndexRank(x_dbox, start);
+            bi  = hypre_BoxIndexRank(b_dbox, start);
+            Ri  = hypre_BoxIndexRank(R_dbox, startc);
+            ri  = hypre_BoxIndexRank(r_dbox, start);
+            rci = hypre_BoxIndexRank(rc_dbox, startc);
+            for (si = 0; si < stencil_size; si++)
+            {
+               Ap[si] = hypre_StructMatrixBoxData(A, fi, si) + Ai;
+               if (Fp != NULL)
+               {
+                  Fp[si] = hypre_StructMatrixBoxDataFloat(A, fi, si) + Ai;
+               }
+            }
+
+            hypre_SemiRestrictResidualBoxes(stencil_size, Ap, Fp, A_s,
+                                            hypre_StructVectorBoxData(x, fi) + xi, xoff, x_s,
+                                            hypre_StructVectorBoxData(b, fi) + bi, b_s,
+                                            Rp0 + Ri + Rp0_offset, Rp1 + Ri, R_s,
+                                            rp + ri + rp0_offset, rp + ri + rp1_offset, r_s,
+                                            rcp + rci, y_s, n);
+         }
+      }
+   }
+
+   hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(Fp, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Return
+    *-----------------------------------------------------------------------*/
+
+   hypre_IncFLOPCount(2 * hypre_StructMatrixGlobalSize(A) +
+                      4 * hypre_StructVectorGlobalSize(rc));
+   hypre_EndTiming(restrict_data -> time_index);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -323,6 +993,7 @@ hypre_SemiRestrictDestroy( void *restrict_vdata )
    {
       hypre_StructMatrixDestroy(restrict_data -> R);
       hypre_ComputePkgDestroy(restrict_data -> compute_pkg);
+      hypre_ComputePkgDestroy(restrict_data -> residual_compute_pkg);
       hypre_FinalizeTiming(restrict_data -> time_index);
       hypre_TFree(restrict_data, HYPRE_MEMORY_HOST);
    }
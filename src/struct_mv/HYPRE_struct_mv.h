@@ -325,7 +325,9 @@ HYPRE_Int HYPRE_StructMatrixGetBoxValues2(HYPRE_StructMatrix  matrix,
 /**
  * Define symmetry properties of the matrix.  By default, matrices are assumed
  * to be nonsymmetric.  Significant storage savings can be made if the matrix is
- * symmetric.
+ * symmetric.  The host matrix-vector product and point relaxation kernels use
+ * each stored coefficient for both of its entries in the same pass, so that
+ * symmetric storage also reduces the memory traffic of these kernels.
  **/
 HYPRE_Int HYPRE_StructMatrixSetSymmetric(HYPRE_StructMatrix  matrix,
                                          HYPRE_Int           symmetric);
@@ -1171,6 +1171,23 @@ typedef struct hypre_CommType_struct
 
 } hypre_CommType;
 
+/*--------------------------------------------------------------------------
+ * hypre_CommPlan:
+ *   Precompiled pack (or unpack) plan for the send (or recv) types of a
+ *   CommPkg.  The buffer of type i is a sequence of runs r = run_starts[i],
+ *   ..., run_starts[i+1]-1, each consisting of run_lengths[r] contiguous data
+ *   values starting at data offset run_offsets[r] (-1 means zeros).
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_CommPlan_struct
+{
+   HYPRE_Int             num_types;
+   HYPRE_Int            *run_starts;
+   HYPRE_Int            *run_offsets;
+   HYPRE_Int            *run_lengths;
+
+} hypre_CommPlan;
+
 /*--------------------------------------------------------------------------
  * hypre_CommPkg:
  *   Structure containing information for doing communications
@@ -1217,6 +1234,16 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* persistent schedule, set up on the first exchange after first_comm */
+   HYPRE_Int          pers_state;  /* 0 = none, 1 = ready, 2 = in use, -1 = off */
+   HYPRE_Int          pers_tag;
+   hypre_MPI_Request *pers_requests;
+   hypre_MPI_Status  *pers_status;
+   HYPRE_Complex    **pers_send_buffers;
+   HYPRE_Complex    **pers_recv_buffers;
+   hypre_CommPlan    *send_plan;
+   hypre_CommPlan    *recv_plan;
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -1243,6 +1270,12 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+   /* flags for receives already unpacked by hypre_TestCommunication */
+   HYPRE_Int         *recvs_done;
+
+   /* uses the persistent schedule of comm_pkg */
+   HYPRE_Int          persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -1295,6 +1328,15 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommTypeRemBoxes(type)      (type -> rem_boxes)
 #define hypre_CommTypeRemBox(type, i)   (&(type -> rem_boxes[i]))
 
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_CommPlan
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CommPlanNumTypes(plan)      (plan -> num_types)
+#define hypre_CommPlanRunStarts(plan)     (plan -> run_starts)
+#define hypre_CommPlanRunOffsets(plan)    (plan -> run_offsets)
+#define hypre_CommPlanRunLengths(plan)    (plan -> run_lengths)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommPkg
  *--------------------------------------------------------------------------*/
@@ -1336,6 +1378,15 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersState(comm_pkg)                  (comm_pkg -> pers_state)
+#define hypre_CommPkgPersTag(comm_pkg)                    (comm_pkg -> pers_tag)
+#define hypre_CommPkgPersRequests(comm_pkg)               (comm_pkg -> pers_requests)
+#define hypre_CommPkgPersStatus(comm_pkg)                 (comm_pkg -> pers_status)
+#define hypre_CommPkgPersSendBuffers(comm_pkg)            (comm_pkg -> pers_send_buffers)
+#define hypre_CommPkgPersRecvBuffers(comm_pkg)            (comm_pkg -> pers_recv_buffers)
+#define hypre_CommPkgSendPlan(comm_pkg)                   (comm_pkg -> send_plan)
+#define hypre_CommPkgRecvPlan(comm_pkg)                   (comm_pkg -> recv_plan)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -1351,6 +1402,8 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_device)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_device)
+#define hypre_CommHandleRecvsDone(comm_handle)            (comm_handle -> recvs_done)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
 
 #endif
 /******************************************************************************
@@ -1381,6 +1434,11 @@ typedef struct hypre_ComputeInfo_struct
    hypre_BoxArrayArray   *dept_boxes;
    hypre_Index            stride;
 
+   /* stencil extent below/above each point, used to find which receives a
+    * dependent box needs (a negative lborder means "all of them") */
+   hypre_Index            lborder;
+   hypre_Index            rborder;
+
 } hypre_ComputeInfo;
 
 /*--------------------------------------------------------------------------
@@ -1400,6 +1458,15 @@ typedef struct hypre_ComputePkg_struct
    hypre_BoxArray        *data_space;
    HYPRE_Int              num_values;
 
+   /* Dependent boxes are computed as the receives they need arrive (see
+    * hypre_NextDeptComputations).  These are NULL if this is not done. */
+   HYPRE_Int             *dept_num_recvs;   /* receives each dept box needs */
+   HYPRE_Int             *recv_dept_starts; /* dept boxes needing each receive */
+   HYPRE_Int             *recv_dept_boxes;
+   HYPRE_Int             *dept_wait;        /* receives still missing */
+   HYPRE_Int             *recv_indices;
+   hypre_BoxArrayArray   *ready_boxes;
+
 } hypre_ComputePkg;
 
 /*--------------------------------------------------------------------------
@@ -1410,6 +1477,8 @@ typedef struct hypre_ComputePkg_struct
 #define hypre_ComputeInfoIndtBoxes(info)    (info -> indt_boxes)
 #define hypre_ComputeInfoDeptBoxes(info)    (info -> dept_boxes)
 #define hypre_ComputeInfoStride(info)       (info -> stride)
+#define hypre_ComputeInfoLBorder(info)      (info -> lborder)
+#define hypre_ComputeInfoRBorder(info)      (info -> rborder)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_ComputePkg
@@ -1425,6 +1494,13 @@ typedef struct hypre_ComputePkg_struct
 #define hypre_ComputePkgDataSpace(compute_pkg)    (compute_pkg -> data_space)
 #define hypre_ComputePkgNumValues(compute_pkg)    (compute_pkg -> num_values)
 
+#define hypre_ComputePkgDeptNumRecvs(compute_pkg)   (compute_pkg -> dept_num_recvs)
+#define hypre_ComputePkgRecvDeptStarts(compute_pkg) (compute_pkg -> recv_dept_starts)
+#define hypre_ComputePkgRecvDeptBoxes(compute_pkg)  (compute_pkg -> recv_dept_boxes)
+#define hypre_ComputePkgDeptWait(compute_pkg)       (compute_pkg -> dept_wait)
+#define hypre_ComputePkgRecvIndices(compute_pkg)    (compute_pkg -> recv_indices)
+#define hypre_ComputePkgReadyBoxes(compute_pkg)     (compute_pkg -> ready_boxes)
+
 #endif
 /******************************************************************************
  * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
@@ -1468,6 +1544,13 @@ typedef struct hypre_StructMatrix_struct
                                                        data_indices[b][s] is the starting
                                                        index of matrix data corresponding
                                                        to box b and stencil coefficient s */
+   float                *data_float;                /* Single-precision copy of data
+                                                       (host, constant_coefficient 0
+                                                       only), or NULL */
+   HYPRE_Int            *constant_boxes;            /* Per box, 1 if the off-diagonal
+                                                       coefficients are stored as one
+                                                       value each (constant_coefficient
+                                                       0 only), or NULL */
    HYPRE_Int             constant_coefficient;      /* normally 0; set to 1 for
                                                        constant coefficient matrices
                                                        or 2 for constant coefficient
@@ -1502,6 +1585,8 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixDataSize(matrix)            ((matrix) -> data_size)
 #define hypre_StructMatrixDataConstSize(matrix)       ((matrix) -> data_const_size)
 #define hypre_StructMatrixDataIndices(matrix)         ((matrix) -> data_indices)
+#define hypre_StructMatrixDataFloat(matrix)           ((matrix) -> data_float)
+#define hypre_StructMatrixConstantBoxes(matrix)       ((matrix) -> constant_boxes)
 #define hypre_StructMatrixConstantCoefficient(matrix) ((matrix) -> constant_coefficient)
 #define hypre_StructMatrixSymmetric(matrix)           ((matrix) -> symmetric)
 #define hypre_StructMatrixSymmElements(matrix)        ((matrix) -> symm_elements)
@@ -1519,6 +1604,15 @@ hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 #define hypre_StructMatrixBoxData(matrix, b, s) \
 (hypre_StructMatrixStencilData(matrix)[s] + hypre_StructMatrixDataIndices(matrix)[b][s])
 
+/* single-precision copy of the coefficients (constant_coefficient 0 only) */
+#define hypre_StructMatrixBoxDataFloat(matrix, b, s) \
+(hypre_StructMatrixDataFloat(matrix) + hypre_StructMatrixDataIndices(matrix)[b][s])
+
+/* box b of a compressed matrix has constant off-diagonal coefficients, read
+   like those of a constant_coefficient 2 matrix */
+#define hypre_StructMatrixBoxConstant(matrix, b) \
+(hypre_StructMatrixConstantBoxes(matrix) != NULL && hypre_StructMatrixConstantBoxes(matrix)[b])
+
 #define hypre_StructMatrixBoxDataValue(matrix, b, s, index) \
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_BoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
@@ -1645,6 +1739,7 @@ HYPRE_Int hypre_SubtractBoxArrays ( hypre_BoxArray *box_array1, hypre_BoxArray *
                                     hypre_BoxArray *tmp_box_array );
 HYPRE_Int hypre_UnionBoxes ( hypre_BoxArray *boxes );
 HYPRE_Int hypre_MinUnionBoxes ( hypre_BoxArray *boxes );
+HYPRE_Int hypre_CoalesceBoxes ( hypre_BoxArray *boxes );
 
 /* box_boundary.c */
 HYPRE_Int hypre_BoxBoundaryIntersect ( hypre_Box *box, hypre_StructGrid *grid, HYPRE_Int d,
@@ -1783,6 +1878,8 @@ HYPRE_Int hypre_ComputePkgCreate ( hypre_ComputeInfo *compute_info, hypre_BoxArr
 HYPRE_Int hypre_ComputePkgDestroy ( hypre_ComputePkg *compute_pkg );
 HYPRE_Int hypre_InitializeIndtComputations ( hypre_ComputePkg *compute_pkg, HYPRE_Complex *data,
                                              hypre_CommHandle **comm_handle_ptr );
+HYPRE_Int hypre_NextDeptComputations ( hypre_ComputePkg *compute_pkg,
+                                       hypre_CommHandle **comm_handle_ptr, hypre_BoxArrayArray **compute_box_aa_ptr );
 HYPRE_Int hypre_FinalizeIndtComputations ( hypre_CommHandle *comm_handle );
 
 /* HYPRE_struct_grid.c */
@@ -1888,6 +1985,8 @@ HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Ind
                                    hypre_CommEntryType *comm_entry );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
+HYPRE_Int hypre_TestCommunication ( hypre_CommHandle *comm_handle, HYPRE_Int *num_done,
+                                    HYPRE_Int *recv_indices );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
 HYPRE_Int hypre_ExchangeLocalData ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                     HYPRE_Complex *recv_data, HYPRE_Int action );
@@ -1914,6 +2013,8 @@ HYPRE_Int hypre_StructGridAssemble ( hypre_StructGrid *grid );
 HYPRE_Int hypre_GatherAllBoxes ( MPI_Comm comm, hypre_BoxArray *boxes, HYPRE_Int dim,
                                  hypre_BoxArray **all_boxes_ptr, HYPRE_Int **all_procs_ptr, HYPRE_Int *first_local_ptr );
 HYPRE_Int hypre_ComputeBoxnums ( hypre_BoxArray *boxes, HYPRE_Int *procs, HYPRE_Int **boxnums_ptr );
+HYPRE_Int hypre_StructGridRedistribute ( hypre_StructGrid *grid, HYPRE_Int group_size,
+                                        hypre_StructGrid **new_grid_ptr );
 HYPRE_Int hypre_StructGridPrint ( FILE *file, hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridRead ( MPI_Comm comm, FILE *file, hypre_StructGrid **grid_ptr );
 HYPRE_Int hypre_StructGridSetNumGhost ( hypre_StructGrid *grid, HYPRE_Int *num_ghost );
@@ -1923,7 +2024,12 @@ HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
                                            HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x, hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Int hypre_StructInnerProdStart ( HYPRE_Int n, hypre_StructVector **x, hypre_StructVector **y,
+                                      HYPRE_Real *local_result, HYPRE_Real *result,
+                                      hypre_MPI_Request *request );
+HYPRE_Int hypre_StructInnerProdWait ( hypre_MPI_Request *request );
 
 /* struct_io.c */
 HYPRE_Int hypre_PrintBoxArrayData ( FILE *file, hypre_BoxArray *box_array,
@@ -1964,6 +2070,12 @@ HYPRE_Int hypre_StructMatrixClearValues ( hypre_StructMatrix *matrix, hypre_Inde
 HYPRE_Int hypre_StructMatrixClearBoxValues ( hypre_StructMatrix *matrix, hypre_Box *clear_box,
                                              HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices, HYPRE_Int boxnum, HYPRE_Int outside );
 HYPRE_Int hypre_StructMatrixAssemble ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixGetSymmPairs ( hypre_StructMatrix *matrix, HYPRE_Int *pairs,
+                                          HYPRE_Int *num_pairs_ptr );
+HYPRE_Int hypre_StructMatrixCreateDataFloat ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixDestroyDataFloat ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixDropData ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixCompressConstant ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixSetNumGhost ( hypre_StructMatrix *matrix, HYPRE_Int *num_ghost );
 HYPRE_Int hypre_StructMatrixSetConstantCoefficient ( hypre_StructMatrix *matrix,
                                                      HYPRE_Int constant_coefficient );
@@ -1986,6 +2098,8 @@ hypre_StructMatrix *hypre_StructMatrixCreateMask ( hypre_StructMatrix *matrix,
 void *hypre_StructMatvecCreate ( void );
 HYPRE_Int hypre_StructMatvecSetup ( void *matvec_vdata, hypre_StructMatrix *A,
                                     hypre_StructVector *x );
+HYPRE_Int hypre_StructMatvecSetDataFloat ( void *matvec_vdata, HYPRE_Int data_float );
+HYPRE_Int hypre_StructMatvecUsesDataFloat ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata, HYPRE_Complex alpha,
                                       hypre_StructMatrix *A, hypre_StructVector *x, HYPRE_Complex beta, hypre_StructVector *y );
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
@@ -1994,6 +2108,11 @@ HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hy
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecStencilKernel ( hypre_StructMatrix *A, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecStencil ( HYPRE_Complex alpha, hypre_StructMatrix *A,
+                                      hypre_StructVector *x, hypre_StructVector *y,
+                                      hypre_BoxArrayArray *compute_box_aa, HYPRE_Int stencil_size,
+                                      HYPRE_Int data_float );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
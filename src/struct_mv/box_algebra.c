@@ -652,3 +652,73 @@ hypre_MinUnionBoxes( hypre_BoxArray *boxes )
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * Merge pairs of non-empty boxes that share a whole face (same extents in
+ * all other dimensions) until no such pair remains.  Unlike
+ * hypre_UnionBoxes, this works in any dimension and never splits a box, so
+ * a box array that was split for distribution is put back together cheaply.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CoalesceBoxes( hypre_BoxArray *boxes )
+{
+   HYPRE_Int   ndim = hypre_BoxArrayNDim(boxes);
+   hypre_Box  *ibox, *jbox;
+   HYPRE_Int   i, j, d, e, merged;
+
+   do
+   {
+      merged = 0;
+      for (i = 0; i < hypre_BoxArraySize(boxes); i++)
+      {
+         ibox = hypre_BoxArrayBox(boxes, i);
+         if (hypre_BoxVolume(ibox) == 0)
+         {
+            continue;
+         }
+         for (j = i + 1; j < hypre_BoxArraySize(boxes); j++)
+         {
+            jbox = hypre_BoxArrayBox(boxes, j);
+            if (hypre_BoxVolume(jbox) == 0)
+            {
+               continue;
+            }
+
+            /* find the one dimension in which the extents differ */
+            d = -1;
+            for (e = 0; e < ndim; e++)
+            {
+               if ((hypre_BoxIMinD(ibox, e) != hypre_BoxIMinD(jbox, e)) ||
+                   (hypre_BoxIMaxD(ibox, e) != hypre_BoxIMaxD(jbox, e)))
+               {
+                  if (d > -1)
+                  {
+                     break;
+                  }
+                  d = e;
+               }
+            }
+            if ((e < ndim) || (d < 0))
+            {
+               continue;
+            }
+
+            if ((hypre_BoxIMaxD(ibox, d) + 1 == hypre_BoxIMinD(jbox, d)) ||
+                (hypre_BoxIMaxD(jbox, d) + 1 == hypre_BoxIMinD(ibox, d)))
+            {
+               hypre_BoxIMinD(ibox, d) = hypre_min(hypre_BoxIMinD(ibox, d),
+                                                   hypre_BoxIMinD(jbox, d));
+               hypre_BoxIMaxD(ibox, d) = hypre_max(hypre_BoxIMaxD(ibox, d),
+                                                   hypre_BoxIMaxD(jbox, d));
+               hypre_DeleteBox(boxes, j);
+               j = i;
+               merged = 1;
+            }
+         }
+      }
+   }
+   while (merged);
+
+   return hypre_error_flag;
+}
@@ -29,6 +29,8 @@ hypre_ComputeInfoCreate( hypre_CommInfo       *comm_info,
    hypre_ComputeInfoDeptBoxes(compute_info) = dept_boxes;
 
    hypre_SetIndex(hypre_ComputeInfoStride(compute_info), 1);
+   hypre_SetIndex(hypre_ComputeInfoLBorder(compute_info), -1);
+   hypre_SetIndex(hypre_ComputeInfoRBorder(compute_info), -1);
 
    *compute_info_ptr = compute_info;
 
@@ -91,11 +93,64 @@ hypre_ComputeInfoDestroy( hypre_ComputeInfo  *compute_info )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Returns 1 if box i of a grid-stencil computation should be split into an
+ * independent interior box and dependent boundary boxes.  On host this is done
+ * when the box receives data from another process and has a nonempty interior.
+ * If HYPRE\_OVERLAP\_COMM\_COMP is defined, all boxes are split.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ComputeInfoSplitBox( hypre_CommInfo  *comm_info,
+                           HYPRE_Int        i,
+                           hypre_Box       *box,
+                           hypre_Index      lborder,
+                           hypre_Index      rborder,
+                           HYPRE_Int        myid )
+{
+#if defined(HYPRE_OVERLAP_COMM_COMP)
+   return 1;
+#elif defined(HYPRE_USING_GPU) || defined(HYPRE_USING_RAJA) || defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return 0;
+#else
+   hypre_BoxArrayArray  *recv_boxes = hypre_CommInfoRecvBoxes(comm_info);
+   hypre_BoxArray       *recv_box_a;
+   HYPRE_Int            *recv_procs;
+   HYPRE_Int             ndim = hypre_BoxNDim(box);
+   HYPRE_Int             j, d;
+
+   for (d = 0; d < ndim; d++)
+   {
+      if (hypre_BoxSizeD(box, d) <= (lborder[d] + rborder[d]))
+      {
+         return 0;
+      }
+   }
+
+   if (i < hypre_BoxArrayArraySize(recv_boxes))
+   {
+      recv_box_a = hypre_BoxArrayArrayBoxArray(recv_boxes, i);
+      recv_procs = hypre_CommInfoRecvProcesses(comm_info)[i];
+      hypre_ForBoxI(j, recv_box_a)
+      {
+         if ( (recv_procs[j] != myid) &&
+              (hypre_BoxVolume(hypre_BoxArrayBox(recv_box_a, j)) > 0) )
+         {
+            return 1;
+         }
+      }
+   }
+
+   return 0;
+#endif
+}
+
 /*--------------------------------------------------------------------------
  * Return descriptions of communications and computations patterns for
- * a given grid-stencil computation.  If HYPRE\_OVERLAP\_COMM\_COMP is
- * defined, then the patterns are computed to allow for overlapping
- * communications and computations.  The default is no overlap.
+ * a given grid-stencil computation.  Boxes that receive off-process data
+ * are split (see hypre_ComputeInfoSplitBox) into an independent interior
+ * box and dependent boundary boxes to allow for overlapping communications
+ * and computations.  Other boxes are entirely dependent.
  *
  * Note: This routine assumes that the grid boxes do not overlap.
  *--------------------------------------------------------------------------*/
@@ -106,30 +161,30 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
                          hypre_ComputeInfo    **compute_info_ptr )
 {
    HYPRE_Int                ndim = hypre_StructGridNDim(grid);
+   hypre_ComputeInfo       *compute_info;
    hypre_CommInfo          *comm_info;
    hypre_BoxArrayArray     *indt_boxes;
    hypre_BoxArrayArray     *dept_boxes;
 
    hypre_BoxArray          *boxes;
+   hypre_Box               *box;
 
    hypre_BoxArray          *cbox_array;
    hypre_Box               *cbox;
 
-   HYPRE_Int                i;
-
-#ifdef HYPRE_OVERLAP_COMM_COMP
    hypre_Box               *rembox;
    hypre_Index             *stencil_shape;
    hypre_Index              lborder, rborder;
    HYPRE_Int                cbox_array_size;
-   HYPRE_Int                s, d;
-#endif
+   HYPRE_Int                myid;
+   HYPRE_Int                i, s, d, k;
 
    /*------------------------------------------------------
     * Extract needed grid info
     *------------------------------------------------------*/
 
    boxes = hypre_StructGridBoxes(grid);
+   hypre_MPI_Comm_rank(hypre_StructGridComm(grid), &myid);
 
    /*------------------------------------------------------
     * Get communication info
@@ -137,8 +192,6 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
 
    hypre_CreateCommInfoFromStencil(grid, stencil, &comm_info);
 
-#ifdef HYPRE_OVERLAP_COMM_COMP
-
    /*------------------------------------------------------
     * Compute border info
     *------------------------------------------------------*/
@@ -150,31 +203,45 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
    {
       for (d = 0; d < ndim; d++)
       {
-         i = hypre_IndexD(stencil_shape[s], d);
-         if (i < 0)
+         k = hypre_IndexD(stencil_shape[s], d);
+         if (k < 0)
          {
-            lborder[d] = hypre_max(lborder[d], -i);
+            lborder[d] = hypre_max(lborder[d], -k);
          }
-         else if (i > 0)
+         else if (k > 0)
          {
-            rborder[d] = hypre_max(rborder[d], i);
+            rborder[d] = hypre_max(rborder[d], k);
          }
       }
    }
 
    /*------------------------------------------------------
-    * Set up the dependent boxes
+    * Set up the independent and dependent boxes
     *------------------------------------------------------*/
 
+   indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
    dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
    rembox = hypre_BoxCreate(hypre_StructGridNDim(grid));
    hypre_ForBoxI(i, boxes)
    {
+      box = hypre_BoxArrayBox(boxes, i);
+
+      if (!hypre_ComputeInfoSplitBox(comm_info, i, box, lborder, rborder, myid))
+      {
+         cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
+         hypre_BoxArraySetSize(cbox_array, 1);
+         cbox = hypre_BoxArrayBox(cbox_array, 0);
+         hypre_CopyBox(box, cbox);
+
+         continue;
+      }
+
+      /* dependent boxes */
       cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
       hypre_BoxArraySetSize(cbox_array, 2 * ndim);
 
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), rembox);
+      hypre_CopyBox(box, rembox);
       cbox_array_size = 0;
       for (d = 0; d < ndim; d++)
       {
@@ -200,21 +267,12 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
          }
       }
       hypre_BoxArraySetSize(cbox_array, cbox_array_size);
-   }
-   hypre_BoxDestroy(rembox);
-
-   /*------------------------------------------------------
-    * Set up the independent boxes
-    *------------------------------------------------------*/
-
-   indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   hypre_ForBoxI(i, boxes)
-   {
+      /* independent box */
       cbox_array = hypre_BoxArrayArrayBoxArray(indt_boxes, i);
       hypre_BoxArraySetSize(cbox_array, 1);
       cbox = hypre_BoxArrayBox(cbox_array, 0);
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+      hypre_CopyBox(box, cbox);
 
       for (d = 0; d < ndim; d++)
       {
@@ -228,37 +286,185 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
          }
       }
    }
-
-#else
+   hypre_BoxDestroy(rembox);
 
    /*------------------------------------------------------
-    * Set up the independent boxes
+    * Return
     *------------------------------------------------------*/
 
-   indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+   hypre_ComputeInfoCreate(comm_info, indt_boxes, dept_boxes, &compute_info);
+   hypre_CopyIndex(lborder, hypre_ComputeInfoLBorder(compute_info));
+   hypre_CopyIndex(rborder, hypre_ComputeInfoRBorder(compute_info));
 
-   /*------------------------------------------------------
-    * Set up the dependent boxes
-    *------------------------------------------------------*/
+   *compute_info_ptr = compute_info;
 
-   dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+   return hypre_error_flag;
+}
 
-   hypre_ForBoxI(i, boxes)
+/*--------------------------------------------------------------------------
+ * Set up the receive dependencies of the dependent boxes so that they can be
+ * computed as their data arrives (see hypre_NextDeptComputations).  A
+ * dependent box needs a receive if one of its recv boxes from that process
+ * lies within the stencil borders of the box.  If the borders are not known,
+ * a dependent box needs all off-process receives of its grid box.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ComputePkgSetupDeptRecvs( hypre_ComputePkg   *compute_pkg,
+                                hypre_ComputeInfo  *compute_info )
+{
+   hypre_CommInfo       *comm_info   = hypre_ComputeInfoCommInfo(compute_info);
+   hypre_IndexRef        lborder     = hypre_ComputeInfoLBorder(compute_info);
+   hypre_IndexRef        rborder     = hypre_ComputeInfoRBorder(compute_info);
+   hypre_BoxArrayArray  *recv_boxes  = hypre_CommInfoRecvBoxes(comm_info);
+   HYPRE_Int           **recv_procs  = hypre_CommInfoRecvProcesses(comm_info);
+   hypre_CommPkg        *comm_pkg    = hypre_ComputePkgCommPkg(compute_pkg);
+   hypre_BoxArrayArray  *dept_boxes  = hypre_ComputePkgDeptBoxes(compute_pkg);
+   HYPRE_Int             num_recvs   = hypre_CommPkgNumRecvs(comm_pkg);
+   HYPRE_Int             ndim        = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int             use_borders = (hypre_IndexD(lborder, 0) >= 0);
+
+   HYPRE_Int            *dept_num_recvs;
+   HYPRE_Int            *recv_dept_starts;
+   HYPRE_Int            *recv_dept_boxes = NULL;
+   HYPRE_Int            *type_procs;
+   HYPRE_Int            *marks;
+   HYPRE_Int            *ready_sizes;
+
+   hypre_BoxArray       *dept_box_a;
+   hypre_BoxArray       *recv_box_a;
+   hypre_Box            *grow_box;
+   hypre_Box            *int_box;
+   HYPRE_Int             num_dept, myid, pass;
+   HYPRE_Int             i, j, k, m, r, d;
+
+   hypre_MPI_Comm_rank(hypre_CommPkgComm(comm_pkg), &myid);
+
+   /* the recv types are sorted by process */
+   type_procs = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   for (r = 0; r < num_recvs; r++)
    {
-      cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 1);
-      cbox = hypre_BoxArrayBox(cbox_array, 0);
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+      type_procs[r] = hypre_CommTypeProc(hypre_CommPkgRecvType(comm_pkg, r));
    }
 
-#endif
+   num_dept = 0;
+   ready_sizes = hypre_TAlloc(HYPRE_Int, hypre_BoxArrayArraySize(dept_boxes),
+                              HYPRE_MEMORY_HOST);
+   hypre_ForBoxArrayI(i, dept_boxes)
+   {
+      ready_sizes[i] = hypre_BoxArraySize(hypre_BoxArrayArrayBoxArray(dept_boxes, i));
+      num_dept += ready_sizes[i];
+   }
 
-   /*------------------------------------------------------
-    * Return
-    *------------------------------------------------------*/
+   dept_num_recvs   = hypre_CTAlloc(HYPRE_Int, num_dept, HYPRE_MEMORY_HOST);
+   recv_dept_starts = hypre_CTAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   marks            = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   grow_box         = hypre_BoxCreate(ndim);
+   int_box          = hypre_BoxCreate(ndim);
+
+   /* first pass counts, second pass fills */
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (r = 0; r < num_recvs; r++)
+      {
+         marks[r] = -1;
+      }
 
-   hypre_ComputeInfoCreate(comm_info, indt_boxes, dept_boxes,
-                           compute_info_ptr);
+      k = 0;
+      hypre_ForBoxArrayI(i, dept_boxes)
+      {
+         dept_box_a = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
+         recv_box_a = NULL;
+         if (i < hypre_BoxArrayArraySize(recv_boxes))
+         {
+            recv_box_a = hypre_BoxArrayArrayBoxArray(recv_boxes, i);
+         }
+
+         hypre_ForBoxI(j, dept_box_a)
+         {
+            hypre_CopyBox(hypre_BoxArrayBox(dept_box_a, j), grow_box);
+            for (d = 0; d < ndim; d++)
+            {
+               hypre_BoxIMinD(grow_box, d) -= hypre_IndexD(lborder, d);
+               hypre_BoxIMaxD(grow_box, d) += hypre_IndexD(rborder, d);
+            }
+
+            for (m = 0; (recv_box_a != NULL) && (m < hypre_BoxArraySize(recv_box_a)); m++)
+            {
+               if (recv_procs[i][m] == myid)
+               {
+                  continue;
+               }
+               r = hypre_BinarySearch(type_procs, recv_procs[i][m], num_recvs);
+               if ((r < 0) || (marks[r] == k))
+               {
+                  continue;
+               }
+               if (use_borders)
+               {
+                  hypre_IntersectBoxes(grow_box, hypre_BoxArrayBox(recv_box_a, m), int_box);
+                  if (hypre_BoxVolume(int_box) == 0)
+                  {
+                     continue;
+                  }
+               }
+
+               marks[r] = k;
+               if (pass == 0)
+               {
+                  dept_num_recvs[k]++;
+                  recv_dept_starts[r + 1]++;
+               }
+               else
+               {
+                  recv_dept_boxes[recv_dept_starts[r]++] = k;
+               }
+            }
+            k++;
+         }
+      }
+
+      if (pass == 0)
+      {
+         for (r = 0; r < num_recvs; r++)
+         {
+            recv_dept_starts[r + 1] += recv_dept_starts[r];
+         }
+         recv_dept_boxes = hypre_TAlloc(HYPRE_Int, recv_dept_starts[num_recvs],
+                                        HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         for (r = num_recvs; r > 0; r--)
+         {
+            recv_dept_starts[r] = recv_dept_starts[r - 1];
+         }
+         recv_dept_starts[0] = 0;
+      }
+   }
+
+   hypre_ComputePkgDeptNumRecvs(compute_pkg)   = dept_num_recvs;
+   hypre_ComputePkgRecvDeptStarts(compute_pkg) = recv_dept_starts;
+   hypre_ComputePkgRecvDeptBoxes(compute_pkg)  = recv_dept_boxes;
+   hypre_ComputePkgDeptWait(compute_pkg)       =
+      hypre_CTAlloc(HYPRE_Int, num_dept, HYPRE_MEMORY_HOST);
+   hypre_ComputePkgRecvIndices(compute_pkg)    =
+      hypre_CTAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   hypre_ComputePkgReadyBoxes(compute_pkg)     =
+      hypre_BoxArrayArrayCreate(hypre_BoxArrayArraySize(dept_boxes), ndim);
+   hypre_ForBoxArrayI(i, dept_boxes)
+   {
+      /* reserve space, then empty */
+      dept_box_a = hypre_BoxArrayArrayBoxArray(hypre_ComputePkgReadyBoxes(compute_pkg), i);
+      hypre_BoxArraySetSize(dept_box_a, ready_sizes[i]);
+      hypre_BoxArraySetSize(dept_box_a, 0);
+   }
+
+   hypre_TFree(type_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(ready_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(marks, HYPRE_MEMORY_HOST);
+   hypre_BoxDestroy(grow_box);
+   hypre_BoxDestroy(int_box);
 
    return hypre_error_flag;
 }
@@ -285,7 +491,6 @@ hypre_ComputePkgCreate( hypre_ComputeInfo     *compute_info,
    hypre_CommPkgCreate(hypre_ComputeInfoCommInfo(compute_info),
                        data_space, data_space, num_values, NULL, 0,
                        hypre_StructGridComm(grid), &comm_pkg);
-   hypre_CommInfoDestroy(hypre_ComputeInfoCommInfo(compute_info));
    hypre_ComputePkgCommPkg(compute_pkg) = comm_pkg;
 
    hypre_ComputePkgIndtBoxes(compute_pkg) =
@@ -295,6 +500,14 @@ hypre_ComputePkgCreate( hypre_ComputeInfo     *compute_info,
    hypre_CopyIndex(hypre_ComputeInfoStride(compute_info),
                    hypre_ComputePkgStride(compute_pkg));
 
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
+   {
+      hypre_ComputePkgSetupDeptRecvs(compute_pkg, compute_info);
+   }
+#endif
+   hypre_CommInfoDestroy(hypre_ComputeInfoCommInfo(compute_info));
+
    hypre_StructGridRef(grid, &hypre_ComputePkgGrid(compute_pkg));
    hypre_ComputePkgDataSpace(compute_pkg) = data_space;
    hypre_ComputePkgNumValues(compute_pkg) = num_values;
@@ -322,6 +535,13 @@ hypre_ComputePkgDestroy( hypre_ComputePkg *compute_pkg )
 
       hypre_StructGridDestroy(hypre_ComputePkgGrid(compute_pkg));
 
+      hypre_TFree(hypre_ComputePkgDeptNumRecvs(compute_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ComputePkgRecvDeptStarts(compute_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ComputePkgRecvDeptBoxes(compute_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ComputePkgDeptWait(compute_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ComputePkgRecvIndices(compute_pkg), HYPRE_MEMORY_HOST);
+      hypre_BoxArrayArrayDestroy(hypre_ComputePkgReadyBoxes(compute_pkg));
+
       hypre_TFree(compute_pkg, HYPRE_MEMORY_HOST);
    }
 
@@ -340,9 +560,122 @@ hypre_InitializeIndtComputations( hypre_ComputePkg  *compute_pkg,
                                   hypre_CommHandle **comm_handle_ptr )
 {
    hypre_CommPkg *comm_pkg = hypre_ComputePkgCommPkg(compute_pkg);
+   HYPRE_Int     *dept_num_recvs = hypre_ComputePkgDeptNumRecvs(compute_pkg);
+   HYPRE_Int      i, num_dept;
 
    hypre_InitializeCommunication(comm_pkg, data, data, 0, 0, comm_handle_ptr);
 
+   if (dept_num_recvs != NULL)
+   {
+      num_dept = 0;
+      hypre_ForBoxArrayI(i, hypre_ComputePkgDeptBoxes(compute_pkg))
+      {
+         num_dept += hypre_BoxArraySize(
+                        hypre_BoxArrayArrayBoxArray(hypre_ComputePkgDeptBoxes(compute_pkg), i));
+      }
+      hypre_TMemcpy(hypre_ComputePkgDeptWait(compute_pkg), dept_num_recvs,
+                    HYPRE_Int, num_dept, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Return the next set of dependent boxes that can be computed, completing
+ * receives as needed.  This is called after the independent computations,
+ * repeatedly until it returns NULL boxes, to allow for overlap of the
+ * dependent computations with the remaining communications.  When all
+ * receives have completed, the exchange is finalized and *comm_handle_ptr
+ * is set to NULL.
+ *
+ * If the receive dependencies were not set up, this finalizes the exchange
+ * and returns all of the dependent boxes at once.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_NextDeptComputations( hypre_ComputePkg     *compute_pkg,
+                            hypre_CommHandle    **comm_handle_ptr,
+                            hypre_BoxArrayArray **compute_box_aa_ptr )
+{
+   hypre_CommHandle     *comm_handle      = *comm_handle_ptr;
+   hypre_BoxArrayArray  *dept_boxes       = hypre_ComputePkgDeptBoxes(compute_pkg);
+   hypre_BoxArrayArray  *ready_boxes      = hypre_ComputePkgReadyBoxes(compute_pkg);
+   HYPRE_Int            *dept_wait        = hypre_ComputePkgDeptWait(compute_pkg);
+   HYPRE_Int            *recv_dept_starts = hypre_ComputePkgRecvDeptStarts(compute_pkg);
+   HYPRE_Int            *recv_dept_boxes  = hypre_ComputePkgRecvDeptBoxes(compute_pkg);
+   HYPRE_Int            *recv_indices     = hypre_ComputePkgRecvIndices(compute_pkg);
+
+   hypre_BoxArray       *dept_box_a;
+   hypre_BoxArray       *ready_box_a;
+   HYPRE_Int             num_ready, num_done, finalized;
+   HYPRE_Int             i, j, k, m, r;
+
+   *compute_box_aa_ptr = NULL;
+
+   if (comm_handle == NULL && dept_wait == NULL)
+   {
+      return hypre_error_flag;
+   }
+
+   if (dept_wait == NULL)
+   {
+      hypre_FinalizeCommunication(comm_handle);
+      *comm_handle_ptr = NULL;
+      *compute_box_aa_ptr = dept_boxes;
+
+      return hypre_error_flag;
+   }
+
+   while (1)
+   {
+      /* collect the boxes that are ready (mark them with -1) */
+      finalized = (*comm_handle_ptr == NULL);
+      num_ready = 0;
+      k = 0;
+      hypre_ForBoxArrayI(i, dept_boxes)
+      {
+         dept_box_a  = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
+         ready_box_a = hypre_BoxArrayArrayBoxArray(ready_boxes, i);
+         hypre_BoxArraySetSize(ready_box_a, 0);
+         hypre_ForBoxI(j, dept_box_a)
+         {
+            if ( (dept_wait[k] == 0) || (finalized && (dept_wait[k] > 0)) )
+            {
+               hypre_AppendBox(hypre_BoxArrayBox(dept_box_a, j), ready_box_a);
+               dept_wait[k] = -1;
+               num_ready++;
+            }
+            k++;
+         }
+      }
+
+      if (num_ready > 0)
+      {
+         *compute_box_aa_ptr = ready_boxes;
+         break;
+      }
+      if (finalized)
+      {
+         break;
+      }
+
+      hypre_TestCommunication(*comm_handle_ptr, &num_done, recv_indices);
+      if (num_done == 0)
+      {
+         /* remaining receives are completed here; everything is ready */
+         hypre_FinalizeCommunication(*comm_handle_ptr);
+         *comm_handle_ptr = NULL;
+      }
+      for (m = 0; m < num_done; m++)
+      {
+         r = recv_indices[m];
+         for (j = recv_dept_starts[r]; j < recv_dept_starts[r + 1]; j++)
+         {
+            dept_wait[recv_dept_boxes[j]]--;
+         }
+      }
+   }
+
    return hypre_error_flag;
 }
 
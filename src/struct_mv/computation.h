@@ -26,6 +26,11 @@ typedef struct hypre_ComputeInfo_struct
    hypre_BoxArrayArray   *dept_boxes;
    hypre_Index            stride;
 
+   /* stencil extent below/above each point, used to find which receives a
+    * dependent box needs (a negative lborder means "all of them") */
+   hypre_Index            lborder;
+   hypre_Index            rborder;
+
 } hypre_ComputeInfo;
 
 /*--------------------------------------------------------------------------
@@ -45,6 +50,15 @@ typedef struct hypre_ComputePkg_struct
    hypre_BoxArray        *data_space;
    HYPRE_Int              num_values;
 
+   /* Dependent boxes are computed as the receives they need arrive (see
+    * hypre_NextDeptComputations).  These are NULL if this is not done. */
+   HYPRE_Int             *dept_num_recvs;   /* receives each dept box needs */
+   HYPRE_Int             *recv_dept_starts; /* dept boxes needing each receive */
+   HYPRE_Int             *recv_dept_boxes;
+   HYPRE_Int             *dept_wait;        /* receives still missing */
+   HYPRE_Int             *recv_indices;
+   hypre_BoxArrayArray   *ready_boxes;
+
 } hypre_ComputePkg;
 
 /*--------------------------------------------------------------------------
@@ -55,6 +69,8 @@ typedef struct hypre_ComputePkg_struct
 #define hypre_ComputeInfoIndtBoxes(info)    (info -> indt_boxes)
 #define hypre_ComputeInfoDeptBoxes(info)    (info -> dept_boxes)
 #define hypre_ComputeInfoStride(info)       (info -> stride)
+#define hypre_ComputeInfoLBorder(info)      (info -> lborder)
+#define hypre_ComputeInfoRBorder(info)      (info -> rborder)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_ComputePkg
@@ -70,4 +86,11 @@ typedef struct hypre_ComputePkg_struct
 #define hypre_ComputePkgDataSpace(compute_pkg)    (compute_pkg -> data_space)
 #define hypre_ComputePkgNumValues(compute_pkg)    (compute_pkg -> num_values)
 
+#define hypre_ComputePkgDeptNumRecvs(compute_pkg)   (compute_pkg -> dept_num_recvs)
+#define hypre_ComputePkgRecvDeptStarts(compute_pkg) (compute_pkg -> recv_dept_starts)
+#define hypre_ComputePkgRecvDeptBoxes(compute_pkg)  (compute_pkg -> recv_dept_boxes)
+#define hypre_ComputePkgDeptWait(compute_pkg)       (compute_pkg -> dept_wait)
+#define hypre_ComputePkgRecvIndices(compute_pkg)    (compute_pkg -> recv_indices)
+#define hypre_ComputePkgReadyBoxes(compute_pkg)     (compute_pkg -> ready_boxes)
+
 #endif
@@ -39,6 +39,7 @@ HYPRE_Int hypre_SubtractBoxArrays ( hypre_BoxArray *box_array1, hypre_BoxArray *
                                     hypre_BoxArray *tmp_box_array );
 HYPRE_Int hypre_UnionBoxes ( hypre_BoxArray *boxes );
 HYPRE_Int hypre_MinUnionBoxes ( hypre_BoxArray *boxes );
+HYPRE_Int hypre_CoalesceBoxes ( hypre_BoxArray *boxes );
 
 /* box_boundary.c */
 HYPRE_Int hypre_BoxBoundaryIntersect ( hypre_Box *box, hypre_StructGrid *grid, HYPRE_Int d,
@@ -177,6 +178,8 @@ HYPRE_Int hypre_ComputePkgCreate ( hypre_ComputeInfo *compute_info, hypre_BoxArr
 HYPRE_Int hypre_ComputePkgDestroy ( hypre_ComputePkg *compute_pkg );
 HYPRE_Int hypre_InitializeIndtComputations ( hypre_ComputePkg *compute_pkg, HYPRE_Complex *data,
                                              hypre_CommHandle **comm_handle_ptr );
+HYPRE_Int hypre_NextDeptComputations ( hypre_ComputePkg *compute_pkg,
+                                       hypre_CommHandle **comm_handle_ptr, hypre_BoxArrayArray **compute_box_aa_ptr );
 HYPRE_Int hypre_FinalizeIndtComputations ( hypre_CommHandle *comm_handle );
 
 /* HYPRE_struct_grid.c */
@@ -282,6 +285,8 @@ HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Ind
                                    hypre_CommEntryType *comm_entry );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
+HYPRE_Int hypre_TestCommunication ( hypre_CommHandle *comm_handle, HYPRE_Int *num_done,
+                                    HYPRE_Int *recv_indices );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
 HYPRE_Int hypre_ExchangeLocalData ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                     HYPRE_Complex *recv_data, HYPRE_Int action );
@@ -308,6 +313,8 @@ HYPRE_Int hypre_StructGridAssemble ( hypre_StructGrid *grid );
 HYPRE_Int hypre_GatherAllBoxes ( MPI_Comm comm, hypre_BoxArray *boxes, HYPRE_Int dim,
                                  hypre_BoxArray **all_boxes_ptr, HYPRE_Int **all_procs_ptr, HYPRE_Int *first_local_ptr );
 HYPRE_Int hypre_ComputeBoxnums ( hypre_BoxArray *boxes, HYPRE_Int *procs, HYPRE_Int **boxnums_ptr );
+HYPRE_Int hypre_StructGridRedistribute ( hypre_StructGrid *grid, HYPRE_Int group_size,
+                                        hypre_StructGrid **new_grid_ptr );
 HYPRE_Int hypre_StructGridPrint ( FILE *file, hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridRead ( MPI_Comm comm, FILE *file, hypre_StructGrid **grid_ptr );
 HYPRE_Int hypre_StructGridSetNumGhost ( hypre_StructGrid *grid, HYPRE_Int *num_ghost );
@@ -317,7 +324,12 @@ HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
                                            HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x, hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Int hypre_StructInnerProdStart ( HYPRE_Int n, hypre_StructVector **x, hypre_StructVector **y,
+                                      HYPRE_Real *local_result, HYPRE_Real *result,
+                                      hypre_MPI_Request *request );
+HYPRE_Int hypre_StructInnerProdWait ( hypre_MPI_Request *request );
 
 /* struct_io.c */
 HYPRE_Int hypre_PrintBoxArrayData ( FILE *file, hypre_BoxArray *box_array,
@@ -358,6 +370,12 @@ HYPRE_Int hypre_StructMatrixClearValues ( hypre_StructMatrix *matrix, hypre_Inde
 HYPRE_Int hypre_StructMatrixClearBoxValues ( hypre_StructMatrix *matrix, hypre_Box *clear_box,
                                              HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices, HYPRE_Int boxnum, HYPRE_Int outside );
 HYPRE_Int hypre_StructMatrixAssemble ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixGetSymmPairs ( hypre_StructMatrix *matrix, HYPRE_Int *pairs,
+                                          HYPRE_Int *num_pairs_ptr );
+HYPRE_Int hypre_StructMatrixCreateDataFloat ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixDestroyDataFloat ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixDropData ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixCompressConstant ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixSetNumGhost ( hypre_StructMatrix *matrix, HYPRE_Int *num_ghost );
 HYPRE_Int hypre_StructMatrixSetConstantCoefficient ( hypre_StructMatrix *matrix,
                                                      HYPRE_Int constant_coefficient );
@@ -380,6 +398,8 @@ hypre_StructMatrix *hypre_StructMatrixCreateMask ( hypre_StructMatrix *matrix,
 void *hypre_StructMatvecCreate ( void );
 HYPRE_Int hypre_StructMatvecSetup ( void *matvec_vdata, hypre_StructMatrix *A,
                                     hypre_StructVector *x );
+HYPRE_Int hypre_StructMatvecSetDataFloat ( void *matvec_vdata, HYPRE_Int data_float );
+HYPRE_Int hypre_StructMatvecUsesDataFloat ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata, HYPRE_Complex alpha,
                                       hypre_StructMatrix *A, hypre_StructVector *x, HYPRE_Complex beta, hypre_StructVector *y );
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
@@ -388,6 +408,11 @@ HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hy
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecStencilKernel ( hypre_StructMatrix *A, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecStencil ( HYPRE_Complex alpha, hypre_StructMatrix *A,
+                                      hypre_StructVector *x, hypre_StructVector *y,
+                                      hypre_BoxArrayArray *compute_box_aa, HYPRE_Int stencil_size,
+                                      HYPRE_Int data_float );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
@@ -762,6 +762,374 @@ hypre_CommTypeSetEntry( hypre_Box           *box,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Create a pack (or unpack) plan for the given send (or recv) types.  The
+ * plan lists the data offsets in the same order as the communication buffer
+ * layout, compressed into runs of contiguous values.  For send types, the
+ * entry 'order' arrays are applied (negative order means zeros).
+ *--------------------------------------------------------------------------*/
+
+static hypre_CommPlan *
+hypre_CommPlanCreate( hypre_CommPkg  *comm_pkg,
+                      HYPRE_Int       num_types,
+                      hypre_CommType *comm_types,
+                      HYPRE_Int       use_order )
+{
+   HYPRE_Int            ndim       = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int            num_values = hypre_CommPkgNumValues(comm_pkg);
+   hypre_CommPlan      *plan;
+   hypre_CommType      *comm_type;
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int           *length_array;
+   HYPRE_Int           *stride_array;
+   HYPRE_Int           *order;
+   HYPRE_Int           *run_starts;
+   HYPRE_Int           *run_offsets;
+   HYPRE_Int           *run_lengths;
+   HYPRE_Int            num_runs, max_runs, first_run;
+   HYPRE_Int            base, size, off, m, n;
+   HYPRE_Int            i, j, d, ll;
+
+   max_runs    = 16;
+   num_runs    = 0;
+   run_starts  = hypre_CTAlloc(HYPRE_Int, num_types + 1, HYPRE_MEMORY_HOST);
+   run_offsets = hypre_TAlloc(HYPRE_Int, max_runs, HYPRE_MEMORY_HOST);
+   run_lengths = hypre_TAlloc(HYPRE_Int, max_runs, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_types; i++)
+   {
+      comm_type = &comm_types[i];
+      first_run = num_runs;
+
+      for (j = 0; j < hypre_CommTypeNumEntries(comm_type); j++)
+      {
+         comm_entry   = hypre_CommTypeEntry(comm_type, j);
+         length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+         stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+         order        = hypre_CommEntryTypeOrder(comm_entry);
+
+         size = 1;
+         for (d = 0; d < ndim; d++)
+         {
+            size *= length_array[d];
+         }
+
+         for (ll = 0; ll < num_values; ll++)
+         {
+            base = hypre_CommEntryTypeOffset(comm_entry);
+            if (use_order)
+            {
+               base = (order[ll] > -1) ? (base + order[ll] * stride_array[ndim]) : -1;
+            }
+            else
+            {
+               base += ll * stride_array[ndim];
+            }
+
+            /* buffer values follow the data in lexicographic order */
+            for (n = 0; n < size; n++)
+            {
+               off = base;
+               if (base > -1)
+               {
+                  m = n;
+                  for (d = 0; d < ndim; d++)
+                  {
+                     off += (m % length_array[d]) * stride_array[d];
+                     m /= length_array[d];
+                  }
+               }
+
+               if ( (num_runs > first_run) &&
+                    (((off < 0) && (run_offsets[num_runs - 1] < 0)) ||
+                     ((off > -1) && (run_offsets[num_runs - 1] > -1) &&
+                      (off == run_offsets[num_runs - 1] + run_lengths[num_runs - 1]))) )
+               {
+                  run_lengths[num_runs - 1]++;
+               }
+               else
+               {
+                  if (num_runs == max_runs)
+                  {
+                     max_runs *= 2;
+                     run_offsets = hypre_TReAlloc(run_offsets, HYPRE_Int, max_runs, HYPRE_MEMORY_HOST);
+                     run_lengths = hypre_TReAlloc(run_lengths, HYPRE_Int, max_runs, HYPRE_MEMORY_HOST);
+                  }
+                  run_offsets[num_runs] = off;
+                  run_lengths[num_runs] = 1;
+                  num_runs++;
+               }
+            }
+         }
+      }
+      run_starts[i + 1] = num_runs;
+   }
+
+   plan = hypre_TAlloc(hypre_CommPlan, 1, HYPRE_MEMORY_HOST);
+   hypre_CommPlanNumTypes(plan)   = num_types;
+   hypre_CommPlanRunStarts(plan)  = run_starts;
+   hypre_CommPlanRunOffsets(plan) = run_offsets;
+   hypre_CommPlanRunLengths(plan) = run_lengths;
+
+   return plan;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommPlanDestroy( hypre_CommPlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(hypre_CommPlanRunStarts(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPlanRunOffsets(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPlanRunLengths(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Pack the buffer 'buf' of type i from 'data' using a plan.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommPlanPack( hypre_CommPlan *plan,
+                    HYPRE_Int       i,
+                    HYPRE_Complex  *data,
+                    HYPRE_Complex  *buf )
+{
+   HYPRE_Int     *run_starts  = hypre_CommPlanRunStarts(plan);
+   HYPRE_Int     *run_offsets = hypre_CommPlanRunOffsets(plan);
+   HYPRE_Int     *run_lengths = hypre_CommPlanRunLengths(plan);
+   HYPRE_Complex *dp;
+   HYPRE_Int      r, k, len;
+
+   for (r = run_starts[i]; r < run_starts[i + 1]; r++)
+   {
+      len = run_lengths[r];
+      if (run_offsets[r] < 0)
+      {
+         for (k = 0; k < len; k++)
+         {
+            buf[k] = 0.0;
+         }
+      }
+      else
+      {
+         dp = data + run_offsets[r];
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp simd
+#endif
+         for (k = 0; k < len; k++)
+         {
+            buf[k] = dp[k];
+         }
+      }
+      buf += len;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Unpack the buffer 'buf' of type i into 'data' using a plan.  See
+ * hypre_InitializeCommunication for 'action'.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommPlanUnpack( hypre_CommPlan *plan,
+                      HYPRE_Int       i,
+                      HYPRE_Complex  *buf,
+                      HYPRE_Complex  *data,
+                      HYPRE_Int       action )
+{
+   HYPRE_Int     *run_starts  = hypre_CommPlanRunStarts(plan);
+   HYPRE_Int     *run_offsets = hypre_CommPlanRunOffsets(plan);
+   HYPRE_Int     *run_lengths = hypre_CommPlanRunLengths(plan);
+   HYPRE_Complex *dp;
+   HYPRE_Int      r, k, len;
+
+   for (r = run_starts[i]; r < run_starts[i + 1]; r++)
+   {
+      len = run_lengths[r];
+      dp  = data + run_offsets[r];
+      if (action > 0)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp simd
+#endif
+         for (k = 0; k < len; k++)
+         {
+            dp[k] += buf[k];
+         }
+      }
+      else
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp simd
+#endif
+         for (k = 0; k < len; k++)
+         {
+            dp[k] = buf[k];
+         }
+      }
+      buf += len;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Set up the persistent communication schedule of a CommPkg: the pack and
+ * unpack plans, the message buffers, and persistent MPI requests for the
+ * given tag.  This is only done after the first communication, since the
+ * recv entries are not known before then.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommPkgSetupPersistent( hypre_CommPkg *comm_pkg,
+                              HYPRE_Int      tag )
+{
+   HYPRE_Int            num_sends = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs = hypre_CommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm      = hypre_CommPkgComm(comm_pkg);
+
+   hypre_MPI_Request   *requests;
+   HYPRE_Complex      **send_buffers;
+   HYPRE_Complex      **recv_buffers;
+   hypre_CommType      *comm_type;
+   HYPRE_Int            i, j;
+
+   if ((num_sends + num_recvs) == 0)
+   {
+      hypre_CommPkgPersState(comm_pkg) = -1;
+      return hypre_error_flag;
+   }
+
+   hypre_CommPkgSendPlan(comm_pkg) =
+      hypre_CommPlanCreate(comm_pkg, num_sends, hypre_CommPkgSendTypes(comm_pkg), 1);
+   hypre_CommPkgRecvPlan(comm_pkg) =
+      hypre_CommPlanCreate(comm_pkg, num_recvs, hypre_CommPkgRecvTypes(comm_pkg), 0);
+
+   send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
+   if (num_sends > 0)
+   {
+      send_buffers[0] = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgSendBufsize(comm_pkg),
+                                      HYPRE_MEMORY_HOST);
+      for (i = 1; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i - 1);
+         send_buffers[i] = send_buffers[i - 1] + hypre_CommTypeBufsize(comm_type);
+      }
+   }
+
+   recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+   if (num_recvs > 0)
+   {
+      recv_buffers[0] = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgRecvBufsize(comm_pkg),
+                                      HYPRE_MEMORY_HOST);
+      for (i = 1; i < num_recvs; i++)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i - 1);
+         recv_buffers[i] = recv_buffers[i - 1] + hypre_CommTypeBufsize(comm_type);
+      }
+   }
+
+   /* the receive requests come first (see hypre_TestCommunication) */
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_recvs + num_sends, HYPRE_MEMORY_HOST);
+   j = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      hypre_MPI_Recv_init(recv_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      hypre_MPI_Send_init(send_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+
+   hypre_CommPkgPersTag(comm_pkg)         = tag;
+   hypre_CommPkgPersRequests(comm_pkg)    = requests;
+   hypre_CommPkgPersStatus(comm_pkg)      =
+      hypre_CTAlloc(hypre_MPI_Status, num_recvs + num_sends, HYPRE_MEMORY_HOST);
+   hypre_CommPkgPersSendBuffers(comm_pkg) = send_buffers;
+   hypre_CommPkgPersRecvBuffers(comm_pkg) = recv_buffers;
+   hypre_CommPkgPersState(comm_pkg)       = 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Initialize a communication exchange with the persistent schedule of
+ * comm_pkg.  The receives are started before the send buffers are packed.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_InitializePersistentCommunication( hypre_CommPkg     *comm_pkg,
+                                         HYPRE_Complex     *send_data,
+                                         HYPRE_Complex     *recv_data,
+                                         HYPRE_Int          action,
+                                         hypre_CommHandle **comm_handle_ptr )
+{
+   HYPRE_Int            num_sends    = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs    = hypre_CommPkgNumRecvs(comm_pkg);
+   hypre_MPI_Request   *requests     = hypre_CommPkgPersRequests(comm_pkg);
+   HYPRE_Complex      **send_buffers = hypre_CommPkgPersSendBuffers(comm_pkg);
+   HYPRE_Complex      **recv_buffers = hypre_CommPkgPersRecvBuffers(comm_pkg);
+
+   hypre_CommHandle    *comm_handle;
+   HYPRE_Int            i;
+
+   if (num_recvs > 0)
+   {
+      hypre_MPI_Startall(num_recvs, requests);
+   }
+
+   for (i = 0; i < num_sends; i++)
+   {
+      hypre_CommPlanPack(hypre_CommPkgSendPlan(comm_pkg), i, send_data, send_buffers[i]);
+   }
+
+   if (num_sends > 0)
+   {
+      hypre_MPI_Startall(num_sends, &requests[num_recvs]);
+   }
+
+   hypre_ExchangeLocalData(comm_pkg, send_data, recv_data, action);
+
+   comm_handle = hypre_TAlloc(hypre_CommHandle, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CommHandleCommPkg(comm_handle)     = comm_pkg;
+   hypre_CommHandleSendData(comm_handle)    = send_data;
+   hypre_CommHandleRecvData(comm_handle)    = recv_data;
+   hypre_CommHandleNumRequests(comm_handle) = num_recvs + num_sends;
+   hypre_CommHandleRequests(comm_handle)    = requests;
+   hypre_CommHandleStatus(comm_handle)      = hypre_CommPkgPersStatus(comm_pkg);
+   hypre_CommHandleSendBuffers(comm_handle) = send_buffers;
+   hypre_CommHandleRecvBuffers(comm_handle) = recv_buffers;
+   hypre_CommHandleAction(comm_handle)      = action;
+   hypre_CommHandleSendBuffersDevice(comm_handle) = send_buffers;
+   hypre_CommHandleRecvBuffersDevice(comm_handle) = recv_buffers;
+   hypre_CommHandleRecvsDone(comm_handle)   = NULL;
+   hypre_CommHandlePersistent(comm_handle)  = 1;
+
+   hypre_CommPkgPersState(comm_pkg) = 2;
+
+   *comm_handle_ptr = comm_handle;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
@@ -812,6 +1180,23 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    HYPRE_Int            i, j, d, ll;
    HYPRE_Int            size;
 
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   /*--------------------------------------------------------------------
+    * after the first communication, use the persistent schedule if it is
+    * free (it is set up for the first tag used)
+    *--------------------------------------------------------------------*/
+
+   if ( !hypre_CommPkgFirstComm(comm_pkg) && (hypre_CommPkgPersState(comm_pkg) == 0) )
+   {
+      hypre_CommPkgSetupPersistent(comm_pkg, tag);
+   }
+   if ( (hypre_CommPkgPersState(comm_pkg) == 1) && (hypre_CommPkgPersTag(comm_pkg) == tag) )
+   {
+      return hypre_InitializePersistentCommunication(comm_pkg, send_data, recv_data,
+                                                     action, comm_handle_ptr);
+   }
+#endif
+
    /*--------------------------------------------------------------------
     * allocate requests and status
     *--------------------------------------------------------------------*/
@@ -1104,12 +1489,161 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    hypre_CommHandleAction(comm_handle)      = action;
    hypre_CommHandleSendBuffersDevice(comm_handle) = send_buffers_device;
    hypre_CommHandleRecvBuffersDevice(comm_handle) = recv_buffers_device;
+   hypre_CommHandleRecvsDone(comm_handle)   = NULL;
+   hypre_CommHandlePersistent(comm_handle)  = 0;
 
    *comm_handle_ptr = comm_handle;
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Unpack the receive buffer 'dptr' of one receive type into 'recv_data'.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommTypeUnpack( hypre_CommPkg  *comm_pkg,
+                      hypre_CommType *comm_type,
+                      HYPRE_Complex  *dptr,
+                      HYPRE_Complex  *recv_data,
+                      HYPRE_Int       action )
+{
+   HYPRE_Int            ndim        = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int            num_values  = hypre_CommPkgNumValues(comm_pkg);
+   HYPRE_Int            num_entries = hypre_CommTypeNumEntries(comm_type);
+
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int           *length_array;
+   HYPRE_Int           *stride_array, unitst_array[HYPRE_MAXDIM + 1];
+   HYPRE_Complex       *kptr, *lptr;
+   HYPRE_Int            j, d, ll;
+
+   for (j = 0; j < num_entries; j++)
+   {
+      comm_entry = hypre_CommTypeEntry(comm_type, j);
+      length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+      stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+      unitst_array[0] = 1;
+      for (d = 1; d <= ndim; d++)
+      {
+         unitst_array[d] = unitst_array[d - 1] * length_array[d - 1];
+      }
+
+      lptr = recv_data + hypre_CommEntryTypeOffset(comm_entry);
+      for (ll = 0; ll < num_values; ll++)
+      {
+         kptr = lptr + ll * stride_array[ndim];
+
+#define DEVICE_VAR is_device_ptr(kptr,dptr)
+         hypre_BasicBoxLoop2Begin(ndim, length_array,
+                                  stride_array, ki,
+                                  unitst_array, di);
+         {
+            if (action > 0)
+            {
+               kptr[ki] += dptr[di];
+            }
+            else
+            {
+               kptr[ki] = dptr[di];
+            }
+         }
+         hypre_BoxLoop2End(ki, di);
+#undef DEVICE_VAR
+
+         dptr += unitst_array[ndim];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Complete and unpack the receives of a communication exchange that have
+ * arrived, without waiting for the others.  If none has arrived yet, this
+ * blocks until one does.  On return, 'recv_indices' holds the indices (into
+ * the CommPkg receive types) of the 'num_done' newly completed receives, and
+ * num_done = 0 means that there are no outstanding receives left.  The
+ * exchange must still be completed with hypre_FinalizeCommunication, which
+ * skips the receives already unpacked here.
+ *
+ * Receives are only completed early for host buffers after the first
+ * communication (which also exchanges the message layout); otherwise
+ * num_done = 0 is returned and everything is left to the finalize call.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TestCommunication( hypre_CommHandle *comm_handle,
+                         HYPRE_Int        *num_done,
+                         HYPRE_Int        *recv_indices )
+{
+   hypre_CommPkg       *comm_pkg     = hypre_CommHandleCommPkg(comm_handle);
+   HYPRE_Complex      **recv_buffers = hypre_CommHandleRecvBuffers(comm_handle);
+   hypre_MPI_Request   *requests     = hypre_CommHandleRequests(comm_handle);
+   hypre_MPI_Status    *status       = hypre_CommHandleStatus(comm_handle);
+   HYPRE_Int            num_recvs    = hypre_CommPkgNumRecvs(comm_pkg);
+   HYPRE_Int           *recvs_done;
+
+   HYPRE_Int            outcount, i;
+
+   *num_done = 0;
+
+   if ( (num_recvs == 0) || hypre_CommPkgFirstComm(comm_pkg) ||
+        (recv_buffers != hypre_CommHandleRecvBuffersDevice(comm_handle)) )
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_CommHandleRecvsDone(comm_handle) == NULL)
+   {
+      hypre_CommHandleRecvsDone(comm_handle) =
+         hypre_CTAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   }
+   recvs_done = hypre_CommHandleRecvsDone(comm_handle);
+
+   /* the receive requests come first in 'requests' */
+   hypre_MPI_Testsome(num_recvs, requests, &outcount, recv_indices, status);
+   if (outcount == 0)
+   {
+      hypre_MPI_Waitany(num_recvs, requests, &i, status);
+      if (i != hypre_MPI_UNDEFINED)
+      {
+         recv_indices[0] = i;
+         outcount = 1;
+      }
+      else
+      {
+         outcount = hypre_MPI_UNDEFINED;
+      }
+   }
+   if (outcount == hypre_MPI_UNDEFINED)
+   {
+      return hypre_error_flag;
+   }
+
+   for (i = 0; i < outcount; i++)
+   {
+      if (hypre_CommHandlePersistent(comm_handle))
+      {
+         hypre_CommPlanUnpack(hypre_CommPkgRecvPlan(comm_pkg), recv_indices[i],
+                              recv_buffers[recv_indices[i]],
+                              hypre_CommHandleRecvData(comm_handle),
+                              hypre_CommHandleAction(comm_handle));
+      }
+      else
+      {
+         hypre_CommTypeUnpack(comm_pkg, hypre_CommPkgRecvType(comm_pkg, recv_indices[i]),
+                              recv_buffers[recv_indices[i]],
+                              hypre_CommHandleRecvData(comm_handle),
+                              hypre_CommHandleAction(comm_handle));
+      }
+      recvs_done[recv_indices[i]] = 1;
+   }
+   *num_done = outcount;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Finalize a communication exchange.  This routine blocks until all
  * of the communication requests are completed.
@@ -1125,27 +1659,21 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
    HYPRE_Complex      **send_buffers = hypre_CommHandleSendBuffers(comm_handle);
    HYPRE_Complex      **recv_buffers = hypre_CommHandleRecvBuffers(comm_handle);
    HYPRE_Int            action       = hypre_CommHandleAction(comm_handle);
+   HYPRE_Int           *recvs_done   = hypre_CommHandleRecvsDone(comm_handle);
 
-   HYPRE_Int            ndim         = hypre_CommPkgNDim(comm_pkg);
-   HYPRE_Int            num_values   = hypre_CommPkgNumValues(comm_pkg);
    HYPRE_Int            num_sends    = hypre_CommPkgNumSends(comm_pkg);
    HYPRE_Int            num_recvs    = hypre_CommPkgNumRecvs(comm_pkg);
 
    hypre_CommType      *comm_type;
-   hypre_CommEntryType *comm_entry;
    HYPRE_Int            num_entries;
 
-   HYPRE_Int           *length_array;
-   HYPRE_Int           *stride_array, unitst_array[HYPRE_MAXDIM + 1];
-
-   HYPRE_Complex       *kptr, *lptr;
    HYPRE_Complex       *dptr;
    HYPRE_Int           *qptr;
 
    HYPRE_Int           *boxnums;
    hypre_Box           *boxes;
 
-   HYPRE_Int            i, j, d, ll;
+   HYPRE_Int            i;
 
    HYPRE_Complex      **send_buffers_device = hypre_CommHandleSendBuffersDevice(comm_handle);
    HYPRE_Complex      **recv_buffers_device = hypre_CommHandleRecvBuffersDevice(comm_handle);
@@ -1161,6 +1689,25 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
                         hypre_CommHandleStatus(comm_handle));
    }
 
+   if (hypre_CommHandlePersistent(comm_handle))
+   {
+      for (i = 0; i < num_recvs; i++)
+      {
+         if (!(recvs_done && recvs_done[i]))
+         {
+            hypre_CommPlanUnpack(hypre_CommPkgRecvPlan(comm_pkg), i, recv_buffers[i],
+                                 hypre_CommHandleRecvData(comm_handle), action);
+         }
+      }
+
+      /* the requests and buffers belong to comm_pkg */
+      hypre_CommPkgPersState(comm_pkg) = 1;
+      hypre_TFree(recvs_done, HYPRE_MEMORY_HOST);
+      hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
    /*--------------------------------------------------------------------
     * if FirstComm, unpack prefix information and set 'num_entries' and
     * 'entries' for RecvType
@@ -1246,6 +1793,12 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
 
    for (i = 0; i < num_recvs; i++)
    {
+      if (recvs_done && recvs_done[i])
+      {
+         /* already unpacked by hypre_TestCommunication */
+         continue;
+      }
+
       comm_type = hypre_CommPkgRecvType(comm_pkg, i);
       num_entries = hypre_CommTypeNumEntries(comm_type);
 
@@ -1256,43 +1809,8 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
          dptr += hypre_CommPrefixSize(num_entries);
       }
 
-      for (j = 0; j < num_entries; j++)
-      {
-         comm_entry = hypre_CommTypeEntry(comm_type, j);
-         length_array = hypre_CommEntryTypeLengthArray(comm_entry);
-         stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
-         unitst_array[0] = 1;
-         for (d = 1; d <= ndim; d++)
-         {
-            unitst_array[d] = unitst_array[d - 1] * length_array[d - 1];
-         }
-
-         lptr = hypre_CommHandleRecvData(comm_handle) +
-                hypre_CommEntryTypeOffset(comm_entry);
-         for (ll = 0; ll < num_values; ll++)
-         {
-            kptr = lptr + ll * stride_array[ndim];
-
-#define DEVICE_VAR is_device_ptr(kptr,dptr)
-            hypre_BasicBoxLoop2Begin(ndim, length_array,
-                                     stride_array, ki,
-                                     unitst_array, di);
-            {
-               if (action > 0)
-               {
-                  kptr[ki] += dptr[di];
-               }
-               else
-               {
-                  kptr[ki] = dptr[di];
-               }
-            }
-            hypre_BoxLoop2End(ki, di);
-#undef DEVICE_VAR
-
-            dptr += unitst_array[ndim];
-         }
-      }
+      hypre_CommTypeUnpack(comm_pkg, comm_type, dptr,
+                           hypre_CommHandleRecvData(comm_handle), action);
    }
 
    /*--------------------------------------------------------------------
@@ -1307,6 +1825,7 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
 
    hypre_TFree(hypre_CommHandleRequests(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_CommHandleStatus(comm_handle), HYPRE_MEMORY_HOST);
+   hypre_TFree(recvs_done, HYPRE_MEMORY_HOST);
    if (num_sends > 0)
    {
       hypre_TFree(send_buffers[0], HYPRE_MEMORY_HOST);
@@ -1466,6 +1985,28 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
       hypre_TFree(hypre_CommPkgIdentityOrder(comm_pkg), HYPRE_MEMORY_HOST);
 
+      if (hypre_CommPkgPersState(comm_pkg) > 0)
+      {
+         for (i = 0; i < (hypre_CommPkgNumSends(comm_pkg) + hypre_CommPkgNumRecvs(comm_pkg)); i++)
+         {
+            hypre_MPI_Request_free(&hypre_CommPkgPersRequests(comm_pkg)[i]);
+         }
+         if (hypre_CommPkgNumSends(comm_pkg) > 0)
+         {
+            hypre_TFree(hypre_CommPkgPersSendBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+         }
+         if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
+         {
+            hypre_TFree(hypre_CommPkgPersRecvBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_CommPkgPersSendBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgPersRecvBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgPersRequests(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgPersStatus(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_CommPlanDestroy(hypre_CommPkgSendPlan(comm_pkg));
+         hypre_CommPlanDestroy(hypre_CommPkgRecvPlan(comm_pkg));
+      }
+
       hypre_TFree(comm_pkg, HYPRE_MEMORY_HOST);
    }
 
@@ -72,6 +72,23 @@ typedef struct hypre_CommType_struct
 
 } hypre_CommType;
 
+/*--------------------------------------------------------------------------
+ * hypre_CommPlan:
+ *   Precompiled pack (or unpack) plan for the send (or recv) types of a
+ *   CommPkg.  The buffer of type i is a sequence of runs r = run_starts[i],
+ *   ..., run_starts[i+1]-1, each consisting of run_lengths[r] contiguous data
+ *   values starting at data offset run_offsets[r] (-1 means zeros).
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_CommPlan_struct
+{
+   HYPRE_Int             num_types;
+   HYPRE_Int            *run_starts;
+   HYPRE_Int            *run_offsets;
+   HYPRE_Int            *run_lengths;
+
+} hypre_CommPlan;
+
 /*--------------------------------------------------------------------------
  * hypre_CommPkg:
  *   Structure containing information for doing communications
@@ -118,6 +135,16 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* persistent schedule, set up on the first exchange after first_comm */
+   HYPRE_Int          pers_state;  /* 0 = none, 1 = ready, 2 = in use, -1 = off */
+   HYPRE_Int          pers_tag;
+   hypre_MPI_Request *pers_requests;
+   hypre_MPI_Status  *pers_status;
+   HYPRE_Complex    **pers_send_buffers;
+   HYPRE_Complex    **pers_recv_buffers;
+   hypre_CommPlan    *send_plan;
+   hypre_CommPlan    *recv_plan;
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -144,6 +171,12 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+   /* flags for receives already unpacked by hypre_TestCommunication */
+   HYPRE_Int         *recvs_done;
+
+   /* uses the persistent schedule of comm_pkg */
+   HYPRE_Int          persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -196,6 +229,15 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommTypeRemBoxes(type)      (type -> rem_boxes)
 #define hypre_CommTypeRemBox(type, i)   (&(type -> rem_boxes[i]))
 
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_CommPlan
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CommPlanNumTypes(plan)      (plan -> num_types)
+#define hypre_CommPlanRunStarts(plan)     (plan -> run_starts)
+#define hypre_CommPlanRunOffsets(plan)    (plan -> run_offsets)
+#define hypre_CommPlanRunLengths(plan)    (plan -> run_lengths)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommPkg
  *--------------------------------------------------------------------------*/
@@ -237,6 +279,15 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersState(comm_pkg)                  (comm_pkg -> pers_state)
+#define hypre_CommPkgPersTag(comm_pkg)                    (comm_pkg -> pers_tag)
+#define hypre_CommPkgPersRequests(comm_pkg)               (comm_pkg -> pers_requests)
+#define hypre_CommPkgPersStatus(comm_pkg)                 (comm_pkg -> pers_status)
+#define hypre_CommPkgPersSendBuffers(comm_pkg)            (comm_pkg -> pers_send_buffers)
+#define hypre_CommPkgPersRecvBuffers(comm_pkg)            (comm_pkg -> pers_recv_buffers)
+#define hypre_CommPkgSendPlan(comm_pkg)                   (comm_pkg -> send_plan)
+#define hypre_CommPkgRecvPlan(comm_pkg)                   (comm_pkg -> recv_plan)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -252,5 +303,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_device)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_device)
+#define hypre_CommHandleRecvsDone(comm_handle)            (comm_handle -> recvs_done)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
 
 #endif
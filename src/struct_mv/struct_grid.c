@@ -729,6 +729,113 @@ hypre_ComputeBoxnums(hypre_BoxArray *boxes,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructGridRedistribute
+ *
+ * Create a new grid in which the boxes of each group of 'group_size'
+ * consecutive processes are gathered onto the first process of the group,
+ * where boxes that share a face are merged.  The remaining processes own no
+ * boxes in the new grid, but the new grid lives on the same communicator and
+ * has the same periodicity as 'grid'.  This is used to agglomerate small
+ * coarse grids onto fewer processes.  Collective on the grid communicator.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructGridRedistribute( hypre_StructGrid  *grid,
+                              HYPRE_Int          group_size,
+                              hypre_StructGrid **new_grid_ptr )
+{
+   MPI_Comm           comm  = hypre_StructGridComm(grid);
+   HYPRE_Int          ndim  = hypre_StructGridNDim(grid);
+   hypre_BoxArray    *boxes = hypre_StructGridBoxes(grid);
+
+   hypre_StructGrid  *new_grid;
+   hypre_BoxArray    *new_boxes;
+   hypre_Box         *box;
+   MPI_Comm           group_comm;
+   HYPRE_Int         *send_buf, *recv_buf = NULL;
+   HYPRE_Int         *recv_sizes = NULL, *displs = NULL;
+   HYPRE_Int          send_size, recv_size;
+   HYPRE_Int          myid, group_id, num_group;
+   HYPRE_Int          i, j, d;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   group_size = hypre_max(group_size, 1);
+
+   hypre_StructGridCreate(comm, ndim, &new_grid);
+   hypre_StructGridSetPeriodic(new_grid, hypre_StructGridPeriodic(grid));
+   new_boxes = hypre_StructGridBoxes(new_grid);
+
+   /* gather the box extents of the group on its first process (in rank
+      order) over a communicator of its own, so no message tags are needed */
+   hypre_MPI_Comm_split(comm, myid / group_size, myid, &group_comm);
+   hypre_MPI_Comm_size(group_comm, &num_group);
+   hypre_MPI_Comm_rank(group_comm, &group_id);
+
+   send_size = 2 * ndim * hypre_BoxArraySize(boxes);
+   send_buf = hypre_TAlloc(HYPRE_Int, send_size, HYPRE_MEMORY_HOST);
+   j = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      for (d = 0; d < ndim; d++)
+      {
+         send_buf[j++] = hypre_BoxIMinD(box, d);
+         send_buf[j++] = hypre_BoxIMaxD(box, d);
+      }
+   }
+
+   if (group_id == 0)
+   {
+      recv_sizes = hypre_TAlloc(HYPRE_Int, num_group, HYPRE_MEMORY_HOST);
+      displs     = hypre_TAlloc(HYPRE_Int, num_group + 1, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gather(&send_size, 1, HYPRE_MPI_INT, recv_sizes, 1, HYPRE_MPI_INT,
+                    0, group_comm);
+   if (group_id == 0)
+   {
+      displs[0] = 0;
+      for (i = 0; i < num_group; i++)
+      {
+         displs[i + 1] = displs[i] + recv_sizes[i];
+      }
+      recv_buf = hypre_TAlloc(HYPRE_Int, displs[num_group], HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gatherv(send_buf, send_size, HYPRE_MPI_INT,
+                     recv_buf, recv_sizes, displs, HYPRE_MPI_INT, 0, group_comm);
+
+   if (group_id == 0)
+   {
+      recv_size = displs[num_group];
+      box = hypre_BoxCreate(ndim);
+      for (j = 0; j < recv_size; )
+      {
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_BoxIMinD(box, d) = recv_buf[j++];
+            hypre_BoxIMaxD(box, d) = recv_buf[j++];
+         }
+         hypre_AppendBox(box, new_boxes);
+      }
+      hypre_BoxDestroy(box);
+
+      hypre_CoalesceBoxes(new_boxes);
+
+      hypre_TFree(recv_sizes, HYPRE_MEMORY_HOST);
+      hypre_TFree(displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_buf, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+   hypre_MPI_Comm_free(&group_comm);
+
+   hypre_StructGridAssemble(new_grid);
+
+   *new_grid_ptr = new_grid;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructGridPrint
  *--------------------------------------------------------------------------*/
@@ -15,16 +15,15 @@
 #include "_hypre_struct_mv.hpp"
 
 /*--------------------------------------------------------------------------
- * hypre_StructInnerProd
+ * hypre_StructInnerProdLocal
+ *
+ * Returns the inner product of the process-local parts of x and y.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Real
-hypre_StructInnerProd( hypre_StructVector *x,
-                       hypre_StructVector *y )
+hypre_StructInnerProdLocal( hypre_StructVector *x,
+                            hypre_StructVector *y )
 {
-   HYPRE_Real       final_innerprod_result;
-   HYPRE_Real       process_result;
-
    hypre_Box       *x_data_box;
    hypre_Box       *y_data_box;
 
@@ -96,7 +95,21 @@ hypre_StructInnerProd( hypre_StructVector *x,
       local_result += (HYPRE_Real) box_sum;
    }
 
-   process_result = (HYPRE_Real) local_result;
+   return local_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructInnerProd( hypre_StructVector *x,
+                       hypre_StructVector *y )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   process_result = hypre_StructInnerProdLocal(x, y);
 
    hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
                        HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
@@ -105,3 +118,53 @@ hypre_StructInnerProd( hypre_StructVector *x,
 
    return final_innerprod_result;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProdStart
+ *
+ * Computes the local parts of the n inner products (x[i], y[i]) and starts
+ * a single non-blocking reduction of all of them.  The results are
+ * available in result[0..n-1] only after hypre_StructInnerProdWait.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructInnerProdStart( HYPRE_Int             n,
+                            hypre_StructVector  **x,
+                            hypre_StructVector  **y,
+                            HYPRE_Real           *local_result,
+                            HYPRE_Real           *result,
+                            hypre_MPI_Request    *request )
+{
+   HYPRE_Int  i;
+
+   if (n < 1)
+   {
+      *request = hypre_MPI_REQUEST_NULL;
+      return hypre_error_flag;
+   }
+
+   for (i = 0; i < n; i++)
+   {
+      local_result[i] = hypre_StructInnerProdLocal(x[i], y[i]);
+      hypre_IncFLOPCount(2 * hypre_StructVectorGlobalSize(x[i]));
+   }
+
+   hypre_MPI_Iallreduce(local_result, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, hypre_StructVectorComm(x[0]), request);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProdWait
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructInnerProdWait( hypre_MPI_Request *request )
+{
+   hypre_MPI_Status status;
+
+   hypre_MPI_Wait(request, &status);
+
+   return hypre_error_flag;
+}
@@ -104,6 +104,8 @@ hypre_StructMatrixDestroy( hypre_StructMatrix *matrix )
             hypre_TFree(hypre_StructMatrixDataConst(matrix), HYPRE_MEMORY_HOST);
          }
          hypre_TFree(hypre_StructMatrixStencilData(matrix), HYPRE_MEMORY_HOST);
+         hypre_StructMatrixDestroyDataFloat(matrix);
+         hypre_TFree(hypre_StructMatrixConstantBoxes(matrix), HYPRE_MEMORY_HOST);
          hypre_CommPkgDestroy(hypre_StructMatrixCommPkg(matrix));
          if (hypre_BoxArraySize(hypre_StructMatrixDataSpace(matrix)) > 0)
          {
@@ -454,6 +456,7 @@ hypre_StructMatrixInitializeData( hypre_StructMatrix *matrix,
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    hypre_StructGrid     *grid = hypre_StructMatrixGrid(matrix);
 #endif
+   hypre_StructMatrixDestroyDataFloat(matrix);
    hypre_StructMatrixData(matrix) = data;
    hypre_StructMatrixDataConst(matrix) = data_const;
    hypre_StructMatrixDataAlloced(matrix) = 0;
@@ -578,6 +581,12 @@ hypre_StructMatrixSetValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   if (action > -1)
+   {
+      /* the single-precision copy does not follow the new values */
+      hypre_StructMatrixDestroyDataFloat(matrix);
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
    symm_elements        = hypre_StructMatrixSymmElements(matrix);
 
@@ -730,6 +739,11 @@ hypre_StructMatrixSetBoxValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   if (action > -1)
+   {
+      hypre_StructMatrixDestroyDataFloat(matrix);
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
    symm_elements        = hypre_StructMatrixSymmElements(matrix);
 
@@ -916,6 +930,11 @@ hypre_StructMatrixSetConstantValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int           i, s;
 
+   if (action > -1)
+   {
+      hypre_StructMatrixDestroyDataFloat(matrix);
+   }
+
    boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
 
@@ -1079,6 +1098,8 @@ hypre_StructMatrixClearValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   hypre_StructMatrixDestroyDataFloat(matrix);
+
    if (outside > 0)
    {
       grid_boxes = hypre_StructMatrixDataSpace(matrix);
@@ -1153,6 +1174,8 @@ hypre_StructMatrixClearBoxValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   hypre_StructMatrixDestroyDataFloat(matrix);
+
    if (outside > 0)
    {
       grid_boxes = hypre_StructMatrixDataSpace(matrix);
@@ -1268,6 +1291,8 @@ hypre_StructMatrixAssemble( hypre_StructMatrix *matrix )
    HYPRE_Int              num_entries;
    /* End - variables for ghost layer identity code below */
 
+   hypre_StructMatrixDestroyDataFloat(matrix);
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient( matrix );
 
    /*-----------------------------------------------------------------------
@@ -1433,6 +1458,330 @@ hypre_StructMatrixAssemble( hypre_StructMatrix *matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixGetSymmPairs
+ *
+ * For a matrix with symmetric storage, lists each stored off-diagonal
+ * stencil entry together with its transpose, which uses the same stored
+ * coefficients shifted by the stencil offset: pairs[2*p] is the stored entry
+ * and pairs[2*p+1] its transpose.  The array 'pairs' must have room for
+ * stencil_size entries.  For a matrix without symmetric storage, num_pairs
+ * is set to 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixGetSymmPairs( hypre_StructMatrix *matrix,
+                                HYPRE_Int          *pairs,
+                                HYPRE_Int          *num_pairs_ptr )
+{
+   HYPRE_Int  *symm_elements = hypre_StructMatrixSymmElements(matrix);
+   HYPRE_Int   stencil_size  = hypre_StructStencilSize(hypre_StructMatrixStencil(matrix));
+   HYPRE_Int   num_pairs = 0;
+   HYPRE_Int   si, sj;
+
+   if (hypre_StructMatrixSymmetric(matrix))
+   {
+      for (sj = 0; sj < stencil_size; sj++)
+      {
+         si = symm_elements[sj];
+         if (si >= 0)
+         {
+            pairs[2 * num_pairs]     = si;
+            pairs[2 * num_pairs + 1] = sj;
+            num_pairs++;
+         }
+      }
+   }
+
+   *num_pairs_ptr = num_pairs;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixCreateDataFloat
+ *
+ * (Re)builds a single-precision copy of the variable coefficients, with the
+ * same layout as the matrix data (see hypre_StructMatrixBoxDataFloat).  Host
+ * kernels that are asked to use it read the coefficients from the copy and
+ * compute in HYPRE_Complex.  The copy is dropped by the routines that change
+ * the values through the matrix interface; after writing into the data array
+ * directly, the copy must be rebuilt.  Nothing is done for constant
+ * coefficient matrices, compressed matrices (see
+ * hypre_StructMatrixCompressConstant), complex builds and device data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixCreateDataFloat( hypre_StructMatrix *matrix )
+{
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   HYPRE_Complex *data      = hypre_StructMatrixData(matrix);
+   HYPRE_Int      data_size = hypre_StructMatrixDataSize(matrix);
+   float         *data_float;
+   HYPRE_Int      i;
+
+   if (hypre_StructMatrixConstantCoefficient(matrix) != 0 || data == NULL ||
+       hypre_StructMatrixConstantBoxes(matrix) != NULL)
+   {
+      return hypre_error_flag;
+   }
+
+   data_float = hypre_StructMatrixDataFloat(matrix);
+   if (data_float == NULL)
+   {
+      data_float = hypre_TAlloc(float, data_size, HYPRE_MEMORY_HOST);
+      hypre_StructMatrixDataFloat(matrix) = data_float;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < data_size; i++)
+   {
+      data_float[i] = (float) data[i];
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixDestroyDataFloat
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixDestroyDataFloat( hypre_StructMatrix *matrix )
+{
+   hypre_TFree(hypre_StructMatrixDataFloat(matrix), HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixDropData
+ *
+ * Frees the variable coefficients of a matrix that has a single-precision
+ * copy, so that only the copy is kept.  Afterwards, the matrix may only be
+ * applied by kernels that read the copy; its values can no longer be set or
+ * read through the matrix interface.  Nothing is done unless the matrix owns
+ * its data and has a copy.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixDropData( hypre_StructMatrix *matrix )
+{
+   HYPRE_Int  stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(matrix));
+   HYPRE_Int  i;
+
+   if (hypre_StructMatrixDataFloat(matrix) == NULL || !hypre_StructMatrixDataAlloced(matrix))
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_TFree(hypre_StructMatrixData(matrix), HYPRE_MEMORY_DEVICE);
+   for (i = 0; i < stencil_size; i++)
+   {
+      hypre_StructMatrixStencilData(matrix)[i] = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixCompressConstant
+ *
+ * Compresses the boxes of a variable-coefficient matrix in which every
+ * off-diagonal coefficient is the same at all grid points of the box.  The
+ * off-diagonal entries of such a box are stored as one value each and the
+ * diagonal is kept in full, as for a constant_coefficient 2 matrix, and the
+ * box is marked in the constant_boxes array (see
+ * hypre_StructMatrixBoxConstant).  The values are compared exactly, so the
+ * matrix is the same operator.  The data is reallocated if any box is
+ * compressed; the values of a compressed matrix can no longer be set.
+ * Nothing is done for constant coefficient matrices, matrices without a
+ * center entry, complex builds and device data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixCompressConstant( hypre_StructMatrix *matrix )
+{
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   HYPRE_Int            ndim          = hypre_StructMatrixNDim(matrix);
+   hypre_BoxArray      *grid_boxes    = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
+   hypre_BoxArray      *data_space    = hypre_StructMatrixDataSpace(matrix);
+   hypre_StructStencil *stencil       = hypre_StructMatrixStencil(matrix);
+   hypre_Index         *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int            stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int           *symm_elements = hypre_StructMatrixSymmElements(matrix);
+   HYPRE_Int          **data_indices  = hypre_StructMatrixDataIndices(matrix);
+
+   HYPRE_Int           *constant_boxes;
+   HYPRE_Complex       *data, *Ap, *Cp;
+   HYPRE_Complex        value;
+   hypre_Box           *grid_box;
+   hypre_Box           *data_box;
+   hypre_IndexRef       start;
+   hypre_Index          loop_size;
+   hypre_Index          stride;
+   hypre_Index          center_index;
+   HYPRE_Int           *indices;
+   HYPRE_Int            center, constant, num_constant, data_size, data_box_volume;
+   HYPRE_Int            i, s;
+
+   hypre_SetIndex(center_index, 0);
+   center = hypre_StructStencilElementRank(stencil, center_index);
+   if (hypre_StructMatrixConstantCoefficient(matrix) != 0 || center < 0 ||
+       hypre_StructMatrixData(matrix) == NULL || hypre_StructMatrixConstantBoxes(matrix) != NULL)
+   {
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Find the boxes with constant off-diagonal coefficients.  With symmetric
+    * storage, the transpose entries read the stored coefficients of the
+    * neighboring points, so they are checked as well.
+    *-----------------------------------------------------------------------*/
+
+   constant_boxes = hypre_CTAlloc(HYPRE_Int, hypre_BoxArraySize(data_space), HYPRE_MEMORY_HOST);
+   num_constant   = 0;
+
+   hypre_SetIndex(stride, 1);
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      grid_box = hypre_BoxArrayBox(grid_boxes, i);
+      data_box = hypre_BoxArrayBox(data_space, i);
+      start    = hypre_BoxIMin(grid_box);
+      hypre_BoxGetSize(grid_box, loop_size);
+
+      constant = (hypre_BoxVolume(grid_box) > 0);
+      for (s = 0; s < stencil_size && constant; s++)
+      {
+         if (s == center)
+         {
+            continue;
+         }
+
+         Ap    = hypre_StructMatrixBoxData(matrix, i, s);
+         value = Ap[hypre_BoxIndexRank(data_box, start)];
+         if (symm_elements[s] >= 0)
+         {
+            value = hypre_StructMatrixBoxData(matrix, i, symm_elements[s])
+                    [hypre_BoxIndexRank(data_box, start)];
+         }
+
+         hypre_SerialBoxLoop1Begin(ndim, loop_size, data_box, start, stride, Ai);
+         {
+            if (Ap[Ai] != value)
+            {
+               constant = 0;
+            }
+         }
+         hypre_SerialBoxLoop1End(Ai);
+      }
+
+      constant_boxes[i] = constant;
+      num_constant += constant;
+   }
+
+   if (num_constant == 0)
+   {
+      hypre_TFree(constant_boxes, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Lay out and copy the data: one value per off-diagonal entry of the
+    * constant boxes, the data box otherwise
+    *-----------------------------------------------------------------------*/
+
+   indices   = hypre_TAlloc(HYPRE_Int, stencil_size * hypre_BoxArraySize(data_space),
+                            HYPRE_MEMORY_HOST);
+   data_size = 0;
+   hypre_ForBoxI(i, data_space)
+   {
+      data_box = hypre_BoxArrayBox(data_space, i);
+      data_box_volume = hypre_BoxVolume(data_box);
+
+      for (s = 0; s < stencil_size; s++)
+      {
+         if (symm_elements[s] < 0)
+         {
+            indices[stencil_size * i + s] = data_size;
+            data_size += (constant_boxes[i] && s != center) ? 1 : data_box_volume;
+         }
+      }
+      for (s = 0; s < stencil_size; s++)
+      {
+         if (symm_elements[s] >= 0)
+         {
+            indices[stencil_size * i + s] = indices[stencil_size * i + symm_elements[s]];
+            if (!constant_boxes[i])
+            {
+               indices[stencil_size * i + s] += hypre_BoxOffsetDistance(data_box, stencil_shape[s]);
+            }
+         }
+      }
+   }
+
+   data = hypre_CTAlloc(HYPRE_Complex, data_size, HYPRE_MEMORY_DEVICE);
+   hypre_ForBoxI(i, data_space)
+   {
+      data_box = hypre_BoxArrayBox(data_space, i);
+      data_box_volume = hypre_BoxVolume(data_box);
+
+      for (s = 0; s < stencil_size; s++)
+      {
+         if (symm_elements[s] >= 0)
+         {
+            continue;
+         }
+
+         Ap = hypre_StructMatrixBoxData(matrix, i, s);
+         Cp = data + indices[stencil_size * i + s];
+         if (constant_boxes[i] && s != center)
+         {
+            start = hypre_BoxIMin(hypre_BoxArrayBox(grid_boxes, i));
+            Cp[0] = Ap[hypre_BoxIndexRank(data_box, start)];
+         }
+         else
+         {
+            hypre_TMemcpy(Cp, Ap, HYPRE_Complex, data_box_volume,
+                          HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_DEVICE);
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Switch the matrix to the new data
+    *-----------------------------------------------------------------------*/
+
+   hypre_StructMatrixDestroyDataFloat(matrix);
+   if (hypre_StructMatrixDataAlloced(matrix))
+   {
+      hypre_TFree(hypre_StructMatrixData(matrix), HYPRE_MEMORY_DEVICE);
+   }
+   hypre_ForBoxI(i, data_space)
+   {
+      for (s = 0; s < stencil_size; s++)
+      {
+         data_indices[i][s] = indices[stencil_size * i + s];
+      }
+   }
+   for (s = 0; s < stencil_size; s++)
+   {
+      hypre_StructMatrixStencilData(matrix)[s] = data;
+   }
+   hypre_StructMatrixData(matrix)          = data;
+   hypre_StructMatrixDataSize(matrix)      = data_size;
+   hypre_StructMatrixDataAlloced(matrix)   = 1;
+   hypre_StructMatrixConstantBoxes(matrix) = constant_boxes;
+
+   hypre_TFree(indices, HYPRE_MEMORY_HOST);
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatrixSetNumGhost
  *--------------------------------------------------------------------------*/
@@ -1572,6 +1921,8 @@ hypre_StructMatrixClearGhostValues( hypre_StructMatrix *matrix )
     * Set the matrix coefficients
     *-----------------------------------------------------------------------*/
 
+   hypre_StructMatrixDestroyDataFloat(matrix);
+
    hypre_SetIndex(unit_stride, 1);
 
    stencil = hypre_StructMatrixStencil(matrix);
@@ -1999,6 +2350,8 @@ hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix)
     * Set the matrix coefficients
     *-----------------------------------------------------------------------*/
 
+   hypre_StructMatrixDestroyDataFloat(matrix);
+
    grid = hypre_StructMatrixGrid(matrix);
    stencil = hypre_StructMatrixStencil(matrix);
    grid_boxes = hypre_StructGridBoxes(grid);
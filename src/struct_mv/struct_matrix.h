@@ -40,6 +40,13 @@ typedef struct hypre_StructMatrix_struct
                                                        data_indices[b][s] is the starting
                                                        index of matrix data corresponding
                                                        to box b and stencil coefficient s */
+   float                *data_float;                /* Single-precision copy of data
+                                                       (host, constant_coefficient 0
+                                                       only), or NULL */
+   HYPRE_Int            *constant_boxes;            /* Per box, 1 if the off-diagonal
+                                                       coefficients are stored as one
+                                                       value each (constant_coefficient
+                                                       0 only), or NULL */
    HYPRE_Int             constant_coefficient;      /* normally 0; set to 1 for
                                                        constant coefficient matrices
                                                        or 2 for constant coefficient
@@ -74,6 +81,8 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixDataSize(matrix)            ((matrix) -> data_size)
 #define hypre_StructMatrixDataConstSize(matrix)       ((matrix) -> data_const_size)
 #define hypre_StructMatrixDataIndices(matrix)         ((matrix) -> data_indices)
+#define hypre_StructMatrixDataFloat(matrix)           ((matrix) -> data_float)
+#define hypre_StructMatrixConstantBoxes(matrix)       ((matrix) -> constant_boxes)
 #define hypre_StructMatrixConstantCoefficient(matrix) ((matrix) -> constant_coefficient)
 #define hypre_StructMatrixSymmetric(matrix)           ((matrix) -> symmetric)
 #define hypre_StructMatrixSymmElements(matrix)        ((matrix) -> symm_elements)
@@ -91,6 +100,15 @@ hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 #define hypre_StructMatrixBoxData(matrix, b, s) \
 (hypre_StructMatrixStencilData(matrix)[s] + hypre_StructMatrixDataIndices(matrix)[b][s])
 
+/* single-precision copy of the coefficients (constant_coefficient 0 only) */
+#define hypre_StructMatrixBoxDataFloat(matrix, b, s) \
+(hypre_StructMatrixDataFloat(matrix) + hypre_StructMatrixDataIndices(matrix)[b][s])
+
+/* box b of a compressed matrix has constant off-diagonal coefficients, read
+   like those of a constant_coefficient 2 matrix */
+#define hypre_StructMatrixBoxConstant(matrix, b) \
+(hypre_StructMatrixConstantBoxes(matrix) != NULL && hypre_StructMatrixConstantBoxes(matrix)[b])
+
 #define hypre_StructMatrixBoxDataValue(matrix, b, s, index) \
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_BoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
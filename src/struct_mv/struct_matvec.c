@@ -29,9 +29,670 @@ typedef struct
    hypre_StructMatrix  *A;
    hypre_StructVector  *x;
    hypre_ComputePkg    *compute_pkg;
+   HYPRE_Int            stencil_kernel; /* stencil size of specialized kernel, or 0 */
+   HYPRE_Int            data_float;     /* read A from its single-precision copy */
 
 } hypre_StructMatvecData;
 
+/*--------------------------------------------------------------------------
+ * Stencil-specialized host kernels
+ *
+ * For the compact stencils (5 and 9-point in 2D, 7, 19 and 27-point in 3D)
+ * with unit stride, hypre_StructMatvecSetup selects a kernel that is
+ * specialized for the stencil size and accumulates up to DEPTH entries per
+ * point in a register.  Rows (unit-stride direction) are processed in tiles of
+ * consecutive j-rows that are swept through all k-planes, so the x rows of
+ * the neighboring planes are reused from cache; the row loops are written
+ * over unit-stride pointers so that they vectorize.  With symmetric storage,
+ * each stored off-diagonal coefficient is used for its entry and for the
+ * transposed entry (at a shifted point) in the same pass over a row.  For
+ * cc = 0, the kernels can read the coefficients from the single-precision
+ * copy of A (hypre_StructMatrixCreateDataFloat) and accumulate in
+ * HYPRE_Complex, which nearly halves the matrix traffic.
+ *--------------------------------------------------------------------------*/
+
+/* target size in bytes of the x rows kept in cache by one tile */
+#define HYPRE_STRUCT_MATVEC_TILE_BYTES 131072
+/* number of stencil entries accumulated in a register per pass over a row */
+#define HYPRE_STRUCT_MATVEC_DEPTH 9
+/* number of symmetric entry pairs accumulated per pass (symmetric storage) */
+#define HYPRE_STRUCT_MATVEC_SYMM_DEPTH 5
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecStencilKernel
+ *
+ * Returns the stencil size if A has one of the compact stencils above and
+ * the specialized kernels apply, and 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecStencilKernel( hypre_StructMatrix *A,
+                                 hypre_IndexRef      stride )
+{
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_RAJA) || defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return 0;
+#else
+   hypre_StructStencil *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index         *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int            stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int            ndim          = hypre_StructStencilNDim(stencil);
+   HYPRE_Int            max_dist, dist, si, sj, d;
+
+   if (ndim == 2 && (stencil_size == 5 || stencil_size == 9))
+   {
+      max_dist = (stencil_size == 5) ? 1 : 2;
+   }
+   else if (ndim == 3 && (stencil_size == 7 || stencil_size == 19 || stencil_size == 27))
+   {
+      max_dist = (stencil_size == 7) ? 1 : ((stencil_size == 19) ? 2 : 3);
+   }
+   else
+   {
+      return 0;
+   }
+
+   for (d = 0; d < ndim; d++)
+   {
+      if (hypre_IndexD(stride, d) != 1)
+      {
+         return 0;
+      }
+   }
+
+   /* all entries distinct, in the unit cube and within the 1-norm distance */
+   for (si = 0; si < stencil_size; si++)
+   {
+      dist = 0;
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_abs(hypre_IndexD(stencil_shape[si], d)) > 1)
+         {
+            return 0;
+         }
+         dist += hypre_abs(hypre_IndexD(stencil_shape[si], d));
+      }
+      if (dist > max_dist)
+      {
+         return 0;
+      }
+      for (sj = 0; sj < si; sj++)
+      {
+         if (hypre_IndexesEqual(stencil_shape[si], stencil_shape[sj], ndim))
+         {
+            return 0;
+         }
+      }
+   }
+
+   return stencil_size;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecStencilRow
+ *
+ * yr = scale*(yr + sum_si a_si*xr[si]) over one row of length nx for depth
+ * stencil entries, where a_si is the row ar[si] for cc = 0 and the constant
+ * AAp[si] otherwise.  If ac is not NULL, the variable coefficient row ac
+ * times xc is added as well (center entry for cc = 2).  For cc = 0, the
+ * single-precision rows fr are used instead of ar if fr is not NULL.  Called
+ * with a literal depth so that the entry loop is unrolled and the row loop
+ * vectorizes.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_StructMatvecStencilRow( HYPRE_Int       depth,
+                              HYPRE_Int       cc,
+                              HYPRE_Complex   scale,
+                              HYPRE_Complex **ar,
+                              float         **fr,
+                              HYPRE_Complex  *AAp,
+                              HYPRE_Complex **xr,
+                              HYPRE_Complex  *ac,
+                              HYPRE_Complex  *xc,
+                              HYPRE_Complex  *yr,
+                              HYPRE_Int       nx )
+{
+   HYPRE_Int  i, si;
+
+   if (cc == 0 && fr != NULL)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp simd
+#endif
+      for (i = 0; i < nx; i++)
+      {
+         HYPRE_Complex t = 0.0;
+         for (si = 0; si < depth; si++)
+         {
+            t += (HYPRE_Complex) fr[si][i] * xr[si][i];
+         }
+         yr[i] = scale * (yr[i] + t);
+      }
+   }
+   else if (cc == 0)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp simd
+#endif
+      for (i = 0; i < nx; i++)
+      {
+         HYPRE_Complex t = 0.0;
+         for (si = 0; si < depth; si++)
+         {
+            t += ar[si][i] * xr[si][i];
+         }
+         yr[i] = scale * (yr[i] + t);
+      }
+   }
+   else if (ac == NULL)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp simd
+#endif
+      for (i = 0; i < nx; i++)
+      {
+         HYPRE_Complex t = 0.0;
+         for (si = 0; si < depth; si++)
+         {
+            t += AAp[si] * xr[si][i];
+         }
+         yr[i] = scale * (yr[i] + t);
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp simd
+#endif
+      for (i = 0; i < nx; i++)
+      {
+         HYPRE_Complex t = ac[i] * xc[i];
+         for (si = 0; si < depth; si++)
+         {
+            t += AAp[si] * xr[si][i];
+         }
+         yr[i] = scale * (yr[i] + t);
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecStencilBox
+ *
+ * y += A*x on one box of size n[0] x n[1] x n[2].  The coefficient and vector
+ * pointers are offset to the first point of the box; *_s[1] and *_s[2] are
+ * the row and plane strides of the respective data boxes.  For cc = 0 the
+ * result is scaled by alpha at the end, for cc = 1 the constant coefficients
+ * AAp are already scaled by alpha, and for cc = 2 the constant off-diagonal
+ * part AAp is added before the variable center Ap[center] and the scaling.
+ * If Fp is not NULL (cc = 0 only), the coefficients are read from the
+ * single-precision arrays Fp instead of Ap.  Called with a literal
+ * stencil_size so that it gets specialized per stencil.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_StructMatvecStencilBox( HYPRE_Int       stencil_size,
+                              HYPRE_Int       cc,
+                              HYPRE_Int       center,
+                              HYPRE_Complex   alpha,
+                              HYPRE_Complex **Ap,
+                              float         **Fp,
+                              HYPRE_Complex  *AAp,
+                              HYPRE_Int      *A_s,
+                              HYPRE_Complex  *xp,
+                              HYPRE_Int      *xoff,
+                              HYPRE_Int      *x_s,
+                              HYPRE_Complex  *yp,
+                              HYPRE_Int      *y_s,
+                              HYPRE_Int      *n )
+{
+   HYPRE_Int  nx = n[0], ny = n[1], nz = n[2];
+   HYPRE_Int  jb, ntiles, t, jt, j, k, si, s0, rem, last;
+
+   /* number of j-rows per tile: three planes of x rows should fit */
+   jb = HYPRE_STRUCT_MATVEC_TILE_BYTES / (3 * (HYPRE_Int) sizeof(HYPRE_Complex) * x_s[1]) - 2;
+   jb = hypre_max(1, hypre_min(jb, ny));
+   ntiles = ((ny + jb - 1) / jb) * nz;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, jt, j, k, si, s0, rem, last) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < ntiles; t++)
+   {
+      jt = t / nz;
+      k  = t - jt * nz;
+
+      for (j = jt * jb; j < hypre_min(ny, (jt + 1) * jb); j++)
+      {
+         HYPRE_Int      Ai = j * A_s[1] + k * A_s[2];
+         HYPRE_Int      xi = j * x_s[1] + k * x_s[2];
+         HYPRE_Complex *yr = yp + j * y_s[1] + k * y_s[2];
+         HYPRE_Complex *ar[27] = {NULL};
+         float         *fr[27] = {NULL};
+         HYPRE_Complex *xr[27];
+
+         for (si = 0; si < stencil_size; si++)
+         {
+            xr[si] = xp + xi + xoff[si];
+            if (Fp != NULL)
+            {
+               fr[si] = Fp[si] + Ai;
+            }
+            else if (cc == 0)
+            {
+               ar[si] = Ap[si] + Ai;
+            }
+         }
+
+         /* accumulate groups of DEPTH entries in a register, one pass each */
+         rem = stencil_size % HYPRE_STRUCT_MATVEC_DEPTH;
+         for (s0 = 0; s0 + HYPRE_STRUCT_MATVEC_DEPTH <= stencil_size; s0 += HYPRE_STRUCT_MATVEC_DEPTH)
+         {
+            last = (s0 + HYPRE_STRUCT_MATVEC_DEPTH == stencil_size);
+            hypre_StructMatvecStencilRow(HYPRE_STRUCT_MATVEC_DEPTH, cc,
+                                         (last && cc != 1) ? alpha : 1.0,
+                                         ar + s0, (Fp != NULL) ? fr + s0 : NULL,
+                                         AAp + s0, xr + s0,
+                                         (cc == 2 && s0 == 0) ? (Ap[center] + Ai) : NULL,
+                                         xr[center], yr, nx);
+         }
+         if (rem > 0)
+         {
+            hypre_StructMatvecStencilRow(rem, cc, (cc != 1) ? alpha : 1.0,
+                                         ar + s0, (Fp != NULL) ? fr + s0 : NULL,
+                                         AAp + s0, xr + s0,
+                                         (cc == 2 && s0 == 0) ? (Ap[center] + Ai) : NULL,
+                                         xr[center], yr, nx);
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecSymmRow
+ *
+ * Symmetric storage version of hypre_StructMatvecStencilRow for cc = 0:
+ *
+ *    yr = scale*(yr + ac*xc + sum_p (ar[p]*xs[p] + ar[p](+ashift[p])*xm[p]))
+ *
+ * over one row, where ar[p] is the row of the p-th stored off-diagonal
+ * coefficient and its transpose reads the same coefficients at the offset
+ * ashift[p].  Each stored coefficient row is thus used for both entries
+ * within one pass.  The center term is skipped if ac is NULL.  If fr is not
+ * NULL, the single-precision rows fr and fc are used instead of ar and ac.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_StructMatvecSymmRow( HYPRE_Int       depth,
+                           HYPRE_Complex   scale,
+                           HYPRE_Complex **ar,
+                           float         **fr,
+                           HYPRE_Int      *ashift,
+                           HYPRE_Complex **xs,
+                           HYPRE_Complex **xm,
+                           HYPRE_Complex  *ac,
+                           float          *fc,
+                           HYPRE_Complex  *xc,
+                           HYPRE_Complex  *yr,
+                           HYPRE_Int       nx )
+{
+   HYPRE_Int  i, p;
+
+   if (fr != NULL)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp simd
+#endif
+      for (i = 0; i < nx; i++)
+      {
+         HYPRE_Complex t = (fc != NULL) ? (HYPRE_Complex) fc[i] * xc[i] : 0.0;
+         for (p = 0; p < depth; p++)
+         {
+            t += (HYPRE_Complex) fr[p][i] * xs[p][i] +
+                 (HYPRE_Complex) fr[p][i + ashift[p]] * xm[p][i];
+         }
+         yr[i] = scale * (yr[i] + t);
+      }
+   }
+   else if (ac == NULL)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp simd
+#endif
+      for (i = 0; i < nx; i++)
+      {
+         HYPRE_Complex t = 0.0;
+         for (p = 0; p < depth; p++)
+         {
+            t += ar[p][i] * xs[p][i] + ar[p][i + ashift[p]] * xm[p][i];
+         }
+         yr[i] = scale * (yr[i] + t);
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp simd
+#endif
+      for (i = 0; i < nx; i++)
+      {
+         HYPRE_Complex t = ac[i] * xc[i];
+         for (p = 0; p < depth; p++)
+         {
+            t += ar[p][i] * xs[p][i] + ar[p][i + ashift[p]] * xm[p][i];
+         }
+         yr[i] = scale * (yr[i] + t);
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecSymmBox
+ *
+ * Symmetric storage version of hypre_StructMatvecStencilBox for cc = 0, with
+ * num_pairs stored off-diagonal entries Ap[p] and the stored center Ac.  The
+ * pairs are spread evenly over the passes of a row.  The tiles also keep the
+ * rows of the stored coefficients that are read one plane away by the
+ * transposed entries (num_zpairs of them) in cache until they are used again
+ * on the next plane.  If Fp is not NULL, the coefficients are read from the
+ * single-precision arrays Fc and Fp instead.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_StructMatvecSymmBox( HYPRE_Int       num_pairs,
+                           HYPRE_Int       num_zpairs,
+                           HYPRE_Complex   alpha,
+                           HYPRE_Complex  *Ac,
+                           HYPRE_Complex **Ap,
+                           float          *Fc,
+                           float         **Fp,
+                           HYPRE_Int      *ashift,
+                           HYPRE_Int      *A_s,
+                           HYPRE_Complex  *xp,
+                           HYPRE_Int      *xsoff,
+                           HYPRE_Int      *xmoff,
+                           HYPRE_Int      *x_s,
+                           HYPRE_Complex  *yp,
+                           HYPRE_Int      *y_s,
+                           HYPRE_Int      *n )
+{
+   HYPRE_Int  nx = n[0], ny = n[1], nz = n[2];
+   HYPRE_Int  jb, ntiles, t, jt, j, k, p, p0, np, npasses, depth;
+   HYPRE_Int  asize = (Fp != NULL) ? (HYPRE_Int) sizeof(float) : (HYPRE_Int) sizeof(HYPRE_Complex);
+
+   /* number of j-rows per tile: three planes of x rows and two planes of the
+      plane-shifted coefficient rows should fit */
+   jb = HYPRE_STRUCT_MATVEC_TILE_BYTES /
+        (3 * (HYPRE_Int) sizeof(HYPRE_Complex) * x_s[1] + 2 * asize * num_zpairs * A_s[1]) - 2;
+   jb = hypre_max(1, hypre_min(jb, ny));
+   ntiles = ((ny + jb - 1) / jb) * nz;
+
+   npasses = (num_pairs + HYPRE_STRUCT_MATVEC_SYMM_DEPTH - 1) / HYPRE_STRUCT_MATVEC_SYMM_DEPTH;
+   depth   = (num_pairs + npasses - 1) / npasses;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, jt, j, k, p, p0, np) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < ntiles; t++)
+   {
+      jt = t / nz;
+      k  = t - jt * nz;
+
+      for (j = jt * jb; j < hypre_min(ny, (jt + 1) * jb); j++)
+      {
+         HYPRE_Int      Ai = j * A_s[1] + k * A_s[2];
+         HYPRE_Int      xi = j * x_s[1] + k * x_s[2];
+         HYPRE_Complex *yr = yp + j * y_s[1] + k * y_s[2];
+         HYPRE_Complex *ar[13] = {NULL};
+         float         *fr[13] = {NULL};
+         HYPRE_Complex *xs[13];
+         HYPRE_Complex *xm[13];
+
+         for (p = 0; p < num_pairs; p++)
+         {
+            if (Fp != NULL)
+            {
+               fr[p] = Fp[p] + Ai;
+            }
+            else
+            {
+               ar[p] = Ap[p] + Ai;
+            }
+            xs[p] = xp + xi + xsoff[p];
+            xm[p] = xp + xi + xmoff[p];
+         }
+
+         for (p0 = 0; p0 < num_pairs; p0 += np)
+         {
+            HYPRE_Complex  scale = (p0 + depth >= num_pairs) ? alpha : 1.0;
+            HYPRE_Complex *ac    = (p0 == 0 && Fp == NULL) ? (Ac + Ai) : NULL;
+            float         *fc    = (p0 == 0 && Fp != NULL) ? (Fc + Ai) : NULL;
+            float        **frp   = (Fp != NULL) ? fr + p0 : NULL;
+
+            np = hypre_min(depth, num_pairs - p0);
+            switch (np)
+            {
+               case 5:
+                  hypre_StructMatvecSymmRow(5, scale, ar + p0, frp, ashift + p0, xs + p0, xm + p0,
+                                            ac, fc, xp + xi, yr, nx);
+                  break;
+               case 4:
+                  hypre_StructMatvecSymmRow(4, scale, ar + p0, frp, ashift + p0, xs + p0, xm + p0,
+                                            ac, fc, xp + xi, yr, nx);
+                  break;
+               case 3:
+                  hypre_StructMatvecSymmRow(3, scale, ar + p0, frp, ashift + p0, xs + p0, xm + p0,
+                                            ac, fc, xp + xi, yr, nx);
+                  break;
+               case 2:
+                  hypre_StructMatvecSymmRow(2, scale, ar + p0, frp, ashift + p0, xs + p0, xm + p0,
+                                            ac, fc, xp + xi, yr, nx);
+                  break;
+               case 1:
+                  hypre_StructMatvecSymmRow(1, scale, ar + p0, frp, ashift + p0, xs + p0, xm + p0,
+                                            ac, fc, xp + xi, yr, nx);
+                  break;
+            }
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecStencil
+ * core of struct matvec computation with the stencil-specialized kernels,
+ * for all constant_coefficient cases.  The compressed boxes of a cc = 0
+ * matrix (see hypre_StructMatrixCompressConstant) are done as for cc = 2.
+ * If data_float is set and A has a single-precision copy of its
+ * coefficients, the copy is used (cc = 0).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecStencil( HYPRE_Complex        alpha,
+                           hypre_StructMatrix  *A,
+                           hypre_StructVector  *x,
+                           hypre_StructVector  *y,
+                           hypre_BoxArrayArray *compute_box_aa,
+                           HYPRE_Int            stencil_size,
+                           HYPRE_Int            data_float )
+{
+   HYPRE_Int             cc            = hypre_StructMatrixConstantCoefficient(A);
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             ndim          = hypre_StructVectorNDim(x);
+
+   HYPRE_Complex        *Ap[27];
+   float                *Fp[27];
+   HYPRE_Complex         AAp[27];
+   HYPRE_Int             xoff[27];
+   HYPRE_Int             A_s[3], x_s[3], y_s[3], n[3];
+   HYPRE_Int             Ai, xi, yi, center = -1;
+   HYPRE_Int             i, j, d, si, bcc;
+
+   /* symmetric storage */
+   HYPRE_Int             pairs[27], num_pairs = 0, num_zpairs = 0;
+   HYPRE_Complex        *Sp[13];
+   float                *SFp[13];
+   HYPRE_Int             ashift[13], xsoff[13], xmoff[13];
+   HYPRE_Int             p;
+
+   hypre_BoxArray       *compute_box_a;
+   hypre_Box            *compute_box;
+   hypre_Box            *A_data_box;
+   hypre_Box            *x_data_box;
+   hypre_Box            *y_data_box;
+   hypre_IndexRef        start;
+   hypre_Index           center_index;
+   HYPRE_Complex        *xp;
+   HYPRE_Complex        *yp;
+
+   if (cc != 0 || hypre_StructMatrixDataFloat(A) == NULL)
+   {
+      data_float = 0;
+   }
+
+   if (cc == 2 || hypre_StructMatrixConstantBoxes(A) != NULL)
+   {
+      hypre_SetIndex(center_index, 0);
+      center = hypre_StructStencilElementRank(stencil, center_index);
+   }
+   if (cc == 0 && hypre_StructMatrixSymmetric(A))
+   {
+      hypre_SetIndex(center_index, 0);
+      center = hypre_StructStencilElementRank(stencil, center_index);
+      hypre_StructMatrixGetSymmPairs(A, pairs, &num_pairs);
+      if (center < 0 || (2 * num_pairs + 1) != stencil_size)
+      {
+         num_pairs = 0;
+      }
+      for (p = 0; p < num_pairs; p++)
+      {
+         if (ndim > 2 && hypre_IndexD(stencil_shape[pairs[2 * p]], 2) != 0)
+         {
+            num_zpairs++;
+         }
+      }
+   }
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      /* compressed boxes are read as constant_coefficient 2 */
+      bcc = hypre_StructMatrixBoxConstant(A, i) ? 2 : cc;
+
+      /* row and plane strides of the data boxes */
+      A_s[0] = x_s[0] = y_s[0] = 1;
+      for (d = 1; d < 3; d++)
+      {
+         A_s[d] = A_s[d - 1] * ((d - 1 < ndim) ? hypre_BoxSizeD(A_data_box, d - 1) : 1);
+         x_s[d] = x_s[d - 1] * ((d - 1 < ndim) ? hypre_BoxSizeD(x_data_box, d - 1) : 1);
+         y_s[d] = y_s[d - 1] * ((d - 1 < ndim) ? hypre_BoxSizeD(y_data_box, d - 1) : 1);
+      }
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+         start = hypre_BoxIMin(compute_box);
+
+         for (d = 0; d < 3; d++)
+         {
+            n[d] = (d < ndim) ? hypre_BoxSizeD(compute_box, d) : 1;
+         }
+         if (n[0] * n[1] * n[2] == 0)
+         {
+            continue;
+         }
+
+         Ai = hypre_BoxIndexRank(A_data_box, start);
+         xi = hypre_BoxIndexRank(x_data_box, start);
+         yi = hypre_BoxIndexRank(y_data_box, start);
+         xp = hypre_StructVectorBoxData(x, i) + xi;
+         yp = hypre_StructVectorBoxData(y, i) + yi;
+
+         for (si = 0; si < stencil_size; si++)
+         {
+            if (bcc == 0 || si == center)
+            {
+               Ap[si] = hypre_StructMatrixBoxData(A, i, si) + Ai;
+               AAp[si] = 0.0;
+               if (data_float)
+               {
+                  Fp[si] = hypre_StructMatrixBoxDataFloat(A, i, si) + Ai;
+               }
+            }
+            else
+            {
+               AAp[si] = hypre_StructMatrixBoxData(A, i, si)[hypre_CCBoxIndexRank(A_data_box, start)];
+               if (bcc == 1)
+               {
+                  AAp[si] *= alpha;
+               }
+            }
+         }
+
+         if (num_pairs > 0 && bcc == 0)
+         {
+            /* symmetric storage: each stored coefficient serves both entries */
+            for (p = 0; p < num_pairs; p++)
+            {
+               Sp[p]     = Ap[pairs[2 * p]];
+               SFp[p]    = (data_float) ? Fp[pairs[2 * p]] : NULL;
+               ashift[p] = (HYPRE_Int) (Ap[pairs[2 * p + 1]] - Ap[pairs[2 * p]]);
+               xsoff[p]  = xoff[pairs[2 * p]];
+               xmoff[p]  = xoff[pairs[2 * p + 1]];
+            }
+            hypre_StructMatvecSymmBox(num_pairs, num_zpairs, alpha, Ap[center], Sp,
+                                      (data_float) ? Fp[center] : NULL,
+                                      (data_float) ? SFp : NULL, ashift,
+                                      A_s, xp, xsoff, xmoff, x_s, yp, y_s, n);
+            continue;
+         }
+
+         switch (stencil_size)
+         {
+            case 5:
+               hypre_StructMatvecStencilBox(5, bcc, center, alpha, Ap,
+                                            (data_float) ? Fp : NULL, AAp, A_s,
+                                            xp, xoff, x_s, yp, y_s, n);
+               break;
+            case 7:
+               hypre_StructMatvecStencilBox(7, bcc, center, alpha, Ap,
+                                            (data_float) ? Fp : NULL, AAp, A_s,
+                                            xp, xoff, x_s, yp, y_s, n);
+               break;
+            case 9:
+               hypre_StructMatvecStencilBox(9, bcc, center, alpha, Ap,
+                                            (data_float) ? Fp : NULL, AAp, A_s,
+                                            xp, xoff, x_s, yp, y_s, n);
+               break;
+            case 19:
+               hypre_StructMatvecStencilBox(19, bcc, center, alpha, Ap,
+                                            (data_float) ? Fp : NULL, AAp, A_s,
+                                            xp, xoff, x_s, yp, y_s, n);
+               break;
+            case 27:
+               hypre_StructMatvecStencilBox(27, bcc, center, alpha, Ap,
+                                            (data_float) ? Fp : NULL, AAp, A_s,
+                                            xp, xoff, x_s, yp, y_s, n);
+               break;
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCreate
  *--------------------------------------------------------------------------*/
@@ -80,10 +741,49 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    (matvec_data -> A)           = hypre_StructMatrixRef(A);
    (matvec_data -> x)           = hypre_StructVectorRef(x);
    (matvec_data -> compute_pkg) = compute_pkg;
+   (matvec_data -> stencil_kernel) =
+      hypre_StructMatvecStencilKernel(A, hypre_ComputePkgStride(compute_pkg));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecSetDataFloat
+ *
+ * If data_float is set, the stencil-specialized host kernels read A from its
+ * single-precision copy (see hypre_StructMatrixCreateDataFloat) when it has
+ * one.  Other cases use the HYPRE_Complex coefficients.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecSetDataFloat( void      *matvec_vdata,
+                                HYPRE_Int  data_float )
+{
+   hypre_StructMatvecData  *matvec_data = (hypre_StructMatvecData  *)matvec_vdata;
+
+   (matvec_data -> data_float) = data_float;
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecUsesDataFloat
+ *
+ * Returns 1 if hypre_StructMatvecCompute reads the coefficients of the matrix
+ * it was set up with only from its single-precision copy, else 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecUsesDataFloat( void *matvec_vdata )
+{
+   hypre_StructMatvecData  *matvec_data = (hypre_StructMatvecData  *)matvec_vdata;
+   hypre_StructMatrix      *A           = (matvec_data -> A);
+
+   return ( (matvec_data -> data_float) && (matvec_data -> stencil_kernel) &&
+            hypre_StructMatrixConstantCoefficient(A) == 0 &&
+            hypre_StructMatrixDataFloat(A) != NULL );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCompute
  *--------------------------------------------------------------------------*/
@@ -171,7 +871,7 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
     * Do (alpha != 0.0) computation
     *-----------------------------------------------------------------------*/
 
-   for (compute_i = 0; compute_i < 2; compute_i++)
+   for (compute_i = 0; ; compute_i++)
    {
       switch (compute_i)
       {
@@ -236,23 +936,40 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
          }
          break;
 
-         case 1:
+         default:
          {
-            hypre_FinalizeIndtComputations(comm_handle);
-            compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+            /* dependent boxes, as their receives complete */
+            hypre_NextDeptComputations(compute_pkg, &comm_handle, &compute_box_aa);
          }
          break;
       }
 
+      if (compute_box_aa == NULL)
+      {
+         break;
+      }
+
       /*--------------------------------------------------------------------
        * y += A*x
        *--------------------------------------------------------------------*/
 
+      if (matvec_data -> stencil_kernel)
+      {
+         hypre_StructMatvecStencil( alpha, A, x, y, compute_box_aa,
+                                    (matvec_data -> stencil_kernel),
+                                    (matvec_data -> data_float) );
+         continue;
+      }
+
       switch ( constant_coefficient )
       {
          case 0:
          {
             hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            if (hypre_StructMatrixConstantBoxes(A) != NULL)
+            {
+               hypre_StructMatvecCC2( alpha, A, x, y, compute_box_aa, stride );
+            }
             break;
          }
          case 1:
@@ -281,7 +998,7 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCC0
  * core of struct matvec computation, for the case constant_coefficient==0
- * (all coefficients are variable)
+ * (all coefficients are variable), except for compressed boxes
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
@@ -331,6 +1048,12 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
 
    hypre_ForBoxArrayI(i, compute_box_aa)
    {
+      if (hypre_StructMatrixBoxConstant(A, i))
+      {
+         /* done by hypre_StructMatvecCC2 */
+         continue;
+      }
+
       compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
 
       A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
@@ -927,7 +1650,8 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
 
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCC2
- * core of struct matvec computation, for the case constant_coefficient==2
+ * core of struct matvec computation, for the case constant_coefficient==2,
+ * and for the compressed boxes of a constant_coefficient==0 matrix
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
@@ -988,6 +1712,12 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
 
    hypre_ForBoxArrayI(i, compute_box_aa)
    {
+      if (hypre_StructMatrixConstantCoefficient(A) == 0 && !hypre_StructMatrixBoxConstant(A, i))
+      {
+         /* done by hypre_StructMatvecCC0 */
+         continue;
+      }
+
       compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
 
       A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
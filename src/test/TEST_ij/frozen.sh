@@ -0,0 +1,61 @@
+#!/bin/sh
+# Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+# HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+#
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+
+TNAME=`basename $0 .sh`
+RTOL=$1
+ATOL=$2
+
+#=============================================================================
+# IJ: a frozen re-setup may take at most one iteration more than a full
+#     re-setup (the truncation can pick other entries on the new values)
+#=============================================================================
+
+for i in 0 2 4 6 8
+do
+   j=`expr $i + 1`
+   FULL=`grep -A1 "new setup" ${TNAME}.out.$i | grep "Iterations" | awk '{print $4}'`
+   FROZEN=`grep -A1 "new setup" ${TNAME}.out.$j | grep "Iterations" | awk '{print $4}'`
+   if [ -z "$FULL" ] || [ -z "$FROZEN" ] || [ "$FROZEN" -gt `expr $FULL + 1` ]; then
+      echo "${TNAME}.out.$j: frozen re-setup takes $FROZEN iterations, full $FULL" >&2
+   fi
+done
+
+#=============================================================================
+# compare with baseline case
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.0\
+ ${TNAME}.out.1\
+ ${TNAME}.out.2\
+ ${TNAME}.out.3\
+ ${TNAME}.out.4\
+ ${TNAME}.out.5\
+ ${TNAME}.out.6\
+ ${TNAME}.out.7\
+ ${TNAME}.out.8\
+ ${TNAME}.out.9\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep -A2 "Shifted matrix" $i | grep -v "^--"
+done > ${TNAME}.out
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+RUNCOUNT=`expr 2 \* $RUNCOUNT`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+#=============================================================================
+# remove temporary files
+#=============================================================================
+
+rm -f ${TNAME}.testdata*
@@ -24,6 +24,65 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -17 ${TNAME}.out.2 | head -6 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+# IJ: staged assembly should give the same matrix as direct assembly
+#=============================================================================
+
+tail -3 ${TNAME}.out.4 | head -2 > ${TNAME}.testdata
+for i in 13 14 15 17
+do
+   tail -3 ${TNAME}.out.$i | head -2 > ${TNAME}.testdata.temp
+   diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+tail -3 ${TNAME}.out.5 | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.16 | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# IJ: value-only re-assembly should give the same matrix
+#=============================================================================
+
+tail -3 ${TNAME}.out.4 | head -2 > ${TNAME}.testdata
+for i in 18 19 20 22
+do
+   tail -3 ${TNAME}.out.$i | head -2 > ${TNAME}.testdata.temp
+   diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+tail -3 ${TNAME}.out.5 | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.21 | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep -A2 "Shifted matrix" ${TNAME}.out.23 > ${TNAME}.testdata
+grep -A2 "Shifted matrix" ${TNAME}.out.24 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# IJ: a system read back from binary files on as many processes as it was
+#     written from should give the same results
+#=============================================================================
+
+tail -3 ${TNAME}.out.0 | head -2 > ${TNAME}.testdata
+for i in 25 26
+do
+   tail -3 ${TNAME}.out.$i | head -2 > ${TNAME}.testdata.temp
+   diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+#=============================================================================
+# IJ: a matrix read from a Matrix Market file should give the same results
+#     as the generated one with the same row partitioning
+#=============================================================================
+
+for i in 29 31
+do
+   j=`expr $i + 1`
+   tail -3 ${TNAME}.out.$i | head -2 > ${TNAME}.testdata
+   tail -3 ${TNAME}.out.$j | head -2 > ${TNAME}.testdata.temp
+   diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -42,6 +101,27 @@ FILES="\
  ${TNAME}.out.10\
  ${TNAME}.out.11\
  ${TNAME}.out.12\
+ ${TNAME}.out.13\
+ ${TNAME}.out.14\
+ ${TNAME}.out.15\
+ ${TNAME}.out.16\
+ ${TNAME}.out.17\
+ ${TNAME}.out.18\
+ ${TNAME}.out.19\
+ ${TNAME}.out.20\
+ ${TNAME}.out.21\
+ ${TNAME}.out.22\
+ ${TNAME}.out.23\
+ ${TNAME}.out.24\
+ ${TNAME}.out.25\
+ ${TNAME}.out.26\
+ ${TNAME}.out.27\
+ ${TNAME}.out.28\
+ ${TNAME}.out.29\
+ ${TNAME}.out.30\
+ ${TNAME}.out.31\
+ ${TNAME}.out.32\
+ ${TNAME}.out.33\
 "
 
 for i in $FILES
@@ -62,3 +142,4 @@ fi
 #=============================================================================
 
 rm -f ${TNAME}.testdata*
+rm -f IJ.out.*.bin
@@ -0,0 +1,56 @@
+#!/bin/sh
+# Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+# HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+#
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+
+TNAME=`basename $0 .sh`
+RTOL=$1
+ATOL=$2
+
+#=============================================================================
+# IJ: the solve with all right-hand sides together must take as many
+#     iterations as the slowest separate solve and give the same solutions
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.0\
+ ${TNAME}.out.1\
+ ${TNAME}.out.2\
+ ${TNAME}.out.3\
+ ${TNAME}.out.4\
+"
+
+for i in $FILES
+do
+   TOGETHER=`grep -A1 "solved together" $i | grep "Iterations" | awk '{print $4}'`
+   SEPARATE=`grep -A1 "one at a time" $i | grep "Iterations" | awk '{print $4}'`
+   if [ -z "$TOGETHER" ] || [ "$TOGETHER" != "$SEPARATE" ]; then
+      echo "$i: $TOGETHER iterations together, $SEPARATE one at a time" >&2
+   fi
+   grep "Relative difference" $i | awk -v f=$i '$NF > 1.0e-06 {print f": solutions differ"}' >&2
+done
+
+#=============================================================================
+# compare with baseline case
+#=============================================================================
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep -A2 -e "sides stored by" -e "sides, solved" $i | grep -v "^--"
+done > ${TNAME}.out
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+RUNCOUNT=`expr 2 \* $RUNCOUNT`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+#=============================================================================
+# remove temporary files
+#=============================================================================
+
+rm -f ${TNAME}.testdata*
@@ -0,0 +1,55 @@
+#!/bin/sh
+# Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+# HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+#
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+
+TNAME=`basename $0 .sh`
+RTOL=$1
+ATOL=$2
+
+#=============================================================================
+# IJ: SELL-C-sigma runs must take the same iterations as the CSR run, also
+#     after the values of the matrix were changed
+#=============================================================================
+
+grep "Iterations" ${TNAME}.out.0 > ${TNAME}.testdata
+
+for i in 1 2 3 4 5
+do
+   grep "Iterations" ${TNAME}.out.$i > ${TNAME}.testdata.temp
+   diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+#=============================================================================
+# compare with baseline case
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.0\
+ ${TNAME}.out.1\
+ ${TNAME}.out.2\
+ ${TNAME}.out.3\
+ ${TNAME}.out.4\
+ ${TNAME}.out.5\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep -A2 "Shifted matrix" $i | grep -v "^--"
+done > ${TNAME}.out
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+RUNCOUNT=`expr 2 \* $RUNCOUNT`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+#=============================================================================
+# remove temporary files
+#=============================================================================
+
+rm -f ${TNAME}.testdata*
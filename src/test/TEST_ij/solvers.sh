@@ -49,6 +49,41 @@ tail -3 ${TNAME}.out.403.p | head -2 > ${TNAME}.testdata
 tail -3 ${TNAME}.out.403.n | head -2 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+tail -3 ${TNAME}.out.0 | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.500 | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.1 | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.502 | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.13 > ${TNAME}.testdata
+for i in 510 511 512
+do
+   grep "Iterations" ${TNAME}.out.$i > ${TNAME}.testdata.temp
+   diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+grep "Iterations" ${TNAME}.out.303 > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.521 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.303 > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.532 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.400.p > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.540 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.116 > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.541 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.117 > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.542 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -233,6 +268,104 @@ if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
    echo "Incorrect number of runs in ${TNAME}.out" >&2
 fi
 
+FILES="\
+ ${TNAME}.out.500\
+ ${TNAME}.out.501\
+ ${TNAME}.out.502\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -3 $i
+done > ${TNAME}.out.g
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out.g | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+FILES="\
+ ${TNAME}.out.510\
+ ${TNAME}.out.511\
+ ${TNAME}.out.512\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -3 $i
+done > ${TNAME}.out.h
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out.h | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+FILES="\
+ ${TNAME}.out.520\
+ ${TNAME}.out.521\
+ ${TNAME}.out.522\
+ ${TNAME}.out.523\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -3 $i
+done > ${TNAME}.out.i
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out.i | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+FILES="\
+ ${TNAME}.out.530\
+ ${TNAME}.out.531\
+ ${TNAME}.out.532\
+ ${TNAME}.out.533\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -3 $i
+done > ${TNAME}.out.j
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out.j | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+FILES="\
+ ${TNAME}.out.540\
+ ${TNAME}.out.541\
+ ${TNAME}.out.542\
+ ${TNAME}.out.543\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -3 $i
+done > ${TNAME}.out.k
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out.k | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
 # put all of the output files together
 cat ${TNAME}.out.[a-z] > ${TNAME}.out
 
@@ -8,6 +8,30 @@ TNAME=`basename $0 .sh`
 RTOL=$1
 ATOL=$2
 
+#=============================================================================
+# single-precision coefficients should not change the iteration counts
+#=============================================================================
+
+for i in 10 12
+do
+   j=`expr $i + 1`
+   grep "Iterations" ${TNAME}.out.$i > ${TNAME}.testdata
+   grep "Iterations" ${TNAME}.out.$j > ${TNAME}.testdata.temp
+   diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+#=============================================================================
+# compressed coarse operators should give the same results
+#=============================================================================
+
+for i in "10 20" "22 21" "11 23"
+do
+   set -- $i
+   tail -3 ${TNAME}.out.$1 | head -2 > ${TNAME}.testdata
+   tail -3 ${TNAME}.out.$2 | head -2 > ${TNAME}.testdata.temp
+   diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -18,6 +42,17 @@ FILES="\
  ${TNAME}.out.2\
  ${TNAME}.out.3\
  ${TNAME}.out.4\
+ ${TNAME}.out.5\
+ ${TNAME}.out.6\
+ ${TNAME}.out.7\
+ ${TNAME}.out.10\
+ ${TNAME}.out.11\
+ ${TNAME}.out.12\
+ ${TNAME}.out.13\
+ ${TNAME}.out.20\
+ ${TNAME}.out.21\
+ ${TNAME}.out.22\
+ ${TNAME}.out.23\
 "
 
 for i in $FILES
@@ -37,4 +72,4 @@ fi
 # remove temporary files
 #=============================================================================
 
-# rm -f ${TNAME}.testdata*
+rm -f ${TNAME}.testdata*
@@ -114,6 +114,8 @@ main( hypre_int argc,
    HYPRE_Int           off_proc = 0;
    HYPRE_Int           chunk = 0;
    HYPRE_Int           omp_flag = 0;
+   HYPRE_Int           stage_flag = 0;
+   HYPRE_Int           rebuild = 0;
    HYPRE_Int           build_matrix_type;
    HYPRE_Int           build_matrix_arg_index;
    HYPRE_Int           build_rhs_type;
@@ -130,6 +132,7 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
+   HYPRE_Int           recompute_res_p = 0;
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
    HYPRE_Int           poutusr = 0; /* if user selects pout */
@@ -259,6 +262,12 @@ main( hypre_int argc,
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
    HYPRE_Int    keepTranspose = 0;
+   HYPRE_Int    sell_num_levels = 0;
+   HYPRE_Int    frozen_pattern = 0;
+   HYPRE_Real   diag_shift = 0.0;
+   HYPRE_Int    num_rhs = 1;
+   HYPRE_Int    rhs_storage = 0;
+   HYPRE_Int    spgemm_host = 0;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -324,6 +333,7 @@ main( hypre_int argc,
    /* parameters for COGMRES */
    HYPRE_Int    cgs = 1;
    HYPRE_Int    unroll = 0;
+   HYPRE_Int    s_step = 1;
    /* parameters for LGMRES */
    HYPRE_Int    aug_dim;
    /* parameters for GSMG */
@@ -341,6 +351,7 @@ main( hypre_int argc,
    HYPRE_Real   agg_P12_trunc_factor  = 0; /* default value */
 
    HYPRE_Int    print_system = 0;
+   HYPRE_Int    print_binary = 0;
    HYPRE_Int    rel_change = 0;
 
    /* begin lobpcg */
@@ -418,6 +429,11 @@ main( hypre_int argc,
    HYPRE_Int ilu_max_row_nnz = 1000;
    HYPRE_Int ilu_schur_max_iter = 3;
    HYPRE_Real ilu_nsh_droptol = 1.0e-02;
+   HYPRE_Int ilu_tri_solve = 1;
+   HYPRE_Int ilu_lower_jacobi_iters = 5;
+   HYPRE_Int ilu_upper_jacobi_iters = 5;
+   HYPRE_Int ilu_iter_setup_type = 0;
+   HYPRE_Int ilu_iter_setup_max_iter = 5;
    /* end hypre ILU options */
 
    HYPRE_Real     *nongalerk_tol = NULL;
@@ -505,6 +521,18 @@ main( hypre_int argc,
          build_matrix_type      = -1;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-frombinaryfile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = -2;
+         build_matrix_arg_index = arg_index;
+      }
+      else if ( strcmp(argv[arg_index], "-frommmfile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = -3;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-fromparcsrfile") == 0 )
       {
          arg_index++;
@@ -600,6 +628,16 @@ main( hypre_int argc,
          arg_index++;
          omp_flag = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-stage") == 0 )
+      {
+         arg_index++;
+         stage_flag = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-rebuild") == 0 )
+      {
+         arg_index++;
+         rebuild = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_constant") == 0 )
       {
          arg_index++;
@@ -637,6 +675,12 @@ main( hypre_int argc,
          build_rhs_type      = 0;
          build_rhs_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-rhsfrombinaryfile") == 0 )
+      {
+         arg_index++;
+         build_rhs_type      = 8;
+         build_rhs_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-rhsfromonefile") == 0 )
       {
          arg_index++;
@@ -1168,6 +1212,36 @@ main( hypre_int argc,
          arg_index++;
          ilu_nsh_droptol = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-ilu_tri_solve") == 0 )
+      {
+         /* Direct (1) or iterative (0) triangular solves */
+         arg_index++;
+         ilu_tri_solve = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_ljac_iters") == 0 )
+      {
+         /* Number of Jacobi sweeps for the L solve */
+         arg_index++;
+         ilu_lower_jacobi_iters = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_ujac_iters") == 0 )
+      {
+         /* Number of Jacobi sweeps for the U solve */
+         arg_index++;
+         ilu_upper_jacobi_iters = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_iter_setup_type") == 0 )
+      {
+         /* Exact (0) or fixed-point (1) factorization */
+         arg_index++;
+         ilu_iter_setup_type = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_iter_setup_max_iter") == 0 )
+      {
+         /* Number of fixed-point sweeps of the factorization */
+         arg_index++;
+         ilu_iter_setup_max_iter = atoi(argv[arg_index++]);
+      }
       /* end ilu options */
 #if defined(HYPRE_USING_GPU)
       else if ( strcmp(argv[arg_index], "-exec_host") == 0 )
@@ -1286,7 +1360,7 @@ main( hypre_int argc,
    if (solver_id == 0 || solver_id == 1 || solver_id == 3 || solver_id == 5
        || solver_id == 9 || solver_id == 13 || solver_id == 14
        || solver_id == 15 || solver_id == 20 || solver_id == 51 || solver_id == 61
-       || solver_id == 16
+       || solver_id == 16 || solver_id == 19
        || solver_id == 70 || solver_id == 71 || solver_id == 72
        || solver_id == 90 || solver_id == 91)
    {
@@ -1342,6 +1416,11 @@ main( hypre_int argc,
          arg_index++;
          unroll = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         s_step = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_residual") == 0 )
       {
          arg_index++;
@@ -1559,6 +1638,11 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-recompute_p") == 0 )
+      {
+         arg_index++;
+         recompute_res_p = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-iout") == 0 )
       {
          arg_index++;
@@ -1748,6 +1832,36 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sell_levels") == 0 )
+      {
+         arg_index++;
+         sell_num_levels  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-frozen_pattern") == 0 )
+      {
+         arg_index++;
+         frozen_pattern  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-diag_shift") == 0 )
+      {
+         arg_index++;
+         diag_shift  = atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-num_rhs") == 0 )
+      {
+         arg_index++;
+         num_rhs  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-rhs_storage") == 0 )
+      {
+         arg_index++;
+         rhs_storage  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-spgemm_host") == 0 )
+      {
+         arg_index++;
+         spgemm_host  = atoi(argv[arg_index++]);
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -1770,6 +1884,11 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-printbinary") == 0 )
+      {
+         arg_index++;
+         print_binary = 1;
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -1887,6 +2006,10 @@ main( hypre_int argc,
          hypre_printf("\n");
          hypre_printf("  -fromfile <filename>       : ");
          hypre_printf("matrix read from multiple files (IJ format)\n");
+         hypre_printf("  -frombinaryfile <filename> : ");
+         hypre_printf("matrix read from a single binary file (IJ format)\n");
+         hypre_printf("  -frommmfile <filename>     : ");
+         hypre_printf("matrix read from a Matrix Market file\n");
          hypre_printf("  -fromparcsrfile <filename> : ");
          hypre_printf("matrix read from multiple files (ParCSR format)\n");
          hypre_printf("  -fromonecsrfile <filename> : ");
@@ -1908,9 +2031,15 @@ main( hypre_int argc,
          hypre_printf("  -exact_size            : inserts immediately into ParCSR structure\n");
          hypre_printf("  -storage_low           : allocates not enough storage for aux struct\n");
          hypre_printf("  -concrete_parcsr       : use parcsr matrix type as concrete type\n");
+         hypre_printf("  -stage <s>             : with -test_ij, stage entries per thread\n");
+         hypre_printf("                           and assemble them in one sort (s != 0)\n");
+         hypre_printf("  -rebuild <n>           : with -test_ij, lock the pattern and\n");
+         hypre_printf("                           re-assemble the matrix n more times\n");
          hypre_printf("\n");
          hypre_printf("  -rhsfromfile           : ");
          hypre_printf("rhs read from multiple files (IJ format)\n");
+         hypre_printf("  -rhsfrombinaryfile     : ");
+         hypre_printf("rhs read from a single binary file (IJ format)\n");
          hypre_printf("  -rhsfromonefile        : ");
          hypre_printf("rhs read from a single file (CSR format)\n");
          hypre_printf("  -rhsparcsrfile        :  ");
@@ -1950,7 +2079,8 @@ main( hypre_int argc,
          hypre_printf("       12=Schwarz-PCG     13=GSMG           \n");
          hypre_printf("       14=GSMG-PCG        15=GSMG-GMRES\n");
          hypre_printf("       16=AMG-COGMRES     17=DIAG-COGMRES\n");
-         hypre_printf("       18=ParaSails-GMRES\n");
+         hypre_printf("       18=ParaSails-GMRES 19=AMG-PipelinedPCG\n");
+         hypre_printf("       21=DS-PipelinedPCG\n");
          hypre_printf("       20=Hybrid solver/ DiagScale, AMG \n");
          hypre_printf("       43=Euclid-PCG      44=Euclid-GMRES   \n");
          hypre_printf("       45=Euclid-BICGSTAB 46=Euclid-COGMRES\n");
@@ -2078,14 +2208,24 @@ main( hypre_int argc,
 
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
+         hypre_printf("  -sstep <val>           : s-step block size for COGMRES (default:1)\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
          hypre_printf("  -atol  <val>           : set solver absolute convergence tolerance = val\n");
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
+         hypre_printf("  -recompute_p  <val>    : pipelined PCG residual replacement period\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
+         hypre_printf("  -sell_levels <val>     : use SELL-C-sigma matvecs on the <val> finest levels (default:0)\n");
+         hypre_printf("  -frozen_pattern <val>  : 1=reuse AMG splitting and interp pattern on re-setup (default:0)\n");
+         hypre_printf("  -diag_shift <val>      : BoomerAMG with an IJ matrix: add val to the diagonal\n");
+         hypre_printf("                           and solve again, before and after re-setup\n");
+         hypre_printf("  -num_rhs <val>         : BoomerAMG: also solve for <val> right-hand sides at once\n");
+         hypre_printf("                           and one at a time, and compare the solutions\n");
+         hypre_printf("  -rhs_storage <val>     : multivector storage for -num_rhs, 0=by columns, 1=by rows\n");
+         hypre_printf("  -spgemm_host <val>     : host SpGEMM, 0=dense marker, 1=row hash/heap accumulators (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
          hypre_printf("\n");
          hypre_printf("  -sai_th   <val>        : set ParaSAILS threshold = val \n");
@@ -2109,6 +2249,7 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -printbinary           : print out the system in binary IJ files\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2221,6 +2362,11 @@ main( hypre_int argc,
          hypre_printf("  -ilu_schur_max_iter   <val>      : set max. num of iteration for GMRES/NSH Schur = val \n");
          hypre_printf("  -ilu_nsh_droptol   <val>         : set drop tolerance threshold for NSH = val \n");
          hypre_printf("  -ilu_sm_max_iter   <val>         : set number of iterations when applied as a smmother in AMG = val \n");
+         hypre_printf("  -ilu_tri_solve   <val>           : set triangular solve type, 0: Jacobi sweeps, 1: direct (default) \n");
+         hypre_printf("  -ilu_ljac_iters   <val>          : set number of Jacobi sweeps for the L solve = val \n");
+         hypre_printf("  -ilu_ujac_iters   <val>          : set number of Jacobi sweeps for the U solve = val \n");
+         hypre_printf("  -ilu_iter_setup_type   <val>     : set factorization type, 0: exact (default), 1: fixed-point sweeps \n");
+         hypre_printf("  -ilu_iter_setup_max_iter   <val> : set number of fixed-point sweeps of the factorization = val \n");
          /* end ILU options */
          /* hypre AMG-DD options */
          hypre_printf("  -amgdd_start_level   <val>       : set AMG-DD start level = val\n");
@@ -2305,6 +2451,9 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* host SpGEMM accumulators */
+   HYPRE_SetSpGemmHostAlgorithm(spgemm_host);
+
 #if defined(HYPRE_USING_GPU)
    /* use cuSPARSE for SpGEMM */
    ierr = HYPRE_SetSpGemmUseCusparse(spgemm_use_cusparse); hypre_assert(ierr == 0);
@@ -2339,6 +2488,26 @@ main( hypre_int argc,
          exit(1);
       }
    }
+   else if ( build_matrix_type == -2 )
+   {
+      ierr = HYPRE_IJMatrixReadBinary( argv[build_matrix_arg_index], comm,
+                                       HYPRE_PARCSR, &ij_A );
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         exit(1);
+      }
+   }
+   else if ( build_matrix_type == -3 )
+   {
+      ierr = HYPRE_IJMatrixReadMM( argv[build_matrix_arg_index], comm,
+                                   HYPRE_PARCSR, &ij_A );
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         exit(1);
+      }
+   }
    else if ( build_matrix_type == 0 )
    {
       BuildParFromFile(argc, argv, build_matrix_arg_index, &parcsr_A);
@@ -2558,6 +2727,11 @@ main( hypre_int argc,
          ierr = HYPRE_IJMatrixSetRowSizes ( ij_A, (const HYPRE_Int *) row_sizes );
       }
 
+      if (stage_flag)
+      {
+         HYPRE_IJMatrixSetStagingFlag(ij_A, 1);
+      }
+
       ierr += HYPRE_IJMatrixInitialize_v2( ij_A, memory_location );
 
       if (omp_flag)
@@ -2602,6 +2776,35 @@ main( hypre_int argc,
                                             (const HYPRE_Real *) data);
          }
       }
+      else if (stage_flag && hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST)
+      {
+         /* staged entries may be set from all threads at once */
+         HYPRE_Int *row_indx = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+
+         for (i = 0; i < num_rows; i++)
+         {
+            row_indx[i + 1] = row_indx[i] + num_cols_h[i];
+         }
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i) reduction(+:ierr) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            if (add)
+            {
+               ierr += HYPRE_IJMatrixAddToValues( ij_A, 1, &num_cols[i], &row_nums[i],
+                                                  (const HYPRE_BigInt *) &col_nums[row_indx[i]],
+                                                  (const HYPRE_Real *) &data[row_indx[i]] );
+            }
+            else
+            {
+               ierr += HYPRE_IJMatrixSetValues( ij_A, 1, &num_cols[i], &row_nums[i],
+                                                (const HYPRE_BigInt *) &col_nums[row_indx[i]],
+                                                (const HYPRE_Real *) &data[row_indx[i]] );
+            }
+         }
+         hypre_TFree(row_indx, HYPRE_MEMORY_HOST);
+      }
       else
       {
          j_indx = 0;
@@ -2622,18 +2825,6 @@ main( hypre_int argc,
             j_indx += num_cols_h[i];
          }
       }
-      hypre_TFree(num_cols_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(row_nums_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(col_nums_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(data_h,     HYPRE_MEMORY_HOST);
-      if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
-      {
-         hypre_TFree(col_nums, memory_location);
-         hypre_TFree(data,     memory_location);
-         hypre_TFree(row_nums, memory_location);
-         hypre_TFree(num_cols, memory_location);
-      }
-
       if (sparsity_known == 1)
       {
          hypre_TFree(diag_sizes,    HYPRE_MEMORY_HOST);
@@ -2651,6 +2842,63 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      /* Assemble the same matrix again with a locked pattern, as a time
+         stepping code would: the first cycle records the pattern, the
+         following ones only write the values */
+      if (rebuild && hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST)
+      {
+         HYPRE_Int k;
+
+         time_index = hypre_InitializeTiming("IJ Matrix Rebuild");
+         hypre_BeginTiming(time_index);
+
+         /* the cycles below are set from one thread */
+         ierr += HYPRE_IJMatrixSetStagingFlag(ij_A, 0);
+         ierr += HYPRE_IJMatrixSetLockPattern(ij_A, 1);
+         for (k = 0; k <= rebuild; k++)
+         {
+            if (add)
+            {
+               ierr += HYPRE_IJMatrixSetConstantValues(ij_A, 0.0);
+            }
+            j_indx = 0;
+            for (i = 0; i < num_rows; i++)
+            {
+               if (add)
+               {
+                  ierr += HYPRE_IJMatrixAddToValues( ij_A, 1, &num_cols_h[i], &row_nums_h[i],
+                                                     (const HYPRE_BigInt *) &col_nums_h[j_indx],
+                                                     (const HYPRE_Real *) &data_h[j_indx] );
+               }
+               else
+               {
+                  ierr += HYPRE_IJMatrixSetValues( ij_A, 1, &num_cols_h[i], &row_nums_h[i],
+                                                   (const HYPRE_BigInt *) &col_nums_h[j_indx],
+                                                   (const HYPRE_Real *) &data_h[j_indx] );
+               }
+               j_indx += num_cols_h[i];
+            }
+            ierr += HYPRE_IJMatrixAssemble( ij_A );
+         }
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("IJ Matrix Rebuild", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+      }
+
+      hypre_TFree(num_cols_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_nums_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(col_nums_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(data_h,     HYPRE_MEMORY_HOST);
+      if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+      {
+         hypre_TFree(col_nums, memory_location);
+         hypre_TFree(data,     memory_location);
+         hypre_TFree(row_nums, memory_location);
+         hypre_TFree(num_cols, memory_location);
+      }
+
       if (ierr)
       {
          hypre_printf("Error in driver building IJMatrix from parcsr matrix. \n");
@@ -2842,6 +3090,34 @@ main( hypre_int argc,
       ierr = HYPRE_IJVectorGetObject( ij_x, &object );
       x = (HYPRE_ParVector) object;
    }
+   else if ( build_rhs_type == 8 )
+   {
+      if (myid == 0)
+      {
+         hypre_printf("  RHS vector read from binary file %s\n", argv[build_rhs_arg_index]);
+         hypre_printf("  Initial guess is 0\n");
+      }
+
+      /* RHS */
+      ierr = HYPRE_IJVectorReadBinary( argv[build_rhs_arg_index], hypre_MPI_COMM_WORLD,
+                                       HYPRE_PARCSR, &ij_b );
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the right-hand-side!\n");
+         exit(1);
+      }
+      ierr = HYPRE_IJVectorGetObject( ij_b, &object );
+      b = (HYPRE_ParVector) object;
+
+      /* Initial guess */
+      HYPRE_IJVectorCreate(hypre_MPI_COMM_WORLD, first_local_col, last_local_col, &ij_x);
+      HYPRE_IJVectorSetObjectType(ij_x, HYPRE_PARCSR);
+      HYPRE_IJVectorInitialize(ij_x);
+      HYPRE_IJVectorAssemble(ij_x);
+
+      ierr = HYPRE_IJVectorGetObject( ij_x, &object );
+      x = (HYPRE_ParVector) object;
+   }
    else if ( build_rhs_type == 1 )
    {
       if (myid == 0)
@@ -3377,6 +3653,27 @@ main( hypre_int argc,
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x0");
    }
 
+   if (print_binary)
+   {
+      if (ij_A)
+      {
+         HYPRE_IJMatrixPrintBinary(ij_A, "IJ.out.A.bin");
+      }
+      else if (parcsr_A)
+      {
+         hypre_ParCSRMatrixPrintBinaryIJ(parcsr_A, 0, 0, "IJ.out.A.bin");
+      }
+      if (ij_b)
+      {
+         HYPRE_IJVectorPrintBinary(ij_b, "IJ.out.b.bin");
+      }
+      else if (b)
+      {
+         hypre_ParVectorPrintBinaryIJ(b, 0, "IJ.out.b.bin");
+      }
+      HYPRE_IJVectorPrintBinary(ij_x, "IJ.out.x0.bin");
+   }
+
    /*-----------------------------------------------------------
     * Migrate the system to the wanted memory space
     *-----------------------------------------------------------*/
@@ -3692,6 +3989,9 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetILUDroptol(amg_solver, ilu_droptol);
       HYPRE_BoomerAMGSetILUMaxRowNnz(amg_solver, ilu_max_row_nnz);
       HYPRE_BoomerAMGSetILUMaxIter(amg_solver, ilu_sm_max_iter);
+      HYPRE_BoomerAMGSetILUTriSolve(amg_solver, ilu_tri_solve);
+      HYPRE_BoomerAMGSetILULowerJacobiIters(amg_solver, ilu_lower_jacobi_iters);
+      HYPRE_BoomerAMGSetILUUpperJacobiIters(amg_solver, ilu_upper_jacobi_iters);
 
       HYPRE_BoomerAMGSetNumFunctions(amg_solver, num_functions);
       HYPRE_BoomerAMGSetAggNumLevels(amg_solver, agg_num_levels);
@@ -3728,6 +4028,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetSellNumLevels(amg_solver, sell_num_levels);
+      HYPRE_BoomerAMGSetFrozenPattern(amg_solver, frozen_pattern);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -3848,6 +4150,136 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      /* change the values of the assembled matrix in place, then solve with
+         the current hierarchy and with a new one */
+      if (diag_shift != 0.0 && solver_id == 0 && ij_A &&
+          hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST)
+      {
+         HYPRE_Real half_shift = 0.5 * diag_shift;
+
+         /* in two assembly cycles; with a locked pattern the first one is
+            recorded and the second one scattered */
+         if (rebuild)
+         {
+            ierr += HYPRE_IJMatrixSetLockPattern(ij_A, 1);
+         }
+         for (j = 0; j < 2; j++)
+         {
+            for (big_i = first_local_row; big_i <= last_local_row; big_i++)
+            {
+               ierr += HYPRE_IJMatrixAddToValues(ij_A, 1, NULL, &big_i, &big_i, &half_shift);
+            }
+            ierr += HYPRE_IJMatrixAssemble(ij_A);
+         }
+
+         for (j = 0; j < 2; j++)
+         {
+            HYPRE_ParVectorSetConstantValues(x, 0.0);
+            if (j == 1)
+            {
+               HYPRE_BoomerAMGSetup(amg_solver, parcsr_A, b, x);
+            }
+            HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, b, x);
+
+            HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+            HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+            if (myid == 0)
+            {
+               hypre_printf("\n");
+               hypre_printf("Shifted matrix, %s setup:\n", j ? "new" : "old");
+               hypre_printf("BoomerAMG Iterations = %d\n", num_iterations);
+               hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+               hypre_printf("\n");
+            }
+         }
+      }
+
+      /* solve for num_rhs right-hand sides at once, then for each of them
+         separately; the first right-hand side is b, the others are random */
+      if (num_rhs > 1 && solver_id == 0 &&
+          hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST)
+      {
+         HYPRE_BigInt    *row_starts = hypre_ParCSRMatrixRowStarts(parcsr_A);
+         HYPRE_BigInt     global_num_rows = hypre_ParCSRMatrixGlobalNumRows(parcsr_A);
+         hypre_ParVector *b_mv, *x_mv, *b_col, *x_col, *x_mv_col;
+         HYPRE_Int        max_num_iterations = 0;
+         HYPRE_Real       max_res_norm = 0.0, max_diff = 0.0, diff_norm, x_norm;
+
+         b_mv     = hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD, global_num_rows,
+                                               row_starts, num_rhs);
+         x_mv     = hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD, global_num_rows,
+                                               row_starts, num_rhs);
+         b_col    = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, global_num_rows, row_starts);
+         x_col    = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, global_num_rows, row_starts);
+         x_mv_col = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, global_num_rows, row_starts);
+         hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(b_mv)) = rhs_storage;
+         hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(x_mv)) = rhs_storage;
+         hypre_ParVectorInitialize_v2(b_mv, HYPRE_MEMORY_HOST);
+         hypre_ParVectorInitialize_v2(x_mv, HYPRE_MEMORY_HOST);
+         hypre_ParVectorInitialize_v2(b_col, HYPRE_MEMORY_HOST);
+         hypre_ParVectorInitialize_v2(x_col, HYPRE_MEMORY_HOST);
+         hypre_ParVectorInitialize_v2(x_mv_col, HYPRE_MEMORY_HOST);
+
+         for (j = 0; j < num_rhs; j++)
+         {
+            if (j == 0)
+            {
+               hypre_ParVectorCopy((hypre_ParVector *) b, b_col);
+            }
+            else
+            {
+               hypre_ParVectorSetRandomValues(b_col, 22775 + j);
+            }
+            hypre_ParMultiVectorSetColumn(b_mv, j, b_col);
+         }
+
+         HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, (HYPRE_ParVector) b_mv,
+                              (HYPRE_ParVector) x_mv);
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+
+         for (j = 0; j < num_rhs; j++)
+         {
+            HYPRE_Int  col_iterations;
+            HYPRE_Real col_res_norm;
+
+            hypre_ParMultiVectorGetColumn(b_mv, j, b_col);
+            hypre_ParVectorSetConstantValues(x_col, 0.0);
+            HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, (HYPRE_ParVector) b_col,
+                                 (HYPRE_ParVector) x_col);
+            HYPRE_BoomerAMGGetNumIterations(amg_solver, &col_iterations);
+            HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &col_res_norm);
+            max_num_iterations = hypre_max(max_num_iterations, col_iterations);
+            max_res_norm       = hypre_max(max_res_norm, col_res_norm);
+
+            hypre_ParMultiVectorGetColumn(x_mv, j, x_mv_col);
+            hypre_ParVectorAxpy(-1.0, x_col, x_mv_col);
+            diff_norm = sqrt(hypre_ParVectorInnerProd(x_mv_col, x_mv_col));
+            x_norm    = sqrt(hypre_ParVectorInnerProd(x_col, x_col));
+            max_diff  = hypre_max(max_diff, x_norm > 0.0 ? diff_norm / x_norm : diff_norm);
+         }
+
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("%d right-hand sides stored by %s, solved together:\n",
+                         num_rhs, rhs_storage ? "rows" : "columns");
+            hypre_printf("BoomerAMG Iterations = %d\n", num_iterations);
+            hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+            hypre_printf("%d right-hand sides, solved one at a time:\n", num_rhs);
+            hypre_printf("BoomerAMG Iterations = %d\n", max_num_iterations);
+            hypre_printf("Final Relative Residual Norm = %e\n", max_res_norm);
+            hypre_printf("Relative difference of the solutions = %e\n", max_diff);
+            hypre_printf("\n");
+         }
+
+         hypre_ParVectorDestroy(b_mv);
+         hypre_ParVectorDestroy(x_mv);
+         hypre_ParVectorDestroy(b_col);
+         hypre_ParVectorDestroy(x_col);
+         hypre_ParVectorDestroy(x_mv_col);
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       //HYPRE_ParVectorSetRandomValues(x, 775);
@@ -4047,6 +4479,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetSellNumLevels(amg_solver, sell_num_levels);
+      HYPRE_BoomerAMGSetFrozenPattern(amg_solver, frozen_pattern);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol - 1]);
@@ -4238,6 +4672,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSellNumLevels(pcg_precond, sell_num_levels);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4418,6 +4853,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSellNumLevels(pcg_precond, sell_num_levels);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4681,6 +5117,134 @@ main( hypre_int argc,
 
    }
 
+   /*-----------------------------------------------------------
+    * Solve the system using pipelined PCG
+    *-----------------------------------------------------------*/
+
+   if (solver_id == 19 || solver_id == 21)
+   {
+      time_index = hypre_InitializeTiming("PipelinedPCG Setup");
+      hypre_BeginTiming(time_index);
+
+      HYPRE_ParCSRPipelinedPCGCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
+      HYPRE_PipelinedPCGSetMaxIter(pcg_solver, max_iter);
+      HYPRE_PipelinedPCGSetTol(pcg_solver, tol);
+      HYPRE_PipelinedPCGSetTwoNorm(pcg_solver, 1);
+      HYPRE_PipelinedPCGSetPrintLevel(pcg_solver, ioutdat);
+      HYPRE_PipelinedPCGSetAbsoluteTol(pcg_solver, atol);
+      HYPRE_PipelinedPCGSetRecomputeResidualP(pcg_solver, recompute_res_p);
+
+      if (solver_id == 19)
+      {
+         /* use BoomerAMG as preconditioner */
+         if (myid == 0) { hypre_printf("Solver: AMG-PipelinedPCG\n"); }
+         HYPRE_BoomerAMGCreate(&pcg_precond);
+         HYPRE_BoomerAMGSetCGCIts(pcg_precond, cgcits);
+         HYPRE_BoomerAMGSetInterpType(pcg_precond, interp_type);
+         HYPRE_BoomerAMGSetPostInterpType(pcg_precond, post_interp_type);
+         HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
+         HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
+         HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
+         HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
+         HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
+         HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
+         HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
+         HYPRE_BoomerAMGSetPMaxElmts(pcg_precond, P_max_elmts);
+         HYPRE_BoomerAMGSetPrintLevel(pcg_precond, poutdat);
+         HYPRE_BoomerAMGSetPrintFileName(pcg_precond, "driver.out.log");
+         HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
+         HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
+         HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
+         if (relax_type > -1) { HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type); }
+         if (relax_down > -1)
+         {
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_down, 1);
+         }
+         if (relax_up > -1)
+         {
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_up, 2);
+         }
+         if (relax_coarse > -1)
+         {
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_coarse, 3);
+         }
+         HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
+         HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
+         HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
+         HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
+         HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
+         HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
+         HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
+         HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
+         HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
+         HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
+         HYPRE_BoomerAMGSetCycleNumSweeps(pcg_precond, ns_coarse, 3);
+         if (num_functions > 1)
+         {
+            HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
+         }
+         HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
+         HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
+         HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSellNumLevels(pcg_precond, sell_num_levels);
+         HYPRE_PipelinedPCGSetPrecond(pcg_solver,
+                                      (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSolve,
+                                      (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSetup,
+                                      pcg_precond);
+      }
+      else if (solver_id == 21)
+      {
+         /* use diagonal scaling as preconditioner */
+         if (myid == 0) { hypre_printf("Solver: DS-PipelinedPCG\n"); }
+         pcg_precond = NULL;
+
+         HYPRE_PipelinedPCGSetPrecond(pcg_solver,
+                                      (HYPRE_PtrToSolverFcn) HYPRE_ParCSRDiagScale,
+                                      (HYPRE_PtrToSolverFcn) HYPRE_ParCSRDiagScaleSetup,
+                                      pcg_precond);
+      }
+
+      HYPRE_PipelinedPCGSetup(pcg_solver, (HYPRE_Matrix)parcsr_A,
+                              (HYPRE_Vector)b, (HYPRE_Vector)x);
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      time_index = hypre_InitializeTiming("PipelinedPCG Solve");
+      hypre_BeginTiming(time_index);
+
+      HYPRE_PipelinedPCGSolve(pcg_solver, (HYPRE_Matrix)parcsr_A,
+                              (HYPRE_Vector)b, (HYPRE_Vector)x);
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      HYPRE_PipelinedPCGGetNumIterations(pcg_solver, &num_iterations);
+      HYPRE_PipelinedPCGGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
+
+      HYPRE_ParCSRPipelinedPCGDestroy(pcg_solver);
+
+      if (solver_id == 19)
+      {
+         HYPRE_BoomerAMGDestroy(pcg_precond);
+      }
+
+      if (myid == 0)
+      {
+         hypre_printf("\n");
+         hypre_printf("Iterations = %d\n", num_iterations);
+         hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+         hypre_printf("\n");
+      }
+   }
+
    /* begin lobpcg */
 
    /*-----------------------------------------------------------
@@ -5839,6 +6403,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSellNumLevels(amg_precond, sell_num_levels);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -6022,6 +6587,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSellNumLevels(pcg_precond, sell_num_levels);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6085,6 +6651,11 @@ main( hypre_int argc,
          HYPRE_ILUCreate(&pcg_precond);
          HYPRE_ILUSetType(pcg_precond, ilu_type);
          HYPRE_ILUSetLevelOfFill(pcg_precond, ilu_lfil);
+         HYPRE_ILUSetTriSolve(pcg_precond, ilu_tri_solve);
+         HYPRE_ILUSetLowerJacobiIters(pcg_precond, ilu_lower_jacobi_iters);
+         HYPRE_ILUSetUpperJacobiIters(pcg_precond, ilu_upper_jacobi_iters);
+         HYPRE_ILUSetIterativeSetupType(pcg_precond, ilu_iter_setup_type);
+         HYPRE_ILUSetIterativeSetupMaxIter(pcg_precond, ilu_iter_setup_max_iter);
          /* set print level */
          HYPRE_ILUSetPrintLevel(pcg_precond, 1);
          /* set max iterations */
@@ -6358,6 +6929,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSellNumLevels(pcg_precond, sell_num_levels);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6559,6 +7131,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSellNumLevels(pcg_precond, sell_num_levels);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6707,6 +7280,11 @@ main( hypre_int argc,
          HYPRE_ILUCreate(&pcg_precond);
          HYPRE_ILUSetType(pcg_precond, ilu_type);
          HYPRE_ILUSetLevelOfFill(pcg_precond, ilu_lfil);
+         HYPRE_ILUSetTriSolve(pcg_precond, ilu_tri_solve);
+         HYPRE_ILUSetLowerJacobiIters(pcg_precond, ilu_lower_jacobi_iters);
+         HYPRE_ILUSetUpperJacobiIters(pcg_precond, ilu_upper_jacobi_iters);
+         HYPRE_ILUSetIterativeSetupType(pcg_precond, ilu_iter_setup_type);
+         HYPRE_ILUSetIterativeSetupMaxIter(pcg_precond, ilu_iter_setup_max_iter);
          /* set print level */
          HYPRE_ILUSetPrintLevel(pcg_precond, 1);
          /* set max iterations */
@@ -6955,6 +7533,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSellNumLevels(pcg_precond, sell_num_levels);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7217,6 +7796,7 @@ main( hypre_int argc,
       HYPRE_COGMRESSetKDim(pcg_solver, k_dim);
       HYPRE_COGMRESSetUnroll(pcg_solver, unroll);
       HYPRE_COGMRESSetCGS(pcg_solver, cgs);
+      HYPRE_COGMRESSetSStep(pcg_solver, s_step);
       HYPRE_COGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_COGMRESSetTol(pcg_solver, tol);
       HYPRE_COGMRESSetAbsoluteTol(pcg_solver, atol);
@@ -7330,6 +7910,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSellNumLevels(pcg_precond, sell_num_levels);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7655,6 +8236,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSellNumLevels(pcg_precond, sell_num_levels);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7933,6 +8515,12 @@ main( hypre_int argc,
       HYPRE_ILUSetType(ilu_solver, ilu_type);
       /* set level of fill */
       HYPRE_ILUSetLevelOfFill(ilu_solver, ilu_lfil);
+      /* set triangular solve */
+      HYPRE_ILUSetTriSolve(ilu_solver, ilu_tri_solve);
+      HYPRE_ILUSetLowerJacobiIters(ilu_solver, ilu_lower_jacobi_iters);
+      HYPRE_ILUSetUpperJacobiIters(ilu_solver, ilu_upper_jacobi_iters);
+      HYPRE_ILUSetIterativeSetupType(ilu_solver, ilu_iter_setup_type);
+      HYPRE_ILUSetIterativeSetupMaxIter(ilu_solver, ilu_iter_setup_max_iter);
       /* set print level */
       HYPRE_ILUSetPrintLevel(ilu_solver, 2);
       /* set max iterations */
@@ -8002,6 +8590,11 @@ main( hypre_int argc,
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x");
    }
 
+   if (print_binary)
+   {
+      HYPRE_IJVectorPrintBinary(ij_x, "IJ.out.x.bin");
+   }
+
    /*-----------------------------------------------------------
     * Finalize things
     *-----------------------------------------------------------*/
@@ -8010,7 +8603,7 @@ final:
 
    HYPRE_ParVectorDestroy(x0_save);
 
-   if (test_ij || build_matrix_type == -1)
+   if (test_ij || build_matrix_type < 0)
    {
       HYPRE_IJMatrixDestroy(ij_A);
    }
@@ -100,6 +100,10 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           fused_relax;
+   HYPRE_Int           agglom_size;
+   HYPRE_Int           mixed_precision;
+   HYPRE_Int           compress_coarse;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -210,6 +214,10 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   fused_relax = 1;
+   agglom_size = 0;
+   mixed_precision = 0;
+   compress_coarse = 0;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -404,6 +412,26 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-fused_relax") == 0 )
+      {
+         arg_index++;
+         fused_relax = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-agglom") == 0 )
+      {
+         arg_index++;
+         agglom_size = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mixed") == 0 )
+      {
+         arg_index++;
+         mixed_precision = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-compress") == 0 )
+      {
+         arg_index++;
+         compress_coarse = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -583,6 +611,10 @@ main( hypre_int argc,
       hypre_printf("                        60 - FlexGMRES with SMG precond\n");
       hypre_printf("                        61 - FlexGMRES with PFMG precond\n");
       hypre_printf("                        69 - FlexGMRES\n");
+      hypre_printf("                        70 - Pipelined CG with SMG precond\n");
+      hypre_printf("                        71 - Pipelined CG with PFMG precond\n");
+      hypre_printf("                        78 - Pipelined CG with diagonal scaling\n");
+      hypre_printf("                        79 - Pipelined CG\n");
       hypre_printf("  -v <n_pre> <n_post> : number of pre and post relaxations\n");
       hypre_printf("  -rap <r>            : coarse grid operator type\n");
       hypre_printf("                        0 - Galerkin (default)\n");
@@ -593,8 +625,16 @@ main( hypre_int argc,
       hypre_printf("                        1 - Weighted Jacobi (default)\n");
       hypre_printf("                        2 - R/B Gauss-Seidel\n");
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
+      hypre_printf("                        4 - Weighted line Jacobi (PFMG)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -fused_relax <k>    : Jacobi sweeps per exchange in PFMG\n");
+      hypre_printf("  -agglom <n>         : agglomerate PFMG coarse grids below\n");
+      hypre_printf("                        n points per process (0 = off)\n");
+      hypre_printf("  -mixed <m>          : single-precision matrix coefficients\n");
+      hypre_printf("                        in PFMG (1) or not (0)\n");
+      hypre_printf("  -compress <c>       : compress constant PFMG coarse\n");
+      hypre_printf("                        operators (1) or not (0)\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
@@ -1462,6 +1502,10 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetFusedRelaxSweeps(solver, fused_relax);
+         HYPRE_StructPFMGSetAgglomSize(solver, agglom_size);
+         HYPRE_StructPFMGSetMixedPrecision(solver, mixed_precision);
+         HYPRE_StructPFMGSetCompressCoarse(solver, compress_coarse);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1644,6 +1688,10 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFusedRelaxSweeps(precond, fused_relax);
+            HYPRE_StructPFMGSetAgglomSize(precond, agglom_size);
+            HYPRE_StructPFMGSetMixedPrecision(precond, mixed_precision);
+            HYPRE_StructPFMGSetCompressCoarse(precond, compress_coarse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1813,6 +1861,10 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetFusedRelaxSweeps(precond, fused_relax);
+               HYPRE_StructPFMGSetAgglomSize(precond, agglom_size);
+               HYPRE_StructPFMGSetMixedPrecision(precond, mixed_precision);
+               HYPRE_StructPFMGSetCompressCoarse(precond, compress_coarse);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2064,6 +2116,10 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetFusedRelaxSweeps(precond, fused_relax);
+               HYPRE_StructPFMGSetAgglomSize(precond, agglom_size);
+               HYPRE_StructPFMGSetMixedPrecision(precond, mixed_precision);
+               HYPRE_StructPFMGSetCompressCoarse(precond, compress_coarse);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2327,6 +2383,10 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFusedRelaxSweeps(precond, fused_relax);
+            HYPRE_StructPFMGSetAgglomSize(precond, agglom_size);
+            HYPRE_StructPFMGSetMixedPrecision(precond, mixed_precision);
+            HYPRE_StructPFMGSetCompressCoarse(precond, compress_coarse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2451,6 +2511,10 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFusedRelaxSweeps(precond, fused_relax);
+            HYPRE_StructPFMGSetAgglomSize(precond, agglom_size);
+            HYPRE_StructPFMGSetMixedPrecision(precond, mixed_precision);
+            HYPRE_StructPFMGSetCompressCoarse(precond, compress_coarse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2602,6 +2666,10 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFusedRelaxSweeps(precond, fused_relax);
+            HYPRE_StructPFMGSetAgglomSize(precond, agglom_size);
+            HYPRE_StructPFMGSetMixedPrecision(precond, mixed_precision);
+            HYPRE_StructPFMGSetCompressCoarse(precond, compress_coarse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2753,6 +2821,10 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFusedRelaxSweeps(precond, fused_relax);
+            HYPRE_StructPFMGSetAgglomSize(precond, agglom_size);
+            HYPRE_StructPFMGSetMixedPrecision(precond, mixed_precision);
+            HYPRE_StructPFMGSetCompressCoarse(precond, compress_coarse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2851,6 +2923,10 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFusedRelaxSweeps(precond, fused_relax);
+            HYPRE_StructPFMGSetAgglomSize(precond, agglom_size);
+            HYPRE_StructPFMGSetMixedPrecision(precond, mixed_precision);
+            HYPRE_StructPFMGSetCompressCoarse(precond, compress_coarse);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2897,6 +2973,108 @@ main( hypre_int argc,
 
       }
 
+      /*-----------------------------------------------------------
+       * Solve the system using pipelined CG
+       *-----------------------------------------------------------*/
+
+      if ((solver_id > 69) && (solver_id < 80))
+      {
+         time_index = hypre_InitializeTiming("PipelinedPCG Setup");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_StructPipelinedPCGCreate(hypre_MPI_COMM_WORLD, &solver);
+         HYPRE_StructPipelinedPCGSetMaxIter(solver, 100);
+         HYPRE_StructPipelinedPCGSetTol(solver, tol);
+         HYPRE_StructPipelinedPCGSetTwoNorm(solver, 1);
+         HYPRE_StructPipelinedPCGSetPrintLevel(solver, 1);
+
+         if (solver_id == 70)
+         {
+            /* use symmetric SMG as preconditioner */
+            HYPRE_StructSMGCreate(hypre_MPI_COMM_WORLD, &precond);
+            HYPRE_StructSMGSetMemoryUse(precond, 0);
+            HYPRE_StructSMGSetMaxIter(precond, 1);
+            HYPRE_StructSMGSetTol(precond, 0.0);
+            HYPRE_StructSMGSetZeroGuess(precond);
+            HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
+            HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetPrintLevel(precond, 0);
+            HYPRE_StructSMGSetLogging(precond, 0);
+            HYPRE_StructPipelinedPCGSetPrecond(solver,
+                                               HYPRE_StructSMGSolve,
+                                               HYPRE_StructSMGSetup,
+                                               precond);
+         }
+
+         else if (solver_id == 71)
+         {
+            /* use symmetric PFMG as preconditioner */
+            HYPRE_StructPFMGCreate(hypre_MPI_COMM_WORLD, &precond);
+            HYPRE_StructPFMGSetMaxIter(precond, 1);
+            HYPRE_StructPFMGSetTol(precond, 0.0);
+            HYPRE_StructPFMGSetZeroGuess(precond);
+            HYPRE_StructPFMGSetRAPType(precond, rap);
+            HYPRE_StructPFMGSetRelaxType(precond, relax);
+            if (usr_jacobi_weight)
+            {
+               HYPRE_StructPFMGSetJacobiWeight(precond, jacobi_weight);
+            }
+            HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
+            HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetFusedRelaxSweeps(precond, fused_relax);
+            HYPRE_StructPFMGSetAgglomSize(precond, agglom_size);
+            HYPRE_StructPFMGSetMixedPrecision(precond, mixed_precision);
+            HYPRE_StructPFMGSetCompressCoarse(precond, compress_coarse);
+            HYPRE_StructPFMGSetPrintLevel(precond, 0);
+            HYPRE_StructPFMGSetLogging(precond, 0);
+            HYPRE_StructPipelinedPCGSetPrecond(solver,
+                                               HYPRE_StructPFMGSolve,
+                                               HYPRE_StructPFMGSetup,
+                                               precond);
+         }
+
+         else if (solver_id == 78)
+         {
+            /* use diagonal scaling as preconditioner */
+            precond = NULL;
+            HYPRE_StructPipelinedPCGSetPrecond(solver,
+                                               HYPRE_StructDiagScale,
+                                               HYPRE_StructDiagScaleSetup,
+                                               precond);
+         }
+
+         HYPRE_StructPipelinedPCGSetup(solver, A, b, x);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         time_index = hypre_InitializeTiming("PipelinedPCG Solve");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_StructPipelinedPCGSolve(solver, A, b, x);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_StructPipelinedPCGGetNumIterations(solver, &num_iterations);
+         HYPRE_StructPipelinedPCGGetFinalRelativeResidualNorm(solver, &final_res_norm);
+         HYPRE_StructPipelinedPCGDestroy(solver);
+
+         if (solver_id == 70)
+         {
+            HYPRE_StructSMGDestroy(precond);
+         }
+         else if (solver_id == 71)
+         {
+            HYPRE_StructPFMGDestroy(precond);
+         }
+      }
+
       /*-----------------------------------------------------------
        * Print the solution and other info
        *-----------------------------------------------------------*/
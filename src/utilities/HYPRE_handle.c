@@ -22,6 +22,15 @@ HYPRE_SetSpGemmUseCusparse( HYPRE_Int use_cusparse )
    return hypre_SetSpGemmUseCusparse(use_cusparse);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSpGemmHostAlgorithm
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetSpGemmHostAlgorithm( HYPRE_Int value )
+{
+   return hypre_SetSpGemmHostAlgorithm(value);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SetUseGpuRand
  *--------------------------------------------------------------------------*/
@@ -230,6 +230,7 @@ HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HY
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int HYPRE_SetSpGemmUseCusparse( HYPRE_Int use_cusparse );
+HYPRE_Int HYPRE_SetSpGemmHostAlgorithm( HYPRE_Int value );
 HYPRE_Int HYPRE_SetUseGpuRand( HYPRE_Int use_curand );
 
 #ifdef __cplusplus
@@ -33,6 +33,7 @@ extern "C" {
 /* This allows us to consistently avoid 'int' throughout hypre */
 typedef int                    hypre_int;
 typedef long int               hypre_longint;
+typedef long long int          hypre_longlongint;
 typedef unsigned int           hypre_uint;
 typedef unsigned long int      hypre_ulongint;
 typedef unsigned long long int hypre_ulonglongint;
@@ -261,10 +262,12 @@ extern "C" {
 #define MPI_Iprobe          hypre_MPI_Iprobe
 #define MPI_Test            hypre_MPI_Test
 #define MPI_Testall         hypre_MPI_Testall
+#define MPI_Testsome        hypre_MPI_Testsome
 #define MPI_Wait            hypre_MPI_Wait
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -384,6 +387,11 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
 
+/* neighborhood collectives on distributed graph communicators (MPI-3) */
+#if MPI_VERSION > 2
+#define HYPRE_USING_MPI_NEIGHBOR_COLL
+#endif
+
 #endif
 
 /******************************************************************************
@@ -460,6 +468,9 @@ HYPRE_Int hypre_MPI_Iprobe( HYPRE_Int source, HYPRE_Int tag, hypre_MPI_Comm comm
 HYPRE_Int hypre_MPI_Test( hypre_MPI_Request *request, HYPRE_Int *flag, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Testall( HYPRE_Int count, hypre_MPI_Request *array_of_requests, HYPRE_Int *flag,
                              hypre_MPI_Status *array_of_statuses );
+HYPRE_Int hypre_MPI_Testsome( HYPRE_Int incount, hypre_MPI_Request *array_of_requests,
+                              HYPRE_Int *outcount, HYPRE_Int *array_of_indices,
+                              hypre_MPI_Status *array_of_statuses );
 HYPRE_Int hypre_MPI_Wait( hypre_MPI_Request *request, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Waitall( HYPRE_Int count, hypre_MPI_Request *array_of_requests,
                              hypre_MPI_Status *array_of_statuses );
@@ -467,6 +478,9 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count, hypre_MPI_Request *array_of_reques
                              HYPRE_Int *index, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
+                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm,
+                                hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                             hypre_MPI_Datatype datatype, hypre_MPI_Op op, HYPRE_Int root, hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf, void *recvbuf, HYPRE_Int count,
@@ -486,6 +500,20 @@ HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
+#if defined(HYPRE_USING_MPI_NEIGHBOR_COLL)
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm, HYPRE_Int indegree,
+                                                HYPRE_Int *sources, HYPRE_Int outdegree,
+                                                HYPRE_Int *destinations, hypre_MPI_Comm *newcomm );
+HYPRE_Int hypre_MPI_Neighbor_allgather( void *sendbuf, HYPRE_Int sendcount,
+                                        hypre_MPI_Datatype sendtype, void *recvbuf, HYPRE_Int recvcount,
+                                        hypre_MPI_Datatype recvtype, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Neighbor_alltoall( void *sendbuf, HYPRE_Int sendcount,
+                                       hypre_MPI_Datatype sendtype, void *recvbuf, HYPRE_Int recvcount,
+                                       hypre_MPI_Datatype recvtype, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Neighbor_alltoallv( void *sendbuf, HYPRE_Int *sendcounts, HYPRE_Int *sdispls,
+                                        hypre_MPI_Datatype sendtype, void *recvbuf, HYPRE_Int *recvcounts,
+                                        HYPRE_Int *rdispls, hypre_MPI_Datatype recvtype, hypre_MPI_Comm comm );
+#endif
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
@@ -1282,6 +1310,8 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   /* host SpGemm: 0 = dense marker, 1 = per-row hash/heap accumulators */
+   HYPRE_Int              spgemm_host_algorithm;
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceData        *device_data;
    /* device G-S options */
@@ -1312,6 +1342,7 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpgemmHostAlgorithm(hypre_handle)            ((hypre_handle) -> spgemm_host_algorithm)
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
 
@@ -1484,6 +1515,15 @@ hypre_LinkList hypre_create_elt ( HYPRE_Int Item );
 void hypre_enter_on_lists ( hypre_LinkList *LoL_head_ptr, hypre_LinkList *LoL_tail_ptr,
                             HYPRE_Int measure, HYPRE_Int index, HYPRE_Int *lists, HYPRE_Int *where );
 
+/* binary_io.c */
+HYPRE_Int hypre_BinaryFileOpenWrite ( MPI_Comm comm, const char *filename, void **file_ptr );
+HYPRE_Int hypre_BinaryFileWriteAt ( void *file_in, hypre_ulonglongint offset, const void *buf,
+                                    hypre_ulonglongint nbytes );
+HYPRE_Int hypre_BinaryFileClose ( void *file_in );
+HYPRE_Int hypre_BinaryFileMap ( const char *filename, hypre_ulonglongint offset,
+                                hypre_ulonglongint nbytes, void **mapping_ptr, void **data_ptr );
+HYPRE_Int hypre_BinaryFileUnmap ( void *mapping_in );
+
 /* binsearch.c */
 HYPRE_Int hypre_BinarySearch ( HYPRE_Int *list, HYPRE_Int value, HYPRE_Int list_length );
 HYPRE_Int hypre_BigBinarySearch ( HYPRE_BigInt *list, HYPRE_BigInt value, HYPRE_Int list_length );
@@ -1784,6 +1824,7 @@ HYPRE_Int hypre_SetSpGemmRownnzEstimateMethod( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmRownnzEstimateNSamples( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmRownnzEstimateMultFactor( HYPRE_Real value );
 HYPRE_Int hypre_SetSpGemmHashType( char value );
+HYPRE_Int hypre_SetSpGemmHostAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetUseGpuRand( HYPRE_Int use_gpurand );
 HYPRE_Int hypre_SetGaussSeidelMethod( HYPRE_Int gs_method );
 HYPRE_Int hypre_SetUserDeviceMalloc(GPUMallocFunc func);
@@ -0,0 +1,271 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Shared binary files: collective writes at explicit offsets (MPI-IO), and
+ * read-only mappings of file ranges (mmap) for any number of readers.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/* largest piece passed to a single write call (counts are hypre_int) */
+#define hypre_BINARY_IO_CHUNK (1 << 30)
+
+typedef struct
+{
+#ifdef HYPRE_SEQUENTIAL
+   FILE          *fp;
+#else
+   MPI_File       fh;
+   MPI_Comm       comm;
+#endif
+
+} hypre_BinaryFile;
+
+typedef struct
+{
+   void          *addr;
+   size_t         length;
+   HYPRE_Int      mapped;     /* addr is an mmap, else it is allocated */
+
+} hypre_BinaryFileMapping;
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileOpenWrite
+ *
+ * Creates (or truncates) a file written by all processes of comm.
+ * Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryFileOpenWrite( MPI_Comm     comm,
+                           const char  *filename,
+                           void       **file_ptr )
+{
+   hypre_BinaryFile *file = hypre_CTAlloc(hypre_BinaryFile, 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_SEQUENTIAL
+   if ((file -> fp = fopen(filename, "wb")) == NULL)
+#else
+   file -> comm = comm;
+   if (MPI_File_open(comm, (char *) filename, MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                     MPI_INFO_NULL, &(file -> fh)) != MPI_SUCCESS ||
+       MPI_File_set_size(file -> fh, 0) != MPI_SUCCESS)
+#endif
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      hypre_TFree(file, HYPRE_MEMORY_HOST);
+      *file_ptr = NULL;
+      return hypre_error_flag;
+   }
+
+   *file_ptr = (void *) file;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileWriteAt
+ *
+ * Writes nbytes at the given byte offset.  Collective; processes with
+ * nothing to write pass nbytes = 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryFileWriteAt( void               *file_in,
+                         hypre_ulonglongint  offset,
+                         const void         *buf,
+                         hypre_ulonglongint  nbytes )
+{
+   hypre_BinaryFile *file = (hypre_BinaryFile *) file_in;
+
+#ifdef HYPRE_SEQUENTIAL
+   if (nbytes > 0 &&
+       (fseek(file -> fp, (long) offset, SEEK_SET) != 0 ||
+        fwrite(buf, 1, (size_t) nbytes, file -> fp) != (size_t) nbytes))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error writing binary file\n");
+   }
+#else
+   HYPRE_Int           num_chunks, max_num_chunks, k, ierr = 0;
+   hypre_ulonglongint  count;
+   const char         *cbuf = (const char *) buf;
+
+   /* every process makes the same number of calls */
+   num_chunks = (HYPRE_Int) ((nbytes + hypre_BINARY_IO_CHUNK - 1) / hypre_BINARY_IO_CHUNK);
+   hypre_MPI_Allreduce(&num_chunks, &max_num_chunks, 1, HYPRE_MPI_INT, hypre_MPI_MAX,
+                       file -> comm);
+   for (k = 0; k < max_num_chunks; k++)
+   {
+      count = (nbytes > hypre_BINARY_IO_CHUNK) ? hypre_BINARY_IO_CHUNK : nbytes;
+      ierr += (MPI_File_write_at_all(file -> fh, (MPI_Offset) offset, (void *) cbuf,
+                                     (hypre_int) count, MPI_BYTE,
+                                     MPI_STATUS_IGNORE) != MPI_SUCCESS);
+      offset += count;
+      cbuf   += count;
+      nbytes -= count;
+   }
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error writing binary file\n");
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileClose
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryFileClose( void *file_in )
+{
+   hypre_BinaryFile *file = (hypre_BinaryFile *) file_in;
+
+   if (file)
+   {
+#ifdef HYPRE_SEQUENTIAL
+      fclose(file -> fp);
+#else
+      MPI_File_close(&(file -> fh));
+#endif
+      hypre_TFree(file, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileMap
+ *
+ * Gives read-only access to nbytes of a file starting at the given byte
+ * offset, in *data_ptr.  The range is mapped into memory when possible, so
+ * only the pages touched are read.  Release with hypre_BinaryFileUnmap.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryFileMap( const char          *filename,
+                     hypre_ulonglongint   offset,
+                     hypre_ulonglongint   nbytes,
+                     void               **mapping_ptr,
+                     void               **data_ptr )
+{
+   hypre_BinaryFileMapping *mapping;
+
+   *mapping_ptr = NULL;
+   *data_ptr    = NULL;
+
+   mapping = hypre_CTAlloc(hypre_BinaryFileMapping, 1, HYPRE_MEMORY_HOST);
+
+#if !defined(_WIN32)
+   {
+      struct stat         st;
+      hypre_ulonglongint  page, start;
+      HYPRE_Int           fd;
+
+      if ((fd = open(filename, O_RDONLY)) < 0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open input file\n");
+         hypre_TFree(mapping, HYPRE_MEMORY_HOST);
+         return hypre_error_flag;
+      }
+      if (fstat(fd, &st) != 0 || offset + nbytes > (hypre_ulonglongint) st.st_size)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file is too short\n");
+         close(fd);
+         hypre_TFree(mapping, HYPRE_MEMORY_HOST);
+         return hypre_error_flag;
+      }
+
+      if (nbytes > 0)
+      {
+         /* the mapping must start on a page boundary */
+         page  = (hypre_ulonglongint) sysconf(_SC_PAGESIZE);
+         start = offset - offset % page;
+         mapping -> length = (size_t) (nbytes + offset - start);
+         mapping -> addr   = mmap(NULL, mapping -> length, PROT_READ, MAP_PRIVATE, fd,
+                                  (off_t) start);
+         if (mapping -> addr == MAP_FAILED)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error mapping binary file\n");
+            close(fd);
+            hypre_TFree(mapping, HYPRE_MEMORY_HOST);
+            return hypre_error_flag;
+         }
+         mapping -> mapped = 1;
+         *data_ptr = (void *) ((char *) mapping -> addr + (offset - start));
+      }
+      close(fd);
+   }
+#else
+   {
+      FILE *fp;
+
+      if ((fp = fopen(filename, "rb")) == NULL)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open input file\n");
+         hypre_TFree(mapping, HYPRE_MEMORY_HOST);
+         return hypre_error_flag;
+      }
+      if (nbytes > 0)
+      {
+         mapping -> length = (size_t) nbytes;
+         mapping -> addr   = hypre_TAlloc(char, mapping -> length, HYPRE_MEMORY_HOST);
+         if (_fseeki64(fp, (__int64) offset, SEEK_SET) != 0 ||
+             fread(mapping -> addr, 1, mapping -> length, fp) != mapping -> length)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file is too short\n");
+            fclose(fp);
+            hypre_TFree(mapping -> addr, HYPRE_MEMORY_HOST);
+            hypre_TFree(mapping, HYPRE_MEMORY_HOST);
+            return hypre_error_flag;
+         }
+         *data_ptr = mapping -> addr;
+      }
+      fclose(fp);
+   }
+#endif
+
+   *mapping_ptr = (void *) mapping;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileUnmap
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryFileUnmap( void *mapping_in )
+{
+   hypre_BinaryFileMapping *mapping = (hypre_BinaryFileMapping *) mapping_in;
+
+   if (mapping)
+   {
+#if !defined(_WIN32)
+      if (mapping -> mapped)
+      {
+         munmap(mapping -> addr, mapping -> length);
+      }
+#else
+      hypre_TFree(mapping -> addr, HYPRE_MEMORY_HOST);
+#endif
+      hypre_TFree(mapping, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
@@ -17,6 +17,7 @@
 /* This allows us to consistently avoid 'int' throughout hypre */
 typedef int                    hypre_int;
 typedef long int               hypre_longint;
+typedef long long int          hypre_longlongint;
 typedef unsigned int           hypre_uint;
 typedef unsigned long int      hypre_ulongint;
 typedef unsigned long long int hypre_ulonglongint;
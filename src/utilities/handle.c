@@ -97,6 +97,21 @@ hypre_SetSpGemmHashType( char value )
    return hypre_error_flag;
 }
 
+/* Host SpGemm */
+HYPRE_Int
+hypre_SetSpGemmHostAlgorithm( HYPRE_Int value )
+{
+   if (value == 0 || value == 1)
+   {
+      hypre_HandleSpgemmHostAlgorithm(hypre_handle()) = value;
+   }
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+   return hypre_error_flag;
+}
+
 /* GPU Rand */
 HYPRE_Int
 hypre_SetUseGpuRand( HYPRE_Int use_gpurand )
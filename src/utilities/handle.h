@@ -23,6 +23,8 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   /* host SpGemm: 0 = dense marker, 1 = per-row hash/heap accumulators */
+   HYPRE_Int              spgemm_host_algorithm;
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceData        *device_data;
    /* device G-S options */
@@ -53,6 +55,7 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpgemmHostAlgorithm(hypre_handle)            ((hypre_handle) -> spgemm_host_algorithm)
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
 
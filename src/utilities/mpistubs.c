@@ -497,6 +497,23 @@ hypre_MPI_Testall( HYPRE_Int          count,
    return (0);
 }
 
+HYPRE_Int
+hypre_MPI_Testsome( HYPRE_Int          incount,
+                    hypre_MPI_Request *array_of_requests,
+                    HYPRE_Int         *outcount,
+                    HYPRE_Int         *array_of_indices,
+                    hypre_MPI_Status  *array_of_statuses )
+{
+   HYPRE_Int i;
+
+   for (i = 0; i < incount; i++)
+   {
+      array_of_indices[i] = i;
+   }
+   *outcount = incount;
+   return (0);
+}
+
 HYPRE_Int
 hypre_MPI_Wait( hypre_MPI_Request *request,
                 hypre_MPI_Status  *status )
@@ -642,6 +659,19 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   *request = hypre_MPI_REQUEST_NULL;
+   return hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1229,6 +1259,29 @@ hypre_MPI_Testall( HYPRE_Int          count,
    return ierr;
 }
 
+HYPRE_Int
+hypre_MPI_Testsome( HYPRE_Int          incount,
+                    hypre_MPI_Request *array_of_requests,
+                    HYPRE_Int         *outcount,
+                    HYPRE_Int         *array_of_indices,
+                    hypre_MPI_Status  *array_of_statuses )
+{
+   hypre_int  mpi_outcount;
+   hypre_int *mpi_indices;
+   HYPRE_Int  i, ierr;
+
+   mpi_indices = hypre_TAlloc(hypre_int, incount, HYPRE_MEMORY_HOST);
+   ierr = (HYPRE_Int) MPI_Testsome((hypre_int)incount, array_of_requests,
+                                   &mpi_outcount, mpi_indices, array_of_statuses);
+   *outcount = (HYPRE_Int) mpi_outcount;
+   for (i = 0; i < *outcount; i++)
+   {
+      array_of_indices[i] = (HYPRE_Int) mpi_indices[i];
+   }
+   hypre_TFree(mpi_indices, HYPRE_MEMORY_HOST);
+   return ierr;
+}
+
 HYPRE_Int
 hypre_MPI_Wait( hypre_MPI_Request *request,
                 hypre_MPI_Status  *status )
@@ -1271,6 +1324,26 @@ hypre_MPI_Allreduce( void              *sendbuf,
                                     datatype, op, comm);
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   /* no non-blocking collectives before MPI-3; complete the reduction now */
+   *request = hypre_MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1393,6 +1466,117 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
+#if defined(HYPRE_USING_MPI_NEIGHBOR_COLL)
+/* all edges have unit weight, ranks are not reordered */
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      hypre_MPI_Comm *newcomm )
+{
+   hypre_int *mpi_sources, *mpi_destinations, *mpi_weights;
+   HYPRE_Int  i;
+   HYPRE_Int  ierr;
+
+   mpi_sources = hypre_TAlloc(hypre_int, indegree, HYPRE_MEMORY_HOST);
+   mpi_destinations = hypre_TAlloc(hypre_int, outdegree, HYPRE_MEMORY_HOST);
+   /* never NULL, which may mean MPI_UNWEIGHTED */
+   mpi_weights = hypre_TAlloc(hypre_int, hypre_max(hypre_max(indegree, outdegree), 1),
+                              HYPRE_MEMORY_HOST);
+   for (i = 0; i < hypre_max(hypre_max(indegree, outdegree), 1); i++)
+   {
+      mpi_weights[i] = 1;
+   }
+   for (i = 0; i < indegree; i++)
+   {
+      mpi_sources[i] = (hypre_int) sources[i];
+   }
+   for (i = 0; i < outdegree; i++)
+   {
+      mpi_destinations[i] = (hypre_int) destinations[i];
+   }
+   ierr = (HYPRE_Int) MPI_Dist_graph_create_adjacent(comm, (hypre_int)indegree, mpi_sources,
+                                                     mpi_weights, (hypre_int)outdegree,
+                                                     mpi_destinations, mpi_weights,
+                                                     MPI_INFO_NULL, 0, newcomm);
+   hypre_TFree(mpi_sources, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destinations, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_weights, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Neighbor_allgather( void               *sendbuf,
+                              HYPRE_Int           sendcount,
+                              hypre_MPI_Datatype  sendtype,
+                              void               *recvbuf,
+                              HYPRE_Int           recvcount,
+                              hypre_MPI_Datatype  recvtype,
+                              hypre_MPI_Comm      comm )
+{
+   return (HYPRE_Int) MPI_Neighbor_allgather(sendbuf, (hypre_int)sendcount, sendtype,
+                                             recvbuf, (hypre_int)recvcount, recvtype, comm);
+}
+
+HYPRE_Int
+hypre_MPI_Neighbor_alltoall( void               *sendbuf,
+                             HYPRE_Int           sendcount,
+                             hypre_MPI_Datatype  sendtype,
+                             void               *recvbuf,
+                             HYPRE_Int           recvcount,
+                             hypre_MPI_Datatype  recvtype,
+                             hypre_MPI_Comm      comm )
+{
+   return (HYPRE_Int) MPI_Neighbor_alltoall(sendbuf, (hypre_int)sendcount, sendtype,
+                                            recvbuf, (hypre_int)recvcount, recvtype, comm);
+}
+
+HYPRE_Int
+hypre_MPI_Neighbor_alltoallv( void               *sendbuf,
+                              HYPRE_Int          *sendcounts,
+                              HYPRE_Int          *sdispls,
+                              hypre_MPI_Datatype  sendtype,
+                              void               *recvbuf,
+                              HYPRE_Int          *recvcounts,
+                              HYPRE_Int          *rdispls,
+                              hypre_MPI_Datatype  recvtype,
+                              hypre_MPI_Comm      comm )
+{
+   hypre_int *mpi_sendcounts, *mpi_sdispls, *mpi_recvcounts, *mpi_rdispls;
+   hypre_int  indegree, outdegree, weighted;
+   HYPRE_Int  i;
+   HYPRE_Int  ierr;
+
+   MPI_Dist_graph_neighbors_count(comm, &indegree, &outdegree, &weighted);
+   mpi_sendcounts = hypre_TAlloc(hypre_int, outdegree, HYPRE_MEMORY_HOST);
+   mpi_sdispls = hypre_TAlloc(hypre_int, outdegree, HYPRE_MEMORY_HOST);
+   mpi_recvcounts = hypre_TAlloc(hypre_int, indegree, HYPRE_MEMORY_HOST);
+   mpi_rdispls = hypre_TAlloc(hypre_int, indegree, HYPRE_MEMORY_HOST);
+   for (i = 0; i < outdegree; i++)
+   {
+      mpi_sendcounts[i] = (hypre_int) sendcounts[i];
+      mpi_sdispls[i] = (hypre_int) sdispls[i];
+   }
+   for (i = 0; i < indegree; i++)
+   {
+      mpi_recvcounts[i] = (hypre_int) recvcounts[i];
+      mpi_rdispls[i] = (hypre_int) rdispls[i];
+   }
+   ierr = (HYPRE_Int) MPI_Neighbor_alltoallv(sendbuf, mpi_sendcounts, mpi_sdispls, sendtype,
+                                             recvbuf, mpi_recvcounts, mpi_rdispls, recvtype,
+                                             comm);
+   hypre_TFree(mpi_sendcounts, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_sdispls, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_recvcounts, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_rdispls, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
+#endif
+
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
@@ -112,10 +112,12 @@ extern "C" {
 #define MPI_Iprobe          hypre_MPI_Iprobe
 #define MPI_Test            hypre_MPI_Test
 #define MPI_Testall         hypre_MPI_Testall
+#define MPI_Testsome        hypre_MPI_Testsome
 #define MPI_Wait            hypre_MPI_Wait
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -235,6 +237,11 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
 
+/* neighborhood collectives on distributed graph communicators (MPI-3) */
+#if MPI_VERSION > 2
+#define HYPRE_USING_MPI_NEIGHBOR_COLL
+#endif
+
 #endif
 
 /******************************************************************************
@@ -311,6 +318,9 @@ HYPRE_Int hypre_MPI_Iprobe( HYPRE_Int source, HYPRE_Int tag, hypre_MPI_Comm comm
 HYPRE_Int hypre_MPI_Test( hypre_MPI_Request *request, HYPRE_Int *flag, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Testall( HYPRE_Int count, hypre_MPI_Request *array_of_requests, HYPRE_Int *flag,
                              hypre_MPI_Status *array_of_statuses );
+HYPRE_Int hypre_MPI_Testsome( HYPRE_Int incount, hypre_MPI_Request *array_of_requests,
+                              HYPRE_Int *outcount, HYPRE_Int *array_of_indices,
+                              hypre_MPI_Status *array_of_statuses );
 HYPRE_Int hypre_MPI_Wait( hypre_MPI_Request *request, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Waitall( HYPRE_Int count, hypre_MPI_Request *array_of_requests,
                              hypre_MPI_Status *array_of_statuses );
@@ -318,6 +328,9 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count, hypre_MPI_Request *array_of_reques
                              HYPRE_Int *index, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
+                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm,
+                                hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                             hypre_MPI_Datatype datatype, hypre_MPI_Op op, HYPRE_Int root, hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf, void *recvbuf, HYPRE_Int count,
@@ -337,6 +350,20 @@ HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
+#if defined(HYPRE_USING_MPI_NEIGHBOR_COLL)
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm, HYPRE_Int indegree,
+                                                HYPRE_Int *sources, HYPRE_Int outdegree,
+                                                HYPRE_Int *destinations, hypre_MPI_Comm *newcomm );
+HYPRE_Int hypre_MPI_Neighbor_allgather( void *sendbuf, HYPRE_Int sendcount,
+                                        hypre_MPI_Datatype sendtype, void *recvbuf, HYPRE_Int recvcount,
+                                        hypre_MPI_Datatype recvtype, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Neighbor_alltoall( void *sendbuf, HYPRE_Int sendcount,
+                                       hypre_MPI_Datatype sendtype, void *recvbuf, HYPRE_Int recvcount,
+                                       hypre_MPI_Datatype recvtype, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Neighbor_alltoallv( void *sendbuf, HYPRE_Int *sendcounts, HYPRE_Int *sdispls,
+                                        hypre_MPI_Datatype sendtype, void *recvbuf, HYPRE_Int *recvcounts,
+                                        HYPRE_Int *rdispls, hypre_MPI_Datatype recvtype, hypre_MPI_Comm comm );
+#endif
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
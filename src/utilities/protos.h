@@ -13,6 +13,15 @@ hypre_LinkList hypre_create_elt ( HYPRE_Int Item );
 void hypre_enter_on_lists ( hypre_LinkList *LoL_head_ptr, hypre_LinkList *LoL_tail_ptr,
                             HYPRE_Int measure, HYPRE_Int index, HYPRE_Int *lists, HYPRE_Int *where );
 
+/* binary_io.c */
+HYPRE_Int hypre_BinaryFileOpenWrite ( MPI_Comm comm, const char *filename, void **file_ptr );
+HYPRE_Int hypre_BinaryFileWriteAt ( void *file_in, hypre_ulonglongint offset, const void *buf,
+                                    hypre_ulonglongint nbytes );
+HYPRE_Int hypre_BinaryFileClose ( void *file_in );
+HYPRE_Int hypre_BinaryFileMap ( const char *filename, hypre_ulonglongint offset,
+                                hypre_ulonglongint nbytes, void **mapping_ptr, void **data_ptr );
+HYPRE_Int hypre_BinaryFileUnmap ( void *mapping_in );
+
 /* binsearch.c */
 HYPRE_Int hypre_BinarySearch ( HYPRE_Int *list, HYPRE_Int value, HYPRE_Int list_length );
 HYPRE_Int hypre_BigBinarySearch ( HYPRE_BigInt *list, HYPRE_BigInt value, HYPRE_Int list_length );
@@ -313,6 +322,7 @@ HYPRE_Int hypre_SetSpGemmRownnzEstimateMethod( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmRownnzEstimateNSamples( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmRownnzEstimateMultFactor( HYPRE_Real value );
 HYPRE_Int hypre_SetSpGemmHashType( char value );
+HYPRE_Int hypre_SetSpGemmHostAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetUseGpuRand( HYPRE_Int use_gpurand );
 HYPRE_Int hypre_SetGaussSeidelMethod( HYPRE_Int gs_method );
 HYPRE_Int hypre_SetUserDeviceMalloc(GPUMallocFunc func);